@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointVector.h"
+#include "FixedPointInt128.h"
+#include "FixedPointParallel.h"
+
+namespace FixedPoint
+{
+	namespace Affine
+	{
+		/**
+		* Raw values of an affine matrix in row vector layout, rows 0 to 2 are the axes and row 3 is the origin.
+		* Shared by the batch transforms of FFixedMatrix, FFixedMatrix33 and FFixedMatrix34 so they round identically.
+		*/
+		struct FRawAffine
+		{
+			int64 M[4][3];
+		};
+
+		/**
+		* Transforms Num vectors by Matrix, each component accumulated at 128 bits and truncated once.
+		* When bTranslate is false the origin row is ignored.
+		*/
+		template<bool bTranslate>
+		void TransformArray(const FRawAffine& Matrix, const FFixedVector64* Src, FFixedVector64* Dst, int32 Num, bool bParallel)
+		{
+			using namespace FixedPoint::Int128;
+
+			const int64 M00 = Matrix.M[0][0], M01 = Matrix.M[0][1], M02 = Matrix.M[0][2];
+			const int64 M10 = Matrix.M[1][0], M11 = Matrix.M[1][1], M12 = Matrix.M[1][2];
+			const int64 M20 = Matrix.M[2][0], M21 = Matrix.M[2][1], M22 = Matrix.M[2][2];
+			//translation joins the sum before the single truncation, scaled up to the same binary point as the products
+			const FInt128 T0 = bTranslate ? Mul(Matrix.M[3][0], FixedPoint::Constants::Raw64::One) : Make(0);
+			const FInt128 T1 = bTranslate ? Mul(Matrix.M[3][1], FixedPoint::Constants::Raw64::One) : Make(0);
+			const FInt128 T2 = bTranslate ? Mul(Matrix.M[3][2], FixedPoint::Constants::Raw64::One) : Make(0);
+
+			FixedPoint::Parallel::ForEachRange(Num, bParallel, [=](int32 Start, int32 End)
+			{
+				for (int32 i = Start; i < End; i++)
+				{
+					const int64 X = Src[i].X.Value;
+					const int64 Y = Src[i].Y.Value;
+					const int64 Z = Src[i].Z.Value;
+					FInt128 SumX = Add(Add(Mul(X, M00), Mul(Y, M10)), Mul(Z, M20));
+					FInt128 SumY = Add(Add(Mul(X, M01), Mul(Y, M11)), Mul(Z, M21));
+					FInt128 SumZ = Add(Add(Mul(X, M02), Mul(Y, M12)), Mul(Z, M22));
+					if (bTranslate)
+					{
+						SumX = Add(SumX, T0);
+						SumY = Add(SumY, T1);
+						SumZ = Add(SumZ, T2);
+					}
+					Dst[i].X.Value = ShiftRightTruncate(SumX, FixedPoint::Constants::BinaryPoint64);
+					Dst[i].Y.Value = ShiftRightTruncate(SumY, FixedPoint::Constants::BinaryPoint64);
+					Dst[i].Z.Value = ShiftRightTruncate(SumZ, FixedPoint::Constants::BinaryPoint64);
+				}
+			});
+		}
+	}
+}
@@ -0,0 +1,485 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointBVH.h"
+#include "FixedPointInt128.h"
+
+//more bins find slightly better splits at a linear cost per node, 16 is the usual sweet spot for binned builds
+static constexpr int32 NumBins = 16;
+
+//leaves test their items' bounds back to back, a few per leaf is cheaper than another level of nodes
+static constexpr int32 MaxLeafItems = 4;
+
+/**
+* Half the surface area in raw units, the heuristic only compares areas so the factor of two is dropped.
+* Kept at 128 bits, an int64 area overflows once a box is a few million units on a side.
+*/
+static FORCEINLINE FixedPoint::Int128::FInt128 HalfAreaRaw(const FFixedBox& Box)
+{
+	using namespace FixedPoint::Int128;
+	const int64 DX = Box.Max.X.Value - Box.Min.X.Value;
+	const int64 DY = Box.Max.Y.Value - Box.Min.Y.Value;
+	const int64 DZ = Box.Max.Z.Value - Box.Min.Z.Value;
+	return ShiftRight(Add(Add(Mul(DX, DY), Mul(DY, DZ)), Mul(DZ, DX)), FixedPoint::Constants::BinaryPoint64);
+}
+
+/** @return true if an entry time of EnterNum / EnterDen rounds down to a fraction after Time */
+static FORCEINLINE bool IsAfter(int64 EnterNum, int64 EnterDen, FFixed64 Time)
+{
+	using namespace FixedPoint::Int128;
+	return Compare(Mul(EnterNum, FixedPoint::Constants::Raw64::One), Mul(Time.Value + 1, EnterDen)) >= 0;
+}
+
+FFixedBVH::FSegment FFixedBVH::MakeSegment(const FFixedVector64& Start, const FFixedVector64& End, FFixed64 Expand)
+{
+	check(Expand >= FixedPoint::Constants::Fixed64::Zero);
+	FSegment Segment;
+	Segment.Start[0] = Start.X.Value;
+	Segment.Start[1] = Start.Y.Value;
+	Segment.Start[2] = Start.Z.Value;
+	Segment.Delta[0] = End.X.Value - Start.X.Value;
+	Segment.Delta[1] = End.Y.Value - Start.Y.Value;
+	Segment.Delta[2] = End.Z.Value - Start.Z.Value;
+	Segment.Expand = Expand.Value;
+	return Segment;
+}
+
+bool FFixedBVH::SegmentHitsBox(const FSegment& Segment, const FFixedVector64& Min, const FFixedVector64& Max, int64& OutEnterNum, int64& OutEnterDen)
+{
+	//the segment runs from time 0 to 1
+	OutEnterNum = 0;
+	OutEnterDen = 1;
+	int64 ExitNum = 1;
+	int64 ExitDen = 1;
+	return FixedPoint::Int128::ClipSlab(Segment.Start[0], Segment.Delta[0], Min.X.Value - Segment.Expand, Max.X.Value + Segment.Expand, OutEnterNum, OutEnterDen, ExitNum, ExitDen)
+		&& FixedPoint::Int128::ClipSlab(Segment.Start[1], Segment.Delta[1], Min.Y.Value - Segment.Expand, Max.Y.Value + Segment.Expand, OutEnterNum, OutEnterDen, ExitNum, ExitDen)
+		&& FixedPoint::Int128::ClipSlab(Segment.Start[2], Segment.Delta[2], Min.Z.Value - Segment.Expand, Max.Z.Value + Segment.Expand, OutEnterNum, OutEnterDen, ExitNum, ExitDen);
+}
+
+void FFixedBVH::Reset()
+{
+	Nodes.Reset();
+	Items.Reset();
+	PackedBounds.Reset();
+	PackedIndexOfItem.Reset();
+	LeafOfItem.Reset();
+}
+
+void FFixedBVH::Build(TArrayView<const FFixedBox> Bounds)
+{
+	using namespace FixedPoint::Int128;
+	Reset();
+	const int32 NumItems = Bounds.Num();
+	if (NumItems == 0)
+	{
+		return;
+	}
+
+	//doubled centers, Min + Max, so no rounding is needed
+	TArray<int64> Centroids[3];
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		Centroids[Axis].SetNumUninitialized(NumItems);
+	}
+	Items.SetNumUninitialized(NumItems);
+	for (int32 i = 0; i < NumItems; i++)
+	{
+		Items[i] = i;
+		Centroids[0][i] = Bounds[i].Min.X.Value + Bounds[i].Max.X.Value;
+		Centroids[1][i] = Bounds[i].Min.Y.Value + Bounds[i].Max.Y.Value;
+		Centroids[2][i] = Bounds[i].Min.Z.Value + Bounds[i].Max.Z.Value;
+	}
+	TArray<int32> Scratch;
+	Scratch.SetNumUninitialized(NumItems);
+	LeafOfItem.SetNumUninitialized(NumItems);
+	Nodes.Reserve(NumItems * 2 - 1);
+
+	struct FTask
+	{
+		int32 Start;
+		int32 End;
+		int32 Parent;
+		bool bSecondChild;
+	};
+	TArray<FTask, TInlineAllocator<64>> Stack;
+	Stack.Add(FTask{ 0, NumItems, INDEX_NONE, false });
+
+	struct FBin
+	{
+		FFixedBox Bounds;
+		int32 Count;
+	};
+
+	while (Stack.Num() > 0)
+	{
+		const FTask Task = Stack.Pop();
+		//popping the first child before the second lays the tree out depth first
+		const int32 NodeIndex = Nodes.AddUninitialized(1);
+		if (Task.bSecondChild)
+		{
+			Nodes[Task.Parent].Offset = NodeIndex;
+		}
+
+		FFixedBox NodeBounds(ForceInit);
+		int64 CentroidMin[3] = { MAX_int64, MAX_int64, MAX_int64 };
+		int64 CentroidMax[3] = { MIN_int64, MIN_int64, MIN_int64 };
+		for (int32 i = Task.Start; i < Task.End; i++)
+		{
+			const int32 Item = Items[i];
+			NodeBounds += Bounds[Item];
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				CentroidMin[Axis] = FMath::Min(CentroidMin[Axis], Centroids[Axis][Item]);
+				CentroidMax[Axis] = FMath::Max(CentroidMax[Axis], Centroids[Axis][Item]);
+			}
+		}
+
+		FNode& Node = Nodes[NodeIndex];
+		Node.Min = NodeBounds.Min;
+		Node.Max = NodeBounds.Max;
+		Node.Parent = Task.Parent;
+		Node.Offset = INDEX_NONE;
+		Node.NumItems = 0;
+		Node.Axis = 0;
+
+		const int32 Count = Task.End - Task.Start;
+		int32 BestAxis = INDEX_NONE;
+		int32 BestBin = 0;
+		int64 BestWidth = 1;
+		FInt128 BestCost = Make(0);
+		int32 BestImbalance = 0;
+		for (int32 Axis = 0; Count > 1 && Axis < 3; Axis++)
+		{
+			const int64 Extent = CentroidMax[Axis] - CentroidMin[Axis];
+			if (Extent == 0)
+			{
+				continue;
+			}
+			//integer bin width, every centroid lands in [0, NumBins) without overflow
+			const int64 Width = Extent / NumBins + 1;
+			FBin Bins[NumBins];
+			for (FBin& Bin : Bins)
+			{
+				Bin.Bounds = FFixedBox(ForceInit);
+				Bin.Count = 0;
+			}
+			for (int32 i = Task.Start; i < Task.End; i++)
+			{
+				const int32 Item = Items[i];
+				FBin& Bin = Bins[(Centroids[Axis][Item] - CentroidMin[Axis]) / Width];
+				Bin.Bounds += Bounds[Item];
+				Bin.Count++;
+			}
+
+			FInt128 RightArea[NumBins];
+			int32 RightCount[NumBins];
+			FFixedBox Accumulated(ForceInit);
+			int32 AccumulatedCount = 0;
+			for (int32 Bin = NumBins - 1; Bin > 0; Bin--)
+			{
+				Accumulated += Bins[Bin].Bounds;
+				AccumulatedCount += Bins[Bin].Count;
+				RightArea[Bin] = AccumulatedCount > 0 ? HalfAreaRaw(Accumulated) : Make(0);
+				RightCount[Bin] = AccumulatedCount;
+			}
+
+			Accumulated = FFixedBox(ForceInit);
+			AccumulatedCount = 0;
+			for (int32 Bin = 0; Bin < NumBins - 1; Bin++)
+			{
+				Accumulated += Bins[Bin].Bounds;
+				AccumulatedCount += Bins[Bin].Count;
+				if (AccumulatedCount == 0 || RightCount[Bin + 1] == 0)
+				{
+					continue;
+				}
+				const FInt128 Cost = Add(MulWide(HalfAreaRaw(Accumulated), AccumulatedCount), MulWide(RightArea[Bin + 1], RightCount[Bin + 1]));
+				const int32 Imbalance = FMath::Abs(AccumulatedCount - RightCount[Bin + 1]);
+				//equal costs happen with flat or point bounds, prefer the more even split so the tree stays shallow
+				const int32 Order = BestAxis == INDEX_NONE ? -1 : Compare(Cost, BestCost);
+				if (Order < 0 || (Order == 0 && Imbalance < BestImbalance))
+				{
+					BestAxis = Axis;
+					BestBin = Bin;
+					BestWidth = Width;
+					BestCost = Cost;
+					BestImbalance = Imbalance;
+				}
+			}
+		}
+
+		bool bLeaf = Count <= MaxLeafItems;
+		if (bLeaf && BestAxis != INDEX_NONE)
+		{
+			//splitting costs a node visit plus both children's items weighted by area, a leaf costs all of its items
+			const FInt128 NodeArea = HalfAreaRaw(NodeBounds);
+			bLeaf = Compare(Add(BestCost, NodeArea), MulWide(NodeArea, Count)) >= 0;
+		}
+		if (Count == 1)
+		{
+			bLeaf = true;
+		}
+
+		if (bLeaf)
+		{
+			Node.Offset = Task.Start;
+			Node.NumItems = (uint16)Count;
+			for (int32 i = Task.Start; i < Task.End; i++)
+			{
+				LeafOfItem[Items[i]] = NodeIndex;
+			}
+			continue;
+		}
+
+		int32 Mid;
+		if (BestAxis != INDEX_NONE)
+		{
+			//stable partition, items keep their relative order on each side
+			int32 Left = Task.Start;
+			for (int32 i = Task.Start; i < Task.End; i++)
+			{
+				const int32 Item = Items[i];
+				if ((Centroids[BestAxis][Item] - CentroidMin[BestAxis]) / BestWidth <= BestBin)
+				{
+					Scratch[Left++] = Item;
+				}
+			}
+			Mid = Left;
+			for (int32 i = Task.Start; i < Task.End; i++)
+			{
+				const int32 Item = Items[i];
+				if ((Centroids[BestAxis][Item] - CentroidMin[BestAxis]) / BestWidth > BestBin)
+				{
+					Scratch[Left++] = Item;
+				}
+			}
+			FMemory::Memcpy(&Items[Task.Start], &Scratch[Task.Start], Count * sizeof(int32));
+			Node.Axis = (uint8)BestAxis;
+		}
+		else
+		{
+			//every centroid is the same, split the run in half
+			Mid = Task.Start + Count / 2;
+		}
+
+		Stack.Add(FTask{ Mid, Task.End, NodeIndex, true });
+		Stack.Add(FTask{ Task.Start, Mid, NodeIndex, false });
+	}
+
+	PackedBounds.SetNumUninitialized(NumItems);
+	PackedIndexOfItem.SetNumUninitialized(NumItems);
+	for (int32 i = 0; i < NumItems; i++)
+	{
+		PackedBounds[i] = Bounds[Items[i]];
+		PackedIndexOfItem[Items[i]] = i;
+	}
+}
+
+bool FFixedBVH::RefitNode(int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	FFixedBox NewBounds(ForceInit);
+	if (Node.NumItems > 0)
+	{
+		const int32 End = Node.Offset + Node.NumItems;
+		for (int32 i = Node.Offset; i < End; i++)
+		{
+			NewBounds += PackedBounds[i];
+		}
+	}
+	else
+	{
+		const FNode& First = Nodes[NodeIndex + 1];
+		const FNode& Second = Nodes[Node.Offset];
+		NewBounds = FFixedBox(First.Min, First.Max) + FFixedBox(Second.Min, Second.Max);
+	}
+
+	if (NewBounds.Min == Node.Min && NewBounds.Max == Node.Max)
+	{
+		return false;
+	}
+	Node.Min = NewBounds.Min;
+	Node.Max = NewBounds.Max;
+	return true;
+}
+
+void FFixedBVH::Refit(TArrayView<const FFixedBox> Bounds)
+{
+	check(Bounds.Num() == Items.Num());
+	for (int32 i = 0; i < Items.Num(); i++)
+	{
+		PackedBounds[i] = Bounds[Items[i]];
+	}
+	//children always come after their parent, so walking backwards refits bottom up
+	for (int32 NodeIndex = Nodes.Num() - 1; NodeIndex >= 0; NodeIndex--)
+	{
+		RefitNode(NodeIndex);
+	}
+}
+
+void FFixedBVH::UpdateItem(int32 Item, const FFixedBox& NewBounds)
+{
+	PackedBounds[PackedIndexOfItem[Item]] = NewBounds;
+	int32 NodeIndex = LeafOfItem[Item];
+	while (NodeIndex != INDEX_NONE && RefitNode(NodeIndex))
+	{
+		NodeIndex = Nodes[NodeIndex].Parent;
+	}
+}
+
+FFixedBox FFixedBVH::GetBounds() const
+{
+	return Nodes.Num() > 0 ? FFixedBox(Nodes[0].Min, Nodes[0].Max) : FFixedBox(ForceInit);
+}
+
+void FFixedBVH::QueryBox(const FFixedBox& Box, TArray<int32>& OutItems) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return;
+	}
+	TArray<int32, TInlineAllocator<64>> Stack;
+	Stack.Add(0);
+	while (Stack.Num() > 0)
+	{
+		const int32 NodeIndex = Stack.Pop();
+		const FNode& Node = Nodes[NodeIndex];
+		if (Box.Min.X > Node.Max.X || Box.Max.X < Node.Min.X
+			|| Box.Min.Y > Node.Max.Y || Box.Max.Y < Node.Min.Y
+			|| Box.Min.Z > Node.Max.Z || Box.Max.Z < Node.Min.Z)
+		{
+			continue;
+		}
+		if (Node.NumItems > 0)
+		{
+			const int32 End = Node.Offset + Node.NumItems;
+			for (int32 i = Node.Offset; i < End; i++)
+			{
+				if (PackedBounds[i].Intersect(Box))
+				{
+					OutItems.Add(Items[i]);
+				}
+			}
+			continue;
+		}
+		Stack.Add(Node.Offset);
+		Stack.Add(NodeIndex + 1);
+	}
+}
+
+void FFixedBVH::QuerySegment(const FSegment& Segment, TArray<int32>& OutItems) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return;
+	}
+	TArray<int32, TInlineAllocator<64>> Stack;
+	Stack.Add(0);
+	while (Stack.Num() > 0)
+	{
+		const int32 NodeIndex = Stack.Pop();
+		const FNode& Node = Nodes[NodeIndex];
+		int64 EnterNum, EnterDen;
+		if (!SegmentHitsBox(Segment, Node.Min, Node.Max, EnterNum, EnterDen))
+		{
+			continue;
+		}
+		if (Node.NumItems > 0)
+		{
+			const int32 End = Node.Offset + Node.NumItems;
+			for (int32 i = Node.Offset; i < End; i++)
+			{
+				if (SegmentHitsBox(Segment, PackedBounds[i].Min, PackedBounds[i].Max, EnterNum, EnterDen))
+				{
+					OutItems.Add(Items[i]);
+				}
+			}
+			continue;
+		}
+		//push the far child first so the near one is visited first
+		const bool bReversed = Segment.Delta[Node.Axis] < 0;
+		Stack.Add(bReversed ? NodeIndex + 1 : Node.Offset);
+		Stack.Add(bReversed ? Node.Offset : NodeIndex + 1);
+	}
+}
+
+void FFixedBVH::QuerySegment(const FFixedVector64& Start, const FFixedVector64& End, TArray<int32>& OutItems) const
+{
+	QuerySegment(MakeSegment(Start, End, FixedPoint::Constants::Fixed64::Zero), OutItems);
+}
+
+void FFixedBVH::QuerySphereSweep(const FFixedVector64& Start, const FFixedVector64& End, FFixed64 Radius, TArray<int32>& OutItems) const
+{
+	QuerySegment(MakeSegment(Start, End, Radius), OutItems);
+}
+
+bool FFixedBVH::Cast(const FSegment& Segment, FFixedBVHHit& OutHit, TFunctionRef<bool(int32 Item, FFixed64& Time)> HitItem) const
+{
+	FFixedBVHHit Best;
+	if (Nodes.Num() > 0)
+	{
+		TArray<int32, TInlineAllocator<64>> Stack;
+		Stack.Add(0);
+		while (Stack.Num() > 0)
+		{
+			const int32 NodeIndex = Stack.Pop();
+			const FNode& Node = Nodes[NodeIndex];
+			int64 EnterNum, EnterDen;
+			//a node entered after the best hit can't hold an earlier one, one entered at the same rounded time may hold a lower index
+			if (!SegmentHitsBox(Segment, Node.Min, Node.Max, EnterNum, EnterDen)
+				|| (Best.Item != INDEX_NONE && IsAfter(EnterNum, EnterDen, Best.Time)))
+			{
+				continue;
+			}
+			if (Node.NumItems > 0)
+			{
+				const int32 End = Node.Offset + Node.NumItems;
+				for (int32 i = Node.Offset; i < End; i++)
+				{
+					if (!SegmentHitsBox(Segment, PackedBounds[i].Min, PackedBounds[i].Max, EnterNum, EnterDen)
+						|| (Best.Item != INDEX_NONE && IsAfter(EnterNum, EnterDen, Best.Time)))
+					{
+						continue;
+					}
+					const int32 Item = Items[i];
+					FFixed64 Time;
+					if (HitItem(Item, Time) && (Best.Item == INDEX_NONE || Time < Best.Time || (Time == Best.Time && Item < Best.Item)))
+					{
+						Best.Item = Item;
+						Best.Time = Time;
+					}
+				}
+				continue;
+			}
+			const bool bReversed = Segment.Delta[Node.Axis] < 0;
+			Stack.Add(bReversed ? NodeIndex + 1 : Node.Offset);
+			Stack.Add(bReversed ? Node.Offset : NodeIndex + 1);
+		}
+	}
+	OutHit = Best;
+	return Best.Item != INDEX_NONE;
+}
+
+bool FFixedBVH::RayCast(const FFixedVector64& Start, const FFixedVector64& End, FFixedBVHHit& OutHit) const
+{
+	const FSegment Segment = MakeSegment(Start, End, FixedPoint::Constants::Fixed64::Zero);
+	return Cast(Segment, OutHit, [this, &Segment](int32 Item, FFixed64& Time)
+	{
+		const FFixedBox& Box = GetItemBounds(Item);
+		int64 EnterNum, EnterDen;
+		SegmentHitsBox(Segment, Box.Min, Box.Max, EnterNum, EnterDen);
+		//rounds down, so the time is never past the real entry
+		Time = FFixed64::MakeFromRawInt(EnterNum) / FFixed64::MakeFromRawInt(EnterDen);
+		return true;
+	});
+}
+
+bool FFixedBVH::RayCast(const FFixedVector64& Start, const FFixedVector64& End, FFixedBVHHit& OutHit, TFunctionRef<bool(int32 Item, FFixed64& Time)> HitItem) const
+{
+	return Cast(MakeSegment(Start, End, FixedPoint::Constants::Fixed64::Zero), OutHit, HitItem);
+}
+
+bool FFixedBVH::SphereCast(const FFixedVector64& Start, const FFixedVector64& End, FFixed64 Radius, FFixedBVHHit& OutHit, TFunctionRef<bool(int32 Item, FFixed64& Time)> HitItem) const
+{
+	return Cast(MakeSegment(Start, End, Radius), OutHit, HitItem);
+}
@@ -0,0 +1,942 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointBatch.h"
+#include "FixedPointVector.h"
+#include "FixedPointMath.h"
+#include <atomic>
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <immintrin.h>
+#include "FixedPointCPU.h"
+#if defined(__clang__) || defined(__GNUC__)
+#define FIXEDPOINT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define FIXEDPOINT_TARGET_AVX2
+#endif
+#endif
+
+static_assert(sizeof(FFixed64) == sizeof(int64), "FFixed64 batch kernels reinterpret arrays of FFixed64 as int64");
+static_assert(sizeof(FFixed32) == sizeof(int32), "FFixed32 batch kernels reinterpret arrays of FFixed32 as int32");
+static_assert(sizeof(FFixedVector64) == sizeof(int64) * 3, "FFixed64 batch kernels expect FFixedVector64 to be 3 packed FFixed64");
+
+namespace FixedPointBatchKernels
+{
+	struct FKernelTable
+	{
+		void (*Mul)(int64* Out, const int64* A, const int64* B, int32 Num);
+		void (*MulScalar)(int64* Out, const int64* A, int64 B, int32 Num);
+		void (*MulAdd)(int64* Out, const int64* A, const int64* B, const int64* C, int32 Num);
+		void (*Dot3)(int64* Out, const int64* AX, const int64* AY, const int64* AZ, const int64* BX, const int64* BY, const int64* BZ, int32 Num);
+		void (*Dot3Packed)(int64* Out, const int64* A, const int64* B, int32 Num);
+		void (*Lerp)(int64* Out, const int64* A, const int64* B, const int64* Alpha, int32 Num);
+		void (*LerpScalar)(int64* Out, const int64* A, const int64* B, int64 Alpha, int32 Num);
+	};
+
+	/**
+	* Scalar kernels, also used for the tails of the vector kernels
+	*/
+	namespace Scalar
+	{
+		static void Mul(int64* Out, const int64* A, const int64* B, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = FFixed64Batch::MulRaw(A[i], B[i]);
+			}
+		}
+
+		static void MulScalar(int64* Out, const int64* A, int64 B, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = FFixed64Batch::MulRaw(A[i], B);
+			}
+		}
+
+		static void MulAdd(int64* Out, const int64* A, const int64* B, const int64* C, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = FFixed64Batch::MulRaw(A[i], B[i]) + C[i];
+			}
+		}
+
+		static void Dot3(int64* Out, const int64* AX, const int64* AY, const int64* AZ, const int64* BX, const int64* BY, const int64* BZ, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = FFixed64Batch::MulRaw(AX[i], BX[i]) + FFixed64Batch::MulRaw(AY[i], BY[i]) + FFixed64Batch::MulRaw(AZ[i], BZ[i]);
+			}
+		}
+
+		static void Dot3Packed(int64* Out, const int64* A, const int64* B, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				const int64* VA = A + i * 3;
+				const int64* VB = B + i * 3;
+				Out[i] = FFixed64Batch::MulRaw(VA[0], VB[0]) + FFixed64Batch::MulRaw(VA[1], VB[1]) + FFixed64Batch::MulRaw(VA[2], VB[2]);
+			}
+		}
+
+		static void Lerp(int64* Out, const int64* A, const int64* B, const int64* Alpha, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = A[i] + FFixed64Batch::MulRaw(Alpha[i], B[i] - A[i]);
+			}
+		}
+
+		static void LerpScalar(int64* Out, const int64* A, const int64* B, int64 Alpha, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = A[i] + FFixed64Batch::MulRaw(Alpha, B[i] - A[i]);
+			}
+		}
+
+		static const FKernelTable Table = { &Mul, &MulScalar, &MulAdd, &Dot3, &Dot3Packed, &Lerp, &LerpScalar };
+	}
+
+	struct FKernelTable32
+	{
+		void (*Add)(int32* Out, const int32* A, const int32* B, int32 Num);
+		void (*Sub)(int32* Out, const int32* A, const int32* B, int32 Num);
+		void (*Mul)(int32* Out, const int32* A, const int32* B, int32 Num);
+		void (*MulScalar)(int32* Out, const int32* A, int32 B, int32 Num);
+		void (*Div)(int32* Out, const int32* A, const int32* B, int32 Num);
+		void (*Sqrt)(int32* Out, const int32* A, int32 Num);
+		void (*Lerp)(int32* Out, const int32* A, const int32* B, const int32* Alpha, int32 Num);
+		void (*LerpScalar)(int32* Out, const int32* A, const int32* B, int32 Alpha, int32 Num);
+		void (*Dot2)(int32* Out, const int32* AX, const int32* AY, const int32* BX, const int32* BY, int32 Num);
+		void (*Dot3)(int32* Out, const int32* AX, const int32* AY, const int32* AZ, const int32* BX, const int32* BY, const int32* BZ, int32 Num);
+		void (*Cross)(int32* OutX, int32* OutY, int32* OutZ, const int32* AX, const int32* AY, const int32* AZ, const int32* BX, const int32* BY, const int32* BZ, int32 Num);
+	};
+
+	/**
+	* Scalar FFixed32 kernels, also used for the tails of the vector kernels
+	*/
+	namespace Scalar32
+	{
+		static void Add(int32* Out, const int32* A, const int32* B, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = A[i] + B[i];
+			}
+		}
+
+		static void Sub(int32* Out, const int32* A, const int32* B, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = A[i] - B[i];
+			}
+		}
+
+		static void Mul(int32* Out, const int32* A, const int32* B, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = FFixed32Batch::MulRaw(A[i], B[i]);
+			}
+		}
+
+		static void MulScalar(int32* Out, const int32* A, int32 B, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = FFixed32Batch::MulRaw(A[i], B);
+			}
+		}
+
+		static void Div(int32* Out, const int32* A, const int32* B, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = (int32)(((int64)A[i] << FixedPoint::Constants::BinaryPoint32) / (int64)B[i]);
+			}
+		}
+
+		static void Sqrt(int32* Out, const int32* A, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = FFixedPointMath::Sqrt(FFixed32::MakeFromRawInt(A[i])).Value;
+			}
+		}
+
+		static void Lerp(int32* Out, const int32* A, const int32* B, const int32* Alpha, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = A[i] + FFixed32Batch::MulRaw(Alpha[i], B[i] - A[i]);
+			}
+		}
+
+		static void LerpScalar(int32* Out, const int32* A, const int32* B, int32 Alpha, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = A[i] + FFixed32Batch::MulRaw(Alpha, B[i] - A[i]);
+			}
+		}
+
+		static void Dot2(int32* Out, const int32* AX, const int32* AY, const int32* BX, const int32* BY, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = FFixed32Batch::MulRaw(AX[i], BX[i]) + FFixed32Batch::MulRaw(AY[i], BY[i]);
+			}
+		}
+
+		static void Dot3(int32* Out, const int32* AX, const int32* AY, const int32* AZ, const int32* BX, const int32* BY, const int32* BZ, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Out[i] = FFixed32Batch::MulRaw(AX[i], BX[i]) + FFixed32Batch::MulRaw(AY[i], BY[i]) + FFixed32Batch::MulRaw(AZ[i], BZ[i]);
+			}
+		}
+
+		static void Cross(int32* OutX, int32* OutY, int32* OutZ, const int32* AX, const int32* AY, const int32* AZ, const int32* BX, const int32* BY, const int32* BZ, int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				const int32 CX = FFixed32Batch::MulRaw(AY[i], BZ[i]) - FFixed32Batch::MulRaw(AZ[i], BY[i]);
+				const int32 CY = FFixed32Batch::MulRaw(AZ[i], BX[i]) - FFixed32Batch::MulRaw(AX[i], BZ[i]);
+				const int32 CZ = FFixed32Batch::MulRaw(AX[i], BY[i]) - FFixed32Batch::MulRaw(AY[i], BX[i]);
+				OutX[i] = CX;
+				OutY[i] = CY;
+				OutZ[i] = CZ;
+			}
+		}
+
+		static const FKernelTable32 Table = { &Add, &Sub, &Mul, &MulScalar, &Div, &Sqrt, &Lerp, &LerpScalar, &Dot2, &Dot3, &Cross };
+	}
+
+#if PLATFORM_CPU_X86_FAMILY
+	/**
+	* SSE2 kernels, 2 lanes. SSE2 has no 64 bit compare so the sign mask is made by broadcasting the arithmetic shift of the high dword.
+	*/
+	namespace SSE2
+	{
+		static FORCEINLINE __m128i SignMask(__m128i V)
+		{
+			return _mm_shuffle_epi32(_mm_srai_epi32(V, 31), _MM_SHUFFLE(3, 3, 1, 1));
+		}
+
+		static FORCEINLINE __m128i MulRaw(__m128i A, __m128i B)
+		{
+			const __m128i Mask32 = _mm_set1_epi64x(0xFFFFFFFFll);
+			const __m128i SignA = SignMask(A);
+			const __m128i SignB = SignMask(B);
+			const __m128i AbsA = _mm_sub_epi64(_mm_xor_si128(A, SignA), SignA);
+			const __m128i AbsB = _mm_sub_epi64(_mm_xor_si128(B, SignB), SignB);
+			const __m128i AHi = _mm_srli_epi64(AbsA, 32);
+			const __m128i BHi = _mm_srli_epi64(AbsB, 32);
+			const __m128i Lo = _mm_mul_epu32(AbsA, AbsB);
+			const __m128i MidA = _mm_mul_epu32(AHi, AbsB);
+			const __m128i MidB = _mm_mul_epu32(AbsA, BHi);
+			const __m128i Hi = _mm_mul_epu32(AHi, BHi);
+			const __m128i Carry = _mm_add_epi64(_mm_srli_epi64(Lo, 32), _mm_add_epi64(_mm_and_si128(MidA, Mask32), _mm_and_si128(MidB, Mask32)));
+			const __m128i Low = _mm_or_si128(_mm_and_si128(Lo, Mask32), _mm_slli_epi64(Carry, 32));
+			const __m128i High = _mm_add_epi64(_mm_add_epi64(Hi, _mm_srli_epi64(Carry, 32)), _mm_add_epi64(_mm_srli_epi64(MidA, 32), _mm_srli_epi64(MidB, 32)));
+			const __m128i Result = _mm_or_si128(_mm_srli_epi64(Low, FixedPoint::Constants::BinaryPoint64), _mm_slli_epi64(High, 64 - FixedPoint::Constants::BinaryPoint64));
+			const __m128i Sign = _mm_xor_si128(SignA, SignB);
+			return _mm_sub_epi64(_mm_xor_si128(Result, Sign), Sign);
+		}
+
+		static FORCEINLINE __m128i Load(const int64* Src)
+		{
+			return _mm_loadu_si128((const __m128i*)Src);
+		}
+
+		static FORCEINLINE void Store(int64* Dst, __m128i V)
+		{
+			_mm_storeu_si128((__m128i*)Dst, V);
+		}
+
+		static void Mul(int64* Out, const int64* A, const int64* B, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 2 <= Num; i += 2)
+			{
+				Store(Out + i, MulRaw(Load(A + i), Load(B + i)));
+			}
+			Scalar::Mul(Out + i, A + i, B + i, Num - i);
+		}
+
+		static void MulScalar(int64* Out, const int64* A, int64 B, int32 Num)
+		{
+			const __m128i VB = _mm_set1_epi64x(B);
+			int32 i = 0;
+			for (; i + 2 <= Num; i += 2)
+			{
+				Store(Out + i, MulRaw(Load(A + i), VB));
+			}
+			Scalar::MulScalar(Out + i, A + i, B, Num - i);
+		}
+
+		static void MulAdd(int64* Out, const int64* A, const int64* B, const int64* C, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 2 <= Num; i += 2)
+			{
+				Store(Out + i, _mm_add_epi64(MulRaw(Load(A + i), Load(B + i)), Load(C + i)));
+			}
+			Scalar::MulAdd(Out + i, A + i, B + i, C + i, Num - i);
+		}
+
+		static void Dot3(int64* Out, const int64* AX, const int64* AY, const int64* AZ, const int64* BX, const int64* BY, const int64* BZ, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 2 <= Num; i += 2)
+			{
+				__m128i Sum = MulRaw(Load(AX + i), Load(BX + i));
+				Sum = _mm_add_epi64(Sum, MulRaw(Load(AY + i), Load(BY + i)));
+				Sum = _mm_add_epi64(Sum, MulRaw(Load(AZ + i), Load(BZ + i)));
+				Store(Out + i, Sum);
+			}
+			Scalar::Dot3(Out + i, AX + i, AY + i, AZ + i, BX + i, BY + i, BZ + i, Num - i);
+		}
+
+		static void Dot3Packed(int64* Out, const int64* A, const int64* B, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 2 <= Num; i += 2)
+			{
+				const int64* VA = A + i * 3;
+				const int64* VB = B + i * 3;
+				__m128i Sum = MulRaw(_mm_set_epi64x(VA[3], VA[0]), _mm_set_epi64x(VB[3], VB[0]));
+				Sum = _mm_add_epi64(Sum, MulRaw(_mm_set_epi64x(VA[4], VA[1]), _mm_set_epi64x(VB[4], VB[1])));
+				Sum = _mm_add_epi64(Sum, MulRaw(_mm_set_epi64x(VA[5], VA[2]), _mm_set_epi64x(VB[5], VB[2])));
+				Store(Out + i, Sum);
+			}
+			Scalar::Dot3Packed(Out + i, A + i * 3, B + i * 3, Num - i);
+		}
+
+		static void Lerp(int64* Out, const int64* A, const int64* B, const int64* Alpha, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 2 <= Num; i += 2)
+			{
+				const __m128i VA = Load(A + i);
+				Store(Out + i, _mm_add_epi64(VA, MulRaw(Load(Alpha + i), _mm_sub_epi64(Load(B + i), VA))));
+			}
+			Scalar::Lerp(Out + i, A + i, B + i, Alpha + i, Num - i);
+		}
+
+		static void LerpScalar(int64* Out, const int64* A, const int64* B, int64 Alpha, int32 Num)
+		{
+			const __m128i VAlpha = _mm_set1_epi64x(Alpha);
+			int32 i = 0;
+			for (; i + 2 <= Num; i += 2)
+			{
+				const __m128i VA = Load(A + i);
+				Store(Out + i, _mm_add_epi64(VA, MulRaw(VAlpha, _mm_sub_epi64(Load(B + i), VA))));
+			}
+			Scalar::LerpScalar(Out + i, A + i, B + i, Alpha, Num - i);
+		}
+
+		static const FKernelTable Table = { &Mul, &MulScalar, &MulAdd, &Dot3, &Dot3Packed, &Lerp, &LerpScalar };
+	}
+
+	/**
+	* AVX2 kernels, 4 lanes. Compiled for AVX2 per function so the module itself does not need to target AVX2.
+	*/
+	namespace AVX2
+	{
+		FIXEDPOINT_TARGET_AVX2 static FORCEINLINE __m256i MulRaw(__m256i A, __m256i B)
+		{
+			const __m256i Zero = _mm256_setzero_si256();
+			const __m256i Mask32 = _mm256_set1_epi64x(0xFFFFFFFFll);
+			const __m256i SignA = _mm256_cmpgt_epi64(Zero, A);
+			const __m256i SignB = _mm256_cmpgt_epi64(Zero, B);
+			const __m256i AbsA = _mm256_sub_epi64(_mm256_xor_si256(A, SignA), SignA);
+			const __m256i AbsB = _mm256_sub_epi64(_mm256_xor_si256(B, SignB), SignB);
+			const __m256i AHi = _mm256_srli_epi64(AbsA, 32);
+			const __m256i BHi = _mm256_srli_epi64(AbsB, 32);
+			const __m256i Lo = _mm256_mul_epu32(AbsA, AbsB);
+			const __m256i MidA = _mm256_mul_epu32(AHi, AbsB);
+			const __m256i MidB = _mm256_mul_epu32(AbsA, BHi);
+			const __m256i Hi = _mm256_mul_epu32(AHi, BHi);
+			const __m256i Carry = _mm256_add_epi64(_mm256_srli_epi64(Lo, 32), _mm256_add_epi64(_mm256_and_si256(MidA, Mask32), _mm256_and_si256(MidB, Mask32)));
+			const __m256i Low = _mm256_or_si256(_mm256_and_si256(Lo, Mask32), _mm256_slli_epi64(Carry, 32));
+			const __m256i High = _mm256_add_epi64(_mm256_add_epi64(Hi, _mm256_srli_epi64(Carry, 32)), _mm256_add_epi64(_mm256_srli_epi64(MidA, 32), _mm256_srli_epi64(MidB, 32)));
+			const __m256i Result = _mm256_or_si256(_mm256_srli_epi64(Low, FixedPoint::Constants::BinaryPoint64), _mm256_slli_epi64(High, 64 - FixedPoint::Constants::BinaryPoint64));
+			const __m256i Sign = _mm256_xor_si256(SignA, SignB);
+			return _mm256_sub_epi64(_mm256_xor_si256(Result, Sign), Sign);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static FORCEINLINE __m256i Load(const int64* Src)
+		{
+			return _mm256_loadu_si256((const __m256i*)Src);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static FORCEINLINE void Store(int64* Dst, __m256i V)
+		{
+			_mm256_storeu_si256((__m256i*)Dst, V);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Mul(int64* Out, const int64* A, const int64* B, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 4 <= Num; i += 4)
+			{
+				Store(Out + i, MulRaw(Load(A + i), Load(B + i)));
+			}
+			Scalar::Mul(Out + i, A + i, B + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void MulScalar(int64* Out, const int64* A, int64 B, int32 Num)
+		{
+			const __m256i VB = _mm256_set1_epi64x(B);
+			int32 i = 0;
+			for (; i + 4 <= Num; i += 4)
+			{
+				Store(Out + i, MulRaw(Load(A + i), VB));
+			}
+			Scalar::MulScalar(Out + i, A + i, B, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void MulAdd(int64* Out, const int64* A, const int64* B, const int64* C, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 4 <= Num; i += 4)
+			{
+				Store(Out + i, _mm256_add_epi64(MulRaw(Load(A + i), Load(B + i)), Load(C + i)));
+			}
+			Scalar::MulAdd(Out + i, A + i, B + i, C + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Dot3(int64* Out, const int64* AX, const int64* AY, const int64* AZ, const int64* BX, const int64* BY, const int64* BZ, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 4 <= Num; i += 4)
+			{
+				__m256i Sum = MulRaw(Load(AX + i), Load(BX + i));
+				Sum = _mm256_add_epi64(Sum, MulRaw(Load(AY + i), Load(BY + i)));
+				Sum = _mm256_add_epi64(Sum, MulRaw(Load(AZ + i), Load(BZ + i)));
+				Store(Out + i, Sum);
+			}
+			Scalar::Dot3(Out + i, AX + i, AY + i, AZ + i, BX + i, BY + i, BZ + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Dot3Packed(int64* Out, const int64* A, const int64* B, int32 Num)
+		{
+			const __m256i Stride = _mm256_setr_epi64x(0, 3, 6, 9);
+			int32 i = 0;
+			for (; i + 4 <= Num; i += 4)
+			{
+				const long long* VA = (const long long*)(A + i * 3);
+				const long long* VB = (const long long*)(B + i * 3);
+				__m256i Sum = MulRaw(_mm256_i64gather_epi64(VA, Stride, 8), _mm256_i64gather_epi64(VB, Stride, 8));
+				Sum = _mm256_add_epi64(Sum, MulRaw(_mm256_i64gather_epi64(VA + 1, Stride, 8), _mm256_i64gather_epi64(VB + 1, Stride, 8)));
+				Sum = _mm256_add_epi64(Sum, MulRaw(_mm256_i64gather_epi64(VA + 2, Stride, 8), _mm256_i64gather_epi64(VB + 2, Stride, 8)));
+				Store(Out + i, Sum);
+			}
+			Scalar::Dot3Packed(Out + i, A + i * 3, B + i * 3, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Lerp(int64* Out, const int64* A, const int64* B, const int64* Alpha, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 4 <= Num; i += 4)
+			{
+				const __m256i VA = Load(A + i);
+				Store(Out + i, _mm256_add_epi64(VA, MulRaw(Load(Alpha + i), _mm256_sub_epi64(Load(B + i), VA))));
+			}
+			Scalar::Lerp(Out + i, A + i, B + i, Alpha + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void LerpScalar(int64* Out, const int64* A, const int64* B, int64 Alpha, int32 Num)
+		{
+			const __m256i VAlpha = _mm256_set1_epi64x(Alpha);
+			int32 i = 0;
+			for (; i + 4 <= Num; i += 4)
+			{
+				const __m256i VA = Load(A + i);
+				Store(Out + i, _mm256_add_epi64(VA, MulRaw(VAlpha, _mm256_sub_epi64(Load(B + i), VA))));
+			}
+			Scalar::LerpScalar(Out + i, A + i, B + i, Alpha, Num - i);
+		}
+
+		static const FKernelTable Table = { &Mul, &MulScalar, &MulAdd, &Dot3, &Dot3Packed, &Lerp, &LerpScalar };
+	}
+
+	/**
+	* AVX2 FFixed32 kernels, 8 lanes.
+	* Even and odd lanes are multiplied separately into 64 bit products, bits 16 to 47 of each product are the truncated result.
+	* Div and Sqrt go through doubles, every FFixed32 quotient and root is exact in a double so truncating gives the integer result.
+	*/
+	namespace AVX2_32
+	{
+		FIXEDPOINT_TARGET_AVX2 static FORCEINLINE __m256i MulRaw(__m256i A, __m256i B)
+		{
+			const __m256i Even = _mm256_srli_epi64(_mm256_mul_epi32(A, B), FixedPoint::Constants::BinaryPoint32);
+			const __m256i Odd = _mm256_slli_epi64(_mm256_mul_epi32(_mm256_srli_epi64(A, 32), _mm256_srli_epi64(B, 32)), 32 - FixedPoint::Constants::BinaryPoint32);
+			return _mm256_blend_epi32(Even, Odd, 0xAA);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static FORCEINLINE __m128i DivRaw(__m128i A, __m128i B)
+		{
+			const __m256d Numerator = _mm256_mul_pd(_mm256_cvtepi32_pd(A), _mm256_set1_pd((double)FixedPoint::Constants::Raw32::One));
+			return _mm256_cvttpd_epi32(_mm256_div_pd(Numerator, _mm256_cvtepi32_pd(B)));
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static FORCEINLINE __m128i SqrtRaw(__m128i A)
+		{
+			const __m128i Root = _mm256_cvttpd_epi32(_mm256_sqrt_pd(_mm256_cvtepi32_pd(_mm_max_epi32(A, _mm_setzero_si128()))));
+			return _mm_slli_epi32(Root, FixedPoint::Constants::BinaryPoint32 / 2);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static FORCEINLINE __m256i Load(const int32* Src)
+		{
+			return _mm256_loadu_si256((const __m256i*)Src);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static FORCEINLINE void Store(int32* Dst, __m256i V)
+		{
+			_mm256_storeu_si256((__m256i*)Dst, V);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Add(int32* Out, const int32* A, const int32* B, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 8 <= Num; i += 8)
+			{
+				Store(Out + i, _mm256_add_epi32(Load(A + i), Load(B + i)));
+			}
+			Scalar32::Add(Out + i, A + i, B + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Sub(int32* Out, const int32* A, const int32* B, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 8 <= Num; i += 8)
+			{
+				Store(Out + i, _mm256_sub_epi32(Load(A + i), Load(B + i)));
+			}
+			Scalar32::Sub(Out + i, A + i, B + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Mul(int32* Out, const int32* A, const int32* B, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 8 <= Num; i += 8)
+			{
+				Store(Out + i, MulRaw(Load(A + i), Load(B + i)));
+			}
+			Scalar32::Mul(Out + i, A + i, B + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void MulScalar(int32* Out, const int32* A, int32 B, int32 Num)
+		{
+			const __m256i VB = _mm256_set1_epi32(B);
+			int32 i = 0;
+			for (; i + 8 <= Num; i += 8)
+			{
+				Store(Out + i, MulRaw(Load(A + i), VB));
+			}
+			Scalar32::MulScalar(Out + i, A + i, B, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Div(int32* Out, const int32* A, const int32* B, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 4 <= Num; i += 4)
+			{
+				_mm_storeu_si128((__m128i*)(Out + i), DivRaw(_mm_loadu_si128((const __m128i*)(A + i)), _mm_loadu_si128((const __m128i*)(B + i))));
+			}
+			Scalar32::Div(Out + i, A + i, B + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Sqrt(int32* Out, const int32* A, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 4 <= Num; i += 4)
+			{
+				_mm_storeu_si128((__m128i*)(Out + i), SqrtRaw(_mm_loadu_si128((const __m128i*)(A + i))));
+			}
+			Scalar32::Sqrt(Out + i, A + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Lerp(int32* Out, const int32* A, const int32* B, const int32* Alpha, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 8 <= Num; i += 8)
+			{
+				const __m256i VA = Load(A + i);
+				Store(Out + i, _mm256_add_epi32(VA, MulRaw(Load(Alpha + i), _mm256_sub_epi32(Load(B + i), VA))));
+			}
+			Scalar32::Lerp(Out + i, A + i, B + i, Alpha + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void LerpScalar(int32* Out, const int32* A, const int32* B, int32 Alpha, int32 Num)
+		{
+			const __m256i VAlpha = _mm256_set1_epi32(Alpha);
+			int32 i = 0;
+			for (; i + 8 <= Num; i += 8)
+			{
+				const __m256i VA = Load(A + i);
+				Store(Out + i, _mm256_add_epi32(VA, MulRaw(VAlpha, _mm256_sub_epi32(Load(B + i), VA))));
+			}
+			Scalar32::LerpScalar(Out + i, A + i, B + i, Alpha, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Dot2(int32* Out, const int32* AX, const int32* AY, const int32* BX, const int32* BY, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 8 <= Num; i += 8)
+			{
+				Store(Out + i, _mm256_add_epi32(MulRaw(Load(AX + i), Load(BX + i)), MulRaw(Load(AY + i), Load(BY + i))));
+			}
+			Scalar32::Dot2(Out + i, AX + i, AY + i, BX + i, BY + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Dot3(int32* Out, const int32* AX, const int32* AY, const int32* AZ, const int32* BX, const int32* BY, const int32* BZ, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 8 <= Num; i += 8)
+			{
+				__m256i Sum = MulRaw(Load(AX + i), Load(BX + i));
+				Sum = _mm256_add_epi32(Sum, MulRaw(Load(AY + i), Load(BY + i)));
+				Sum = _mm256_add_epi32(Sum, MulRaw(Load(AZ + i), Load(BZ + i)));
+				Store(Out + i, Sum);
+			}
+			Scalar32::Dot3(Out + i, AX + i, AY + i, AZ + i, BX + i, BY + i, BZ + i, Num - i);
+		}
+
+		FIXEDPOINT_TARGET_AVX2 static void Cross(int32* OutX, int32* OutY, int32* OutZ, const int32* AX, const int32* AY, const int32* AZ, const int32* BX, const int32* BY, const int32* BZ, int32 Num)
+		{
+			int32 i = 0;
+			for (; i + 8 <= Num; i += 8)
+			{
+				const __m256i VAX = Load(AX + i);
+				const __m256i VAY = Load(AY + i);
+				const __m256i VAZ = Load(AZ + i);
+				const __m256i VBX = Load(BX + i);
+				const __m256i VBY = Load(BY + i);
+				const __m256i VBZ = Load(BZ + i);
+				Store(OutX + i, _mm256_sub_epi32(MulRaw(VAY, VBZ), MulRaw(VAZ, VBY)));
+				Store(OutY + i, _mm256_sub_epi32(MulRaw(VAZ, VBX), MulRaw(VAX, VBZ)));
+				Store(OutZ + i, _mm256_sub_epi32(MulRaw(VAX, VBY), MulRaw(VAY, VBX)));
+			}
+			Scalar32::Cross(OutX + i, OutY + i, OutZ + i, AX + i, AY + i, AZ + i, BX + i, BY + i, BZ + i, Num - i);
+		}
+
+		static const FKernelTable32 Table = { &Add, &Sub, &Mul, &MulScalar, &Div, &Sqrt, &Lerp, &LerpScalar, &Dot2, &Dot3, &Cross };
+	}
+#endif
+
+	static EFixedPointSIMDLevel DetectLevel()
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		uint32 Regs[4];
+		FixedPoint::CPU::CPUID(0, 0, Regs);
+		const uint32 MaxLeaf = Regs[0];
+		FixedPoint::CPU::CPUID(1, 0, Regs);
+		const bool bOSXSave = (Regs[2] & (1u << 27)) != 0;
+		const bool bAVX = (Regs[2] & (1u << 28)) != 0;
+		if (MaxLeaf >= 7 && bOSXSave && bAVX)
+		{
+			//the OS has to save the ymm registers, xcr0 bits 1 and 2
+			const bool bOSSavesYMM = (FixedPoint::CPU::ReadXCR0() & 0x6) == 0x6;
+			FixedPoint::CPU::CPUID(7, 0, Regs);
+			const bool bAVX2 = (Regs[1] & (1u << 5)) != 0;
+			if (bOSSavesYMM && bAVX2)
+			{
+				return EFixedPointSIMDLevel::AVX2;
+			}
+		}
+		//SSE2 is part of the x86-64 baseline
+		return EFixedPointSIMDLevel::SSE2;
+#else
+		return EFixedPointSIMDLevel::Scalar;
+#endif
+	}
+
+	static const FKernelTable& GetTable(EFixedPointSIMDLevel Level)
+	{
+		switch (Level)
+		{
+#if PLATFORM_CPU_X86_FAMILY
+		case EFixedPointSIMDLevel::AVX2:
+			return AVX2::Table;
+		case EFixedPointSIMDLevel::SSE2:
+			return SSE2::Table;
+#endif
+		default:
+			return Scalar::Table;
+		}
+	}
+
+	static const FKernelTable32& GetTable32(EFixedPointSIMDLevel Level)
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		if (Level == EFixedPointSIMDLevel::AVX2)
+		{
+			return AVX2_32::Table;
+		}
+#endif
+		return Scalar32::Table;
+	}
+
+	static EFixedPointSIMDLevel& SupportedLevel()
+	{
+		static EFixedPointSIMDLevel Level = DetectLevel();
+		return Level;
+	}
+
+	static std::atomic<EFixedPointSIMDLevel>& ActiveLevel()
+	{
+		static std::atomic<EFixedPointSIMDLevel> Level(SupportedLevel());
+		return Level;
+	}
+
+	static FORCEINLINE const FKernelTable& Active()
+	{
+		return GetTable(ActiveLevel().load(std::memory_order_relaxed));
+	}
+
+	static FORCEINLINE const FKernelTable32& Active32()
+	{
+		return GetTable32(ActiveLevel().load(std::memory_order_relaxed));
+	}
+
+	static FORCEINLINE int64* Raw(FFixed64* Data)
+	{
+		return (int64*)Data;
+	}
+
+	static FORCEINLINE const int64* Raw(const FFixed64* Data)
+	{
+		return (const int64*)Data;
+	}
+
+	static FORCEINLINE const int64* Raw(const FFixedVector64* Data)
+	{
+		return (const int64*)Data;
+	}
+
+	static FORCEINLINE int32* Raw(FFixed32* Data)
+	{
+		return (int32*)Data;
+	}
+
+	static FORCEINLINE const int32* Raw(const FFixed32* Data)
+	{
+		return (const int32*)Data;
+	}
+}
+
+EFixedPointSIMDLevel FFixed64Batch::GetSupportedLevel()
+{
+	return FixedPointBatchKernels::SupportedLevel();
+}
+
+EFixedPointSIMDLevel FFixed64Batch::GetActiveLevel()
+{
+	return FixedPointBatchKernels::ActiveLevel().load(std::memory_order_relaxed);
+}
+
+EFixedPointSIMDLevel FFixed64Batch::SetActiveLevel(EFixedPointSIMDLevel Level)
+{
+	const EFixedPointSIMDLevel NewLevel = (uint8)Level > (uint8)GetSupportedLevel() ? GetSupportedLevel() : Level;
+	FixedPointBatchKernels::ActiveLevel().store(NewLevel, std::memory_order_relaxed);
+	return NewLevel;
+}
+
+void FFixed64Batch::Mul(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, TArrayView<const FFixed64> B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active().Mul(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Out.Num());
+}
+
+void FFixed64Batch::Mul(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, const FFixed64& B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num());
+	Active().MulScalar(Raw(Out.GetData()), Raw(A.GetData()), B.Value, Out.Num());
+}
+
+void FFixed64Batch::MulAdd(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, TArrayView<const FFixed64> B, TArrayView<const FFixed64> C)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num() && C.Num() == Out.Num());
+	Active().MulAdd(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Raw(C.GetData()), Out.Num());
+}
+
+void FFixed64Batch::Dot3(TArrayView<FFixed64> Out,
+	TArrayView<const FFixed64> AX, TArrayView<const FFixed64> AY, TArrayView<const FFixed64> AZ,
+	TArrayView<const FFixed64> BX, TArrayView<const FFixed64> BY, TArrayView<const FFixed64> BZ)
+{
+	using namespace FixedPointBatchKernels;
+	check(AX.Num() == Out.Num() && AY.Num() == Out.Num() && AZ.Num() == Out.Num());
+	check(BX.Num() == Out.Num() && BY.Num() == Out.Num() && BZ.Num() == Out.Num());
+	Active().Dot3(Raw(Out.GetData()), Raw(AX.GetData()), Raw(AY.GetData()), Raw(AZ.GetData()), Raw(BX.GetData()), Raw(BY.GetData()), Raw(BZ.GetData()), Out.Num());
+}
+
+void FFixed64Batch::Dot3(TArrayView<FFixed64> Out, TArrayView<const FFixedVector64> A, TArrayView<const FFixedVector64> B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active().Dot3Packed(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Out.Num());
+}
+
+void FFixed64Batch::Lerp(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, TArrayView<const FFixed64> B, TArrayView<const FFixed64> Alpha)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num() && Alpha.Num() == Out.Num());
+	Active().Lerp(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Raw(Alpha.GetData()), Out.Num());
+}
+
+void FFixed64Batch::Lerp(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, TArrayView<const FFixed64> B, const FFixed64& Alpha)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active().LerpScalar(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Alpha.Value, Out.Num());
+}
+
+void FFixed32Batch::Add(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active32().Add(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Out.Num());
+}
+
+void FFixed32Batch::Sub(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active32().Sub(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Out.Num());
+}
+
+void FFixed32Batch::Mul(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active32().Mul(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Out.Num());
+}
+
+void FFixed32Batch::Mul(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, const FFixed32& B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num());
+	Active32().MulScalar(Raw(Out.GetData()), Raw(A.GetData()), B.Value, Out.Num());
+}
+
+void FFixed32Batch::Div(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active32().Div(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Out.Num());
+}
+
+void FFixed32Batch::Sqrt(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num());
+	Active32().Sqrt(Raw(Out.GetData()), Raw(A.GetData()), Out.Num());
+}
+
+void FFixed32Batch::Lerp(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B, TArrayView<const FFixed32> Alpha)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num() && Alpha.Num() == Out.Num());
+	Active32().Lerp(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Raw(Alpha.GetData()), Out.Num());
+}
+
+void FFixed32Batch::Lerp(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B, const FFixed32& Alpha)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active32().LerpScalar(Raw(Out.GetData()), Raw(A.GetData()), Raw(B.GetData()), Alpha.Value, Out.Num());
+}
+
+void FFixed32Batch::Add(FFixed32Vector2SoA& Out, const FFixed32Vector2SoA& A, const FFixed32Vector2SoA& B)
+{
+	Add(Out.X, A.X, B.X);
+	Add(Out.Y, A.Y, B.Y);
+}
+
+void FFixed32Batch::Add(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B)
+{
+	Add(Out.X, A.X, B.X);
+	Add(Out.Y, A.Y, B.Y);
+	Add(Out.Z, A.Z, B.Z);
+}
+
+void FFixed32Batch::Sub(FFixed32Vector2SoA& Out, const FFixed32Vector2SoA& A, const FFixed32Vector2SoA& B)
+{
+	Sub(Out.X, A.X, B.X);
+	Sub(Out.Y, A.Y, B.Y);
+}
+
+void FFixed32Batch::Sub(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B)
+{
+	Sub(Out.X, A.X, B.X);
+	Sub(Out.Y, A.Y, B.Y);
+	Sub(Out.Z, A.Z, B.Z);
+}
+
+void FFixed32Batch::Scale(FFixed32Vector2SoA& Out, const FFixed32Vector2SoA& A, const FFixed32& Scale)
+{
+	Mul(Out.X, A.X, Scale);
+	Mul(Out.Y, A.Y, Scale);
+}
+
+void FFixed32Batch::Scale(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32& Scale)
+{
+	Mul(Out.X, A.X, Scale);
+	Mul(Out.Y, A.Y, Scale);
+	Mul(Out.Z, A.Z, Scale);
+}
+
+void FFixed32Batch::Lerp(FFixed32Vector2SoA& Out, const FFixed32Vector2SoA& A, const FFixed32Vector2SoA& B, const FFixed32& Alpha)
+{
+	Lerp(Out.X, A.X, B.X, Alpha);
+	Lerp(Out.Y, A.Y, B.Y, Alpha);
+}
+
+void FFixed32Batch::Lerp(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B, const FFixed32& Alpha)
+{
+	Lerp(Out.X, A.X, B.X, Alpha);
+	Lerp(Out.Y, A.Y, B.Y, Alpha);
+	Lerp(Out.Z, A.Z, B.Z, Alpha);
+}
+
+void FFixed32Batch::Dot(TArrayView<FFixed32> Out, const FFixed32Vector2SoA& A, const FFixed32Vector2SoA& B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active32().Dot2(Raw(Out.GetData()), Raw(A.X.GetData()), Raw(A.Y.GetData()), Raw(B.X.GetData()), Raw(B.Y.GetData()), Out.Num());
+}
+
+void FFixed32Batch::Dot(TArrayView<FFixed32> Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active32().Dot3(Raw(Out.GetData()), Raw(A.X.GetData()), Raw(A.Y.GetData()), Raw(A.Z.GetData()), Raw(B.X.GetData()), Raw(B.Y.GetData()), Raw(B.Z.GetData()), Out.Num());
+}
+
+void FFixed32Batch::Cross(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B)
+{
+	using namespace FixedPointBatchKernels;
+	check(A.Num() == Out.Num() && B.Num() == Out.Num());
+	Active32().Cross(Raw(Out.X.GetData()), Raw(Out.Y.GetData()), Raw(Out.Z.GetData()), Raw(A.X.GetData()), Raw(A.Y.GetData()), Raw(A.Z.GetData()), Raw(B.X.GetData()), Raw(B.Y.GetData()), Raw(B.Z.GetData()), Out.Num());
+}
+
+void FFixed32Batch::Size(TArrayView<FFixed32> Out, const FFixed32Vector2SoA& A)
+{
+	Dot(Out, A, A);
+	Sqrt(Out, Out);
+}
+
+void FFixed32Batch::Size(TArrayView<FFixed32> Out, const FFixed32Vector3SoA& A)
+{
+	Dot(Out, A, A);
+	Sqrt(Out, Out);
+}
@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+namespace FixedPoint
+{
+	/**
+	* Runtime CPU feature queries for the kernels that pick an instruction set when first used
+	*/
+	namespace CPU
+	{
+		FORCEINLINE void CPUID(int32 Leaf, int32 SubLeaf, uint32 OutRegs[4])
+		{
+#if defined(_MSC_VER)
+			int Regs[4];
+			__cpuidex(Regs, Leaf, SubLeaf);
+			OutRegs[0] = (uint32)Regs[0];
+			OutRegs[1] = (uint32)Regs[1];
+			OutRegs[2] = (uint32)Regs[2];
+			OutRegs[3] = (uint32)Regs[3];
+#else
+			__cpuid_count(Leaf, SubLeaf, OutRegs[0], OutRegs[1], OutRegs[2], OutRegs[3]);
+#endif
+		}
+
+		FORCEINLINE uint64 ReadXCR0()
+		{
+#if defined(_MSC_VER)
+			return _xgetbv(0);
+#else
+			uint32 Eax, Edx;
+			__asm__ volatile("xgetbv" : "=a"(Eax), "=d"(Edx) : "c"(0));
+			return ((uint64)Edx << 32) | Eax;
+#endif
+		}
+
+		/** @return true if the CPU has BMI2, for pdep and pext */
+		FORCEINLINE bool HasBMI2()
+		{
+			uint32 Regs[4];
+			CPUID(0, 0, Regs);
+			if (Regs[0] < 7)
+			{
+				return false;
+			}
+			CPUID(7, 0, Regs);
+			return (Regs[1] & (1u << 8)) != 0;
+		}
+	}
+}
+#endif
@@ -0,0 +1,550 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointConvexHull.h"
+#include "FixedPointInt128.h"
+#include "FixedPointNormal.h"
+#include "FixedPointParallel.h"
+
+using FixedPoint::Int128::FInt128;
+
+namespace
+{
+	struct FHullFace
+	{
+		/** Counter clockwise seen from outside, edge i runs from corner i to corner i + 1 */
+		int32 Corners[3];
+
+		/** Face across each edge */
+		int32 Neighbors[3];
+
+		/** Exact (B - A) x (C - A) of the corners */
+		FInt128 Normal[3];
+
+		/** First point outside this face, the rest follow through NextOutside */
+		int32 FirstOutside;
+
+		int32 Furthest;
+
+		/** Orientation of Furthest, its distance times the face's doubled area */
+		FInt128 FurthestDistance;
+
+		/** Iteration this face was last tested for visibility on */
+		int32 VisitedOn;
+
+		bool bVisible;
+
+		bool bAlive;
+	};
+
+	struct FHorizonEdge
+	{
+		int32 From;
+		int32 To;
+
+		/** Face kept on the far side of the edge */
+		int32 Outer;
+	};
+}
+
+static FORCEINLINE void ExactCross(const FFixedVector64& A, const FFixedVector64& B, const FFixedVector64& C, FInt128 OutCross[3])
+{
+	using namespace FixedPoint::Int128;
+	const int64 ABX = B.X.Value - A.X.Value;
+	const int64 ABY = B.Y.Value - A.Y.Value;
+	const int64 ABZ = B.Z.Value - A.Z.Value;
+	const int64 ACX = C.X.Value - A.X.Value;
+	const int64 ACY = C.Y.Value - A.Y.Value;
+	const int64 ACZ = C.Z.Value - A.Z.Value;
+	OutCross[0] = Sub(Mul(ABY, ACZ), Mul(ABZ, ACY));
+	OutCross[1] = Sub(Mul(ABZ, ACX), Mul(ABX, ACZ));
+	OutCross[2] = Sub(Mul(ABX, ACY), Mul(ABY, ACX));
+}
+
+/** Exact Normal . (P - Origin), positive in front of the plane */
+static FORCEINLINE FInt128 ExactSide(const FInt128 Normal[3], const FFixedVector64& Origin, const FFixedVector64& P)
+{
+	using namespace FixedPoint::Int128;
+	return Add(Add(MulWide(Normal[0], P.X.Value - Origin.X.Value), MulWide(Normal[1], P.Y.Value - Origin.Y.Value)), MulWide(Normal[2], P.Z.Value - Origin.Z.Value));
+}
+
+static FORCEINLINE FInt128 AbsInt128(const FInt128& A)
+{
+	return FixedPoint::Int128::IsNegative(A) ? FixedPoint::Int128::Negate(A) : A;
+}
+
+static FORCEINLINE bool IsLexicographicallyLess(const FFixedVector64& A, const FFixedVector64& B)
+{
+	if (A.X != B.X)
+	{
+		return A.X < B.X;
+	}
+	if (A.Y != B.Y)
+	{
+		return A.Y < B.Y;
+	}
+	return A.Z < B.Z;
+}
+
+namespace
+{
+	/** Quickhull over one point set, faces are only ever appended so every scan runs in the same order */
+	struct FQuickHull
+	{
+		TArrayView<const FFixedVector64> Points;
+		TArray<FHullFace> Faces;
+		TArray<int32> NextOutside;
+
+		explicit FQuickHull(TArrayView<const FFixedVector64> InPoints)
+			: Points(InPoints)
+		{
+			NextOutside.SetNumUninitialized(Points.Num());
+		}
+
+		int32 AddFace(int32 A, int32 B, int32 C)
+		{
+			FHullFace& Face = Faces.AddDefaulted_GetRef();
+			Face.Corners[0] = A;
+			Face.Corners[1] = B;
+			Face.Corners[2] = C;
+			Face.Neighbors[0] = Face.Neighbors[1] = Face.Neighbors[2] = INDEX_NONE;
+			ExactCross(Points[A], Points[B], Points[C], Face.Normal);
+			Face.FirstOutside = INDEX_NONE;
+			Face.Furthest = INDEX_NONE;
+			Face.FurthestDistance = FixedPoint::Int128::Make(0);
+			Face.VisitedOn = INDEX_NONE;
+			Face.bVisible = false;
+			Face.bAlive = true;
+			return Faces.Num() - 1;
+		}
+
+		FORCEINLINE FInt128 GetSide(int32 FaceIndex, int32 PointIndex) const
+		{
+			const FHullFace& Face = Faces[FaceIndex];
+			return ExactSide(Face.Normal, Points[Face.Corners[0]], Points[PointIndex]);
+		}
+
+		/** Hands the point to the first face in [FirstFace, EndFace) it is strictly in front of, points behind all of them are inside */
+		void AssignPoint(int32 PointIndex, int32 FirstFace, int32 EndFace)
+		{
+			using namespace FixedPoint::Int128;
+			for (int32 FaceIndex = FirstFace; FaceIndex < EndFace; FaceIndex++)
+			{
+				const FInt128 Side = GetSide(FaceIndex, PointIndex);
+				if (Sign(Side) > 0)
+				{
+					FHullFace& Face = Faces[FaceIndex];
+					NextOutside[PointIndex] = Face.FirstOutside;
+					Face.FirstOutside = PointIndex;
+					if (Face.Furthest == INDEX_NONE || Compare(Side, Face.FurthestDistance) > 0 || (Compare(Side, Face.FurthestDistance) == 0 && PointIndex < Face.Furthest))
+					{
+						Face.Furthest = PointIndex;
+						Face.FurthestDistance = Side;
+					}
+					return;
+				}
+			}
+		}
+
+		/** Sets the neighbor of FaceIndex across its edge From -> To */
+		void SetNeighbor(int32 FaceIndex, int32 From, int32 To, int32 Neighbor)
+		{
+			FHullFace& Face = Faces[FaceIndex];
+			for (int32 Edge = 0; Edge < 3; Edge++)
+			{
+				if (Face.Corners[Edge] == From && Face.Corners[Edge == 2 ? 0 : Edge + 1] == To)
+				{
+					Face.Neighbors[Edge] = Neighbor;
+					return;
+				}
+			}
+		}
+
+		/** @return false if the points have no volume */
+		bool BuildSimplex()
+		{
+			using namespace FixedPoint::Int128;
+			const int32 NumPoints = Points.Num();
+			int32 Lowest = 0;
+			int32 Highest = 0;
+			for (int32 i = 1; i < NumPoints; i++)
+			{
+				if (IsLexicographicallyLess(Points[i], Points[Lowest]))
+				{
+					Lowest = i;
+				}
+				if (IsLexicographicallyLess(Points[Highest], Points[i]))
+				{
+					Highest = i;
+				}
+			}
+			if (Points[Lowest] == Points[Highest])
+			{
+				return false;
+			}
+
+			//the point furthest from the line, measured by the exact cross product's largest component sum
+			int32 Third = INDEX_NONE;
+			FInt128 BestArea = Make(0);
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				FInt128 Cross[3];
+				ExactCross(Points[Lowest], Points[Highest], Points[i], Cross);
+				const FInt128 Area = Add(Add(AbsInt128(Cross[0]), AbsInt128(Cross[1])), AbsInt128(Cross[2]));
+				if (Compare(Area, BestArea) > 0)
+				{
+					BestArea = Area;
+					Third = i;
+				}
+			}
+			if (Third == INDEX_NONE)
+			{
+				return false;
+			}
+
+			FInt128 Normal[3];
+			ExactCross(Points[Lowest], Points[Highest], Points[Third], Normal);
+			int32 Fourth = INDEX_NONE;
+			FInt128 BestVolume = Make(0);
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				const FInt128 Volume = AbsInt128(ExactSide(Normal, Points[Lowest], Points[i]));
+				if (Compare(Volume, BestVolume) > 0)
+				{
+					BestVolume = Volume;
+					Fourth = i;
+				}
+			}
+			if (Fourth == INDEX_NONE)
+			{
+				return false;
+			}
+			//the fourth point must be behind the first face for every face to point outwards
+			if (Sign(ExactSide(Normal, Points[Lowest], Points[Fourth])) > 0)
+			{
+				Swap(Highest, Third);
+			}
+
+			const int32 Corners[4] = { Lowest, Highest, Third, Fourth };
+			AddFace(Corners[0], Corners[1], Corners[2]);
+			AddFace(Corners[0], Corners[3], Corners[1]);
+			AddFace(Corners[0], Corners[2], Corners[3]);
+			AddFace(Corners[1], Corners[3], Corners[2]);
+			for (int32 FaceIndex = 0; FaceIndex < 4; FaceIndex++)
+			{
+				for (int32 Edge = 0; Edge < 3; Edge++)
+				{
+					const int32 From = Faces[FaceIndex].Corners[Edge];
+					const int32 To = Faces[FaceIndex].Corners[Edge == 2 ? 0 : Edge + 1];
+					for (int32 Other = 0; Other < 4; Other++)
+					{
+						if (Other != FaceIndex)
+						{
+							SetNeighbor(Other, To, From, FaceIndex);
+						}
+					}
+				}
+			}
+
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				if (i != Lowest && i != Highest && i != Third && i != Fourth)
+				{
+					AssignPoint(i, 0, 4);
+				}
+			}
+			return true;
+		}
+
+		/** Adds Eye to the hull, replacing every face that can see it with a cone of faces from its horizon */
+		void AddPoint(int32 StartFace, int32 Eye, int32 Iteration, TArray<int32>& Visible, TArray<FHorizonEdge>& Horizon, TArray<FHorizonEdge>& Loop)
+		{
+			using namespace FixedPoint::Int128;
+			//faces are visible only when strictly in front, so coplanar neighbors stay and are merged afterwards
+			Visible.Reset();
+			Visible.Add(StartFace);
+			Faces[StartFace].VisitedOn = Iteration;
+			Faces[StartFace].bVisible = true;
+			for (int32 Cursor = 0; Cursor < Visible.Num(); Cursor++)
+			{
+				for (int32 Edge = 0; Edge < 3; Edge++)
+				{
+					const int32 Neighbor = Faces[Visible[Cursor]].Neighbors[Edge];
+					FHullFace& NeighborFace = Faces[Neighbor];
+					if (NeighborFace.VisitedOn == Iteration)
+					{
+						continue;
+					}
+					NeighborFace.VisitedOn = Iteration;
+					NeighborFace.bVisible = Sign(GetSide(Neighbor, Eye)) > 0;
+					if (NeighborFace.bVisible)
+					{
+						Visible.Add(Neighbor);
+					}
+				}
+			}
+
+			Horizon.Reset();
+			for (const int32 FaceIndex : Visible)
+			{
+				const FHullFace& Face = Faces[FaceIndex];
+				for (int32 Edge = 0; Edge < 3; Edge++)
+				{
+					if (!Faces[Face.Neighbors[Edge]].bVisible)
+					{
+						Horizon.Add(FHorizonEdge{ Face.Corners[Edge], Face.Corners[Edge == 2 ? 0 : Edge + 1], Face.Neighbors[Edge] });
+					}
+				}
+			}
+			//the visible faces form a disc, so the horizon is one loop
+			Loop.Reset();
+			Loop.Add(Horizon[0]);
+			while (Loop.Num() < Horizon.Num())
+			{
+				const int32 To = Loop.Last().To;
+				const FHorizonEdge* Next = Horizon.FindByPredicate([To](const FHorizonEdge& Edge) { return Edge.From == To; });
+				check(Next != nullptr);
+				Loop.Add(*Next);
+			}
+
+			const int32 NumLoop = Loop.Num();
+			const int32 FirstNew = Faces.Num();
+			for (int32 i = 0; i < NumLoop; i++)
+			{
+				const int32 NewFace = AddFace(Loop[i].From, Loop[i].To, Eye);
+				Faces[NewFace].Neighbors[0] = Loop[i].Outer;
+				Faces[NewFace].Neighbors[1] = FirstNew + (i + 1 < NumLoop ? i + 1 : 0);
+				Faces[NewFace].Neighbors[2] = FirstNew + (i > 0 ? i - 1 : NumLoop - 1);
+				SetNeighbor(Loop[i].Outer, Loop[i].To, Loop[i].From, NewFace);
+			}
+
+			for (const int32 FaceIndex : Visible)
+			{
+				Faces[FaceIndex].bAlive = false;
+				Faces[FaceIndex].bVisible = false;
+				int32 PointIndex = Faces[FaceIndex].FirstOutside;
+				while (PointIndex != INDEX_NONE)
+				{
+					const int32 Next = NextOutside[PointIndex];
+					if (PointIndex != Eye)
+					{
+						AssignPoint(PointIndex, FirstNew, Faces.Num());
+					}
+					PointIndex = Next;
+				}
+				Faces[FaceIndex].FirstOutside = INDEX_NONE;
+			}
+		}
+
+		void Run()
+		{
+			TArray<int32> Visible;
+			TArray<FHorizonEdge> Horizon;
+			TArray<FHorizonEdge> Loop;
+			int32 Iteration = 0;
+			for (int32 FaceIndex = 0; FaceIndex < Faces.Num(); FaceIndex++)
+			{
+				//a face keeps being picked until it is replaced, its furthest point always makes it visible
+				if (Faces[FaceIndex].bAlive && Faces[FaceIndex].FirstOutside != INDEX_NONE)
+				{
+					AddPoint(FaceIndex, Faces[FaceIndex].Furthest, Iteration++, Visible, Horizon, Loop);
+				}
+			}
+		}
+	};
+}
+
+void FFixedConvexHull::Reset()
+{
+	Vertices.Reset();
+	FaceIndices.Reset();
+	FaceStarts.Reset();
+	Planes.Reset();
+}
+
+bool FFixedConvexHull::Build(TArrayView<const FFixedVector64> Points)
+{
+	using namespace FixedPoint::Int128;
+	Reset();
+	if (Points.Num() < 4)
+	{
+		return false;
+	}
+	FQuickHull Hull(Points);
+	if (!Hull.BuildSimplex())
+	{
+		return false;
+	}
+	Hull.Run();
+	TArray<FHullFace>& Faces = Hull.Faces;
+	const int32 NumFaces = Faces.Num();
+
+	//triangles sharing an edge merge when the far corner of one is exactly on the other's plane
+	TArray<int32> Parent;
+	Parent.SetNumUninitialized(NumFaces);
+	for (int32 i = 0; i < NumFaces; i++)
+	{
+		Parent[i] = i;
+	}
+	auto FindRoot = [&Parent](int32 i)
+	{
+		while (Parent[i] != i)
+		{
+			Parent[i] = Parent[Parent[i]];
+			i = Parent[i];
+		}
+		return i;
+	};
+	for (int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+	{
+		const FHullFace& Face = Faces[FaceIndex];
+		if (!Face.bAlive)
+		{
+			continue;
+		}
+		for (int32 Edge = 0; Edge < 3; Edge++)
+		{
+			const int32 Neighbor = Face.Neighbors[Edge];
+			if (Neighbor < FaceIndex)
+			{
+				continue;
+			}
+			const FHullFace& Other = Faces[Neighbor];
+			int32 FarCorner = Other.Corners[0];
+			for (const int32 Corner : Other.Corners)
+			{
+				if (Corner != Face.Corners[Edge] && Corner != Face.Corners[Edge == 2 ? 0 : Edge + 1])
+				{
+					FarCorner = Corner;
+				}
+			}
+			if (IsZero(Hull.GetSide(FaceIndex, FarCorner)))
+			{
+				const int32 RootA = FindRoot(FaceIndex);
+				const int32 RootB = FindRoot(Neighbor);
+				//the lower face stays the root so groups come out in face order
+				Parent[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+			}
+		}
+	}
+
+	//each group's outline, chained through the next corner along its boundary
+	TArray<int32> GroupStart;
+	TArray<int32> GroupFaces;
+	GroupStart.Init(0, NumFaces + 1);
+	for (int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+	{
+		if (Faces[FaceIndex].bAlive)
+		{
+			Parent[FaceIndex] = FindRoot(FaceIndex);
+			GroupStart[Parent[FaceIndex] + 1]++;
+		}
+	}
+	for (int32 i = 0; i < NumFaces; i++)
+	{
+		GroupStart[i + 1] += GroupStart[i];
+	}
+	GroupFaces.SetNumUninitialized(GroupStart[NumFaces]);
+	{
+		TArray<int32> Fill(GroupStart);
+		for (int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+		{
+			if (Faces[FaceIndex].bAlive)
+			{
+				GroupFaces[Fill[Parent[FaceIndex]]++] = FaceIndex;
+			}
+		}
+	}
+
+	TArray<int32> NextCorner;
+	TArray<int32> Remap;
+	TArray<int32> Outline;
+	NextCorner.SetNumUninitialized(Points.Num());
+	Remap.Init(INDEX_NONE, Points.Num());
+	for (int32 Group = 0; Group < NumFaces; Group++)
+	{
+		if (GroupStart[Group] == GroupStart[Group + 1])
+		{
+			continue;
+		}
+		int32 First = INDEX_NONE;
+		for (int32 Member = GroupStart[Group]; Member < GroupStart[Group + 1]; Member++)
+		{
+			const FHullFace& Face = Faces[GroupFaces[Member]];
+			for (int32 Edge = 0; Edge < 3; Edge++)
+			{
+				if (Parent[Face.Neighbors[Edge]] != Group)
+				{
+					NextCorner[Face.Corners[Edge]] = Face.Corners[Edge == 2 ? 0 : Edge + 1];
+					First = First == INDEX_NONE ? Face.Corners[Edge] : First;
+				}
+			}
+		}
+		Outline.Reset();
+		int32 Corner = First;
+		do
+		{
+			Outline.Add(Corner);
+			Corner = NextCorner[Corner];
+		}
+		while (Corner != First);
+
+		//corners on a straight run of the outline are not hull vertices
+		const int32 FaceStart = FaceIndices.Num();
+		const int32 NumOutline = Outline.Num();
+		for (int32 i = 0; i < NumOutline; i++)
+		{
+			FInt128 Cross[3];
+			ExactCross(Points[Outline[i]], Points[Outline[i + 1 < NumOutline ? i + 1 : 0]], Points[Outline[i > 0 ? i - 1 : NumOutline - 1]], Cross);
+			if (IsZero(Cross[0]) && IsZero(Cross[1]) && IsZero(Cross[2]))
+			{
+				continue;
+			}
+			if (Remap[Outline[i]] == INDEX_NONE)
+			{
+				Remap[Outline[i]] = Vertices.Add(Points[Outline[i]]);
+			}
+			FaceIndices.Add(Remap[Outline[i]]);
+		}
+		FaceStarts.Add(FaceStart);
+
+		//exact normal of the merged face, rounded once
+		const FFixedVector64 Normal = FixedPoint::Normal::GetPreciseNormal(Faces[Group].Normal);
+		FFixed64 W = Normal | Vertices[FaceIndices[FaceStart]];
+		for (int32 i = FaceStart + 1; i < FaceIndices.Num(); i++)
+		{
+			W = FMath::Max(W, Normal | Vertices[FaceIndices[i]]);
+		}
+		Planes.Add(FFixedPlane(Normal, W));
+	}
+	return true;
+}
+
+bool FFixedConvexHull::IsPointInside(const FFixedVector64& P) const
+{
+	for (int32 Face = 0; Face < NumFaces(); Face++)
+	{
+		const TArrayView<const int32> Corners = GetFace(Face);
+		FInt128 Normal[3];
+		ExactCross(Vertices[Corners[0]], Vertices[Corners[1]], Vertices[Corners[2]], Normal);
+		if (FixedPoint::Int128::Sign(ExactSide(Normal, Vertices[Corners[0]], P)) > 0)
+		{
+			return false;
+		}
+	}
+	return NumFaces() > 0;
+}
+
+void FFixedConvexHull::BuildAll(TArrayView<const TArrayView<const FFixedVector64>> PointSets, TArray<FFixedConvexHull>& OutHulls, bool bParallel)
+{
+	OutHulls.SetNum(PointSets.Num());
+	FFixedConvexHull* OutPtr = OutHulls.GetData();
+	//each hull is one task, they vary too much in size to batch evenly
+	FixedPoint::Parallel::ForEachRange(PointSets.Num(), bParallel, [PointSets, OutPtr](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			OutPtr[i].Build(PointSets[i]);
+		}
+	}, 1);
+}
@@ -0,0 +1,171 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointConvexVolume.h"
+#include "FixedPointTypes.h"
+#include "FixedPointParallel.h"
+
+//one mask word per 64 objects, parallel tasks take whole words so no two tasks ever write the same word
+static constexpr int32 CullBlockSize = 64;
+static constexpr int32 CullBatchSize = CullBlockSize * 64;
+
+/**
+* Fills one mask word per block of 64 objects. OutsideMask(PlaneIndex, First, NumLanes) returns the lanes entirely in front
+* of that plane, planes are the outer loop so each one's coefficients stay in registers across the block.
+*/
+template<typename OutsideMaskType>
+static void CullBlocks(int32 Count, int32 NumPlanes, uint64* OutVisibleMask, bool bParallel, const OutsideMaskType& OutsideMask)
+{
+	FixedPoint::Parallel::ForEachRange(Count, bParallel, [NumPlanes, OutVisibleMask, &OutsideMask](int32 Start, int32 End)
+	{
+		for (int32 First = Start; First < End; First += CullBlockSize)
+		{
+			const int32 NumLanes = FMath::Min(End - First, CullBlockSize);
+			uint64 Visible = NumLanes == CullBlockSize ? ~0ull : ((1ull << NumLanes) - 1);
+			for (int32 PlaneIndex = 0; PlaneIndex < NumPlanes && Visible != 0; PlaneIndex++)
+			{
+				Visible &= ~OutsideMask(PlaneIndex, First, NumLanes);
+			}
+			OutVisibleMask[First / CullBlockSize] = Visible;
+		}
+	}, CullBatchSize);
+}
+
+static int32 AppendMaskIndices(TArrayView<const uint64> Mask, TArray<int32>& OutIndices)
+{
+	const int32 FirstIndex = OutIndices.Num();
+	for (int32 Word = 0; Word < Mask.Num(); Word++)
+	{
+		uint64 Bits = Mask[Word];
+		while (Bits != 0)
+		{
+			OutIndices.Add(Word * 64 + (int32)FMath::CountTrailingZeros64(Bits));
+			Bits &= Bits - 1;
+		}
+	}
+	return OutIndices.Num() - FirstIndex;
+}
+
+FFixedConvexVolume::FFixedConvexVolume(TArrayView<const FFixedPlane> InPlanes)
+	: Planes(InPlanes.GetData(), InPlanes.Num())
+{
+	Init();
+}
+
+FFixedConvexVolume FFixedConvexVolume::MakeFrustum(const FFixedVector64& Origin, const FFixedRotator64& Rotation, FFixed64 HalfFOVDegrees, FFixed64 AspectRatio, FFixed64 NearDistance, FFixed64 FarDistance)
+{
+	const FFixedRotationMatrix RotationMatrix(Rotation);
+	const FFixedVector64 Forward = RotationMatrix.GetScaledAxis(EAxis::X);
+	const FFixedVector64 Right = RotationMatrix.GetScaledAxis(EAxis::Y);
+	const FFixedVector64 Up = RotationMatrix.GetScaledAxis(EAxis::Z);
+	const FFixed64 TanHalfX = FFixedPointMath::Tan(FFixedPointMath::DegreesToRadians(HalfFOVDegrees));
+	const FFixed64 TanHalfY = TanHalfX / AspectRatio;
+
+	FFixedConvexVolume Volume;
+	Volume.Planes.Reserve(6);
+	Volume.Planes.Add(FFixedPlane(Origin + Forward * NearDistance, -Forward));
+	//a point Forward * D + Right * R from the eye is inside the right plane while R <= D * TanHalfX
+	Volume.Planes.Add(FFixedPlane(Origin, (-Right - Forward * TanHalfX).GetSafeNormal()));
+	Volume.Planes.Add(FFixedPlane(Origin, (Right - Forward * TanHalfX).GetSafeNormal()));
+	Volume.Planes.Add(FFixedPlane(Origin, (Up - Forward * TanHalfY).GetSafeNormal()));
+	Volume.Planes.Add(FFixedPlane(Origin, (-Up - Forward * TanHalfY).GetSafeNormal()));
+	if (FarDistance > FixedPoint::Constants::Fixed64::Zero)
+	{
+		Volume.Planes.Add(FFixedPlane(Origin + Forward * FarDistance, Forward));
+	}
+	Volume.Init();
+	return Volume;
+}
+
+void FFixedConvexVolume::Init()
+{
+	PlaneSoA.SetPlanes(Planes);
+}
+
+bool FFixedConvexVolume::IntersectPoint(const FFixedVector64& Point) const
+{
+	return PlaneSoA.IsPointInside(Point);
+}
+
+bool FFixedConvexVolume::IntersectSphere(const FFixedVector64& Origin, FFixed64 Radius) const
+{
+	for (int32 PlaneIndex = 0; PlaneIndex < PlaneSoA.Num(); PlaneIndex++)
+	{
+		if (PlaneSoA.X[PlaneIndex] * Origin.X + PlaneSoA.Y[PlaneIndex] * Origin.Y + PlaneSoA.Z[PlaneIndex] * Origin.Z - PlaneSoA.W[PlaneIndex] > Radius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FFixedConvexVolume::IntersectBox(const FFixedBox& Box) const
+{
+	for (int32 PlaneIndex = 0; PlaneIndex < PlaneSoA.Num(); PlaneIndex++)
+	{
+		const FFixed64 PX = PlaneSoA.X[PlaneIndex], PY = PlaneSoA.Y[PlaneIndex], PZ = PlaneSoA.Z[PlaneIndex];
+		const FFixedVector64 Corner(
+			PX > FixedPoint::Constants::Fixed64::Zero ? Box.Min.X : Box.Max.X,
+			PY > FixedPoint::Constants::Fixed64::Zero ? Box.Min.Y : Box.Max.Y,
+			PZ > FixedPoint::Constants::Fixed64::Zero ? Box.Min.Z : Box.Max.Z);
+		if (PX * Corner.X + PY * Corner.Y + PZ * Corner.Z - PlaneSoA.W[PlaneIndex] > FixedPoint::Constants::Fixed64::Zero)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FFixedConvexVolume::CullSpheres(const FFixedSphereSoA& Spheres, TArrayView<uint64> OutVisibleMask, bool bParallel) const
+{
+	check(OutVisibleMask.Num() == GetNumMaskWords(Spheres.Num()));
+	CullBlocks(Spheres.Num(), PlaneSoA.Num(), OutVisibleMask.GetData(), bParallel, [this, &Spheres](int32 PlaneIndex, int32 First, int32 NumLanes)
+	{
+		const FFixed64 PX = PlaneSoA.X[PlaneIndex], PY = PlaneSoA.Y[PlaneIndex], PZ = PlaneSoA.Z[PlaneIndex], PW = PlaneSoA.W[PlaneIndex];
+		const FFixed64* CenterX = Spheres.CenterX.GetData() + First;
+		const FFixed64* CenterY = Spheres.CenterY.GetData() + First;
+		const FFixed64* CenterZ = Spheres.CenterZ.GetData() + First;
+		const FFixed64* Radius = Spheres.W.GetData() + First;
+		uint64 Outside = 0;
+		for (int32 Lane = 0; Lane < NumLanes; Lane++)
+		{
+			Outside |= (uint64)(PX * CenterX[Lane] + PY * CenterY[Lane] + PZ * CenterZ[Lane] - PW > Radius[Lane]) << Lane;
+		}
+		return Outside;
+	});
+}
+
+int32 FFixedConvexVolume::CullSpheres(const FFixedSphereSoA& Spheres, TArray<int32>& OutVisible, bool bParallel) const
+{
+	TArray<uint64> Mask;
+	Mask.SetNumUninitialized(GetNumMaskWords(Spheres.Num()));
+	CullSpheres(Spheres, Mask, bParallel);
+	return AppendMaskIndices(Mask, OutVisible);
+}
+
+void FFixedConvexVolume::CullBoxes(const FFixedBoxSoA& Boxes, TArrayView<uint64> OutVisibleMask, bool bParallel) const
+{
+	check(OutVisibleMask.Num() == GetNumMaskWords(Boxes.Num()));
+	CullBlocks(Boxes.Num(), PlaneSoA.Num(), OutVisibleMask.GetData(), bParallel, [this, &Boxes](int32 PlaneIndex, int32 First, int32 NumLanes)
+	{
+		const FFixed64 PX = PlaneSoA.X[PlaneIndex], PY = PlaneSoA.Y[PlaneIndex], PZ = PlaneSoA.Z[PlaneIndex], PW = PlaneSoA.W[PlaneIndex];
+		//the corner furthest behind the plane is picked once per plane, as whole arrays
+		const FFixed64* CornerX = (PX > FixedPoint::Constants::Fixed64::Zero ? Boxes.MinX.GetData() : Boxes.MaxX.GetData()) + First;
+		const FFixed64* CornerY = (PY > FixedPoint::Constants::Fixed64::Zero ? Boxes.MinY.GetData() : Boxes.MaxY.GetData()) + First;
+		const FFixed64* CornerZ = (PZ > FixedPoint::Constants::Fixed64::Zero ? Boxes.MinZ.GetData() : Boxes.MaxZ.GetData()) + First;
+		uint64 Outside = 0;
+		for (int32 Lane = 0; Lane < NumLanes; Lane++)
+		{
+			Outside |= (uint64)(PX * CornerX[Lane] + PY * CornerY[Lane] + PZ * CornerZ[Lane] - PW > FixedPoint::Constants::Fixed64::Zero) << Lane;
+		}
+		return Outside;
+	});
+}
+
+int32 FFixedConvexVolume::CullBoxes(const FFixedBoxSoA& Boxes, TArray<int32>& OutVisible, bool bParallel) const
+{
+	TArray<uint64> Mask;
+	Mask.SetNumUninitialized(GetNumMaskWords(Boxes.Num()));
+	CullBoxes(Boxes, Mask, bParallel);
+	return AppendMaskIndices(Mask, OutVisible);
+}
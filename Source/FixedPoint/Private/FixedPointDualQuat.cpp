@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointDualQuat.h"
+#include "FixedPointTypes.h"
+#include "FixedPointParallel.h"
+
+const FFixedDualQuat64 FFixedDualQuat64::Identity(
+	FFixedQuat64(FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::One),
+	FFixedVector64(FixedPoint::Constants::Fixed64::Zero),
+	FixedPoint::Constants::Fixed64::One);
+
+/** Sums weighted inputs, flipping each onto the hemisphere of the first, then normalizes */
+template<typename GetFunctorType>
+static FORCEINLINE FFixedDualQuat64 BlendInfluences(int32 NumInfluences, const FFixed64* Weights, GetFunctorType&& GetInfluence)
+{
+	if (NumInfluences == 0)
+	{
+		return FFixedDualQuat64::Identity;
+	}
+	const FFixedQuat64 Pivot = GetInfluence(0).Real;
+	FFixedDualQuat64 Result;
+	Result.Real = FFixedQuat64(ForceInitToZero);
+	Result.Dual = FFixedQuat64(ForceInitToZero);
+	Result.Scale = FixedPoint::Constants::Fixed64::Zero;
+	for (int32 k = 0; k < NumInfluences; k++)
+	{
+		const FFixedDualQuat64& Influence = GetInfluence(k);
+		const FFixed64 Weight = (Influence.Real | Pivot) < FixedPoint::Constants::Fixed64::Zero ? -Weights[k] : Weights[k];
+		Result.Real += Influence.Real * Weight;
+		Result.Dual += Influence.Dual * Weight;
+		Result.Scale += Influence.Scale * Weights[k];
+	}
+	Result.Normalize();
+	return Result;
+}
+
+FFixedDualQuat64 FFixedDualQuat64::Blend(TArrayView<const FFixedDualQuat64> DualQuats, TArrayView<const FFixed64> Weights)
+{
+	check(DualQuats.Num() == Weights.Num());
+	const FFixedDualQuat64* DualQuatPtr = DualQuats.GetData();
+	return BlendInfluences(DualQuats.Num(), Weights.GetData(), [DualQuatPtr](int32 k) -> const FFixedDualQuat64& { return DualQuatPtr[k]; });
+}
+
+void FFixedDualQuat64::Blend(TArrayView<FFixedDualQuat64> OutDualQuats, TArrayView<const FFixedDualQuat64> DualQuats, TArrayView<const int32> Indices, TArrayView<const FFixed64> Weights, int32 InfluencesPerOutput, bool bParallel)
+{
+	check(Indices.Num() == OutDualQuats.Num() * InfluencesPerOutput && Weights.Num() == Indices.Num());
+	const FFixedDualQuat64* DualQuatPtr = DualQuats.GetData();
+	const int32* IndexPtr = Indices.GetData();
+	const FFixed64* WeightPtr = Weights.GetData();
+	FFixedDualQuat64* OutPtr = OutDualQuats.GetData();
+	FixedPoint::Parallel::ForEachRange(OutDualQuats.Num(), bParallel, [=](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			const int32* OutputIndices = IndexPtr + i * InfluencesPerOutput;
+			OutPtr[i] = BlendInfluences(InfluencesPerOutput, WeightPtr + i * InfluencesPerOutput, [DualQuatPtr, OutputIndices](int32 k) -> const FFixedDualQuat64& { return DualQuatPtr[OutputIndices[k]]; });
+		}
+	});
+}
+
+void FFixedDualQuat64::TransformPositions(TArrayView<const FFixedDualQuat64> DualQuats, TArrayView<const FFixedVector64> Positions, TArrayView<FFixedVector64> OutPositions, bool bParallel)
+{
+	check(DualQuats.Num() == Positions.Num() && Positions.Num() == OutPositions.Num());
+	const FFixedDualQuat64* DualQuatPtr = DualQuats.GetData();
+	const FFixedVector64* PositionPtr = Positions.GetData();
+	FFixedVector64* OutPtr = OutPositions.GetData();
+	FixedPoint::Parallel::ForEachRange(OutPositions.Num(), bParallel, [=](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			OutPtr[i] = DualQuatPtr[i].TransformPosition(PositionPtr[i]);
+		}
+	});
+}
@@ -0,0 +1,779 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointGJK.h"
+#include "FixedPointInt128.h"
+#include "FixedPointNormal.h"
+
+using FixedPoint::Int128::FInt128;
+
+//progress below which GJK and EPA stop, 2^-12 of the current distance squared or depth
+static constexpr uint32 RelativeToleranceShift = 12;
+//GJK's floor in the 2^-40 units of exact squared distances, the rounding of a closest point a few raw units out
+static constexpr int64 RawSquaredTolerance = 1 << 12;
+//EPA's floor in raw units, a few roundings of a dot product
+static constexpr int64 RawDepthTolerance = 8;
+//EPA polytope capacity, a closed triangle mesh of V vertices has 2V - 4 faces and a horizon has at most V edges
+static constexpr int32 MaxPolytopeVertices = 64;
+static constexpr int32 MaxPolytopeFaces = MaxPolytopeVertices * 2;
+static constexpr int32 MaxHorizonEdges = MaxPolytopeVertices;
+
+namespace
+{
+	struct FSimplexVertex
+	{
+		/** Point of the core Minkowski difference, A - B */
+		FFixedVector64 W;
+		FFixedVector64 A;
+		FFixedVector64 B;
+		/** Search direction that found W, kept for warm starts */
+		FFixedVector64 Direction;
+	};
+
+	struct FSimplex
+	{
+		FSimplexVertex Vertices[4];
+		/** Barycentric weights of the closest point, summing to one */
+		FFixed64 Lambdas[4];
+		int32 Num = 0;
+	};
+
+	struct FPolytopeFace
+	{
+		int32 Indices[3];
+		FFixedVector64 Normal;
+		FFixed64 Distance;
+		bool bAlive;
+	};
+}
+
+/** Dot product with a single rounding */
+static FORCEINLINE FFixed64 Dot(const FFixedVector64& A, const FFixedVector64& B)
+{
+	return FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(A.X.Value, B.X.Value, A.Y.Value, B.Y.Value, A.Z.Value, B.Z.Value));
+}
+
+/** Exact dot product of the raw values, only its sign and comparisons are used */
+static FORCEINLINE FInt128 ExactDot(const FFixedVector64& A, const FFixedVector64& B)
+{
+	using namespace FixedPoint::Int128;
+	return Add(Add(Mul(A.X.Value, B.X.Value), Mul(A.Y.Value, B.Y.Value)), Mul(A.Z.Value, B.Z.Value));
+}
+
+/** Exact (B - A) ^ (C - A) of the raw values */
+static FORCEINLINE void ExactCross(const FFixedVector64& A, const FFixedVector64& B, const FFixedVector64& C, FInt128 OutCross[3])
+{
+	using namespace FixedPoint::Int128;
+	const int64 ABX = B.X.Value - A.X.Value;
+	const int64 ABY = B.Y.Value - A.Y.Value;
+	const int64 ABZ = B.Z.Value - A.Z.Value;
+	const int64 ACX = C.X.Value - A.X.Value;
+	const int64 ACY = C.Y.Value - A.Y.Value;
+	const int64 ACZ = C.Z.Value - A.Z.Value;
+	OutCross[0] = Sub(Mul(ABY, ACZ), Mul(ABZ, ACY));
+	OutCross[1] = Sub(Mul(ABZ, ACX), Mul(ABX, ACZ));
+	OutCross[2] = Sub(Mul(ABX, ACY), Mul(ABY, ACX));
+}
+
+static FORCEINLINE FFixed64 GetDepthTolerance(FFixed64 Depth)
+{
+	return FFixed64::MakeFromRawInt(RawDepthTolerance + (FFixedPointMath::Abs(Depth).Value >> RelativeToleranceShift));
+}
+
+static FORCEINLINE FSimplexVertex SupportPair(const FFixedConvexShape& A, const FFixedConvexShape& B, const FFixedVector64& Direction)
+{
+	const FFixedVector64 PointA = A.Support(Direction);
+	const FFixedVector64 PointB = B.Support(-Direction);
+	return FSimplexVertex{ PointA - PointB, PointA, PointB, Direction };
+}
+
+static FORCEINLINE FFixedVector64 SetVertex(FSimplex& Out, const FSimplexVertex& P0)
+{
+	Out.Num = 1;
+	Out.Vertices[0] = P0;
+	Out.Lambdas[0] = FixedPoint::Constants::Fixed64::One;
+	return P0.W;
+}
+
+/** Keeps the edge P0 P1 with the closest point T of the way along it */
+static FORCEINLINE FFixedVector64 SetEdge(FSimplex& Out, const FSimplexVertex& P0, const FSimplexVertex& P1, FFixed64 T)
+{
+	Out.Num = 2;
+	Out.Vertices[0] = P0;
+	Out.Vertices[1] = P1;
+	Out.Lambdas[0] = FixedPoint::Constants::Fixed64::One - T;
+	Out.Lambdas[1] = T;
+	return P0.W + (P1.W - P0.W) * T;
+}
+
+static FFixedVector64 ClosestOnSegment(const FSimplexVertex& P0, const FSimplexVertex& P1, FSimplex& Out)
+{
+	const FFixedVector64 Edge = P1.W - P0.W;
+	const FFixed64 T = -Dot(P0.W, Edge);
+	const FFixed64 LengthSquared = Dot(Edge, Edge);
+	if (T <= FixedPoint::Constants::Fixed64::Zero || LengthSquared == FixedPoint::Constants::Fixed64::Zero)
+	{
+		return SetVertex(Out, P0);
+	}
+	if (T >= LengthSquared)
+	{
+		return SetVertex(Out, P1);
+	}
+	return SetEdge(Out, P0, P1, T / LengthSquared);
+}
+
+/**
+* Closest point of a triangle to the origin by Voronoi regions, see Real-Time Collision Detection 5.1.5.
+* The region tests multiply pairs of dot products, those are exact 128 bit values and the face weights are
+* divided out of them directly.
+*/
+static FFixedVector64 ClosestOnTriangle(const FSimplexVertex& P0, const FSimplexVertex& P1, const FSimplexVertex& P2, FSimplex& Out)
+{
+	using namespace FixedPoint::Int128;
+	const FFixed64 Zero = FixedPoint::Constants::Fixed64::Zero;
+	const FFixedVector64 AB = P1.W - P0.W;
+	const FFixedVector64 AC = P2.W - P0.W;
+
+	const FFixed64 D1 = -Dot(AB, P0.W);
+	const FFixed64 D2 = -Dot(AC, P0.W);
+	if (D1 <= Zero && D2 <= Zero)
+	{
+		return SetVertex(Out, P0);
+	}
+	const FFixed64 D3 = -Dot(AB, P1.W);
+	const FFixed64 D4 = -Dot(AC, P1.W);
+	if (D3 >= Zero && D4 <= D3)
+	{
+		return SetVertex(Out, P1);
+	}
+	const FInt128 VC = Sub(Mul(D1.Value, D4.Value), Mul(D3.Value, D2.Value));
+	if (Sign(VC) <= 0 && D1 >= Zero && D3 <= Zero)
+	{
+		return SetEdge(Out, P0, P1, D1 / (D1 - D3));
+	}
+	const FFixed64 D5 = -Dot(AB, P2.W);
+	const FFixed64 D6 = -Dot(AC, P2.W);
+	if (D6 >= Zero && D5 <= D6)
+	{
+		return SetVertex(Out, P2);
+	}
+	const FInt128 VB = Sub(Mul(D5.Value, D2.Value), Mul(D1.Value, D6.Value));
+	if (Sign(VB) <= 0 && D2 >= Zero && D6 <= Zero)
+	{
+		return SetEdge(Out, P0, P2, D2 / (D2 - D6));
+	}
+	const FInt128 VA = Sub(Mul(D3.Value, D6.Value), Mul(D5.Value, D4.Value));
+	if (Sign(VA) <= 0 && D4 - D3 >= Zero && D5 - D6 >= Zero)
+	{
+		return SetEdge(Out, P1, P2, (D4 - D3) / ((D4 - D3) + (D5 - D6)));
+	}
+
+	const FInt128 Denominator = Add(Add(VA, VB), VC);
+	if (Sign(Denominator) <= 0)
+	{
+		//collinear corners, the closest edge is the answer
+		FSimplex Edge;
+		FFixedVector64 Best = ClosestOnSegment(P0, P1, Out);
+		FFixed64 BestSquared = Dot(Best, Best);
+		const FSimplexVertex* Edges[2][2] = { { &P0, &P2 }, { &P1, &P2 } };
+		for (int32 i = 0; i < 2; i++)
+		{
+			const FFixedVector64 Candidate = ClosestOnSegment(*Edges[i][0], *Edges[i][1], Edge);
+			const FFixed64 CandidateSquared = Dot(Candidate, Candidate);
+			if (CandidateSquared < BestSquared)
+			{
+				Best = Candidate;
+				BestSquared = CandidateSquared;
+				Out = Edge;
+			}
+		}
+		return Best;
+	}
+	const FFixed64 V = FFixed64::MakeFromRawInt(MulDivTruncate(FixedPoint::Constants::Raw64::One, VB, Denominator));
+	const FFixed64 W = FFixed64::MakeFromRawInt(MulDivTruncate(FixedPoint::Constants::Raw64::One, VC, Denominator));
+	Out.Num = 3;
+	Out.Vertices[0] = P0;
+	Out.Vertices[1] = P1;
+	Out.Vertices[2] = P2;
+	Out.Lambdas[0] = FixedPoint::Constants::Fixed64::One - V - W;
+	Out.Lambdas[1] = V;
+	Out.Lambdas[2] = W;
+	return P0.W + AB * V + AC * W;
+}
+
+/**
+* Closest point of a tetrahedron to the origin, the closest of the faces the origin is outside of.
+* Which side of a face the origin is on is an exact 128 bit test, a flat tetrahedron has the origin outside every
+* face so it never counts as enclosing it.
+* @return zero with all four vertices kept when the origin is inside
+*/
+static FFixedVector64 ClosestOnTetrahedron(const FSimplex& In, FSimplex& Out)
+{
+	using namespace FixedPoint::Int128;
+	static constexpr int32 Faces[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+	FFixedVector64 Best = FFixedVector64::ZeroVector;
+	FFixed64 BestSquared = FixedPoint::Constants::Fixed64::BigNumber;
+	bool bOutsideAny = false;
+	for (int32 Face = 0; Face < 4; Face++)
+	{
+		const FSimplexVertex& A = In.Vertices[Faces[Face][0]];
+		const FSimplexVertex& B = In.Vertices[Faces[Face][1]];
+		const FSimplexVertex& C = In.Vertices[Faces[Face][2]];
+		const FSimplexVertex& D = In.Vertices[Faces[Face][3]];
+		const FFixedVector64 Normal = (B.W - A.W) ^ (C.W - A.W);
+		const int32 OriginSide = -Sign(ExactDot(Normal, A.W));
+		const int32 OppositeSide = Sign(ExactDot(Normal, D.W - A.W));
+		if (OppositeSide != 0 && OriginSide * OppositeSide >= 0)
+		{
+			continue;
+		}
+		bOutsideAny = true;
+		FSimplex Candidate;
+		const FFixedVector64 Point = ClosestOnTriangle(A, B, C, Candidate);
+		const FFixed64 PointSquared = Dot(Point, Point);
+		if (PointSquared < BestSquared)
+		{
+			Best = Point;
+			BestSquared = PointSquared;
+			Out = Candidate;
+		}
+	}
+	if (!bOutsideAny)
+	{
+		Out = In;
+		return FFixedVector64::ZeroVector;
+	}
+	return Best;
+}
+
+/** Reduces the simplex to the feature closest to the origin and returns that closest point */
+static FFixedVector64 SolveSimplex(FSimplex& Simplex)
+{
+	const FSimplex In = Simplex;
+	switch (In.Num)
+	{
+	case 1:
+		return SetVertex(Simplex, In.Vertices[0]);
+	case 2:
+		return ClosestOnSegment(In.Vertices[0], In.Vertices[1], Simplex);
+	case 3:
+		return ClosestOnTriangle(In.Vertices[0], In.Vertices[1], In.Vertices[2], Simplex);
+	default:
+		return ClosestOnTetrahedron(In, Simplex);
+	}
+}
+
+static FORCEINLINE bool ContainsPoint(const FSimplex& Simplex, const FFixedVector64& W)
+{
+	for (int32 i = 0; i < Simplex.Num; i++)
+	{
+		if (Simplex.Vertices[i].W == W)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+* Runs GJK on the cores.
+* @param bStopWhenSeparated - Return as soon as a direction shows the rounded shapes cannot touch
+* @param OutV - Closest point of the core Minkowski difference to the origin
+* @return true if the cores touch or overlap, or with bStopWhenSeparated the rounded shapes do
+*/
+static bool RunGJK(const FFixedConvexShape& A, const FFixedConvexShape& B, FFixedGJKCache* Cache, bool bStopWhenSeparated, FSimplex& Simplex, FFixedVector64& OutV, int32& OutIterations)
+{
+	using namespace FixedPoint::Int128;
+	Simplex.Num = 0;
+	if (Cache != nullptr)
+	{
+		for (int32 i = 0; i < Cache->NumDirections; i++)
+		{
+			const FSimplexVertex Vertex = SupportPair(A, B, Cache->Directions[i]);
+			if (!ContainsPoint(Simplex, Vertex.W))
+			{
+				Simplex.Vertices[Simplex.Num++] = Vertex;
+			}
+		}
+	}
+	if (Simplex.Num == 0)
+	{
+		const FFixedVector64 Between = B.GetCenter() - A.GetCenter();
+		Simplex.Vertices[Simplex.Num++] = SupportPair(A, B, Between.IsZero() ? FFixedVector64::XAxisVector : Between);
+	}
+
+	const FFixed64 RadiusSum = A.Radius + B.Radius;
+	const int64 RadiusSumSquared = (RadiusSum * RadiusSum).Value;
+	bool bOverlap = false;
+	for (OutIterations = 1; OutIterations <= FFixedGJK::MaxIterations; OutIterations++)
+	{
+		OutV = SolveSimplex(Simplex);
+		//squared distances are compared exactly, rounding them to 20 bits would lose close contacts entirely
+		const FInt128 VV = ExactDot(OutV, OutV);
+		if (Simplex.Num == 4 || IsZero(VV))
+		{
+			bOverlap = true;
+			break;
+		}
+		const FSimplexVertex W = SupportPair(A, B, -OutV);
+		const FInt128 VW = ExactDot(OutV, W.W);
+		//V is a few raw units off the true closest point, which moves V.W by as many times W
+		const FFixedVector64 WAbs = W.W.GetAbs();
+		const FInt128 Floor = Make(RawSquaredTolerance + (FMath::Max3(WAbs.X.Value, WAbs.Y.Value, WAbs.Z.Value) << 2));
+		//too close to tell from touching, and V too short to trust as a normal
+		if (Compare(VV, Floor) <= 0)
+		{
+			bOverlap = true;
+			break;
+		}
+		//the support plane along -V is past the origin by more than both radii, nothing can touch
+		if (bStopWhenSeparated && Sign(VW) > 0)
+		{
+			const int64 RawVW = ShiftRightTruncate(VW, FixedPoint::Constants::BinaryPoint64);
+			if (Compare(Mul(RawVW, RawVW), Mul(RadiusSumSquared, ShiftRightTruncate(VV, FixedPoint::Constants::BinaryPoint64))) > 0)
+			{
+				break;
+			}
+		}
+		if (Compare(Sub(VV, VW), Add(Floor, ShiftRight(VV, RelativeToleranceShift))) <= 0 || ContainsPoint(Simplex, W.W))
+		{
+			break;
+		}
+		//out of iterations, keep the simplex V and its lambdas were solved from so the points and cache match V
+		if (OutIterations == FFixedGJK::MaxIterations)
+		{
+			break;
+		}
+		Simplex.Vertices[Simplex.Num++] = W;
+	}
+	OutIterations = FMath::Min(OutIterations, FFixedGJK::MaxIterations);
+
+	if (Cache != nullptr)
+	{
+		Cache->NumDirections = Simplex.Num;
+		for (int32 i = 0; i < Simplex.Num; i++)
+		{
+			Cache->Directions[i] = Simplex.Vertices[i].Direction;
+		}
+	}
+	return bOverlap;
+}
+
+/** Fills a separated result from the closest simplex of the cores, then steps each point out by its radius */
+static void SetSeparatedResult(const FFixedConvexShape& A, const FFixedConvexShape& B, const FSimplex& Simplex, const FFixedVector64& V, FFixedGJKResult& OutResult)
+{
+	FFixedVector64 CoreA = FFixedVector64::ZeroVector;
+	FFixedVector64 CoreB = FFixedVector64::ZeroVector;
+	for (int32 i = 0; i < Simplex.Num; i++)
+	{
+		CoreA += Simplex.Vertices[i].A * Simplex.Lambdas[i];
+		CoreB += Simplex.Vertices[i].B * Simplex.Lambdas[i];
+	}
+	OutResult.Normal = FixedPoint::Normal::GetPreciseNormal(-V);
+	const FFixed64 CoreDistance = -Dot(OutResult.Normal, V);
+	OutResult.PointA = CoreA + OutResult.Normal * A.Radius;
+	OutResult.PointB = CoreB - OutResult.Normal * B.Radius;
+	OutResult.Distance = CoreDistance - A.Radius - B.Radius;
+}
+
+/** Grows a simplex around the origin into a tetrahedron, false when the core Minkowski difference is flat */
+static bool ExpandToTetrahedron(const FFixedConvexShape& A, const FFixedConvexShape& B, FSimplex& Simplex)
+{
+	using namespace FixedPoint::Int128;
+	static const FFixedVector64 AxisDirections[6] = {
+		FFixedVector64::XAxisVector, -FFixedVector64::XAxisVector,
+		FFixedVector64::YAxisVector, -FFixedVector64::YAxisVector,
+		FFixedVector64::ZAxisVector, -FFixedVector64::ZAxisVector
+	};
+
+	while (Simplex.Num < 4)
+	{
+		const FFixedVector64& Base = Simplex.Vertices[0].W;
+		FFixedVector64 Directions[6];
+		int32 NumDirections = 0;
+		if (Simplex.Num == 1)
+		{
+			for (const FFixedVector64& Axis : AxisDirections)
+			{
+				Directions[NumDirections++] = Axis;
+			}
+		}
+		else if (Simplex.Num == 2)
+		{
+			//two directions perpendicular to the edge and each other, from the axis the edge is least along
+			const FFixedVector64 Edge = Simplex.Vertices[1].W - Base;
+			const FFixedVector64 Abs = Edge.GetAbs();
+			const FFixedVector64& Axis = Abs.X <= Abs.Y && Abs.X <= Abs.Z ? FFixedVector64::XAxisVector : (Abs.Y <= Abs.Z ? FFixedVector64::YAxisVector : FFixedVector64::ZAxisVector);
+			const FFixedVector64 First = Edge ^ Axis;
+			const FFixedVector64 Second = Edge ^ First;
+			Directions[NumDirections++] = First;
+			Directions[NumDirections++] = -First;
+			Directions[NumDirections++] = Second;
+			Directions[NumDirections++] = -Second;
+		}
+		else
+		{
+			const FFixedVector64 Normal = (Simplex.Vertices[1].W - Base) ^ (Simplex.Vertices[2].W - Base);
+			Directions[NumDirections++] = Normal;
+			Directions[NumDirections++] = -Normal;
+		}
+
+		bool bGrew = false;
+		for (int32 i = 0; i < NumDirections && !bGrew; i++)
+		{
+			const FSimplexVertex Vertex = SupportPair(A, B, Directions[i]);
+			const FFixedVector64 Offset = Vertex.W - Base;
+			if (Simplex.Num == 1)
+			{
+				bGrew = !Offset.IsZero();
+			}
+			else if (Simplex.Num == 2)
+			{
+				bGrew = !((Simplex.Vertices[1].W - Base) ^ Offset).IsZero();
+			}
+			else
+			{
+				bGrew = Sign(ExactDot((Simplex.Vertices[1].W - Base) ^ (Simplex.Vertices[2].W - Base), Offset)) != 0;
+			}
+			if (bGrew)
+			{
+				Simplex.Vertices[Simplex.Num++] = Vertex;
+			}
+		}
+		if (!bGrew)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static FORCEINLINE FPolytopeFace MakeFace(const FSimplexVertex* Vertices, int32 I0, int32 I1, int32 I2)
+{
+	FPolytopeFace Face;
+	Face.Indices[0] = I0;
+	Face.Indices[1] = I1;
+	Face.Indices[2] = I2;
+	FInt128 Cross[3];
+	ExactCross(Vertices[I0].W, Vertices[I1].W, Vertices[I2].W, Cross);
+	Face.Normal = FixedPoint::Normal::GetPreciseNormal(Cross);
+	//a degenerate face with no normal is never picked and never seen
+	Face.Distance = Face.Normal.IsZero() ? FixedPoint::Constants::Fixed64::BigNumber : Dot(Face.Normal, Vertices[I0].W);
+	Face.bAlive = true;
+	return Face;
+}
+
+/**
+* Expands the tetrahedron around the origin towards the boundary of the core Minkowski difference, see
+* Van den Bergen's EPA. Faces wind counter clockwise seen from outside.
+* @return EPA iterations taken
+*/
+static int32 RunEPA(const FFixedConvexShape& A, const FFixedConvexShape& B, const FSimplex& Tetrahedron, FFixedGJKResult& OutResult)
+{
+	using namespace FixedPoint::Int128;
+	FSimplexVertex Vertices[MaxPolytopeVertices];
+	FPolytopeFace Faces[MaxPolytopeFaces];
+	int32 Edges[MaxHorizonEdges][2];
+	int32 NumVertices = 4;
+	int32 NumFaces = 0;
+	for (int32 i = 0; i < 4; i++)
+	{
+		Vertices[i] = Tetrahedron.Vertices[i];
+	}
+	//face 0 1 2 must face away from vertex 3
+	if (Sign(ExactDot((Vertices[1].W - Vertices[0].W) ^ (Vertices[2].W - Vertices[0].W), Vertices[3].W - Vertices[0].W)) > 0)
+	{
+		Swap(Vertices[1], Vertices[2]);
+	}
+	Faces[NumFaces++] = MakeFace(Vertices, 0, 1, 2);
+	Faces[NumFaces++] = MakeFace(Vertices, 0, 3, 1);
+	Faces[NumFaces++] = MakeFace(Vertices, 0, 2, 3);
+	Faces[NumFaces++] = MakeFace(Vertices, 1, 3, 2);
+
+	int32 Best = 0;
+	int32 Iterations = 0;
+	while (true)
+	{
+		Best = INDEX_NONE;
+		for (int32 i = 0; i < NumFaces; i++)
+		{
+			if (Best == INDEX_NONE || Faces[i].Distance < Faces[Best].Distance)
+			{
+				Best = i;
+			}
+		}
+		const FPolytopeFace& Closest = Faces[Best];
+		if (Iterations == FFixedGJK::MaxEPAIterations || NumVertices == MaxPolytopeVertices || Closest.Normal.IsZero())
+		{
+			break;
+		}
+		Iterations++;
+		const FSimplexVertex Vertex = SupportPair(A, B, Closest.Normal);
+		if (Dot(Closest.Normal, Vertex.W) - Closest.Distance <= GetDepthTolerance(Closest.Distance))
+		{
+			break;
+		}
+
+		//remove every face the new vertex sees, the edges left between kept and removed faces form the horizon
+		int32 NumEdges = 0;
+		bool bHorizonFull = false;
+		int32 NumKept = 0;
+		for (int32 i = 0; i < NumFaces; i++)
+		{
+			const FPolytopeFace& Face = Faces[i];
+			if (Sign(ExactDot(Face.Normal, Vertex.W - Vertices[Face.Indices[0]].W)) <= 0)
+			{
+				Faces[NumKept++] = Face;
+				continue;
+			}
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const int32 From = Face.Indices[Corner];
+				const int32 To = Face.Indices[Corner == 2 ? 0 : Corner + 1];
+				int32 Shared = INDEX_NONE;
+				for (int32 Edge = 0; Edge < NumEdges; Edge++)
+				{
+					if (Edges[Edge][0] == To && Edges[Edge][1] == From)
+					{
+						Shared = Edge;
+						break;
+					}
+				}
+				if (Shared != INDEX_NONE)
+				{
+					NumEdges--;
+					Edges[Shared][0] = Edges[NumEdges][0];
+					Edges[Shared][1] = Edges[NumEdges][1];
+				}
+				else if (NumEdges < MaxHorizonEdges)
+				{
+					Edges[NumEdges][0] = From;
+					Edges[NumEdges][1] = To;
+					NumEdges++;
+				}
+				else
+				{
+					bHorizonFull = true;
+				}
+			}
+		}
+		if (bHorizonFull || NumKept + NumEdges > MaxPolytopeFaces || NumEdges == 0)
+		{
+			//the polytope is past its fixed capacity, the faces removed above were copies so stop on the best one
+			NumFaces = NumKept;
+			Best = INDEX_NONE;
+			for (int32 i = 0; i < NumFaces; i++)
+			{
+				if (Best == INDEX_NONE || Faces[i].Distance < Faces[Best].Distance)
+				{
+					Best = i;
+				}
+			}
+			break;
+		}
+		NumFaces = NumKept;
+		const int32 NewIndex = NumVertices++;
+		Vertices[NewIndex] = Vertex;
+		for (int32 Edge = 0; Edge < NumEdges; Edge++)
+		{
+			Faces[NumFaces++] = MakeFace(Vertices, Edges[Edge][0], Edges[Edge][1], NewIndex);
+		}
+	}
+
+	if (Best == INDEX_NONE)
+	{
+		return Iterations;
+	}
+	//the origin projected onto the closest face gives the weights of the deepest points
+	const FPolytopeFace& Closest = Faces[Best];
+	FSimplex Feature;
+	ClosestOnTriangle(Vertices[Closest.Indices[0]], Vertices[Closest.Indices[1]], Vertices[Closest.Indices[2]], Feature);
+	FFixedVector64 CoreA = FFixedVector64::ZeroVector;
+	FFixedVector64 CoreB = FFixedVector64::ZeroVector;
+	for (int32 i = 0; i < Feature.Num; i++)
+	{
+		CoreA += Feature.Vertices[i].A * Feature.Lambdas[i];
+		CoreB += Feature.Vertices[i].B * Feature.Lambdas[i];
+	}
+	OutResult.Normal = Closest.Normal;
+	OutResult.PointA = CoreA + Closest.Normal * A.Radius;
+	OutResult.PointB = CoreB - Closest.Normal * B.Radius;
+	OutResult.Distance = -(Closest.Distance + A.Radius + B.Radius);
+	return Iterations;
+}
+
+FFixedConvexShape FFixedConvexShape::MakeSphere(const FFixedVector64& InCenter, FFixed64 InRadius)
+{
+	FFixedConvexShape Shape;
+	Shape.Type = EFixedConvexShape::Sphere;
+	Shape.Center = InCenter;
+	Shape.Radius = InRadius;
+	return Shape;
+}
+
+FFixedConvexShape FFixedConvexShape::MakeBox(const FFixedVector64& InCenter, const FFixedVector64& Extent, const FFixedQuat64& Rotation)
+{
+	FFixedConvexShape Shape;
+	Shape.Type = EFixedConvexShape::Box;
+	Shape.Center = InCenter;
+	if (Rotation.IsIdentity(FixedPoint::Constants::Fixed64::Zero))
+	{
+		Shape.Axes[0] = FFixedVector64(Extent.X, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero);
+		Shape.Axes[1] = FFixedVector64(FixedPoint::Constants::Fixed64::Zero, Extent.Y, FixedPoint::Constants::Fixed64::Zero);
+		Shape.Axes[2] = FFixedVector64(FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, Extent.Z);
+	}
+	else
+	{
+		Shape.Axes[0] = Rotation.RotateVector(FFixedVector64::XAxisVector) * Extent.X;
+		Shape.Axes[1] = Rotation.RotateVector(FFixedVector64::YAxisVector) * Extent.Y;
+		Shape.Axes[2] = Rotation.RotateVector(FFixedVector64::ZAxisVector) * Extent.Z;
+	}
+	return Shape;
+}
+
+FFixedConvexShape FFixedConvexShape::MakeCapsule(const FFixedVector64& Start, const FFixedVector64& InEnd, FFixed64 InRadius)
+{
+	FFixedConvexShape Shape;
+	Shape.Type = EFixedConvexShape::Capsule;
+	Shape.Center = Start;
+	Shape.End = InEnd;
+	Shape.Radius = InRadius;
+	return Shape;
+}
+
+FFixedConvexShape FFixedConvexShape::MakeHull(TArrayView<const FFixedVector64> InPoints, FFixed64 InRadius)
+{
+	check(InPoints.Num() > 0);
+	FFixedConvexShape Shape;
+	Shape.Type = EFixedConvexShape::Hull;
+	Shape.Points = InPoints;
+	Shape.Center = FFixedBox(InPoints).GetCenter();
+	Shape.Radius = InRadius;
+	return Shape;
+}
+
+FFixedVector64 FFixedConvexShape::Support(const FFixedVector64& Direction) const
+{
+	using namespace FixedPoint::Int128;
+	switch (Type)
+	{
+	case EFixedConvexShape::Box:
+	{
+		FFixedVector64 Result = Center;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			if (Sign(ExactDot(Direction, Axes[Axis])) >= 0)
+			{
+				Result += Axes[Axis];
+			}
+			else
+			{
+				Result -= Axes[Axis];
+			}
+		}
+		return Result;
+	}
+	case EFixedConvexShape::Capsule:
+		return Sign(ExactDot(Direction, End - Center)) > 0 ? End : Center;
+	case EFixedConvexShape::Hull:
+	{
+		int32 BestIndex = 0;
+		FInt128 BestDot = ExactDot(Direction, Points[0]);
+		for (int32 i = 1; i < Points.Num(); i++)
+		{
+			const FInt128 PointDot = ExactDot(Direction, Points[i]);
+			if (Compare(PointDot, BestDot) > 0)
+			{
+				BestDot = PointDot;
+				BestIndex = i;
+			}
+		}
+		return Points[BestIndex];
+	}
+	default:
+		return Center;
+	}
+}
+
+FFixedVector64 FFixedConvexShape::GetCenter() const
+{
+	return Type == EFixedConvexShape::Capsule ? (Center + End) * FixedPoint::Constants::Fixed64::Half : Center;
+}
+
+bool FFixedGJK::Intersect(const FFixedConvexShape& A, const FFixedConvexShape& B, FFixedGJKCache* Cache)
+{
+	FSimplex Simplex;
+	FFixedVector64 V;
+	int32 Iterations;
+	if (RunGJK(A, B, Cache, true, Simplex, V, Iterations))
+	{
+		return true;
+	}
+	const FFixed64 RadiusSum = A.Radius + B.Radius;
+	return FixedPoint::Int128::Compare(FixedPoint::Int128::Mul(RadiusSum.Value, RadiusSum.Value), ExactDot(V, V)) >= 0;
+}
+
+bool FFixedGJK::ComputeDistance(const FFixedConvexShape& A, const FFixedConvexShape& B, FFixedGJKResult& OutResult, FFixedGJKCache* Cache)
+{
+	FSimplex Simplex;
+	FFixedVector64 V;
+	if (RunGJK(A, B, Cache, false, Simplex, V, OutResult.Iterations))
+	{
+		OutResult.Normal = FFixedVector64::ZeroVector;
+		OutResult.PointA = FFixedVector64::ZeroVector;
+		OutResult.PointB = FFixedVector64::ZeroVector;
+		for (int32 i = 0; i < Simplex.Num && Simplex.Num < 4; i++)
+		{
+			OutResult.PointA += Simplex.Vertices[i].A * Simplex.Lambdas[i];
+			OutResult.PointB += Simplex.Vertices[i].B * Simplex.Lambdas[i];
+		}
+		OutResult.Distance = FixedPoint::Constants::Fixed64::Zero;
+		return false;
+	}
+	SetSeparatedResult(A, B, Simplex, V, OutResult);
+	return OutResult.Distance > FixedPoint::Constants::Fixed64::Zero;
+}
+
+bool FFixedGJK::ComputePenetration(const FFixedConvexShape& A, const FFixedConvexShape& B, FFixedGJKResult& OutResult, FFixedGJKCache* Cache)
+{
+	FSimplex Simplex;
+	FFixedVector64 V;
+	if (!RunGJK(A, B, Cache, false, Simplex, V, OutResult.Iterations))
+	{
+		SetSeparatedResult(A, B, Simplex, V, OutResult);
+		return OutResult.Distance <= FixedPoint::Constants::Fixed64::Zero;
+	}
+
+	if (!ExpandToTetrahedron(A, B, Simplex))
+	{
+		//the cores' difference is flat through the origin, they only touch so the radii are the whole depth
+		const FFixedVector64& Base = Simplex.Vertices[0].W;
+		FFixedVector64 Normal = B.GetCenter() - A.GetCenter();
+		if (Simplex.Num == 3)
+		{
+			Normal = (Simplex.Vertices[1].W - Base) ^ (Simplex.Vertices[2].W - Base);
+		}
+		else if (Simplex.Num == 2)
+		{
+			const FFixedVector64 Edge = Simplex.Vertices[1].W - Base;
+			Normal = Normal - Edge * (Dot(Normal, Edge) / Dot(Edge, Edge));
+		}
+		Normal = FixedPoint::Normal::GetPreciseNormal(Normal);
+		if (Normal.IsZero())
+		{
+			Normal = FFixedVector64::ZAxisVector;
+		}
+		//face from A towards B where the centers say which way that is
+		if (Dot(Normal, B.GetCenter() - A.GetCenter()) < FixedPoint::Constants::Fixed64::Zero)
+		{
+			Normal = -Normal;
+		}
+		OutResult.Normal = Normal;
+		OutResult.PointA = Simplex.Vertices[0].A + Normal * A.Radius;
+		OutResult.PointB = Simplex.Vertices[0].B - Normal * B.Radius;
+		OutResult.Distance = -(A.Radius + B.Radius);
+		return true;
+	}
+	OutResult.Iterations += RunEPA(A, B, Simplex, OutResult);
+	return true;
+}
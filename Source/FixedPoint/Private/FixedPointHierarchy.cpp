@@ -0,0 +1,223 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointHierarchy.h"
+
+bool FFixedHierarchyLevels::Build(TArrayView<const int32> ParentIndices)
+{
+	Reset();
+	const int32 NumNodes = ParentIndices.Num();
+
+	//children of each node packed together, in ascending index order
+	TArray<int32> ChildStarts;
+	ChildStarts.SetNumZeroed(NumNodes + 1);
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		const int32 Parent = ParentIndices[i];
+		if (Parent == INDEX_NONE)
+		{
+			continue;
+		}
+		if (Parent < 0 || Parent >= NumNodes || Parent == i)
+		{
+			return false;
+		}
+		ChildStarts[Parent + 1]++;
+	}
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		ChildStarts[i + 1] += ChildStarts[i];
+	}
+	TArray<int32> Children;
+	Children.SetNumUninitialized(ChildStarts[NumNodes]);
+	TArray<int32> Cursor(ChildStarts.GetData(), NumNodes);
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		if (ParentIndices[i] != INDEX_NONE)
+		{
+			Children[Cursor[ParentIndices[i]]++] = i;
+		}
+	}
+
+	Order.Reserve(NumNodes);
+	SortedParents.Reserve(NumNodes);
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		if (ParentIndices[i] == INDEX_NONE)
+		{
+			Order.Add(i);
+			SortedParents.Add(INDEX_NONE);
+		}
+	}
+
+	int32 LevelStart = 0;
+	while (LevelStart < Order.Num())
+	{
+		const int32 LevelEnd = Order.Num();
+		LevelStarts.Add(LevelStart);
+		for (int32 Sorted = LevelStart; Sorted < LevelEnd; Sorted++)
+		{
+			const int32 Node = Order[Sorted];
+			for (int32 c = ChildStarts[Node]; c < ChildStarts[Node + 1]; c++)
+			{
+				Order.Add(Children[c]);
+				SortedParents.Add(Sorted);
+			}
+		}
+		LevelStart = LevelEnd;
+	}
+	LevelStarts.Add(Order.Num());
+
+	//nodes on a cycle are never reached from a root
+	if (Order.Num() != NumNodes)
+	{
+		Reset();
+		return false;
+	}
+	return true;
+}
+
+int32 FFixedTransformHierarchy::AddNode(const FFixedTransform64& LocalTransform, int32 Parent)
+{
+	check(Parent == INDEX_NONE || Parents.IsValidIndex(Parent));
+	const int32 Index = Parents.Add(Parent);
+	FirstChild.Add(INDEX_NONE);
+	NextSibling.Add(INDEX_NONE);
+	if (Parent != INDEX_NONE)
+	{
+		NextSibling[Index] = FirstChild[Parent];
+		FirstChild[Parent] = Index;
+	}
+	Flags.Add(Changed);
+	LocalTransforms.Add(LocalTransform);
+	WorldTransforms.AddUninitialized();
+	WorldInverses.AddUninitialized();
+	WorldMatrices.AddUninitialized();
+	ChangedNodes.Add(Index);
+	return Index;
+}
+
+void FFixedTransformHierarchy::SetLocalTransform(int32 Index, const FFixedTransform64& LocalTransform)
+{
+	LocalTransforms[Index] = LocalTransform;
+	Invalidate(Index);
+}
+
+void FFixedTransformHierarchy::Invalidate(int32 Index)
+{
+	InvalidateStack.Reset();
+	InvalidateStack.Add(Index);
+	while (InvalidateStack.Num() > 0)
+	{
+		const int32 Node = InvalidateStack.Pop();
+		uint8& NodeFlags = Flags[Node];
+		//an out of date node that is already on the changed list has every descendant in the same state
+		if ((NodeFlags & (WorldValid | Changed)) == Changed)
+		{
+			continue;
+		}
+		if ((NodeFlags & Changed) == 0)
+		{
+			ChangedNodes.Add(Node);
+		}
+		NodeFlags = Changed;
+		for (int32 Child = FirstChild[Node]; Child != INDEX_NONE; Child = NextSibling[Child])
+		{
+			InvalidateStack.Add(Child);
+		}
+	}
+}
+
+const FFixedTransform64& FFixedTransformHierarchy::GetWorldTransform(int32 Index)
+{
+	if ((Flags[Index] & WorldValid) == 0)
+	{
+		//collect the out of date ancestors, then compose them from the top down
+		TArray<int32, TInlineAllocator<32>> Chain;
+		for (int32 Node = Index; Node != INDEX_NONE && (Flags[Node] & WorldValid) == 0; Node = Parents[Node])
+		{
+			Chain.Add(Node);
+		}
+		for (int32 i = Chain.Num() - 1; i >= 0; i--)
+		{
+			const int32 Node = Chain[i];
+			const int32 Parent = Parents[Node];
+			if (Parent == INDEX_NONE)
+			{
+				WorldTransforms[Node] = LocalTransforms[Node];
+			}
+			else
+			{
+				FFixedTransform64::Multiply(&WorldTransforms[Node], &LocalTransforms[Node], &WorldTransforms[Parent]);
+			}
+			Flags[Node] |= WorldValid;
+		}
+	}
+	return WorldTransforms[Index];
+}
+
+const FFixedTransform64& FFixedTransformHierarchy::GetWorldInverse(int32 Index)
+{
+	if ((Flags[Index] & InverseValid) == 0)
+	{
+		WorldInverses[Index] = GetWorldTransform(Index).Inverse();
+		Flags[Index] |= InverseValid;
+	}
+	return WorldInverses[Index];
+}
+
+const FFixedMatrix& FFixedTransformHierarchy::GetWorldMatrix(int32 Index)
+{
+	if ((Flags[Index] & MatrixValid) == 0)
+	{
+		WorldMatrices[Index] = GetWorldTransform(Index).ToMatrixWithScale();
+		Flags[Index] |= MatrixValid;
+	}
+	return WorldMatrices[Index];
+}
+
+void FFixedTransformHierarchy::UpdateWorldTransforms()
+{
+	for (int32 Index = 0; Index < Parents.Num(); Index++)
+	{
+		if ((Flags[Index] & WorldValid) == 0)
+		{
+			GetWorldTransform(Index);
+		}
+	}
+}
+
+void FFixedTransformHierarchy::ResetChanged()
+{
+	for (const int32 Index : ChangedNodes)
+	{
+		Flags[Index] &= ~Changed;
+	}
+	ChangedNodes.Reset();
+}
+
+void FFixedTransformHierarchy::Reserve(int32 Number)
+{
+	Parents.Reserve(Number);
+	FirstChild.Reserve(Number);
+	NextSibling.Reserve(Number);
+	Flags.Reserve(Number);
+	LocalTransforms.Reserve(Number);
+	WorldTransforms.Reserve(Number);
+	WorldInverses.Reserve(Number);
+	WorldMatrices.Reserve(Number);
+}
+
+void FFixedTransformHierarchy::Reset()
+{
+	Parents.Reset();
+	FirstChild.Reset();
+	NextSibling.Reset();
+	Flags.Reset();
+	LocalTransforms.Reset();
+	WorldTransforms.Reset();
+	WorldInverses.Reset();
+	WorldMatrices.Reset();
+	ChangedNodes.Reset();
+}
+
@@ -8,6 +8,7 @@
 #include "FixedPointMath.h"
 #include "FixedPointRotator.h"
 #include "FixedPointRotationMatrix.h"
+#include "FixedPointAffineKernels.h"
 
 const FFixedMatrix FFixedMatrix::Identity(
 	FFixedPlane(FixedPoint::Constants::Fixed64::One, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero),
@@ -32,4 +33,29 @@ FFixedRotator64 FFixedMatrix::Rotator() const
 	Rotator.Roll = FFixedPointMath::Atan2(ZAxis | SYAxis, YAxis | SYAxis) * RadToDeg;
 
 	return Rotator;
-}
\ No newline at end of file
+}
+
+static FixedPoint::Affine::FRawAffine GetRawAffine(const FFixedMatrix& Matrix)
+{
+	FixedPoint::Affine::FRawAffine Raw;
+	for (int32 Row = 0; Row < 4; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			Raw.M[Row][Column] = Matrix.M[Row][Column].Value;
+		}
+	}
+	return Raw;
+}
+
+void FFixedMatrix::TransformPositions(TArrayView<const FFixedVector64> Positions, TArrayView<FFixedVector64> OutPositions, bool bParallel) const
+{
+	check(Positions.Num() == OutPositions.Num());
+	FixedPoint::Affine::TransformArray<true>(GetRawAffine(*this), Positions.GetData(), OutPositions.GetData(), Positions.Num(), bParallel);
+}
+
+void FFixedMatrix::TransformVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel) const
+{
+	check(Vectors.Num() == OutVectors.Num());
+	FixedPoint::Affine::TransformArray<false>(GetRawAffine(*this), Vectors.GetData(), OutVectors.GetData(), Vectors.Num(), bParallel);
+}
@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointMatrix33.h"
+#include "FixedPointTypes.h"
+#include "FixedPointAffineKernels.h"
+
+const FFixedMatrix33 FFixedMatrix33::Identity(
+	FFixedVector64(FixedPoint::Constants::Fixed64::One, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero),
+	FFixedVector64(FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::One, FixedPoint::Constants::Fixed64::Zero),
+	FFixedVector64(FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::One));
+
+void FFixedMatrix33::TransformVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel) const
+{
+	check(Vectors.Num() == OutVectors.Num());
+	FixedPoint::Affine::FRawAffine Raw;
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			Raw.M[Row][Column] = M[Row][Column].Value;
+		}
+		Raw.M[3][Row] = 0;
+	}
+	FixedPoint::Affine::TransformArray<false>(Raw, Vectors.GetData(), OutVectors.GetData(), Vectors.Num(), bParallel);
+}
+
+void FFixedMatrix33::Multiply(TArrayView<FFixedMatrix33> OutMatrices, TArrayView<const FFixedMatrix33> A, TArrayView<const FFixedMatrix33> B, bool bParallel)
+{
+	check(A.Num() == OutMatrices.Num() && B.Num() == OutMatrices.Num());
+	const FFixedMatrix33* APtr = A.GetData();
+	const FFixedMatrix33* BPtr = B.GetData();
+	FFixedMatrix33* OutPtr = OutMatrices.GetData();
+	FixedPoint::Parallel::ForEachRange(OutMatrices.Num(), bParallel, [APtr, BPtr, OutPtr](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			//product is built in a temporary so the output may alias either input
+			const FFixedMatrix33 Product = APtr[i] * BPtr[i];
+			OutPtr[i] = Product;
+		}
+	});
+}
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointMatrix34.h"
+#include "FixedPointTypes.h"
+#include "FixedPointAffineKernels.h"
+
+const FFixedMatrix34 FFixedMatrix34::Identity(
+	FFixedVector64(FixedPoint::Constants::Fixed64::One, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero),
+	FFixedVector64(FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::One, FixedPoint::Constants::Fixed64::Zero),
+	FFixedVector64(FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::One),
+	FFixedVector64(FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero));
+
+static FixedPoint::Affine::FRawAffine GetRawAffine(const FFixedMatrix34& Matrix)
+{
+	FixedPoint::Affine::FRawAffine Raw;
+	for (int32 Row = 0; Row < 4; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			Raw.M[Row][Column] = Matrix.M[Row][Column].Value;
+		}
+	}
+	return Raw;
+}
+
+void FFixedMatrix34::TransformPositions(TArrayView<const FFixedVector64> Positions, TArrayView<FFixedVector64> OutPositions, bool bParallel) const
+{
+	check(Positions.Num() == OutPositions.Num());
+	FixedPoint::Affine::TransformArray<true>(GetRawAffine(*this), Positions.GetData(), OutPositions.GetData(), Positions.Num(), bParallel);
+}
+
+void FFixedMatrix34::TransformVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel) const
+{
+	check(Vectors.Num() == OutVectors.Num());
+	FixedPoint::Affine::TransformArray<false>(GetRawAffine(*this), Vectors.GetData(), OutVectors.GetData(), Vectors.Num(), bParallel);
+}
+
+void FFixedMatrix34::Multiply(TArrayView<FFixedMatrix34> OutMatrices, TArrayView<const FFixedMatrix34> A, TArrayView<const FFixedMatrix34> B, bool bParallel)
+{
+	check(A.Num() == OutMatrices.Num() && B.Num() == OutMatrices.Num());
+	const FFixedMatrix34* APtr = A.GetData();
+	const FFixedMatrix34* BPtr = B.GetData();
+	FFixedMatrix34* OutPtr = OutMatrices.GetData();
+	FixedPoint::Parallel::ForEachRange(OutMatrices.Num(), bParallel, [APtr, BPtr, OutPtr](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			//product is built in a temporary so the output may alias either input
+			const FFixedMatrix34 Product = APtr[i] * BPtr[i];
+			OutPtr[i] = Product;
+		}
+	});
+}
@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointInt128.h"
+
+namespace FixedPoint
+{
+	namespace Normal
+	{
+		//magnitude the largest component is scaled to, three squared components still fit in 63 bits
+		constexpr uint32 ScaledBits = 30;
+
+		/** Divides components already scaled to ScaledBits by their length, rounding each once */
+		FORCEINLINE FFixedVector64 NormalizeScaled(const int64 Scaled[3])
+		{
+			const int64 Length = Int128::SqrtFloor(Int128::Make(Scaled[0] * Scaled[0] + Scaled[1] * Scaled[1] + Scaled[2] * Scaled[2]));
+			int64 Raw[3];
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				//round half away from zero so opposite directions stay exact negatives of each other
+				const int64 Numerator = Scaled[Axis] * ((int64)1 << FixedPoint::Constants::BinaryPoint64);
+				Raw[Axis] = (Numerator + (Numerator < 0 ? -(Length >> 1) : (Length >> 1))) / Length;
+			}
+			return FFixedVector64(FFixed64::MakeFromRawInt(Raw[0]), FFixed64::MakeFromRawInt(Raw[1]), FFixed64::MakeFromRawInt(Raw[2]));
+		}
+
+		/**
+		* Unit direction of V, or zero for the zero vector.
+		* GetSafeNormal's square root keeps 10 fraction bits and its reciprocal loses more as the length grows, so its
+		* directions can be a few thousandths off. Here V is scaled to 30 bits, its length is found with an exact
+		* integer square root and each component is divided by it once, leaving only the final rounding.
+		*/
+		FORCEINLINE FFixedVector64 GetPreciseNormal(const FFixedVector64& V)
+		{
+			const uint64 Largest = (uint64)FMath::Max3(FMath::Abs(V.X.Value), FMath::Abs(V.Y.Value), FMath::Abs(V.Z.Value));
+			if (Largest == 0)
+			{
+				return FFixedVector64::ZeroVector;
+			}
+			const int32 Shift = (int32)ScaledBits - (64 - (int32)FMath::CountLeadingZeros64(Largest));
+			const int64 Raw[3] = { V.X.Value, V.Y.Value, V.Z.Value };
+			int64 Scaled[3];
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				Scaled[Axis] = Shift >= 0 ? Raw[Axis] * ((int64)1 << Shift) : Raw[Axis] / ((int64)1 << -Shift);
+			}
+			return NormalizeScaled(Scaled);
+		}
+
+		/** Unit direction of an exact 128 bit vector such as a cross product of raw coordinates, or zero */
+		FORCEINLINE FFixedVector64 GetPreciseNormal(const FixedPoint::Int128::FInt128 V[3])
+		{
+			using namespace FixedPoint::Int128;
+			const uint32 Bits = FMath::Max3(MagnitudeBits(V[0]), MagnitudeBits(V[1]), MagnitudeBits(V[2]));
+			if (Bits == 0)
+			{
+				return FFixedVector64::ZeroVector;
+			}
+			int64 Scaled[3];
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				if (Bits > ScaledBits)
+				{
+					//shift the magnitude so both signs truncate towards zero
+					const bool bNegative = IsNegative(V[Axis]);
+					const int64 Magnitude = (int64)ShiftRight(bNegative ? Negate(V[Axis]) : V[Axis], Bits - ScaledBits).Lo;
+					Scaled[Axis] = bNegative ? -Magnitude : Magnitude;
+				}
+				else
+				{
+					Scaled[Axis] = (int64)V[Axis].Lo * ((int64)1 << (ScaledBits - Bits));
+				}
+			}
+			return NormalizeScaled(Scaled);
+		}
+	}
+}
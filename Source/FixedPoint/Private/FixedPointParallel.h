@@ -0,0 +1,37 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+
+namespace FixedPoint
+{
+	namespace Parallel
+	{
+		//number of elements each task handles when batch work is split across threads
+		constexpr int32 DefaultBatchSize = 4096;
+
+		/**
+		* Calls Functor(Start, End) over [0, Num), either once on this thread or in fixed size ranges through ParallelFor.
+		* Ranges never depend on the thread count, so as long as each element is independent the result is the same either way.
+		*/
+		template<typename FunctorType>
+		FORCEINLINE void ForEachRange(int32 Num, bool bParallel, FunctorType&& Functor, int32 BatchSize = DefaultBatchSize)
+		{
+			if (bParallel && Num > BatchSize)
+			{
+				const int32 NumBatches = (Num + BatchSize - 1) / BatchSize;
+				ParallelFor(NumBatches, [&Functor, Num, BatchSize](int32 BatchIndex)
+				{
+					const int32 Start = BatchIndex * BatchSize;
+					Functor(Start, FMath::Min(Start + BatchSize, Num));
+				});
+			}
+			else
+			{
+				Functor(0, Num);
+			}
+		}
+	}
+}
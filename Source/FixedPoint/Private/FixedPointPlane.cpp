@@ -0,0 +1,25 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointPlane.h"
+#include "FixedPointTypes.h"
+#include "FixedPointParallel.h"
+
+void FFixedPlane::TransformBy(TArrayView<FFixedPlane> OutPlanes, TArrayView<const FFixedPlane> Planes, const FFixedMatrix& M, bool bParallel)
+{
+	check(OutPlanes.Num() == Planes.Num());
+
+	// shared by every plane, these are the expensive part of TransformBy
+	const FFixedMatrix TA = M.TransposeAdjoint();
+	const FFixed64 DetM = M.Determinant();
+
+	const FFixedPlane* Src = Planes.GetData();
+	FFixedPlane* Dst = OutPlanes.GetData();
+	FixedPoint::Parallel::ForEachRange(Planes.Num(), bParallel, [Src, Dst, &M, &TA, DetM](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			Dst[i] = Src[i].TransformByUsingAdjointT(M, DetM, TA);
+		}
+	});
+}
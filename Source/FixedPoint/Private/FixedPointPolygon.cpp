@@ -0,0 +1,150 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointPolygon.h"
+#include "FixedPointInt128.h"
+
+using FixedPoint::Int128::FInt128;
+
+/** Exact Plane.PlaneDot(P) scaled by one, no product is rounded */
+static FORCEINLINE FInt128 ExactPlaneDot(const FFixedPlane& Plane, const FFixedVector64& P)
+{
+	using namespace FixedPoint::Int128;
+	return Sub(Add(Add(Mul(Plane.X.Value, P.X.Value), Mul(Plane.Y.Value, P.Y.Value)), Mul(Plane.Z.Value, P.Z.Value)), Mul(Plane.W.Value, FixedPoint::Constants::Raw64::One));
+}
+
+/** Appends V to the polygon being built unless it repeats the previous vertex, cuts can land exactly on a vertex */
+static FORCEINLINE void AddPolygonVertex(TArray<FFixedVector64>& Vertices, int32 PolygonStart, const FFixedVector64& V)
+{
+	if (Vertices.Num() == PolygonStart || Vertices.Last() != V)
+	{
+		Vertices.Add(V);
+	}
+}
+
+static FORCEINLINE void FinishPolygon(TArray<FFixedVector64>& Vertices, int32 PolygonStart)
+{
+	if (Vertices.Num() - PolygonStart > 1 && Vertices.Last() == Vertices[PolygonStart])
+	{
+		Vertices.Pop();
+	}
+}
+
+int32 FFixedPolygonArena::Add(TArrayView<const FFixedVector64> Polygon)
+{
+	Vertices.Append(Polygon.GetData(), Polygon.Num());
+	return Starts.Add(Vertices.Num() - Polygon.Num());
+}
+
+void FFixedPolygonArena::Reserve(int32 NumPolygons, int32 InNumVertices)
+{
+	Starts.Reserve(NumPolygons);
+	Vertices.Reserve(InNumVertices);
+}
+
+void FFixedPolygonArena::Reset()
+{
+	Starts.Reset();
+	Vertices.Reset();
+}
+
+EFixedPolygonSplit FFixedPolygonArena::SplitWithPlane(TArrayView<const FFixedVector64> Polygon, const FFixedPlane& Plane, FFixedPolygonArena& OutFront, FFixedPolygonArena& OutBack, bool bVeryPrecise)
+{
+	using namespace FixedPoint::Int128;
+	const int64 Thresh = bVeryPrecise ? FixedPoint::Constants::Raw64::ThreshSplitPolyPrecisely : FixedPoint::Constants::Raw64::ThreshSplitPolyWithPlane;
+	const FInt128 FrontThreshold = Mul(Thresh, FixedPoint::Constants::Raw64::One);
+	const FInt128 BackThreshold = Negate(FrontThreshold);
+
+	const int32 NumVerts = Polygon.Num();
+	TArray<FInt128, TInlineAllocator<16>> Distances;
+	TArray<int8, TInlineAllocator<16>> Sides;
+	Distances.SetNumUninitialized(NumVerts);
+	Sides.SetNumUninitialized(NumVerts);
+	int32 NumFront = 0;
+	int32 NumBack = 0;
+	for (int32 i = 0; i < NumVerts; i++)
+	{
+		Distances[i] = ExactPlaneDot(Plane, Polygon[i]);
+		Sides[i] = Compare(Distances[i], FrontThreshold) > 0 ? 1 : (Compare(Distances[i], BackThreshold) < 0 ? -1 : 0);
+		NumFront += Sides[i] > 0;
+		NumBack += Sides[i] < 0;
+	}
+
+	if (NumFront == 0)
+	{
+		return NumBack == 0 ? EFixedPolygonSplit::Coplanar : EFixedPolygonSplit::Back;
+	}
+	if (NumBack == 0)
+	{
+		return EFixedPolygonSplit::Front;
+	}
+
+	const int32 FrontStart = OutFront.Vertices.Num();
+	const int32 BackStart = OutBack.Vertices.Num();
+	for (int32 i = 0; i < NumVerts; i++)
+	{
+		const int32 j = i + 1 < NumVerts ? i + 1 : 0;
+		if (Sides[i] >= 0)
+		{
+			AddPolygonVertex(OutFront.Vertices, FrontStart, Polygon[i]);
+		}
+		if (Sides[i] <= 0)
+		{
+			AddPolygonVertex(OutBack.Vertices, BackStart, Polygon[i]);
+		}
+		if (Sides[i] * Sides[j] < 0)
+		{
+			//the distances have opposite signs so the fraction is within [0, 1]
+			const FInt128 Span = Sub(Distances[i], Distances[j]);
+			const FFixedVector64& A = Polygon[i];
+			const FFixedVector64& B = Polygon[j];
+			const FFixedVector64 Cut(
+				FFixed64::MakeFromRawInt(A.X.Value + MulDivTruncate(B.X.Value - A.X.Value, Distances[i], Span)),
+				FFixed64::MakeFromRawInt(A.Y.Value + MulDivTruncate(B.Y.Value - A.Y.Value, Distances[i], Span)),
+				FFixed64::MakeFromRawInt(A.Z.Value + MulDivTruncate(B.Z.Value - A.Z.Value, Distances[i], Span)));
+			AddPolygonVertex(OutFront.Vertices, FrontStart, Cut);
+			AddPolygonVertex(OutBack.Vertices, BackStart, Cut);
+		}
+	}
+	FinishPolygon(OutFront.Vertices, FrontStart);
+	FinishPolygon(OutBack.Vertices, BackStart);
+	OutFront.Starts.Add(FrontStart);
+	OutBack.Starts.Add(BackStart);
+	return EFixedPolygonSplit::Split;
+}
+
+bool FFixedPolygonArena::IsOnPlane(TArrayView<const FFixedVector64> Polygon, const FFixedPlane& Plane)
+{
+	using namespace FixedPoint::Int128;
+	const FInt128 Threshold = Mul(FixedPoint::Constants::Raw64::ThreshPointOnPlane, FixedPoint::Constants::Raw64::One);
+	for (const FFixedVector64& Vertex : Polygon)
+	{
+		const FInt128 Distance = ExactPlaneDot(Plane, Vertex);
+		if (Compare(IsNegative(Distance) ? Negate(Distance) : Distance, Threshold) > 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FFixedPolygonArena::SplitAllWithPlane(const FFixedPlane& Plane, FFixedPolygonArena& OutFront, FFixedPolygonArena& OutBack, bool bVeryPrecise) const
+{
+	check(&OutFront != this && &OutBack != this);
+	for (int32 i = 0; i < Num(); i++)
+	{
+		const TArrayView<const FFixedVector64> Polygon = GetPolygon(i);
+		switch (SplitWithPlane(Polygon, Plane, OutFront, OutBack, bVeryPrecise))
+		{
+		case EFixedPolygonSplit::Coplanar:
+		case EFixedPolygonSplit::Front:
+			OutFront.Add(Polygon);
+			break;
+		case EFixedPolygonSplit::Back:
+			OutBack.Add(Polygon);
+			break;
+		default:
+			break;
+		}
+	}
+}
@@ -0,0 +1,880 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointPolygon2D.h"
+#include "FixedPointInt128.h"
+#include "FixedPointTypes.h"
+#include "Misc/MemStack.h"
+
+using FixedPoint::Int128::FInt128;
+
+template<typename ElementType>
+using TScratchArray = TArray<ElementType, TMemStackAllocator<>>;
+
+//cos(45 degrees) in raw FFixed64, the diagonal corners of the octagons that round offset joins
+static constexpr int64 RawCos45 = 741455;
+
+namespace
+{
+	/** Raw coordinates, all predicates work on these directly */
+	struct FPoint
+	{
+		int64 X;
+		int64 Y;
+
+		FORCEINLINE bool operator==(const FPoint& Other) const
+		{
+			return X == Other.X && Y == Other.Y;
+		}
+
+		FORCEINLINE bool operator!=(const FPoint& Other) const
+		{
+			return X != Other.X || Y != Other.Y;
+		}
+
+		FORCEINLINE bool operator<(const FPoint& Other) const
+		{
+			return X < Other.X || (X == Other.X && Y < Other.Y);
+		}
+	};
+
+	struct FEdge
+	{
+		FPoint A;
+		FPoint B;
+		int64 MinX;
+		int64 MaxX;
+		int64 MinY;
+		int64 MaxY;
+		int32 Set;
+	};
+
+	/** A point an edge is cut at, Key is its exact projection onto the edge */
+	struct FSplit
+	{
+		int32 Edge;
+		FPoint P;
+		FInt128 Key;
+	};
+
+	/** Piece of an input edge between cuts, Lo and Hi are its ends in sorted order so coincident pieces share them */
+	struct FFragment
+	{
+		FPoint S;
+		FPoint E;
+		FPoint Lo;
+		FPoint Hi;
+		int32 Set;
+		int32 Group;
+	};
+
+	/** Coincident fragments, Right is each set's winding on its right looking from Lo to Hi */
+	struct FGroup
+	{
+		FPoint Lo;
+		FPoint Hi;
+		int32 Crossings[2];
+		int32 Right[2];
+		bool bKnown;
+	};
+
+	/** One end of a group, with the direction the group leaves that end in */
+	struct FGroupEnd
+	{
+		FPoint At;
+		int64 DX;
+		int64 DY;
+		int32 Group;
+		bool bAtLo;
+	};
+
+	struct FOutputEdge
+	{
+		FPoint S;
+		FPoint E;
+	};
+}
+
+static FORCEINLINE FInt128 Cross(int64 UX, int64 UY, int64 VX, int64 VY)
+{
+	using namespace FixedPoint::Int128;
+	return Sub(Mul(UX, VY), Mul(UY, VX));
+}
+
+static FORCEINLINE FInt128 Dot(int64 UX, int64 UY, int64 VX, int64 VY)
+{
+	using namespace FixedPoint::Int128;
+	return Add(Mul(UX, VX), Mul(UY, VY));
+}
+
+/** @return 1 if C is left of the line from A to B, -1 if right and 0 if on it */
+static FORCEINLINE int32 Orient(const FPoint& A, const FPoint& B, const FPoint& C)
+{
+	return FixedPoint::Int128::Sign(Cross(B.X - A.X, B.Y - A.Y, C.X - A.X, C.Y - A.Y));
+}
+
+/** @return true if P, already known to be on the line through A and B, lies strictly between them */
+static FORCEINLINE bool IsStrictlyBetween(const FPoint& A, const FPoint& B, const FPoint& P)
+{
+	using namespace FixedPoint::Int128;
+	return P != A && P != B && Sign(Dot(P.X - A.X, P.Y - A.Y, B.X - A.X, B.Y - A.Y)) > 0 && Sign(Dot(P.X - B.X, P.Y - B.Y, A.X - B.X, A.Y - B.Y)) > 0;
+}
+
+static FORCEINLINE FPoint ToPoint(const FFixedVector2d& V)
+{
+	return FPoint{ V.X.Value, V.Y.Value };
+}
+
+static FORCEINLINE FFixedVector2d ToVector(const FPoint& P)
+{
+	return FFixedVector2d(FFixed64::MakeFromRawInt(P.X), FFixed64::MakeFromRawInt(P.Y));
+}
+
+static FORCEINLINE bool IsInsideResult(EFixedPolygonBoolean Operation, bool bInsideA, bool bInsideB)
+{
+	switch (Operation)
+	{
+	case EFixedPolygonBoolean::Union:
+		return bInsideA || bInsideB;
+	case EFixedPolygonBoolean::Intersection:
+		return bInsideA && bInsideB;
+	default:
+		return bInsideA && !bInsideB;
+	}
+}
+
+static void GatherEdges(const FFixedPolygonArena2D& Arena, int32 Set, TScratchArray<FEdge>& OutEdges)
+{
+	for (int32 PolygonIndex = 0; PolygonIndex < Arena.Num(); PolygonIndex++)
+	{
+		const TArrayView<const FFixedVector2d> Polygon = Arena.GetPolygon(PolygonIndex);
+		for (int32 i = 0; i < Polygon.Num(); i++)
+		{
+			const FPoint A = ToPoint(Polygon[i]);
+			const FPoint B = ToPoint(Polygon[i + 1 < Polygon.Num() ? i + 1 : 0]);
+			if (A != B)
+			{
+				OutEdges.Add(FEdge{ A, B, FMath::Min(A.X, B.X), FMath::Max(A.X, B.X), FMath::Min(A.Y, B.Y), FMath::Max(A.Y, B.Y), Set });
+			}
+		}
+	}
+}
+
+static FORCEINLINE void AddSplit(const TScratchArray<FEdge>& Edges, int32 EdgeIndex, const FPoint& P, TScratchArray<FSplit>& OutSplits)
+{
+	const FEdge& Edge = Edges[EdgeIndex];
+	OutSplits.Add(FSplit{ EdgeIndex, P, Dot(P.X - Edge.A.X, P.Y - Edge.A.Y, Edge.B.X - Edge.A.X, Edge.B.Y - Edge.A.Y) });
+}
+
+/** Cuts both edges where they cross, or where an end of one touches the other */
+static void IntersectEdges(const TScratchArray<FEdge>& Edges, int32 First, int32 Second, TScratchArray<FSplit>& OutSplits)
+{
+	const FPoint& A = Edges[First].A;
+	const FPoint& B = Edges[First].B;
+	const FPoint& C = Edges[Second].A;
+	const FPoint& D = Edges[Second].B;
+	const int32 C_AB = Orient(A, B, C);
+	const int32 D_AB = Orient(A, B, D);
+	const int32 A_CD = Orient(C, D, A);
+	const int32 B_CD = Orient(C, D, B);
+
+	if (C_AB * D_AB < 0 && A_CD * B_CD < 0)
+	{
+		//proper crossing, the only place a new point is made, it is rounded once and shared by both edges
+		const FInt128 Num = Cross(C.X - A.X, C.Y - A.Y, D.X - C.X, D.Y - C.Y);
+		const FInt128 Den = Cross(B.X - A.X, B.Y - A.Y, D.X - C.X, D.Y - C.Y);
+		const FPoint P{ A.X + FixedPoint::Int128::MulDivTruncate(B.X - A.X, Num, Den), A.Y + FixedPoint::Int128::MulDivTruncate(B.Y - A.Y, Num, Den) };
+		AddSplit(Edges, First, P, OutSplits);
+		AddSplit(Edges, Second, P, OutSplits);
+		return;
+	}
+
+	//touching ends cut the other edge at an existing vertex, which also makes overlapping collinear edges share pieces
+	if (C_AB == 0 && IsStrictlyBetween(A, B, C))
+	{
+		AddSplit(Edges, First, C, OutSplits);
+	}
+	if (D_AB == 0 && IsStrictlyBetween(A, B, D))
+	{
+		AddSplit(Edges, First, D, OutSplits);
+	}
+	if (A_CD == 0 && IsStrictlyBetween(C, D, A))
+	{
+		AddSplit(Edges, Second, A, OutSplits);
+	}
+	if (B_CD == 0 && IsStrictlyBetween(C, D, B))
+	{
+		AddSplit(Edges, Second, B, OutSplits);
+	}
+}
+
+namespace
+{
+	/** Fragment as the winding rays read it, doubled so it compares exactly against doubled midpoints */
+	struct FRayFragment
+	{
+		FPoint P;
+		FPoint Q;
+		int32 Set;
+		int32 Group;
+	};
+
+	/**
+	* Fragments bucketed into slabs along one axis by their doubled coordinate range, so a ray along the other axis
+	* only tests the fragments whose range can reach it. Each slab is sorted by the fragments' lower bound on the
+	* ray's axis, rays run towards negative values so a query stops at the first fragment starting past the ray.
+	*/
+	struct FSlabIndex
+	{
+		int64 Min = 0;
+		int64 Width = 1;
+		int32 NumSlabs = 1;
+		bool bXAxis = true;
+		TScratchArray<FRayFragment> Fragments;
+		TScratchArray<int32> Starts;
+		TScratchArray<int32> Items;
+
+		FORCEINLINE int64 Lower(const FRayFragment& Fragment) const
+		{
+			return bXAxis ? FMath::Min(Fragment.P.X, Fragment.Q.X) : FMath::Min(Fragment.P.Y, Fragment.Q.Y);
+		}
+
+		FORCEINLINE int64 Upper(const FRayFragment& Fragment) const
+		{
+			return bXAxis ? FMath::Max(Fragment.P.X, Fragment.Q.X) : FMath::Max(Fragment.P.Y, Fragment.Q.Y);
+		}
+
+		FORCEINLINE int64 RayLower(const FRayFragment& Fragment) const
+		{
+			return bXAxis ? FMath::Min(Fragment.P.Y, Fragment.Q.Y) : FMath::Min(Fragment.P.X, Fragment.Q.X);
+		}
+
+		void Build(const TScratchArray<FFragment>& InFragments, bool bInXAxis)
+		{
+			bXAxis = bInXAxis;
+			Fragments.SetNumUninitialized(InFragments.Num());
+			for (int32 i = 0; i < InFragments.Num(); i++)
+			{
+				const FFragment& Fragment = InFragments[i];
+				Fragments[i] = FRayFragment{ FPoint{ Fragment.S.X * 2, Fragment.S.Y * 2 }, FPoint{ Fragment.E.X * 2, Fragment.E.Y * 2 }, Fragment.Set, Fragment.Group };
+			}
+			//sorted along the ray's axis, so filling the slabs in order leaves each one sorted too
+			Fragments.Sort([this](const FRayFragment& First, const FRayFragment& Second)
+			{
+				return RayLower(First) < RayLower(Second);
+			});
+
+			int64 Max = 0;
+			for (int32 i = 0; i < Fragments.Num(); i++)
+			{
+				Min = i == 0 ? Lower(Fragments[i]) : FMath::Min(Min, Lower(Fragments[i]));
+				Max = i == 0 ? Upper(Fragments[i]) : FMath::Max(Max, Upper(Fragments[i]));
+			}
+			NumSlabs = FMath::Clamp((int32)FMath::Sqrt((float)Fragments.Num()) * 2, 1, MaxSlabs);
+			Width = (Max - Min) / NumSlabs + 1;
+
+			//counting sort of fragments into every slab their range touches
+			Starts.SetNumZeroed(NumSlabs + 1);
+			for (const FRayFragment& Fragment : Fragments)
+			{
+				for (int32 Slab = GetSlab(Lower(Fragment)); Slab <= GetSlab(Upper(Fragment)); Slab++)
+				{
+					Starts[Slab + 1]++;
+				}
+			}
+			for (int32 Slab = 0; Slab < NumSlabs; Slab++)
+			{
+				Starts[Slab + 1] += Starts[Slab];
+			}
+			Items.SetNumUninitialized(Starts[NumSlabs]);
+			TScratchArray<int32> Next;
+			Next.Append(Starts.GetData(), NumSlabs);
+			for (int32 i = 0; i < Fragments.Num(); i++)
+			{
+				for (int32 Slab = GetSlab(Lower(Fragments[i])); Slab <= GetSlab(Upper(Fragments[i])); Slab++)
+				{
+					Items[Next[Slab]++] = i;
+				}
+			}
+		}
+
+		FORCEINLINE TArrayView<const int32> Query(int64 Coordinate) const
+		{
+			const int32 Slab = GetSlab(Coordinate);
+			return TArrayView<const int32>(Items.GetData() + Starts[Slab], Starts[Slab + 1] - Starts[Slab]);
+		}
+
+		FORCEINLINE int32 GetSlab(int64 Coordinate) const
+		{
+			return (int32)((Coordinate - Min) / Width);
+		}
+
+		//only one ray is cast per connected outline, so slabs stay coarse and cheap to fill
+		static constexpr int32 MaxSlabs = 4096;
+	};
+}
+
+/**
+* Winding number of each set just off a group of coincident fragments, on the side a ray from the doubled midpoint M2
+* leaves towards negative y, or negative x when the group is vertical. Fragments in the group lie on the ray's start
+* line and are skipped, every other fragment crossing the ray adds one when crossing it right to left.
+* @return true if the ray left on the group's right side
+*/
+static bool WindingBelowGroup(const FSlabIndex& SlabsX, const FSlabIndex& SlabsY, int32 Group, const FPoint& M2, int64 DX, int64 DY, int32 OutWinding[2])
+{
+	OutWinding[0] = 0;
+	OutWinding[1] = 0;
+	const bool bVerticalRay = DX != 0;
+	const FSlabIndex& Slabs = bVerticalRay ? SlabsX : SlabsY;
+	const int64 RayStart = bVerticalRay ? M2.Y : M2.X;
+	for (const int32 FragmentIndex : Slabs.Query(bVerticalRay ? M2.X : M2.Y))
+	{
+		const FRayFragment& Fragment = Slabs.Fragments[FragmentIndex];
+		if (Slabs.RayLower(Fragment) > RayStart)
+		{
+			break;
+		}
+		if (Fragment.Group == Group)
+		{
+			continue;
+		}
+		//which side of the ray's line each end is on, ends on the line count as left
+		const FPoint& P = Fragment.P;
+		const FPoint& Q = Fragment.Q;
+		const bool bPLeft = bVerticalRay ? P.X >= M2.X : P.Y <= M2.Y;
+		const bool bQLeft = bVerticalRay ? Q.X >= M2.X : Q.Y <= M2.Y;
+		if (bPLeft == bQLeft)
+		{
+			continue;
+		}
+		const int32 Side = Orient(P, Q, M2);
+		if (!bPLeft && Side > 0)
+		{
+			OutWinding[Fragment.Set]++;
+		}
+		else if (bPLeft && Side < 0)
+		{
+			OutWinding[Fragment.Set]--;
+		}
+	}
+	//a downward ray is on the right of a group heading to positive x, a ray to negative x is right of a group heading down
+	return bVerticalRay ? DX > 0 : DY < 0;
+}
+
+/** @return 0 if V is within [0, 180) degrees counter clockwise of Ref, 1 if within [180, 360) */
+static FORCEINLINE int32 AngleHalf(int64 RefX, int64 RefY, int64 VX, int64 VY)
+{
+	using namespace FixedPoint::Int128;
+	const int32 CrossSign = Sign(Cross(RefX, RefY, VX, VY));
+	return CrossSign > 0 || (CrossSign == 0 && Sign(Dot(RefX, RefY, VX, VY)) > 0) ? 0 : 1;
+}
+
+/** @return 0 for directions within [0, 180) degrees of positive x, 1 for [180, 360) */
+static FORCEINLINE int32 DirectionHalf(int64 X, int64 Y)
+{
+	return Y < 0 || (Y == 0 && X < 0) ? 1 : 0;
+}
+
+/** Sets a group's windings from what is known just right of one of its ends' outgoing direction */
+static FORCEINLINE void SetFromRightOfEnd(FGroup& Group, bool bAtLo, const int32 Winding[2])
+{
+	for (int32 Set = 0; Set < 2; Set++)
+	{
+		Group.Right[Set] = bAtLo ? Winding[Set] : Winding[Set] - Group.Crossings[Set];
+	}
+	Group.bKnown = true;
+}
+
+/** Sets a group's windings from what is known just left of one of its ends' outgoing direction */
+static FORCEINLINE void SetFromLeftOfEnd(FGroup& Group, bool bAtLo, const int32 Winding[2])
+{
+	for (int32 Set = 0; Set < 2; Set++)
+	{
+		Group.Right[Set] = bAtLo ? Winding[Set] - Group.Crossings[Set] : Winding[Set];
+	}
+	Group.bKnown = true;
+}
+
+/** Appends a closed ring, dropping vertices where the outline runs straight on */
+static void EmitRing(TScratchArray<FPoint>& Ring, FFixedPolygonArena2D& Out)
+{
+	TScratchArray<FPoint> Clean;
+	Clean.Reserve(Ring.Num());
+	for (const FPoint& P : Ring)
+	{
+		Clean.Add(P);
+		while (Clean.Num() >= 3 && Orient(Clean[Clean.Num() - 3], Clean[Clean.Num() - 2], Clean.Last()) == 0)
+		{
+			Clean.RemoveAt(Clean.Num() - 2);
+		}
+	}
+	while (Clean.Num() >= 3 && Orient(Clean[Clean.Num() - 2], Clean.Last(), Clean[0]) == 0)
+	{
+		Clean.Pop();
+	}
+	while (Clean.Num() >= 3 && Orient(Clean.Last(), Clean[0], Clean[1]) == 0)
+	{
+		Clean.RemoveAt(0);
+	}
+	if (Clean.Num() < 3)
+	{
+		return;
+	}
+
+	TArray<FFixedVector2d, TMemStackAllocator<>> Vertices;
+	Vertices.SetNumUninitialized(Clean.Num());
+	for (int32 i = 0; i < Clean.Num(); i++)
+	{
+		Vertices[i] = ToVector(Clean[i]);
+	}
+	Out.Add(Vertices);
+}
+
+int32 FFixedPolygonArena2D::Add(TArrayView<const FFixedVector2d> Polygon)
+{
+	Vertices.Append(Polygon.GetData(), Polygon.Num());
+	return Starts.Add(Vertices.Num() - Polygon.Num());
+}
+
+void FFixedPolygonArena2D::Append(const FFixedPolygonArena2D& Other)
+{
+	for (int32 i = 0; i < Other.Num(); i++)
+	{
+		Add(Other.GetPolygon(i));
+	}
+}
+
+void FFixedPolygonArena2D::Reserve(int32 NumPolygons, int32 InNumVertices)
+{
+	Starts.Reserve(NumPolygons);
+	Vertices.Reserve(InNumVertices);
+}
+
+void FFixedPolygonArena2D::Reset()
+{
+	Starts.Reset();
+	Vertices.Reset();
+}
+
+FFixed64 FFixedPolygonArena2D::GetArea() const
+{
+	FInt128 TwiceArea = FixedPoint::Int128::Make(0);
+	for (int32 PolygonIndex = 0; PolygonIndex < Num(); PolygonIndex++)
+	{
+		const TArrayView<const FFixedVector2d> Polygon = GetPolygon(PolygonIndex);
+		for (int32 i = 0; i < Polygon.Num(); i++)
+		{
+			const FFixedVector2d& A = Polygon[i];
+			const FFixedVector2d& B = Polygon[i + 1 < Polygon.Num() ? i + 1 : 0];
+			TwiceArea = FixedPoint::Int128::Add(TwiceArea, Cross(A.X.Value, A.Y.Value, B.X.Value, B.Y.Value));
+		}
+	}
+	//halve and drop the binary point in one rounding
+	return FFixed64::MakeFromRawInt(FixedPoint::Int128::ShiftRightTruncate(TwiceArea, FixedPoint::Constants::BinaryPoint64 + 1));
+}
+
+bool FFixedPolygonArena2D::IsPointInside(const FFixedVector2d& InP) const
+{
+	const FPoint P = ToPoint(InP);
+	int32 Winding = 0;
+	for (int32 PolygonIndex = 0; PolygonIndex < Num(); PolygonIndex++)
+	{
+		const TArrayView<const FFixedVector2d> Polygon = GetPolygon(PolygonIndex);
+		for (int32 i = 0; i < Polygon.Num(); i++)
+		{
+			const FPoint A = ToPoint(Polygon[i]);
+			const FPoint B = ToPoint(Polygon[i + 1 < Polygon.Num() ? i + 1 : 0]);
+			if (A.Y <= P.Y)
+			{
+				if (B.Y > P.Y && Orient(A, B, P) > 0)
+				{
+					Winding++;
+				}
+			}
+			else if (B.Y <= P.Y && Orient(A, B, P) < 0)
+			{
+				Winding--;
+			}
+		}
+	}
+	return Winding > 0;
+}
+
+void FFixedPolygonArena2D::Boolean(const FFixedPolygonArena2D& A, const FFixedPolygonArena2D& B, EFixedPolygonBoolean Operation, FFixedPolygonArena2D& Out)
+{
+	using namespace FixedPoint::Int128;
+	check(&Out != &A && &Out != &B);
+	FMemMark Mark(FMemStack::Get());
+
+	TScratchArray<FEdge> Edges;
+	Edges.Reserve(A.NumVertices() + B.NumVertices());
+	GatherEdges(A, 0, Edges);
+	GatherEdges(B, 1, Edges);
+	const int32 NumEdges = Edges.Num();
+
+	//sweep along x so only edges with overlapping x ranges are tested against each other
+	TScratchArray<int32> ByMinX;
+	ByMinX.SetNumUninitialized(NumEdges);
+	for (int32 i = 0; i < NumEdges; i++)
+	{
+		ByMinX[i] = i;
+	}
+	ByMinX.Sort([&Edges](int32 First, int32 Second)
+	{
+		return Edges[First].MinX < Edges[Second].MinX || (Edges[First].MinX == Edges[Second].MinX && First < Second);
+	});
+	TScratchArray<FSplit> Splits;
+	for (int32 i = 0; i < NumEdges; i++)
+	{
+		const FEdge& Edge = Edges[ByMinX[i]];
+		for (int32 j = i + 1; j < NumEdges && Edges[ByMinX[j]].MinX <= Edge.MaxX; j++)
+		{
+			const FEdge& Other = Edges[ByMinX[j]];
+			if (Other.MinY <= Edge.MaxY && Edge.MinY <= Other.MaxY)
+			{
+				IntersectEdges(Edges, ByMinX[i], ByMinX[j], Splits);
+			}
+		}
+	}
+
+	//cut every edge into fragments in order along it
+	Splits.Sort([](const FSplit& First, const FSplit& Second)
+	{
+		if (First.Edge != Second.Edge)
+		{
+			return First.Edge < Second.Edge;
+		}
+		const int32 KeyOrder = Compare(First.Key, Second.Key);
+		return KeyOrder != 0 ? KeyOrder < 0 : First.P < Second.P;
+	});
+	TScratchArray<FFragment> Fragments;
+	Fragments.Reserve(NumEdges + Splits.Num());
+	auto AddFragment = [&Fragments](const FPoint& S, const FPoint& E, int32 Set)
+	{
+		const bool bForward = S < E;
+		Fragments.Add(FFragment{ S, E, bForward ? S : E, bForward ? E : S, Set, INDEX_NONE });
+	};
+	int32 SplitIndex = 0;
+	for (int32 EdgeIndex = 0; EdgeIndex < NumEdges; EdgeIndex++)
+	{
+		const FEdge& Edge = Edges[EdgeIndex];
+		const FInt128 LengthSquared = Dot(Edge.B.X - Edge.A.X, Edge.B.Y - Edge.A.Y, Edge.B.X - Edge.A.X, Edge.B.Y - Edge.A.Y);
+		FPoint Previous = Edge.A;
+		for (; SplitIndex < Splits.Num() && Splits[SplitIndex].Edge == EdgeIndex; SplitIndex++)
+		{
+			//a rounded crossing can land on or just past an end, those add nothing
+			const FSplit& Split = Splits[SplitIndex];
+			if (Sign(Split.Key) > 0 && Compare(Split.Key, LengthSquared) < 0 && Split.P != Previous && Split.P != Edge.B)
+			{
+				AddFragment(Previous, Split.P, Edge.Set);
+				Previous = Split.P;
+			}
+		}
+		AddFragment(Previous, Edge.B, Edge.Set);
+	}
+
+	//coincident fragments from either input form one group, classified once
+	TScratchArray<int32> ByEnds;
+	ByEnds.SetNumUninitialized(Fragments.Num());
+	for (int32 i = 0; i < Fragments.Num(); i++)
+	{
+		ByEnds[i] = i;
+	}
+	ByEnds.Sort([&Fragments](int32 First, int32 Second)
+	{
+		const FFragment& F = Fragments[First];
+		const FFragment& S = Fragments[Second];
+		if (F.Lo != S.Lo)
+		{
+			return F.Lo < S.Lo;
+		}
+		if (F.Hi != S.Hi)
+		{
+			return F.Hi < S.Hi;
+		}
+		return First < Second;
+	});
+	TScratchArray<int32> GroupStarts;
+	for (int32 i = 0; i < ByEnds.Num(); i++)
+	{
+		FFragment& Fragment = Fragments[ByEnds[i]];
+		if (i == 0 || Fragment.Lo != Fragments[ByEnds[i - 1]].Lo || Fragment.Hi != Fragments[ByEnds[i - 1]].Hi)
+		{
+			GroupStarts.Add(i);
+		}
+		Fragment.Group = GroupStarts.Num() - 1;
+	}
+
+	TScratchArray<FGroup> Groups;
+	Groups.SetNumUninitialized(GroupStarts.Num());
+	for (int32 Group = 0; Group < GroupStarts.Num(); Group++)
+	{
+		const int32 First = GroupStarts[Group];
+		const int32 Last = Group + 1 < GroupStarts.Num() ? GroupStarts[Group + 1] : ByEnds.Num();
+		FGroup& Info = Groups[Group];
+		Info.Lo = Fragments[ByEnds[First]].Lo;
+		Info.Hi = Fragments[ByEnds[First]].Hi;
+		Info.bKnown = false;
+		//crossing an edge from its right to its left raises that set's winding by one
+		Info.Crossings[0] = 0;
+		Info.Crossings[1] = 0;
+		for (int32 i = First; i < Last; i++)
+		{
+			const FFragment& Fragment = Fragments[ByEnds[i]];
+			Info.Crossings[Fragment.Set] += Fragment.S == Info.Lo ? 1 : -1;
+		}
+	}
+
+	//group ends around each vertex in counter clockwise order, the wedge between neighbours is a single face
+	TScratchArray<FGroupEnd> Ends;
+	Ends.SetNumUninitialized(Groups.Num() * 2);
+	for (int32 Group = 0; Group < Groups.Num(); Group++)
+	{
+		const FGroup& Info = Groups[Group];
+		Ends[Group * 2] = FGroupEnd{ Info.Lo, Info.Hi.X - Info.Lo.X, Info.Hi.Y - Info.Lo.Y, Group, true };
+		Ends[Group * 2 + 1] = FGroupEnd{ Info.Hi, Info.Lo.X - Info.Hi.X, Info.Lo.Y - Info.Hi.Y, Group, false };
+	}
+	Ends.Sort([](const FGroupEnd& First, const FGroupEnd& Second)
+	{
+		if (First.At != Second.At)
+		{
+			return First.At < Second.At;
+		}
+		const int32 FirstHalf = DirectionHalf(First.DX, First.DY);
+		const int32 SecondHalf = DirectionHalf(Second.DX, Second.DY);
+		if (FirstHalf != SecondHalf)
+		{
+			return FirstHalf < SecondHalf;
+		}
+		const int32 Turn = Sign(Cross(First.DX, First.DY, Second.DX, Second.DY));
+		return Turn != 0 ? Turn > 0 : First.Group < Second.Group;
+	});
+	TScratchArray<int32> EndIndices;
+	TScratchArray<int32> VertexFirst;
+	TScratchArray<int32> VertexCount;
+	EndIndices.SetNumUninitialized(Ends.Num());
+	VertexFirst.SetNumUninitialized(Ends.Num());
+	VertexCount.SetNumUninitialized(Ends.Num());
+	for (int32 First = 0, Last = 0; First < Ends.Num(); First = Last)
+	{
+		for (Last = First; Last < Ends.Num() && Ends[Last].At == Ends[First].At; Last++)
+		{
+			EndIndices[Ends[Last].Group * 2 + (Ends[Last].bAtLo ? 0 : 1)] = Last;
+		}
+		for (int32 i = First; i < Last; i++)
+		{
+			VertexFirst[i] = First;
+			VertexCount[i] = Last - First;
+		}
+	}
+
+	//one ray finds the windings of a group, then they spread to every group connected to it through shared faces
+	FSlabIndex SlabsX;
+	FSlabIndex SlabsY;
+	SlabsX.Build(Fragments, true);
+	SlabsY.Build(Fragments, false);
+	TScratchArray<int32> Pending;
+	for (int32 Seed = 0; Seed < Groups.Num(); Seed++)
+	{
+		if (Groups[Seed].bKnown)
+		{
+			continue;
+		}
+		FGroup& SeedInfo = Groups[Seed];
+		int32 Winding[2];
+		const bool bRight = WindingBelowGroup(SlabsX, SlabsY, Seed, FPoint{ SeedInfo.Lo.X + SeedInfo.Hi.X, SeedInfo.Lo.Y + SeedInfo.Hi.Y }, SeedInfo.Hi.X - SeedInfo.Lo.X, SeedInfo.Hi.Y - SeedInfo.Lo.Y, Winding);
+		if (bRight)
+		{
+			SetFromRightOfEnd(SeedInfo, true, Winding);
+		}
+		else
+		{
+			SetFromLeftOfEnd(SeedInfo, true, Winding);
+		}
+		Pending.Add(Seed);
+		while (Pending.Num() > 0)
+		{
+			const int32 Group = Pending.Pop();
+			const FGroup& Info = Groups[Group];
+			for (int32 EndSide = 0; EndSide < 2; EndSide++)
+			{
+				const bool bAtLo = EndSide == 0;
+				const int32 End = EndIndices[Group * 2 + EndSide];
+				const int32 First = VertexFirst[End];
+				const int32 Count = VertexCount[End];
+				int32 LeftOfEnd[2];
+				int32 RightOfEnd[2];
+				for (int32 Set = 0; Set < 2; Set++)
+				{
+					RightOfEnd[Set] = bAtLo ? Info.Right[Set] : Info.Right[Set] + Info.Crossings[Set];
+					LeftOfEnd[Set] = bAtLo ? Info.Right[Set] + Info.Crossings[Set] : Info.Right[Set];
+				}
+				//the next end counter clockwise shares the face on this end's left, the previous one the face on its right
+				const FGroupEnd& Next = Ends[First + (End - First + 1) % Count];
+				if (!Groups[Next.Group].bKnown)
+				{
+					SetFromRightOfEnd(Groups[Next.Group], Next.bAtLo, LeftOfEnd);
+					Pending.Add(Next.Group);
+				}
+				const FGroupEnd& Previous = Ends[First + (End - First + Count - 1) % Count];
+				if (!Groups[Previous.Group].bKnown)
+				{
+					SetFromLeftOfEnd(Groups[Previous.Group], Previous.bAtLo, RightOfEnd);
+					Pending.Add(Previous.Group);
+				}
+			}
+		}
+	}
+
+	//keep each group where the result is inside on exactly one side, facing so the inside is on its left
+	TScratchArray<FOutputEdge> OutputEdges;
+	for (const FGroup& Info : Groups)
+	{
+		const bool bInsideRight = IsInsideResult(Operation, Info.Right[0] > 0, Info.Right[1] > 0);
+		const bool bInsideLeft = IsInsideResult(Operation, Info.Right[0] + Info.Crossings[0] > 0, Info.Right[1] + Info.Crossings[1] > 0);
+		if (bInsideLeft && !bInsideRight)
+		{
+			OutputEdges.Add(FOutputEdge{ Info.Lo, Info.Hi });
+		}
+		else if (bInsideRight && !bInsideLeft)
+		{
+			OutputEdges.Add(FOutputEdge{ Info.Hi, Info.Lo });
+		}
+	}
+
+	//join the kept edges into rings
+	const int32 NumOutput = OutputEdges.Num();
+	TScratchArray<int32> ByStart;
+	ByStart.SetNumUninitialized(NumOutput);
+	for (int32 i = 0; i < NumOutput; i++)
+	{
+		ByStart[i] = i;
+	}
+	ByStart.Sort([&OutputEdges](int32 First, int32 Second)
+	{
+		return OutputEdges[First].S != OutputEdges[Second].S ? OutputEdges[First].S < OutputEdges[Second].S : First < Second;
+	});
+	TScratchArray<bool> Used;
+	Used.SetNumZeroed(NumOutput);
+	TScratchArray<FPoint> Ring;
+	for (int32 RingStart = 0; RingStart < NumOutput; RingStart++)
+	{
+		if (Used[RingStart])
+		{
+			continue;
+		}
+		Ring.Reset();
+		int32 Current = RingStart;
+		bool bClosed = false;
+		while (true)
+		{
+			Used[Current] = true;
+			const FOutputEdge& Edge = OutputEdges[Current];
+			Ring.Add(Edge.S);
+
+			//of the edges leaving this vertex, take the first one clockwise from the way back, the tightest left turn
+			const int64 RefX = Edge.S.X - Edge.E.X;
+			const int64 RefY = Edge.S.Y - Edge.E.Y;
+			int32 Low = 0;
+			int32 High = NumOutput;
+			while (Low < High)
+			{
+				const int32 Mid = (Low + High) / 2;
+				if (OutputEdges[ByStart[Mid]].S < Edge.E)
+				{
+					Low = Mid + 1;
+				}
+				else
+				{
+					High = Mid;
+				}
+			}
+			int32 Best = INDEX_NONE;
+			int64 BestX = 0;
+			int64 BestY = 0;
+			int32 BestHalf = 0;
+			for (int32 i = Low; i < NumOutput && OutputEdges[ByStart[i]].S == Edge.E; i++)
+			{
+				const int32 Candidate = ByStart[i];
+				if (Used[Candidate] && Candidate != RingStart)
+				{
+					continue;
+				}
+				const int64 VX = OutputEdges[Candidate].E.X - Edge.E.X;
+				const int64 VY = OutputEdges[Candidate].E.Y - Edge.E.Y;
+				const int32 Half = AngleHalf(RefX, RefY, VX, VY);
+				if (Best == INDEX_NONE || Half > BestHalf || (Half == BestHalf && Sign(Cross(BestX, BestY, VX, VY)) > 0))
+				{
+					Best = Candidate;
+					BestX = VX;
+					BestY = VY;
+					BestHalf = Half;
+				}
+			}
+			if (Best == INDEX_NONE)
+			{
+				break;
+			}
+			if (Best == RingStart)
+			{
+				bClosed = true;
+				break;
+			}
+			Current = Best;
+		}
+		if (bClosed)
+		{
+			EmitRing(Ring, Out);
+		}
+	}
+}
+
+void FFixedPolygonArena2D::Offset(const FFixedPolygonArena2D& In, FFixed64 Distance, FFixedPolygonArena2D& Out)
+{
+	check(&Out != &In);
+	if (Distance == FixedPoint::Constants::Fixed64::Zero)
+	{
+		Out.Append(In);
+		return;
+	}
+
+	const FFixed64 AbsDistance = FFixedPointMath::Abs(Distance);
+	const FFixed64 Diagonal = AbsDistance * FFixed64::MakeFromRawInt(RawCos45);
+	FFixedPolygonArena2D Stroke;
+	Stroke.Reserve(In.NumVertices() * 2, In.NumVertices() * 12);
+	for (int32 PolygonIndex = 0; PolygonIndex < In.Num(); PolygonIndex++)
+	{
+		const TArrayView<const FFixedVector2d> Polygon = In.GetPolygon(PolygonIndex);
+		for (int32 i = 0; i < Polygon.Num(); i++)
+		{
+			const FFixedVector2d& P = Polygon[i];
+			const FFixedVector2d& Q = Polygon[i + 1 < Polygon.Num() ? i + 1 : 0];
+			const FFixed64 DX = Q.X - P.X;
+			const FFixed64 DY = Q.Y - P.Y;
+			if (DX != FixedPoint::Constants::Fixed64::Zero || DY != FixedPoint::Constants::Fixed64::Zero)
+			{
+				//divide by the larger component first so long edges never overflow the squared length
+				const FFixed64 Scale = FFixedPointMath::Max(FFixedPointMath::Abs(DX), FFixedPointMath::Abs(DY));
+				const FFixed64 UX = DX / Scale;
+				const FFixed64 UY = DY / Scale;
+				const FFixed64 Length = FFixedPointMath::Sqrt(UX * UX + UY * UY);
+				const FFixedVector2d Normal(-UY / Length * AbsDistance, UX / Length * AbsDistance);
+				const FFixedVector2d Band[4] = { P - Normal, Q - Normal, Q + Normal, P + Normal };
+				Stroke.Add(Band);
+			}
+
+			const FFixedVector2d Octagon[8] = {
+				FFixedVector2d(P.X + AbsDistance, P.Y),
+				FFixedVector2d(P.X + Diagonal, P.Y + Diagonal),
+				FFixedVector2d(P.X, P.Y + AbsDistance),
+				FFixedVector2d(P.X - Diagonal, P.Y + Diagonal),
+				FFixedVector2d(P.X - AbsDistance, P.Y),
+				FFixedVector2d(P.X - Diagonal, P.Y - Diagonal),
+				FFixedVector2d(P.X, P.Y - AbsDistance),
+				FFixedVector2d(P.X + Diagonal, P.Y - Diagonal)
+			};
+			Stroke.Add(Octagon);
+		}
+	}
+	Boolean(In, Stroke, Distance > FixedPoint::Constants::Fixed64::Zero ? EFixedPolygonBoolean::Union : EFixedPolygonBoolean::Difference, Out);
+}
@@ -4,6 +4,7 @@
 #include "FixedPointQuat.h"
 #include "FixedPointNumbers.h"
 #include "FixedPointVector.h"
+#include "FixedPointParallel.h"
 
 
 const FFixedQuat64 FFixedQuat64::Identity = FFixedQuat64(FFixed64(), FFixed64(), FFixed64(), FFixed64((int64)1));
@@ -42,6 +43,127 @@ FFixedRotator64 FFixedQuat64::Rotator() const
 	return FFixedRotator64(Pitch, Yaw, Roll);
 }
 
+namespace FixedPoint
+{
+	namespace Slerp
+	{
+		/**
+		* Coefficients of the series sin(T * Theta) / sin(Theta) = T * (1 + B1 * (1 + B2 * (1 + ...))) with Bi = (U[i] * T^2 - V[i]) * (cos(Theta) - 1),
+		* U[i] = 1 / (i * (2i + 1)) and V[i] = i / (2i + 1), with the last pair scaled by 1.85298109 to absorb the truncated tail.
+		* See "A Fast and Accurate Algorithm for Computing SLERP", David Eberly.
+		*/
+		static constexpr int32 NumTerms = 8;
+		static constexpr int64 U[NumTerms] = { 349525, 104858, 49932, 29127, 19065, 13443, 9986, 14287 };
+		static constexpr int64 V[NumTerms] = { 349525, 419430, 449390, 466034, 476625, 483958, 489335, 914349 };
+
+		/** Alpha dependent terms of both weights, shared by every quaternion slerped by the same Alpha */
+		struct FWeights
+		{
+			FFixed64 T;
+			FFixed64 D;
+			FFixed64 TermsT[NumTerms];
+			FFixed64 TermsD[NumTerms];
+
+			explicit FWeights(FFixed64 Alpha)
+			{
+				T = Alpha;
+				D = FixedPoint::Constants::Fixed64::One - Alpha;
+				const FFixed64 SquareT = T * T;
+				const FFixed64 SquareD = D * D;
+				for (int32 i = 0; i < NumTerms; i++)
+				{
+					TermsT[i] = FFixed64::MakeFromRawInt(U[i]) * SquareT - FFixed64::MakeFromRawInt(V[i]);
+					TermsD[i] = FFixed64::MakeFromRawInt(U[i]) * SquareD - FFixed64::MakeFromRawInt(V[i]);
+				}
+			}
+
+			/** Weights of the first and second quaternion for an angle with cosine CosTheta, which must be in [0, 1] */
+			FORCEINLINE void Evaluate(FFixed64 CosTheta, FFixed64& OutWeight1, FFixed64& OutWeight2) const
+			{
+				const FFixed64 CosMinusOne = CosTheta - FixedPoint::Constants::Fixed64::One;
+				FFixed64 SumT = FixedPoint::Constants::Fixed64::One;
+				FFixed64 SumD = FixedPoint::Constants::Fixed64::One;
+				for (int32 i = NumTerms - 1; i >= 0; i--)
+				{
+					SumT = FixedPoint::Constants::Fixed64::One + TermsT[i] * CosMinusOne * SumT;
+					SumD = FixedPoint::Constants::Fixed64::One + TermsD[i] * CosMinusOne * SumD;
+				}
+				OutWeight1 = D * SumD;
+				OutWeight2 = T * SumT;
+			}
+
+			/** Shortest path slerp, the second quaternion is negated when the two are more than 90 degrees apart */
+			FORCEINLINE FFixedQuat64 Interpolate(const FFixedQuat64& Quat1, const FFixedQuat64& Quat2) const
+			{
+				const FFixed64 CosTheta = Quat1 | Quat2;
+				FFixed64 Weight1, Weight2;
+				Evaluate(FFixedPointMath::Abs(CosTheta), Weight1, Weight2);
+				Weight2 = CosTheta < FixedPoint::Constants::Fixed64::Zero ? -Weight2 : Weight2;
+				return (Quat1 * Weight1) + (Quat2 * Weight2);
+			}
+		};
+	}
+}
+
+FFixedQuat64 FFixedQuat64::Slerp_NotNormalized(const FFixedQuat64& Quat1, const FFixedQuat64& Quat2, FFixed64 Slerp)
+{
+	return FixedPoint::Slerp::FWeights(Slerp).Interpolate(Quat1, Quat2);
+}
+
+FFixedQuat64 FFixedQuat64::SlerpFullPath_NotNormalized(const FFixedQuat64& quat1, const FFixedQuat64& quat2, FFixed64 Alpha)
+{
+	const FFixed64 CosTheta = quat1 | quat2;
+	if (CosTheta >= FixedPoint::Constants::Fixed64::Zero)
+	{
+		return FixedPoint::Slerp::FWeights(Alpha).Interpolate(quat1, quat2);
+	}
+
+	// nearly opposite, the midpoint is undefined so fall back to a linear blend. FQuat has no such case, it divides by the
+	// sine of an angle close to 180 degrees and its weights blow up instead
+	if (CosTheta <= -FixedPoint::Constants::Fixed64::One + FixedPoint::Constants::Fixed64::KindaSmallNumber)
+	{
+		return (quat1 * (FixedPoint::Constants::Fixed64::One - Alpha)) + (quat2 * Alpha);
+	}
+
+	// both halves of the arc are under 90 degrees, so each stays in the accurate range of the polynomial
+	FFixedQuat64 Midpoint = quat1 + quat2;
+	Midpoint.Normalize();
+	const FFixed64 Two = FFixed64::MakeFromRawInt(FixedPoint::Constants::Raw64::One * 2);
+	if (Alpha < FixedPoint::Constants::Fixed64::Half)
+	{
+		return FixedPoint::Slerp::FWeights(Alpha * Two).Interpolate(quat1, Midpoint);
+	}
+	return FixedPoint::Slerp::FWeights(Alpha * Two - FixedPoint::Constants::Fixed64::One).Interpolate(Midpoint, quat2);
+}
+
+FFixedQuat64 FFixedQuat64::Squad(const FFixedQuat64& quat1, const FFixedQuat64& tang1, const FFixedQuat64& quat2, const FFixedQuat64& tang2, FFixed64 Alpha)
+{
+	// Always slerp along the short path from quat1 to quat2 to prevent axis flipping.
+	// This approach is taken by OGRE engine, amongst others.
+	const FFixedQuat64 Q1 = FFixedQuat64::Slerp_NotNormalized(quat1, quat2, Alpha);
+	const FFixedQuat64 Q2 = FFixedQuat64::SlerpFullPath_NotNormalized(tang1, tang2, Alpha);
+	const FFixed64 Two = FFixed64::MakeFromRawInt(FixedPoint::Constants::Raw64::One * 2);
+	return FFixedQuat64::SlerpFullPath(Q1, Q2, Two * Alpha * (FixedPoint::Constants::Fixed64::One - Alpha));
+}
+
+void FFixedQuat64::Slerp(TArrayView<FFixedQuat64> OutQuats, TArrayView<const FFixedQuat64> Quat1, TArrayView<const FFixedQuat64> Quat2, FFixed64 Alpha, bool bParallel)
+{
+	check(Quat1.Num() == OutQuats.Num() && Quat2.Num() == OutQuats.Num());
+	const FixedPoint::Slerp::FWeights Weights(Alpha);
+	const FFixedQuat64* Quat1Ptr = Quat1.GetData();
+	const FFixedQuat64* Quat2Ptr = Quat2.GetData();
+	FFixedQuat64* OutPtr = OutQuats.GetData();
+	FixedPoint::Parallel::ForEachRange(OutQuats.Num(), bParallel, [&Weights, Quat1Ptr, Quat2Ptr, OutPtr](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			FFixedQuat64 Result = Weights.Interpolate(Quat1Ptr[i], Quat2Ptr[i]);
+			Result.Normalize();
+			OutPtr[i] = Result;
+		}
+	});
+}
+
 /**
 * CONSTRUCTORS
 */
@@ -0,0 +1,266 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointRadixSort.h"
+#include "FixedPointParallel.h"
+
+//bits sorted each pass, 256 buckets of counts stay in L1
+static constexpr int32 RadixBits = 8;
+static constexpr int32 NumBuckets = 1 << RadixBits;
+//below this many keys a stable insertion sort beats the fixed cost of clearing and summing buckets every pass
+static constexpr int32 InsertionSortThreshold = 64;
+//keys each task counts and scatters in a parallel pass, fixed so the split never depends on the thread count
+static constexpr int32 RadixBatchSize = 1 << 16;
+
+template<typename KeyType>
+static FORCEINLINE uint32 GetDigit(KeyType Key, int32 Pass)
+{
+	return (uint32)(Key >> (Pass * RadixBits)) & (NumBuckets - 1);
+}
+
+template<typename KeyType, bool bWithIndices>
+static void InsertionSort(TArray<KeyType>& Keys, TArray<int32>& Indices)
+{
+	for (int32 i = 1; i < Keys.Num(); i++)
+	{
+		const KeyType Key = Keys[i];
+		const int32 Index = bWithIndices ? Indices[i] : 0;
+		int32 Slot = i;
+		//strictly greater, so equal keys stay in input order
+		for (; Slot > 0 && Keys[Slot - 1] > Key; Slot--)
+		{
+			Keys[Slot] = Keys[Slot - 1];
+			if (bWithIndices)
+			{
+				Indices[Slot] = Indices[Slot - 1];
+			}
+		}
+		Keys[Slot] = Key;
+		if (bWithIndices)
+		{
+			Indices[Slot] = Index;
+		}
+	}
+}
+
+/**
+* LSD radix sort of unsigned keys, carrying Indices along when bWithIndices is set.
+* Each chunk of the input gets its own run of every bucket, and runs are laid out bucket by bucket in chunk order, so
+* every key lands where the serial sort would put it.
+*/
+template<typename KeyType, bool bWithIndices>
+static void RadixSort(TArray<KeyType>& Keys, TArray<int32>& Indices, bool bParallel)
+{
+	constexpr int32 NumPasses = (int32)sizeof(KeyType) * 8 / RadixBits;
+	const int32 Num = Keys.Num();
+	if (Num < InsertionSortThreshold)
+	{
+		InsertionSort<KeyType, bWithIndices>(Keys, Indices);
+		return;
+	}
+	const bool bChunked = bParallel && Num > RadixBatchSize;
+	const int32 NumChunks = bChunked ? (Num + RadixBatchSize - 1) / RadixBatchSize : 1;
+	const int32 ChunkSize = bChunked ? RadixBatchSize : Num;
+	auto ForEachChunk = [NumChunks, bChunked](auto&& Functor)
+	{
+		FixedPoint::Parallel::ForEachRange(NumChunks, bChunked, [&Functor](int32 Start, int32 End)
+		{
+			for (int32 Chunk = Start; Chunk < End; Chunk++)
+			{
+				Functor(Chunk);
+			}
+		}, 1);
+	};
+
+	//every pass's digit counts in one read, they do not depend on the order so they also hold after earlier passes
+	TArray<int32> Counts;
+	Counts.SetNumZeroed(NumChunks * NumPasses * NumBuckets);
+	ForEachChunk([&Keys, &Counts, ChunkSize, Num](int32 Chunk)
+	{
+		int32* ChunkCounts = Counts.GetData() + Chunk * NumPasses * NumBuckets;
+		const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+		for (int32 i = Chunk * ChunkSize; i < End; i++)
+		{
+			for (int32 Pass = 0; Pass < NumPasses; Pass++)
+			{
+				ChunkCounts[Pass * NumBuckets + GetDigit(Keys[i], Pass)]++;
+			}
+		}
+	});
+	int32 Totals[NumPasses][NumBuckets];
+	FMemory::Memcpy(Totals, Counts.GetData(), sizeof(Totals));
+	for (int32 Chunk = 1; Chunk < NumChunks; Chunk++)
+	{
+		const int32* ChunkCounts = Counts.GetData() + Chunk * NumPasses * NumBuckets;
+		for (int32 Bucket = 0; Bucket < NumPasses * NumBuckets; Bucket++)
+		{
+			Totals[Bucket / NumBuckets][Bucket % NumBuckets] += ChunkCounts[Bucket];
+		}
+	}
+
+	TArray<KeyType> ScratchKeys;
+	ScratchKeys.SetNumUninitialized(Num);
+	TArray<int32> ScratchIndices;
+	if (bWithIndices)
+	{
+		ScratchIndices.SetNumUninitialized(Num);
+	}
+	TArray<int32> Offsets;
+	Offsets.SetNumUninitialized(NumChunks * NumBuckets);
+	for (int32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		//every key shares this digit, the pass would leave the order as it is
+		if (Totals[Pass][GetDigit(Keys[0], Pass)] == Num)
+		{
+			continue;
+		}
+		if (bChunked)
+		{
+			//the counts from before the first pass are stale once keys have moved between chunks
+			ForEachChunk([&Keys, &Offsets, ChunkSize, Num, Pass](int32 Chunk)
+			{
+				int32* ChunkOffsets = Offsets.GetData() + Chunk * NumBuckets;
+				FMemory::Memzero(ChunkOffsets, NumBuckets * sizeof(int32));
+				const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; i++)
+				{
+					ChunkOffsets[GetDigit(Keys[i], Pass)]++;
+				}
+			});
+		}
+		else
+		{
+			FMemory::Memcpy(Offsets.GetData(), Totals[Pass], NumBuckets * sizeof(int32));
+		}
+		//bucket major, chunk minor
+		int32 Next = 0;
+		for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+		{
+			for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+			{
+				const int32 Count = Offsets[Chunk * NumBuckets + Bucket];
+				Offsets[Chunk * NumBuckets + Bucket] = Next;
+				Next += Count;
+			}
+		}
+		ForEachChunk([&Keys, &Indices, &ScratchKeys, &ScratchIndices, &Offsets, ChunkSize, Num, Pass](int32 Chunk)
+		{
+			int32* ChunkOffsets = Offsets.GetData() + Chunk * NumBuckets;
+			const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+			for (int32 i = Chunk * ChunkSize; i < End; i++)
+			{
+				const int32 Slot = ChunkOffsets[GetDigit(Keys[i], Pass)]++;
+				ScratchKeys[Slot] = Keys[i];
+				if (bWithIndices)
+				{
+					ScratchIndices[Slot] = Indices[i];
+				}
+			}
+		});
+		Swap(Keys, ScratchKeys);
+		if (bWithIndices)
+		{
+			Swap(Indices, ScratchIndices);
+		}
+	}
+}
+
+//flipping the sign bit maps signed order onto unsigned order
+static FORCEINLINE uint64 ToRadixKey(FFixed64 Value)
+{
+	return (uint64)Value.Value ^ ((uint64)1 << 63);
+}
+
+static FORCEINLINE uint32 ToRadixKey(FFixed32 Value)
+{
+	return (uint32)Value.Value ^ (1u << 31);
+}
+
+static FORCEINLINE uint64 ToRadixKey(uint64 Value)
+{
+	return Value;
+}
+
+template<typename KeyType, typename ElementType>
+static void ArgSortInternal(TArrayView<const ElementType> Elements, TArray<int32>& OutOrder, bool bParallel)
+{
+	TArray<KeyType> Keys;
+	Keys.SetNumUninitialized(Elements.Num());
+	OutOrder.SetNumUninitialized(Elements.Num());
+	FixedPoint::Parallel::ForEachRange(Elements.Num(), bParallel, [&Keys, &OutOrder, Elements](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			Keys[i] = ToRadixKey(Elements[i]);
+			OutOrder[i] = i;
+		}
+	});
+	RadixSort<KeyType, true>(Keys, OutOrder, bParallel);
+}
+
+void FFixedRadixSort::Sort(TArrayView<FFixed64> Values, bool bParallel)
+{
+	TArray<uint64> Keys;
+	Keys.SetNumUninitialized(Values.Num());
+	FixedPoint::Parallel::ForEachRange(Values.Num(), bParallel, [&Keys, Values](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			Keys[i] = ToRadixKey(Values[i]);
+		}
+	});
+	TArray<int32> NoIndices;
+	RadixSort<uint64, false>(Keys, NoIndices, bParallel);
+	FixedPoint::Parallel::ForEachRange(Values.Num(), bParallel, [&Keys, Values](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			Values[i] = FFixed64::MakeFromRawInt((int64)(Keys[i] ^ ((uint64)1 << 63)));
+		}
+	});
+}
+
+void FFixedRadixSort::Sort(TArrayView<FFixed32> Values, bool bParallel)
+{
+	TArray<uint32> Keys;
+	Keys.SetNumUninitialized(Values.Num());
+	FixedPoint::Parallel::ForEachRange(Values.Num(), bParallel, [&Keys, Values](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			Keys[i] = ToRadixKey(Values[i]);
+		}
+	});
+	TArray<int32> NoIndices;
+	RadixSort<uint32, false>(Keys, NoIndices, bParallel);
+	FixedPoint::Parallel::ForEachRange(Values.Num(), bParallel, [&Keys, Values](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			Values[i] = FFixed32::MakeFromRawInt((int32)(Keys[i] ^ (1u << 31)));
+		}
+	});
+}
+
+void FFixedRadixSort::Sort(TArrayView<uint64> Values, bool bParallel)
+{
+	TArray<uint64> Keys(Values.GetData(), Values.Num());
+	TArray<int32> NoIndices;
+	RadixSort<uint64, false>(Keys, NoIndices, bParallel);
+	FMemory::Memcpy(Values.GetData(), Keys.GetData(), Values.Num() * sizeof(uint64));
+}
+
+void FFixedRadixSort::ArgSort(TArrayView<const FFixed64> Keys, TArray<int32>& OutOrder, bool bParallel)
+{
+	ArgSortInternal<uint64>(Keys, OutOrder, bParallel);
+}
+
+void FFixedRadixSort::ArgSort(TArrayView<const FFixed32> Keys, TArray<int32>& OutOrder, bool bParallel)
+{
+	ArgSortInternal<uint32>(Keys, OutOrder, bParallel);
+}
+
+void FFixedRadixSort::ArgSort(TArrayView<const uint64> Keys, TArray<int32>& OutOrder, bool bParallel)
+{
+	ArgSortInternal<uint64>(Keys, OutOrder, bParallel);
+}
@@ -0,0 +1,300 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointRayBatch.h"
+#include "FixedPointTypes.h"
+#include "FixedPointBatch.h"
+#include "FixedPointParallel.h"
+
+//rays are masked in blocks of 64, parallel tasks take several blocks so each one streams the primitives a few times at most
+static constexpr int32 RayBlockSize = 64;
+static constexpr int32 RayBatchSize = RayBlockSize * 4;
+
+using FixedPoint::Int128::FInt128;
+
+/** Truncating Num * One / Den towards zero gives a time of at least zero, Den is positive */
+static FORCEINLINE bool IsTimeNotNegative(int64 Num, int64 Den)
+{
+	using namespace FixedPoint::Int128;
+	//a small negative numerator still truncates to a time of zero
+	return Num >= 0 || Compare(Mul(-Num, FixedPoint::Constants::Raw64::One), Make(Den)) < 0;
+}
+
+/** Truncating Num * One / Den towards zero gives a time of at most one, UpperBound is Den * (One + 1) */
+static FORCEINLINE bool IsTimeNotAboveOne(int64 Num, const FInt128& UpperBound)
+{
+	using namespace FixedPoint::Int128;
+	return Num < 0 || Compare(Mul(Num, FixedPoint::Constants::Raw64::One), UpperBound) < 0;
+}
+
+/**
+* Runs Test(Ray, Item, OutTime) over every ray and item, keeping the earliest hit per ray with ties going to the lower item.
+* Items are the outer loop within a block of rays so each item is loaded once per block, and rays that are done
+* are masked out, the block moves on once no ray in it is still searching.
+*/
+template<typename TestType>
+static void RunRayBlocks(int32 NumRays, int32 NumItems, int32* OutItems, FFixed64* OutTimes, bool bAnyHit, bool bParallel, const TestType& Test)
+{
+	FixedPoint::Parallel::ForEachRange(NumRays, bParallel, [NumItems, OutItems, OutTimes, bAnyHit, &Test](int32 Start, int32 End)
+	{
+		for (int32 BlockStart = Start; BlockStart < End; BlockStart += RayBlockSize)
+		{
+			const int32 BlockNum = FMath::Min(End - BlockStart, RayBlockSize);
+			uint64 Active = BlockNum == RayBlockSize ? ~0ull : ((1ull << BlockNum) - 1);
+			for (int32 Lane = 0; Lane < BlockNum; Lane++)
+			{
+				OutItems[BlockStart + Lane] = INDEX_NONE;
+				OutTimes[BlockStart + Lane] = FixedPoint::Constants::Fixed64::One;
+			}
+
+			for (int32 Item = 0; Item < NumItems && Active != 0; Item++)
+			{
+				uint64 Lanes = Active;
+				while (Lanes != 0)
+				{
+					const int32 Lane = (int32)FMath::CountTrailingZeros64(Lanes);
+					Lanes &= Lanes - 1;
+					const int32 Ray = BlockStart + Lane;
+					FFixed64 Time;
+					if (Test(Ray, Item, Time) && (OutItems[Ray] == INDEX_NONE || Time < OutTimes[Ray]))
+					{
+						OutItems[Ray] = Item;
+						OutTimes[Ray] = Time;
+						if (bAnyHit)
+						{
+							Active &= ~(1ull << Lane);
+						}
+					}
+				}
+			}
+		}
+	}, RayBatchSize);
+}
+
+int32 FFixedRayBatch::AddRay(const FFixedVector64& Start, const FFixedVector64& Dir, FFixed64 InLength)
+{
+	return AddInternal(Start, Start + Dir * InLength, Dir, InLength);
+}
+
+int32 FFixedRayBatch::AddSegment(const FFixedVector64& Start, const FFixedVector64& End)
+{
+	const FFixedVector64 Delta = End - Start;
+	return AddInternal(Start, End, Delta.GetSafeNormal(), Delta.Size());
+}
+
+int32 FFixedRayBatch::AddInternal(const FFixedVector64& Start, const FFixedVector64& End, const FFixedVector64& Dir, FFixed64 InLength)
+{
+	using namespace FixedPoint::Int128;
+	const FFixedVector64 Delta = End - Start;
+	const int64 AbsLength = FMath::Abs(InLength.Value);
+
+	StartY.Add(Start.Y);
+	StartZ.Add(Start.Z);
+	EndX.Add(End.X);
+	EndY.Add(End.Y);
+	EndZ.Add(End.Z);
+	DirX.Add(Dir.X);
+	DirY.Add(Dir.Y);
+	DirZ.Add(Dir.Z);
+	Length.Add(InLength);
+	DeltaX.Add(Delta.X);
+	DeltaY.Add(Delta.Y);
+	DeltaZ.Add(Delta.Z);
+	TimeDenominator.Add(AbsLength);
+	TimeUpperBound.Add(Mul(AbsLength, FixedPoint::Constants::Raw64::One + 1));
+	return StartX.Add(Start.X);
+}
+
+void FFixedRayBatch::Reserve(int32 Number)
+{
+	StartX.Reserve(Number);
+	StartY.Reserve(Number);
+	StartZ.Reserve(Number);
+	EndX.Reserve(Number);
+	EndY.Reserve(Number);
+	EndZ.Reserve(Number);
+	DirX.Reserve(Number);
+	DirY.Reserve(Number);
+	DirZ.Reserve(Number);
+	Length.Reserve(Number);
+	DeltaX.Reserve(Number);
+	DeltaY.Reserve(Number);
+	DeltaZ.Reserve(Number);
+	TimeDenominator.Reserve(Number);
+	TimeUpperBound.Reserve(Number);
+}
+
+void FFixedRayBatch::Reset()
+{
+	StartX.Reset();
+	StartY.Reset();
+	StartZ.Reset();
+	EndX.Reset();
+	EndY.Reset();
+	EndZ.Reset();
+	DirX.Reset();
+	DirY.Reset();
+	DirZ.Reset();
+	Length.Reset();
+	DeltaX.Reset();
+	DeltaY.Reset();
+	DeltaZ.Reset();
+	TimeDenominator.Reset();
+	TimeUpperBound.Reset();
+}
+
+void FFixedRayBatch::IntersectSpheres(const FFixedSphereSoA& Spheres, TArrayView<int32> OutItems, TArrayView<FFixed64> OutTimes, bool bAnyHit, bool bParallel) const
+{
+	check(OutItems.Num() == Num() && OutTimes.Num() == Num());
+	RunRayBlocks(Num(), Spheres.Num(), OutItems.GetData(), OutTimes.GetData(), bAnyHit, bParallel, [this, &Spheres](int32 Ray, int32 Item, FFixed64& OutTime)
+	{
+		const int64 L = Length[Ray].Value;
+		if (L == 0)
+		{
+			return false;
+		}
+		//Origin - Start, EO is its negation and squares the same since products truncate towards zero
+		const int64 DX = Spheres.CenterX[Item].Value - StartX[Ray].Value;
+		const int64 DY = Spheres.CenterY[Item].Value - StartY[Ray].Value;
+		const int64 DZ = Spheres.CenterZ[Item].Value - StartZ[Ray].Value;
+		const int64 V = FFixed64Batch::MulRaw(DirX[Ray].Value, DX) + FFixed64Batch::MulRaw(DirY[Ray].Value, DY) + FFixed64Batch::MulRaw(DirZ[Ray].Value, DZ);
+		const int64 EOSquared = FFixed64Batch::MulRaw(DX, DX) + FFixed64Batch::MulRaw(DY, DY) + FFixed64Batch::MulRaw(DZ, DZ);
+		const int64 Radius = Spheres.W[Item].Value;
+		const int64 Disc = FFixed64Batch::MulRaw(Radius, Radius) - (EOSquared - FFixed64Batch::MulRaw(V, V));
+		if (Disc < 0)
+		{
+			return false;
+		}
+
+		//the square root only lowers the numerator, so v alone can rule the sphere out before paying for it
+		const int64 Den = TimeDenominator[Ray];
+		if (L > 0 ? !IsTimeNotNegative(V, Den) : !IsTimeNotAboveOne(-V, TimeUpperBound[Ray]))
+		{
+			return false;
+		}
+		const int64 Numerator = V - FFixedPointMath::Sqrt(FFixed64::MakeFromRawInt(Disc)).Value;
+		const int64 SignedNumerator = L > 0 ? Numerator : -Numerator;
+		if (!IsTimeNotNegative(SignedNumerator, Den) || !IsTimeNotAboveOne(SignedNumerator, TimeUpperBound[Ray]))
+		{
+			return false;
+		}
+		OutTime = FFixed64::MakeFromRawInt(Numerator) / Length[Ray];
+		return true;
+	});
+}
+
+void FFixedRayBatch::IntersectPlanes(const FFixedPlaneSoA& Planes, TArrayView<int32> OutItems, TArrayView<FFixed64> OutTimes, bool bAnyHit, bool bParallel) const
+{
+	using namespace FixedPoint::Int128;
+	check(OutItems.Num() == Num() && OutTimes.Num() == Num());
+
+	//Plane.GetOrigin() for each plane, once rather than once per ray
+	const int32 NumPlanes = Planes.Num();
+	TArray<int64> OriginX, OriginY, OriginZ;
+	OriginX.SetNumUninitialized(NumPlanes);
+	OriginY.SetNumUninitialized(NumPlanes);
+	OriginZ.SetNumUninitialized(NumPlanes);
+	for (int32 i = 0; i < NumPlanes; i++)
+	{
+		OriginX[i] = FFixed64Batch::MulRaw(Planes.X[i].Value, Planes.W[i].Value);
+		OriginY[i] = FFixed64Batch::MulRaw(Planes.Y[i].Value, Planes.W[i].Value);
+		OriginZ[i] = FFixed64Batch::MulRaw(Planes.Z[i].Value, Planes.W[i].Value);
+	}
+
+	RunRayBlocks(Num(), NumPlanes, OutItems.GetData(), OutTimes.GetData(), bAnyHit, bParallel, [this, &Planes, &OriginX, &OriginY, &OriginZ](int32 Ray, int32 Item, FFixed64& OutTime)
+	{
+		const int64 NX = Planes.X[Item].Value;
+		const int64 NY = Planes.Y[Item].Value;
+		const int64 NZ = Planes.Z[Item].Value;
+		const int64 Den = FFixed64Batch::MulRaw(DeltaX[Ray].Value, NX) + FFixed64Batch::MulRaw(DeltaY[Ray].Value, NY) + FFixed64Batch::MulRaw(DeltaZ[Ray].Value, NZ);
+		if (Den == 0)
+		{
+			return false;
+		}
+		const int64 Numerator = FFixed64Batch::MulRaw(OriginX[Item] - StartX[Ray].Value, NX)
+			+ FFixed64Batch::MulRaw(OriginY[Item] - StartY[Ray].Value, NY)
+			+ FFixed64Batch::MulRaw(OriginZ[Item] - StartZ[Ray].Value, NZ);
+		const int64 AbsDen = Den > 0 ? Den : -Den;
+		const int64 SignedNumerator = Den > 0 ? Numerator : -Numerator;
+		if (!IsTimeNotNegative(SignedNumerator, AbsDen) || !IsTimeNotAboveOne(SignedNumerator, Mul(AbsDen, FixedPoint::Constants::Raw64::One + 1)))
+		{
+			return false;
+		}
+		OutTime = FFixed64::MakeFromRawInt(Numerator) / FFixed64::MakeFromRawInt(Den);
+		return true;
+	});
+}
+
+void FFixedRayBatch::IntersectBoxes(const FFixedBoxSoA& Boxes, TArrayView<int32> OutItems, TArrayView<FFixed64> OutTimes, bool bAnyHit, bool bParallel) const
+{
+	check(OutItems.Num() == Num() && OutTimes.Num() == Num());
+	RunRayBlocks(Num(), Boxes.Num(), OutItems.GetData(), OutTimes.GetData(), bAnyHit, bParallel, [this, &Boxes](int32 Ray, int32 Item, FFixed64& OutTime)
+	{
+		using namespace FixedPoint::Int128;
+		int64 EnterNum = 0;
+		int64 EnterDen = 1;
+		int64 ExitNum = 1;
+		int64 ExitDen = 1;
+		if (!ClipSlab(StartX[Ray].Value, DeltaX[Ray].Value, Boxes.MinX[Item].Value, Boxes.MaxX[Item].Value, EnterNum, EnterDen, ExitNum, ExitDen)
+			|| !ClipSlab(StartY[Ray].Value, DeltaY[Ray].Value, Boxes.MinY[Item].Value, Boxes.MaxY[Item].Value, EnterNum, EnterDen, ExitNum, ExitDen)
+			|| !ClipSlab(StartZ[Ray].Value, DeltaZ[Ray].Value, Boxes.MinZ[Item].Value, Boxes.MaxZ[Item].Value, EnterNum, EnterDen, ExitNum, ExitDen))
+		{
+			return false;
+		}
+		OutTime = FFixed64::MakeFromRawInt(DivideTruncate(Mul(EnterNum, FixedPoint::Constants::Raw64::One), EnterDen));
+		return true;
+	});
+}
+
+void FFixedRayBatch::IntersectTriangles(const FFixedTriangleSoA& Triangles, TArrayView<int32> OutItems, TArrayView<FFixed64> OutTimes, bool bAnyHit, bool bParallel) const
+{
+	check(OutItems.Num() == Num() && OutTimes.Num() == Num());
+	RunRayBlocks(Num(), Triangles.Num(), OutItems.GetData(), OutTimes.GetData(), bAnyHit, bParallel, [this, &Triangles](int32 Ray, int32 Item, FFixed64& OutTime)
+	{
+		const int64 DX = DeltaX[Ray].Value;
+		const int64 DY = DeltaY[Ray].Value;
+		const int64 DZ = DeltaZ[Ray].Value;
+		const int64 E1X = Triangles.Edge1X[Item].Value, E1Y = Triangles.Edge1Y[Item].Value, E1Z = Triangles.Edge1Z[Item].Value;
+		const int64 E2X = Triangles.Edge2X[Item].Value, E2Y = Triangles.Edge2Y[Item].Value, E2Z = Triangles.Edge2Z[Item].Value;
+
+		//P = Delta ^ Edge2
+		const int64 PX = FFixed64Batch::MulRaw(DY, E2Z) - FFixed64Batch::MulRaw(DZ, E2Y);
+		const int64 PY = FFixed64Batch::MulRaw(DZ, E2X) - FFixed64Batch::MulRaw(DX, E2Z);
+		const int64 PZ = FFixed64Batch::MulRaw(DX, E2Y) - FFixed64Batch::MulRaw(DY, E2X);
+		int64 Det = FFixed64Batch::MulRaw(E1X, PX) + FFixed64Batch::MulRaw(E1Y, PY) + FFixed64Batch::MulRaw(E1Z, PZ);
+		if (Det == 0)
+		{
+			return false;
+		}
+
+		//T = Start - A
+		const int64 TX = StartX[Ray].Value - Triangles.AX[Item].Value;
+		const int64 TY = StartY[Ray].Value - Triangles.AY[Item].Value;
+		const int64 TZ = StartZ[Ray].Value - Triangles.AZ[Item].Value;
+		const int64 Flip = Det < 0 ? -1 : 1;
+		Det *= Flip;
+		const int64 U = Flip * (FFixed64Batch::MulRaw(TX, PX) + FFixed64Batch::MulRaw(TY, PY) + FFixed64Batch::MulRaw(TZ, PZ));
+		//U above Det fails whichever of the V tests the scalar function reaches first
+		if (U < 0 || U > Det)
+		{
+			return false;
+		}
+
+		//Q = T ^ Edge1
+		const int64 QX = FFixed64Batch::MulRaw(TY, E1Z) - FFixed64Batch::MulRaw(TZ, E1Y);
+		const int64 QY = FFixed64Batch::MulRaw(TZ, E1X) - FFixed64Batch::MulRaw(TX, E1Z);
+		const int64 QZ = FFixed64Batch::MulRaw(TX, E1Y) - FFixed64Batch::MulRaw(TY, E1X);
+		const int64 V = Flip * (FFixed64Batch::MulRaw(DX, QX) + FFixed64Batch::MulRaw(DY, QY) + FFixed64Batch::MulRaw(DZ, QZ));
+		if (V < 0 || U + V > Det)
+		{
+			return false;
+		}
+		const int64 W = Flip * (FFixed64Batch::MulRaw(E2X, QX) + FFixed64Batch::MulRaw(E2Y, QY) + FFixed64Batch::MulRaw(E2Z, QZ));
+		if (W < 0 || W > Det)
+		{
+			return false;
+		}
+		OutTime = FFixed64::MakeFromRawInt(W) / FFixed64::MakeFromRawInt(Det);
+		return true;
+	});
+}
@@ -0,0 +1,125 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointRotationMatrix62.h"
+#include "FixedPointTypes.h"
+#include "FixedPointParallel.h"
+
+const FFixedRotationMatrix62 FFixedRotationMatrix62::Identity(
+	FixedPoint::Constants::RawRotation::One, 0, 0,
+	0, FixedPoint::Constants::RawRotation::One, 0,
+	0, 0, FixedPoint::Constants::RawRotation::One);
+
+//FFixed64 raw value to Q1.62, exact
+static FORCEINLINE int64 ToRawRotation(int64 Raw64)
+{
+	return Raw64 * ((int64)1 << FixedPoint::Constants::BinaryPointRotationDifference);
+}
+
+//Q1.62 to FFixed64 raw value, rounded to nearest
+static FORCEINLINE int64 ToRaw64(int64 RawRotation)
+{
+	return (RawRotation + ((int64)1 << (FixedPoint::Constants::BinaryPointRotationDifference - 1))) >> FixedPoint::Constants::BinaryPointRotationDifference;
+}
+
+FFixedRotationMatrix62::FFixedRotationMatrix62(const FFixedQuat64& Q)
+{
+	// products of 20 bit components fit in 40 bits, so every term is exact before it is widened to 62 bits
+	const int64 X = Q.X.Value;
+	const int64 Y = Q.Y.Value;
+	const int64 Z = Q.Z.Value;
+	const int64 W = Q.W.Value;
+	const int64 One40 = (int64)1 << (FixedPoint::Constants::BinaryPoint64 * 2);
+	const int64 Widen = (int64)1 << (FixedPoint::Constants::BinaryPointRotation - FixedPoint::Constants::BinaryPoint64 * 2);
+
+	M[0][0] = (One40 - 2 * (Y * Y + Z * Z)) * Widen;
+	M[0][1] = 2 * (X * Y + W * Z) * Widen;
+	M[0][2] = 2 * (X * Z - W * Y) * Widen;
+	M[1][0] = 2 * (X * Y - W * Z) * Widen;
+	M[1][1] = (One40 - 2 * (X * X + Z * Z)) * Widen;
+	M[1][2] = 2 * (Y * Z + W * X) * Widen;
+	M[2][0] = 2 * (X * Z + W * Y) * Widen;
+	M[2][1] = 2 * (Y * Z - W * X) * Widen;
+	M[2][2] = (One40 - 2 * (X * X + Y * Y)) * Widen;
+
+	// the quaternion is only unit length to 20 bits, two steps take the error to the limit of 62
+	Orthonormalize();
+	Orthonormalize();
+}
+
+FFixedRotationMatrix62::FFixedRotationMatrix62(const FFixedRotator64& Rot)
+	: FFixedRotationMatrix62(FFixedMatrix33(Rot))
+{
+}
+
+FFixedRotationMatrix62::FFixedRotationMatrix62(const FFixedMatrix33& InMatrix)
+{
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			M[Row][Column] = ToRawRotation(InMatrix.M[Row][Column].Value);
+		}
+	}
+	Orthonormalize();
+	Orthonormalize();
+}
+
+void FFixedRotationMatrix62::Orthonormalize()
+{
+	// Half = (3I - Mt * M) / 2, kept as I + (I - Mt * M) / 2 so the diagonal never leaves Q1.62
+	int64 Half[3][3];
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			const int64 Product = Dot3(M[0][Row], M[0][Column], M[1][Row], M[1][Column], M[2][Row], M[2][Column], FixedPoint::Constants::BinaryPointRotation);
+			Half[Row][Column] = Row == Column
+				? FixedPoint::Constants::RawRotation::One + (FixedPoint::Constants::RawRotation::One - Product) / 2
+				: -Product / 2;
+		}
+	}
+
+	FFixedRotationMatrix62 Result;
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			Result.M[Row][Column] = Dot3(M[Row][0], Half[0][Column], M[Row][1], Half[1][Column], M[Row][2], Half[2][Column], FixedPoint::Constants::BinaryPointRotation);
+		}
+	}
+	*this = Result;
+}
+
+FFixedMatrix33 FFixedRotationMatrix62::ToMatrix33() const
+{
+	FFixedMatrix33 Result;
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			Result.M[Row][Column] = FFixed64::MakeFromRawInt(ToRaw64(M[Row][Column]));
+		}
+	}
+	return Result;
+}
+
+FFixedMatrix FFixedRotationMatrix62::ToMatrix() const
+{
+	return ToMatrix33().ToMatrix();
+}
+
+void FFixedRotationMatrix62::TransformVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel) const
+{
+	check(Vectors.Num() == OutVectors.Num());
+	const FFixedRotationMatrix62 Matrix = *this;
+	const FFixedVector64* Src = Vectors.GetData();
+	FFixedVector64* Dst = OutVectors.GetData();
+	FixedPoint::Parallel::ForEachRange(Vectors.Num(), bParallel, [&Matrix, Src, Dst](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			Dst[i] = Matrix.TransformVector(Src[i]);
+		}
+	});
+}
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "FixedPointRotator.h"
+#include "FixedPointTypes.h"
 
 const FFixedRotator64 FFixedRotator64::ZeroRotator = FFixedRotator64(FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero);
 
@@ -26,3 +27,15 @@ FFixedRotator64 FFixedRotator64::MakeFromEuler(const FFixedVector64& Euler)
 {
 	return FFixedRotator64(Euler.Y, Euler.Z, Euler.X);
 }
+
+void FFixedRotator64::RotateVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel) const
+{
+	FFixedMatrix33(*this).TransformVectors(Vectors, OutVectors, bParallel);
+}
+
+void FFixedRotator64::UnrotateVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel) const
+{
+	// the inverse of a rotation matrix is its transpose
+	FFixedMatrix33(*this).GetTransposed().TransformVectors(Vectors, OutVectors, bParallel);
+}
+
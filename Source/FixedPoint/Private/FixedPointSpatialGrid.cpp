@@ -0,0 +1,520 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointSpatialGrid.h"
+#include "FixedPointInt128.h"
+#include "FixedPointParallel.h"
+
+//a query walks several cells and allocates its result, so batches are split into much smaller parallel tasks than vector transforms
+static constexpr int32 QueryBatchSize = 64;
+
+static FORCEINLINE int32 FloorToCell(int64 Raw, int64 CellRaw)
+{
+	int64 Quotient = Raw / CellRaw;
+	if (Raw % CellRaw != 0 && Raw < 0)
+	{
+		Quotient--;
+	}
+	//cells beyond int32 range share the border cells, queries still test real positions so results stay exact
+	return (int32)FMath::Clamp<int64>(Quotient, -MAX_int32, MAX_int32);
+}
+
+static FORCEINLINE uint32 HashCellCoord(const FIntVector& Coord)
+{
+	uint32 Hash = ((uint32)Coord.X * 73856093u) ^ ((uint32)Coord.Y * 19349663u) ^ ((uint32)Coord.Z * 83492791u);
+	//the table is indexed by the low bits, mix the high bits down into them
+	Hash ^= Hash >> 16;
+	Hash *= 0x7feb352du;
+	Hash ^= Hash >> 15;
+	return Hash;
+}
+
+static FORCEINLINE FIntVector CellMin(const FIntVector& A, const FIntVector& B)
+{
+	return FIntVector(FMath::Min(A.X, B.X), FMath::Min(A.Y, B.Y), FMath::Min(A.Z, B.Z));
+}
+
+static FORCEINLINE FIntVector CellMax(const FIntVector& A, const FIntVector& B)
+{
+	return FIntVector(FMath::Max(A.X, B.X), FMath::Max(A.Y, B.Y), FMath::Max(A.Z, B.Z));
+}
+
+static FORCEINLINE int64 ChebyshevDistance(const FIntVector& A, const FIntVector& B)
+{
+	return FMath::Max3(FMath::Abs((int64)A.X - B.X), FMath::Abs((int64)A.Y - B.Y), FMath::Abs((int64)A.Z - B.Z));
+}
+
+FFixedSpatialGrid::FFixedSpatialGrid()
+	: FFixedSpatialGrid(FFixed64(100))
+{
+}
+
+FFixedSpatialGrid::FFixedSpatialGrid(FFixed64 InCellSize)
+{
+	Reset(InCellSize);
+}
+
+void FFixedSpatialGrid::Reset(FFixed64 InCellSize)
+{
+	check(InCellSize > FixedPoint::Constants::Fixed64::Zero);
+	CellSize = InCellSize;
+	NumElements = 0;
+	Positions.Reset();
+	CellOfId.Reset();
+	PackedIndexOfId.Reset();
+	IdFlags.Reset();
+	DirtyIds.Reset();
+	ChangedIds.Reset();
+	PackedIds.Reset();
+	PackedX.Reset();
+	PackedY.Reset();
+	PackedZ.Reset();
+	Cells.Reset();
+	Slots.Reset();
+	MinOccupied = FIntVector::ZeroValue;
+	MaxOccupied = FIntVector::ZeroValue;
+}
+
+FIntVector FFixedSpatialGrid::GetCellCoord(const FFixedVector64& Position) const
+{
+	return FIntVector(
+		FloorToCell(Position.X.Value, CellSize.Value),
+		FloorToCell(Position.Y.Value, CellSize.Value),
+		FloorToCell(Position.Z.Value, CellSize.Value));
+}
+
+int32 FFixedSpatialGrid::FindCell(const FIntVector& Coord) const
+{
+	if (Slots.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+	const uint32 Mask = (uint32)Slots.Num() - 1;
+	uint32 Index = HashCellCoord(Coord) & Mask;
+	while (true)
+	{
+		const FSlot& Slot = Slots[Index];
+		if (Slot.Cell == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+		if (Slot.Coord == Coord)
+		{
+			return Slot.Cell;
+		}
+		Index = (Index + 1) & Mask;
+	}
+}
+
+bool FFixedSpatialGrid::PackedLess(int32 A, int32 B) const
+{
+	const FIntVector& CellA = CellOfId[A];
+	const FIntVector& CellB = CellOfId[B];
+	if (CellA.Z != CellB.Z)
+	{
+		return CellA.Z < CellB.Z;
+	}
+	if (CellA.Y != CellB.Y)
+	{
+		return CellA.Y < CellB.Y;
+	}
+	if (CellA.X != CellB.X)
+	{
+		return CellA.X < CellB.X;
+	}
+	return A < B;
+}
+
+void FFixedSpatialGrid::MarkDirty(int32 Id)
+{
+	if ((IdFlags[Id] & Dirty) == 0)
+	{
+		IdFlags[Id] |= Dirty;
+		DirtyIds.Add(Id);
+	}
+}
+
+void FFixedSpatialGrid::Insert(int32 Id, const FFixedVector64& Position)
+{
+	check(Id >= 0);
+	if (Id >= IdFlags.Num())
+	{
+		const int32 NewNum = Id + 1;
+		Positions.SetNumUninitialized(NewNum);
+		CellOfId.SetNumUninitialized(NewNum);
+		PackedIndexOfId.SetNumUninitialized(NewNum);
+		IdFlags.SetNumZeroed(NewNum);
+	}
+	checkf((IdFlags[Id] & Present) == 0, TEXT("Id %d is already in the grid"), Id);
+
+	IdFlags[Id] |= Present;
+	Positions[Id] = Position;
+	CellOfId[Id] = GetCellCoord(Position);
+	NumElements++;
+	MarkDirty(Id);
+}
+
+void FFixedSpatialGrid::Remove(int32 Id)
+{
+	check(Contains(Id));
+	IdFlags[Id] &= ~Present;
+	NumElements--;
+	MarkDirty(Id);
+}
+
+void FFixedSpatialGrid::Move(int32 Id, const FFixedVector64& NewPosition)
+{
+	check(Contains(Id));
+	Positions[Id] = NewPosition;
+	const FIntVector NewCell = GetCellCoord(NewPosition);
+	if ((IdFlags[Id] & Dirty) == 0 && NewCell == CellOfId[Id])
+	{
+		//same cell, the packed order is unchanged
+		const int32 PackedIndex = PackedIndexOfId[Id];
+		PackedX[PackedIndex] = NewPosition.X;
+		PackedY[PackedIndex] = NewPosition.Y;
+		PackedZ[PackedIndex] = NewPosition.Z;
+	}
+	else
+	{
+		CellOfId[Id] = NewCell;
+		MarkDirty(Id);
+	}
+}
+
+void FFixedSpatialGrid::Flush()
+{
+	ChangedIds.Reset();
+	if (DirtyIds.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<int32> Incoming;
+	Incoming.Reserve(DirtyIds.Num());
+	for (const int32 Id : DirtyIds)
+	{
+		if ((IdFlags[Id] & Present) != 0)
+		{
+			Incoming.Add(Id);
+		}
+	}
+	Incoming.Sort([this](int32 A, int32 B) { return PackedLess(A, B); });
+
+	//elements that were not touched are still in packed order, so only the dirty ones need sorting before a linear merge
+	TArray<int32> NewIds;
+	NewIds.Reserve(NumElements);
+	int32 Next = 0;
+	for (const int32 Id : PackedIds)
+	{
+		if ((IdFlags[Id] & Dirty) != 0)
+		{
+			continue;
+		}
+		while (Next < Incoming.Num() && PackedLess(Incoming[Next], Id))
+		{
+			NewIds.Add(Incoming[Next++]);
+		}
+		NewIds.Add(Id);
+	}
+	while (Next < Incoming.Num())
+	{
+		NewIds.Add(Incoming[Next++]);
+	}
+	check(NewIds.Num() == NumElements);
+
+	for (const int32 Id : DirtyIds)
+	{
+		IdFlags[Id] &= ~Dirty;
+	}
+	DirtyIds.Reset();
+	ChangedIds = MoveTemp(Incoming);
+	ChangedIds.Sort();
+
+	PackedIds = MoveTemp(NewIds);
+	PackedX.SetNumUninitialized(NumElements);
+	PackedY.SetNumUninitialized(NumElements);
+	PackedZ.SetNumUninitialized(NumElements);
+	Cells.Reset();
+	for (int32 i = 0; i < NumElements; i++)
+	{
+		const int32 Id = PackedIds[i];
+		PackedIndexOfId[Id] = i;
+		PackedX[i] = Positions[Id].X;
+		PackedY[i] = Positions[Id].Y;
+		PackedZ[i] = Positions[Id].Z;
+		const FIntVector& Coord = CellOfId[Id];
+		if (Cells.Num() == 0 || Cells.Last().Coord != Coord)
+		{
+			Cells.Add(FCell{ Coord, i, 0 });
+		}
+		Cells.Last().Num++;
+	}
+
+	MinOccupied = FIntVector(MAX_int32);
+	MaxOccupied = FIntVector(-MAX_int32);
+	for (const FCell& Cell : Cells)
+	{
+		MinOccupied = CellMin(MinOccupied, Cell.Coord);
+		MaxOccupied = CellMax(MaxOccupied, Cell.Coord);
+	}
+
+	//at most half full so probe chains stay short
+	const int32 NumSlots = (int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(Cells.Num() * 2, 16));
+	Slots.SetNumUninitialized(NumSlots);
+	for (FSlot& Slot : Slots)
+	{
+		Slot.Cell = INDEX_NONE;
+	}
+	const uint32 Mask = (uint32)NumSlots - 1;
+	for (int32 CellIndex = 0; CellIndex < Cells.Num(); CellIndex++)
+	{
+		uint32 Index = HashCellCoord(Cells[CellIndex].Coord) & Mask;
+		while (Slots[Index].Cell != INDEX_NONE)
+		{
+			Index = (Index + 1) & Mask;
+		}
+		Slots[Index].Coord = Cells[CellIndex].Coord;
+		Slots[Index].Cell = CellIndex;
+	}
+}
+
+template<typename VisitorType>
+void FFixedSpatialGrid::ForEachCellInRange(const FIntVector& MinCoord, const FIntVector& MaxCoord, VisitorType&& Visitor) const
+{
+	if (Cells.Num() == 0)
+	{
+		return;
+	}
+	const FIntVector Lo = CellMax(MinCoord, MinOccupied);
+	const FIntVector Hi = CellMin(MaxCoord, MaxOccupied);
+	if (Lo.X > Hi.X || Lo.Y > Hi.Y || Lo.Z > Hi.Z)
+	{
+		return;
+	}
+
+	//probing costs a hash lookup per cell in the range, scanning costs a compare per occupied cell, both visit in the same order
+	const int64 NumOccupied = Cells.Num();
+	const int64 SizeX = (int64)Hi.X - Lo.X + 1;
+	const int64 SizeY = (int64)Hi.Y - Lo.Y + 1;
+	const int64 SizeZ = (int64)Hi.Z - Lo.Z + 1;
+	const bool bScan = SizeX > NumOccupied || SizeY > NumOccupied || SizeZ > NumOccupied
+		|| SizeX * SizeY > NumOccupied || SizeX * SizeY * SizeZ > NumOccupied;
+
+	if (bScan)
+	{
+		for (const FCell& Cell : Cells)
+		{
+			if (Cell.Coord.X >= Lo.X && Cell.Coord.X <= Hi.X && Cell.Coord.Y >= Lo.Y && Cell.Coord.Y <= Hi.Y && Cell.Coord.Z >= Lo.Z && Cell.Coord.Z <= Hi.Z)
+			{
+				Visitor(Cell);
+			}
+		}
+		return;
+	}
+
+	//64 bit counters so a range ending at the last int32 cell terminates
+	for (int64 Z = Lo.Z; Z <= Hi.Z; Z++)
+	{
+		for (int64 Y = Lo.Y; Y <= Hi.Y; Y++)
+		{
+			for (int64 X = Lo.X; X <= Hi.X; X++)
+			{
+				const int32 CellIndex = FindCell(FIntVector((int32)X, (int32)Y, (int32)Z));
+				if (CellIndex != INDEX_NONE)
+				{
+					Visitor(Cells[CellIndex]);
+				}
+			}
+		}
+	}
+}
+
+void FFixedSpatialGrid::QueryRadius(const FFixedVector64& Center, FFixed64 Radius, TArray<int32>& OutIds) const
+{
+	checkf(!IsDirty(), TEXT("Flush the grid before querying"));
+	const FFixedVector64 Extent(Radius);
+	const FFixed64 RadiusSquared = Radius * Radius;
+	ForEachCellInRange(GetCellCoord(Center - Extent), GetCellCoord(Center + Extent), [this, &Center, RadiusSquared, &OutIds](const FCell& Cell)
+	{
+		const int32 End = Cell.Start + Cell.Num;
+		for (int32 i = Cell.Start; i < End; i++)
+		{
+			const FFixed64 DX = PackedX[i] - Center.X;
+			const FFixed64 DY = PackedY[i] - Center.Y;
+			const FFixed64 DZ = PackedZ[i] - Center.Z;
+			if (DX * DX + DY * DY + DZ * DZ <= RadiusSquared)
+			{
+				OutIds.Add(PackedIds[i]);
+			}
+		}
+	});
+}
+
+void FFixedSpatialGrid::QueryBox(const FFixedBox& Box, TArray<int32>& OutIds) const
+{
+	checkf(!IsDirty(), TEXT("Flush the grid before querying"));
+	ForEachCellInRange(GetCellCoord(Box.Min), GetCellCoord(Box.Max), [this, &Box, &OutIds](const FCell& Cell)
+	{
+		const int32 End = Cell.Start + Cell.Num;
+		for (int32 i = Cell.Start; i < End; i++)
+		{
+			if (PackedX[i] >= Box.Min.X && PackedX[i] <= Box.Max.X && PackedY[i] >= Box.Min.Y && PackedY[i] <= Box.Max.Y && PackedZ[i] >= Box.Min.Z && PackedZ[i] <= Box.Max.Z)
+			{
+				OutIds.Add(PackedIds[i]);
+			}
+		}
+	});
+}
+
+void FFixedSpatialGrid::QueryNearest(const FFixedVector64& Center, int32 K, TArray<int32>& OutIds) const
+{
+	checkf(!IsDirty(), TEXT("Flush the grid before querying"));
+	OutIds.Reset();
+	if (K <= 0 || NumElements == 0)
+	{
+		return;
+	}
+
+	struct FCandidate
+	{
+		FFixed64 DistSquared;
+		int32 Id;
+
+		FORCEINLINE bool operator<(const FCandidate& Other) const
+		{
+			return DistSquared < Other.DistSquared || (DistSquared == Other.DistSquared && Id < Other.Id);
+		}
+	};
+	//kept sorted nearest first, K is small so insertion beats a heap
+	TArray<FCandidate, TInlineAllocator<32>> Best;
+	Best.Reserve(K + 1);
+
+	auto Consider = [this, &Center, &Best, K](const FCell& Cell)
+	{
+		const int32 End = Cell.Start + Cell.Num;
+		for (int32 i = Cell.Start; i < End; i++)
+		{
+			const FFixed64 DX = PackedX[i] - Center.X;
+			const FFixed64 DY = PackedY[i] - Center.Y;
+			const FFixed64 DZ = PackedZ[i] - Center.Z;
+			const FCandidate Candidate{ DX * DX + DY * DY + DZ * DZ, PackedIds[i] };
+			if (Best.Num() == K && !(Candidate < Best.Last()))
+			{
+				continue;
+			}
+			int32 InsertAt = Best.Num();
+			while (InsertAt > 0 && Candidate < Best[InsertAt - 1])
+			{
+				InsertAt--;
+			}
+			Best.Insert(Candidate, InsertAt);
+			if (Best.Num() > K)
+			{
+				Best.Pop();
+			}
+		}
+	};
+
+	const FIntVector Origin = GetCellCoord(Center);
+	for (int64 Ring = 0; ; Ring++)
+	{
+		const int64 Side = 2 * Ring + 1;
+		const int64 RingCells = Ring == 0 ? 1 : Side * Side * Side - (Side - 2) * (Side - 2) * (Side - 2);
+		if (RingCells > Cells.Num())
+		{
+			//the ring has more cells than are occupied, visit every occupied cell not already visited and stop
+			for (const FCell& Cell : Cells)
+			{
+				if (ChebyshevDistance(Cell.Coord, Origin) >= Ring)
+				{
+					Consider(Cell);
+				}
+			}
+			break;
+		}
+
+		for (int64 Z = Origin.Z - Ring; Z <= Origin.Z + Ring; Z++)
+		{
+			if (Z < MinOccupied.Z || Z > MaxOccupied.Z)
+			{
+				continue;
+			}
+			for (int64 Y = Origin.Y - Ring; Y <= Origin.Y + Ring; Y++)
+			{
+				if (Y < MinOccupied.Y || Y > MaxOccupied.Y)
+				{
+					continue;
+				}
+				//inside the ring's faces only the two X ends belong to the ring
+				const bool bFace = FMath::Abs(Z - Origin.Z) == Ring || FMath::Abs(Y - Origin.Y) == Ring;
+				const int64 Step = (bFace || Ring == 0) ? 1 : 2 * Ring;
+				for (int64 X = Origin.X - Ring; X <= Origin.X + Ring; X += Step)
+				{
+					if (X < MinOccupied.X || X > MaxOccupied.X)
+					{
+						continue;
+					}
+					const int32 CellIndex = FindCell(FIntVector((int32)X, (int32)Y, (int32)Z));
+					if (CellIndex != INDEX_NONE)
+					{
+						Consider(Cells[CellIndex]);
+					}
+				}
+			}
+		}
+
+		if (Origin.X - Ring <= MinOccupied.X && Origin.X + Ring >= MaxOccupied.X
+			&& Origin.Y - Ring <= MinOccupied.Y && Origin.Y + Ring >= MaxOccupied.Y
+			&& Origin.Z - Ring <= MinOccupied.Z && Origin.Z + Ring >= MaxOccupied.Z)
+		{
+			break;
+		}
+
+		if (Best.Num() == K)
+		{
+			//everything not yet visited is at least Ring cells away, its truncated squared distance can be up to 3 raw units short
+			using namespace FixedPoint::Int128;
+			const int64 BoundRaw = Ring * CellSize.Value;
+			if (Compare(Mul(Best.Last().DistSquared.Value + 3, FixedPoint::Constants::Raw64::One), Mul(BoundRaw, BoundRaw)) < 0)
+			{
+				break;
+			}
+		}
+	}
+
+	OutIds.Reserve(Best.Num());
+	for (const FCandidate& Candidate : Best)
+	{
+		OutIds.Add(Candidate.Id);
+	}
+}
+
+void FFixedSpatialGrid::QueryRadius(TArrayView<const FFixedVector64> Centers, FFixed64 Radius, TArrayView<TArray<int32>> OutIds, bool bParallel) const
+{
+	check(Centers.Num() == OutIds.Num());
+	const FFixedVector64* Src = Centers.GetData();
+	TArray<int32>* Dst = OutIds.GetData();
+	FixedPoint::Parallel::ForEachRange(Centers.Num(), bParallel, [this, Src, Dst, Radius](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			Dst[i].Reset();
+			QueryRadius(Src[i], Radius, Dst[i]);
+		}
+	}, QueryBatchSize);
+}
+
+void FFixedSpatialGrid::QueryNearest(TArrayView<const FFixedVector64> Centers, int32 K, TArrayView<TArray<int32>> OutIds, bool bParallel) const
+{
+	check(Centers.Num() == OutIds.Num());
+	const FFixedVector64* Src = Centers.GetData();
+	TArray<int32>* Dst = OutIds.GetData();
+	FixedPoint::Parallel::ForEachRange(Centers.Num(), bParallel, [this, Src, Dst, K](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			QueryNearest(Src[i], K, Dst[i]);
+		}
+	}, QueryBatchSize);
+}
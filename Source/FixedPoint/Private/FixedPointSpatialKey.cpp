@@ -0,0 +1,286 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointSpatialKey.h"
+#include "FixedPointParallel.h"
+#include "FixedPointRadixSort.h"
+#include <atomic>
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_64BITS
+#include <immintrin.h>
+#include "FixedPointCPU.h"
+#define FIXEDPOINT_WITH_BMI2 1
+#if defined(__clang__) || defined(__GNUC__)
+#define FIXEDPOINT_TARGET_BMI2 __attribute__((target("bmi2")))
+#else
+#define FIXEDPOINT_TARGET_BMI2
+#endif
+#else
+#define FIXEDPOINT_WITH_BMI2 0
+#endif
+
+//positions each task keys, a key is a few dozen instructions
+static constexpr int32 KeyBatchSize = 4096;
+//every third bit from bit zero, the bits of the x axis in a 3D key
+static constexpr uint64 Mask3D = 0x1249249249249249ull;
+//every other bit from bit zero, the bits of the x axis in a 2D key
+static constexpr uint64 Mask2D = 0x5555555555555555ull;
+
+namespace
+{
+	/** Snaps raw coordinates to cells, by shifting when the cell size is a power of two and floor dividing otherwise */
+	struct FCellScale
+	{
+		int64 Size;
+		int32 Shift;
+
+		explicit FCellScale(FFixed64 CellSize)
+			: Size(CellSize.Value)
+			, Shift(FMath::IsPowerOfTwo(CellSize.Value) ? (int32)FMath::CountTrailingZeros64((uint64)CellSize.Value) : INDEX_NONE)
+		{
+			check(CellSize.Value > 0);
+		}
+
+		FORCEINLINE int64 ToCell(int64 Raw) const
+		{
+			if (Shift >= 0)
+			{
+				return Raw >> Shift;
+			}
+			const int64 Quotient = Raw / Size;
+			return Quotient - (Raw < 0 && Quotient * Size != Raw);
+		}
+
+		/** @return the cell offset so cell zero is mid range and clamped to NumBits */
+		template<int32 NumBits>
+		FORCEINLINE uint32 ToKeyCell(int64 Raw) const
+		{
+			const int64 Cell = ToCell(Raw) + ((int64)1 << (NumBits - 1));
+			return (uint32)FMath::Clamp<int64>(Cell, 0, ((int64)1 << NumBits) - 1);
+		}
+	};
+}
+
+static std::atomic<bool>& UseBMI2()
+{
+#if FIXEDPOINT_WITH_BMI2
+	static std::atomic<bool> bUse(FixedPoint::CPU::HasBMI2());
+#else
+	static std::atomic<bool> bUse(false);
+#endif
+	return bUse;
+}
+
+/** Spreads the low 21 bits two bits apart */
+static FORCEINLINE uint64 Spread3(uint32 Value)
+{
+	uint64 Bits = Value & 0x1FFFFF;
+	Bits = (Bits | Bits << 32) & 0x001F00000000FFFFull;
+	Bits = (Bits | Bits << 16) & 0x001F0000FF0000FFull;
+	Bits = (Bits | Bits << 8) & 0x100F00F00F00F00Full;
+	Bits = (Bits | Bits << 4) & 0x10C30C30C30C30C3ull;
+	Bits = (Bits | Bits << 2) & Mask3D;
+	return Bits;
+}
+
+/** Spreads 32 bits one bit apart */
+static FORCEINLINE uint64 Spread2(uint32 Value)
+{
+	uint64 Bits = Value;
+	Bits = (Bits | Bits << 16) & 0x0000FFFF0000FFFFull;
+	Bits = (Bits | Bits << 8) & 0x00FF00FF00FF00FFull;
+	Bits = (Bits | Bits << 4) & 0x0F0F0F0F0F0F0F0Full;
+	Bits = (Bits | Bits << 2) & 0x3333333333333333ull;
+	Bits = (Bits | Bits << 1) & Mask2D;
+	return Bits;
+}
+
+#if FIXEDPOINT_WITH_BMI2
+//not force inlined, callers are built without bmi2 and inlining across targets fails
+FIXEDPOINT_TARGET_BMI2 static uint64 Interleave3BMI2(uint32 X, uint32 Y, uint32 Z)
+{
+	return _pdep_u64(X, Mask3D) | _pdep_u64(Y, Mask3D << 1) | _pdep_u64(Z, Mask3D << 2);
+}
+
+FIXEDPOINT_TARGET_BMI2 static uint64 Interleave2BMI2(uint32 X, uint32 Y)
+{
+	return _pdep_u64(X, Mask2D) | _pdep_u64(Y, Mask2D << 1);
+}
+#endif
+
+/** Interleaves the cells with the first axis in the lowest bit of each group */
+template<int32 NumAxes>
+static FORCEINLINE uint64 Interleave(const uint32 Cells[NumAxes], bool bBMI2)
+{
+#if FIXEDPOINT_WITH_BMI2
+	if (bBMI2)
+	{
+		return NumAxes == 3 ? Interleave3BMI2(Cells[0], Cells[1], Cells[NumAxes - 1]) : Interleave2BMI2(Cells[0], Cells[1]);
+	}
+#endif
+	return NumAxes == 3 ? Spread3(Cells[0]) | Spread3(Cells[1]) << 1 | Spread3(Cells[NumAxes - 1]) << 2 : Spread2(Cells[0]) | Spread2(Cells[1]) << 1;
+}
+
+/**
+* Skilling's transform of cell coordinates to the transposed Hilbert index, "Programming the Hilbert curve" (2004).
+* Afterwards the index's bits read from the top bit of Cells[0] down through each axis in turn.
+*/
+template<int32 NumAxes, int32 NumBits>
+static FORCEINLINE void AxesToTranspose(uint32 Cells[NumAxes])
+{
+	const uint32 Top = 1u << (NumBits - 1);
+	//undo the excess work of the inverse
+	for (uint32 Q = Top; Q > 1; Q >>= 1)
+	{
+		const uint32 P = Q - 1;
+		for (int32 Axis = 0; Axis < NumAxes; Axis++)
+		{
+			if (Cells[Axis] & Q)
+			{
+				Cells[0] ^= P;
+			}
+			else
+			{
+				const uint32 Swap = (Cells[0] ^ Cells[Axis]) & P;
+				Cells[0] ^= Swap;
+				Cells[Axis] ^= Swap;
+			}
+		}
+	}
+	//gray encode
+	for (int32 Axis = 1; Axis < NumAxes; Axis++)
+	{
+		Cells[Axis] ^= Cells[Axis - 1];
+	}
+	uint32 Flip = 0;
+	for (uint32 Q = Top; Q > 1; Q >>= 1)
+	{
+		if (Cells[NumAxes - 1] & Q)
+		{
+			Flip ^= Q - 1;
+		}
+	}
+	for (int32 Axis = 0; Axis < NumAxes; Axis++)
+	{
+		Cells[Axis] ^= Flip;
+	}
+}
+
+template<int32 NumAxes>
+static FORCEINLINE uint64 KeyFromRaw(const int64 Raw[NumAxes], const FCellScale& Scale, EFixedSpatialCurve Curve, bool bBMI2)
+{
+	constexpr int32 NumBits = NumAxes == 3 ? FFixedSpatialKey::Bits3D : FFixedSpatialKey::Bits2D;
+	uint32 Cells[NumAxes];
+	for (int32 Axis = 0; Axis < NumAxes; Axis++)
+	{
+		Cells[Axis] = Scale.ToKeyCell<NumBits>(Raw[Axis]);
+	}
+	if (Curve == EFixedSpatialCurve::Hilbert)
+	{
+		AxesToTranspose<NumAxes, NumBits>(Cells);
+		//the transposed index leads with Cells[0], the interleave puts the first axis lowest
+		Swap(Cells[0], Cells[NumAxes - 1]);
+	}
+	return Interleave<NumAxes>(Cells, bBMI2);
+}
+
+/** Keys every position, GetRaw(Index, Raw) fills in a position's raw coordinates */
+template<int32 NumAxes, typename GetRawType>
+static void MakeKeysInternal(int32 Num, FFixed64 CellSize, EFixedSpatialCurve Curve, TArrayView<uint64> OutKeys, bool bParallel, GetRawType&& GetRaw)
+{
+	check(OutKeys.Num() == Num);
+	const FCellScale Scale(CellSize);
+	const bool bBMI2 = UseBMI2().load(std::memory_order_relaxed);
+	FixedPoint::Parallel::ForEachRange(Num, bParallel, [&Scale, Curve, bBMI2, OutKeys, &GetRaw](int32 Start, int32 End)
+	{
+		int64 Raw[NumAxes];
+		for (int32 i = Start; i < End; i++)
+		{
+			GetRaw(i, Raw);
+			OutKeys[i] = KeyFromRaw<NumAxes>(Raw, Scale, Curve, bBMI2);
+		}
+	}, KeyBatchSize);
+}
+
+uint64 FFixedSpatialKey::Morton(const FFixedVector64& Position, FFixed64 CellSize)
+{
+	const int64 Raw[3] = { Position.X.Value, Position.Y.Value, Position.Z.Value };
+	return KeyFromRaw<3>(Raw, FCellScale(CellSize), EFixedSpatialCurve::Morton, UseBMI2().load(std::memory_order_relaxed));
+}
+
+uint64 FFixedSpatialKey::Morton(const FFixedVector2d& Position, FFixed64 CellSize)
+{
+	const int64 Raw[2] = { Position.X.Value, Position.Y.Value };
+	return KeyFromRaw<2>(Raw, FCellScale(CellSize), EFixedSpatialCurve::Morton, UseBMI2().load(std::memory_order_relaxed));
+}
+
+uint64 FFixedSpatialKey::Hilbert(const FFixedVector64& Position, FFixed64 CellSize)
+{
+	const int64 Raw[3] = { Position.X.Value, Position.Y.Value, Position.Z.Value };
+	return KeyFromRaw<3>(Raw, FCellScale(CellSize), EFixedSpatialCurve::Hilbert, UseBMI2().load(std::memory_order_relaxed));
+}
+
+uint64 FFixedSpatialKey::Hilbert(const FFixedVector2d& Position, FFixed64 CellSize)
+{
+	const int64 Raw[2] = { Position.X.Value, Position.Y.Value };
+	return KeyFromRaw<2>(Raw, FCellScale(CellSize), EFixedSpatialCurve::Hilbert, UseBMI2().load(std::memory_order_relaxed));
+}
+
+void FFixedSpatialKey::MakeKeys(TArrayView<const FFixedVector64> Positions, FFixed64 CellSize, EFixedSpatialCurve Curve, TArrayView<uint64> OutKeys, bool bParallel)
+{
+	MakeKeysInternal<3>(Positions.Num(), CellSize, Curve, OutKeys, bParallel, [Positions](int32 Index, int64 Raw[3])
+	{
+		Raw[0] = Positions[Index].X.Value;
+		Raw[1] = Positions[Index].Y.Value;
+		Raw[2] = Positions[Index].Z.Value;
+	});
+}
+
+void FFixedSpatialKey::MakeKeys(TArrayView<const FFixedVector2d> Positions, FFixed64 CellSize, EFixedSpatialCurve Curve, TArrayView<uint64> OutKeys, bool bParallel)
+{
+	MakeKeysInternal<2>(Positions.Num(), CellSize, Curve, OutKeys, bParallel, [Positions](int32 Index, int64 Raw[2])
+	{
+		Raw[0] = Positions[Index].X.Value;
+		Raw[1] = Positions[Index].Y.Value;
+	});
+}
+
+void FFixedSpatialKey::MakeKeys(TArrayView<const FFixed64> X, TArrayView<const FFixed64> Y, TArrayView<const FFixed64> Z, FFixed64 CellSize, EFixedSpatialCurve Curve, TArrayView<uint64> OutKeys, bool bParallel)
+{
+	check(Y.Num() == X.Num() && Z.Num() == X.Num());
+	MakeKeysInternal<3>(X.Num(), CellSize, Curve, OutKeys, bParallel, [X, Y, Z](int32 Index, int64 Raw[3])
+	{
+		Raw[0] = X[Index].Value;
+		Raw[1] = Y[Index].Value;
+		Raw[2] = Z[Index].Value;
+	});
+}
+
+void FFixedSpatialKey::MakeKeys(TArrayView<const FFixed64> X, TArrayView<const FFixed64> Y, FFixed64 CellSize, EFixedSpatialCurve Curve, TArrayView<uint64> OutKeys, bool bParallel)
+{
+	check(Y.Num() == X.Num());
+	MakeKeysInternal<2>(X.Num(), CellSize, Curve, OutKeys, bParallel, [X, Y](int32 Index, int64 Raw[2])
+	{
+		Raw[0] = X[Index].Value;
+		Raw[1] = Y[Index].Value;
+	});
+}
+
+void FFixedSpatialKey::SortOrder(TArrayView<const uint64> Keys, TArray<int32>& OutOrder, bool bParallel)
+{
+	FFixedRadixSort::ArgSort(Keys, OutOrder, bParallel);
+}
+
+bool FFixedSpatialKey::IsUsingBMI2()
+{
+	return UseBMI2().load(std::memory_order_relaxed);
+}
+
+bool FFixedSpatialKey::SetUseBMI2(bool bUse)
+{
+#if FIXEDPOINT_WITH_BMI2
+	static const bool bSupported = FixedPoint::CPU::HasBMI2();
+	UseBMI2().store(bUse && bSupported, std::memory_order_relaxed);
+#endif
+	return IsUsingBMI2();
+}
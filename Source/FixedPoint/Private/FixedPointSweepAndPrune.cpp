@@ -0,0 +1,286 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointSweepAndPrune.h"
+#include "FixedPointParallel.h"
+#include "FixedPointRadixSort.h"
+
+//boxes each task sweeps, a box is compared with the handful of neighbors that overlap it on the sweep axis
+static constexpr int32 PairBatchSize = 1024;
+//average distance a box may move through the sorted order before the insertion sort gives up and the order is rebuilt
+static constexpr int64 MaxShiftsPerBox = 16;
+//inserts beyond one for every this many kept boxes rebuild the order instead of inserting each one
+static constexpr int32 RebuildInsertRatio = 8;
+
+static FORCEINLINE bool IsSweepAxis(EAxis::Type Axis)
+{
+	return Axis == EAxis::X || Axis == EAxis::Y || Axis == EAxis::Z;
+}
+
+static FORCEINLINE int32 GetAxisIndex(EAxis::Type Axis)
+{
+	checkSlow(IsSweepAxis(Axis));
+	return (int32)Axis - (int32)EAxis::X;
+}
+
+/** Lower id in the high half, so sorting packed pairs sorts by lower id then higher id */
+static FORCEINLINE uint64 PackPair(int32 A, int32 B)
+{
+	return A < B ? ((uint64)A << 32) | (uint32)B : ((uint64)B << 32) | (uint32)A;
+}
+
+FFixedSweepAndPrune::FFixedSweepAndPrune()
+	: FFixedSweepAndPrune(EAxis::X)
+{
+}
+
+FFixedSweepAndPrune::FFixedSweepAndPrune(EAxis::Type InSweepAxis)
+{
+	Reset(InSweepAxis);
+}
+
+void FFixedSweepAndPrune::Reset(EAxis::Type InSweepAxis)
+{
+	check(IsSweepAxis(InSweepAxis));
+	SweepAxis = InSweepAxis;
+	NumElements = 0;
+	bOrderDirty = false;
+	bRebuildOrder = false;
+	Boxes.Reset();
+	SortedIndexOfId.Reset();
+	IdFlags.Reset();
+	DirtyIds.Reset();
+	SortedMin.Reset();
+	SortedBoxes.Reset();
+}
+
+void FFixedSweepAndPrune::SetSweepAxis(EAxis::Type InSweepAxis)
+{
+	check(IsSweepAxis(InSweepAxis));
+	if (InSweepAxis != SweepAxis)
+	{
+		SweepAxis = InSweepAxis;
+		bOrderDirty = true;
+		bRebuildOrder = true;
+	}
+}
+
+FFixedSweepAndPrune::FSortedBox FFixedSweepAndPrune::MakeSortedBox(int32 Id, int64& OutSweepMin) const
+{
+	const FFixedBox& Box = Boxes[Id];
+	const int32 Sweep = GetAxisIndex(SweepAxis);
+	const int32 AxisA = (Sweep + 1) % 3;
+	const int32 AxisB = (Sweep + 2) % 3;
+	OutSweepMin = Box.Min[Sweep].Value;
+	return FSortedBox{ Box.Max[Sweep].Value, Box.Min[AxisA].Value, Box.Max[AxisA].Value, Box.Min[AxisB].Value, Box.Max[AxisB].Value, Id };
+}
+
+void FFixedSweepAndPrune::MarkDirty(int32 Id)
+{
+	if ((IdFlags[Id] & Dirty) == 0)
+	{
+		IdFlags[Id] |= Dirty;
+		DirtyIds.Add(Id);
+	}
+}
+
+void FFixedSweepAndPrune::Insert(int32 Id, const FFixedBox& Box)
+{
+	check(Id >= 0);
+	if (Id >= IdFlags.Num())
+	{
+		const int32 NewNum = Id + 1;
+		Boxes.SetNumUninitialized(NewNum);
+		SortedIndexOfId.SetNumUninitialized(NewNum);
+		IdFlags.SetNumZeroed(NewNum);
+	}
+	checkf((IdFlags[Id] & Present) == 0, TEXT("Id %d is already in the sweep and prune"), Id);
+
+	IdFlags[Id] |= Present;
+	Boxes[Id] = Box;
+	NumElements++;
+	MarkDirty(Id);
+}
+
+void FFixedSweepAndPrune::Remove(int32 Id)
+{
+	check(Contains(Id));
+	IdFlags[Id] &= ~Present;
+	NumElements--;
+	MarkDirty(Id);
+}
+
+void FFixedSweepAndPrune::Move(int32 Id, const FFixedBox& NewBox)
+{
+	check(Contains(Id));
+	Boxes[Id] = NewBox;
+	if ((IdFlags[Id] & Dirty) == 0)
+	{
+		//update the entry where it is, Flush moves it to its new place in the order
+		const int32 SortedIndex = SortedIndexOfId[Id];
+		SortedBoxes[SortedIndex] = MakeSortedBox(Id, SortedMin[SortedIndex]);
+		bOrderDirty = true;
+	}
+}
+
+void FFixedSweepAndPrune::RebuildOrder()
+{
+	//ids ascending into a stable sort, so equal minimums stay in id order
+	TArray<int32> Ids;
+	TArray<FFixed64> Keys;
+	Ids.Reserve(NumElements);
+	Keys.Reserve(NumElements);
+	const int32 Sweep = GetAxisIndex(SweepAxis);
+	for (int32 Id = 0; Id < IdFlags.Num(); Id++)
+	{
+		if ((IdFlags[Id] & Present) != 0)
+		{
+			Ids.Add(Id);
+			Keys.Add(Boxes[Id].Min[Sweep]);
+		}
+	}
+	TArray<int32> Order;
+	FFixedRadixSort::ArgSort(Keys, Order);
+	SortedMin.SetNumUninitialized(Ids.Num());
+	SortedBoxes.SetNumUninitialized(Ids.Num());
+	for (int32 i = 0; i < Ids.Num(); i++)
+	{
+		SortedBoxes[i] = MakeSortedBox(Ids[Order[i]], SortedMin[i]);
+	}
+}
+
+bool FFixedSweepAndPrune::InsertionSortOrder()
+{
+	const int32 NumSorted = SortedMin.Num();
+	const int64 MaxShifts = (int64)NumSorted * MaxShiftsPerBox;
+	int64 Shifts = 0;
+	int64* Mins = SortedMin.GetData();
+	FSortedBox* Sorted = SortedBoxes.GetData();
+	for (int32 i = 1; i < NumSorted; i++)
+	{
+		const int64 Min = Mins[i];
+		if (Mins[i - 1] < Min || (Mins[i - 1] == Min && Sorted[i - 1].Id < Sorted[i].Id))
+		{
+			continue;
+		}
+		const FSortedBox Box = Sorted[i];
+		int32 Slot = i;
+		for (; Slot > 0 && (Mins[Slot - 1] > Min || (Mins[Slot - 1] == Min && Sorted[Slot - 1].Id > Box.Id)); Slot--)
+		{
+			Mins[Slot] = Mins[Slot - 1];
+			Sorted[Slot] = Sorted[Slot - 1];
+		}
+		Mins[Slot] = Min;
+		Sorted[Slot] = Box;
+		Shifts += i - Slot;
+		if (Shifts > MaxShifts)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FFixedSweepAndPrune::Flush()
+{
+	if (!IsDirty())
+	{
+		return;
+	}
+
+	if (DirtyIds.Num() > 0)
+	{
+		//drop the entries of removed and re-inserted ids, keeping the rest in order
+		int32 NumKept = 0;
+		for (int32 i = 0; i < SortedBoxes.Num(); i++)
+		{
+			if ((IdFlags[SortedBoxes[i].Id] & Dirty) == 0)
+			{
+				SortedMin[NumKept] = SortedMin[i];
+				SortedBoxes[NumKept] = SortedBoxes[i];
+				NumKept++;
+			}
+		}
+		SortedMin.SetNum(NumKept);
+		SortedBoxes.SetNum(NumKept);
+
+		//new entries go on the end in id order for the insertion sort to place
+		DirtyIds.Sort();
+		int32 NumInserted = 0;
+		for (const int32 Id : DirtyIds)
+		{
+			IdFlags[Id] &= ~Dirty;
+			if ((IdFlags[Id] & Present) != 0)
+			{
+				int64 Min;
+				const FSortedBox Box = MakeSortedBox(Id, Min);
+				SortedMin.Add(Min);
+				SortedBoxes.Add(Box);
+				NumInserted++;
+			}
+		}
+		DirtyIds.Reset();
+		if ((int64)NumInserted * RebuildInsertRatio > NumKept)
+		{
+			bRebuildOrder = true;
+		}
+	}
+	check(SortedBoxes.Num() == NumElements);
+
+	if (bRebuildOrder || !InsertionSortOrder())
+	{
+		RebuildOrder();
+	}
+	for (int32 i = 0; i < SortedBoxes.Num(); i++)
+	{
+		SortedIndexOfId[SortedBoxes[i].Id] = i;
+	}
+	bOrderDirty = false;
+	bRebuildOrder = false;
+}
+
+void FFixedSweepAndPrune::FindPairs(TArray<FIntPoint>& OutPairs, bool bParallel) const
+{
+	checkf(!IsDirty(), TEXT("Flush the sweep and prune before finding pairs"));
+	const int32 NumSorted = SortedBoxes.Num();
+	TArray<TArray<uint64>> BatchPairs;
+	BatchPairs.SetNum(FMath::Max(1, (NumSorted + PairBatchSize - 1) / PairBatchSize));
+	FixedPoint::Parallel::ForEachRange(NumSorted, bParallel, [this, NumSorted, &BatchPairs](int32 Start, int32 End)
+	{
+		TArray<uint64>& Pairs = BatchPairs[Start / PairBatchSize];
+		const int64* Mins = SortedMin.GetData();
+		const FSortedBox* Sorted = SortedBoxes.GetData();
+		for (int32 i = Start; i < End; i++)
+		{
+			const FSortedBox& Box = Sorted[i];
+			//later boxes start at or after this one, the first that starts past its end ends the sweep
+			for (int32 Other = i + 1; Other < NumSorted && Mins[Other] <= Box.SweepMax; Other++)
+			{
+				const FSortedBox& OtherBox = Sorted[Other];
+				if (OtherBox.MinA <= Box.MaxA && Box.MinA <= OtherBox.MaxA && OtherBox.MinB <= Box.MaxB && Box.MinB <= OtherBox.MaxB)
+				{
+					Pairs.Add(PackPair(Box.Id, OtherBox.Id));
+				}
+			}
+		}
+	}, PairBatchSize);
+
+	TArray<uint64> Packed;
+	int32 NumPairs = 0;
+	for (const TArray<uint64>& Pairs : BatchPairs)
+	{
+		NumPairs += Pairs.Num();
+	}
+	Packed.Reserve(NumPairs);
+	for (const TArray<uint64>& Pairs : BatchPairs)
+	{
+		Packed.Append(Pairs);
+	}
+	FFixedRadixSort::Sort(Packed, bParallel);
+
+	OutPairs.SetNumUninitialized(NumPairs);
+	for (int32 i = 0; i < NumPairs; i++)
+	{
+		OutPairs[i] = FIntPoint((int32)(Packed[i] >> 32), (int32)(uint32)Packed[i]);
+	}
+}
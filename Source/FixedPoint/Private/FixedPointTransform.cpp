@@ -2,6 +2,9 @@
 
 #include "FixedPointTransform.h"
 #include "Misc/DefaultValueHelper.h"
+#include "FixedPointHierarchy.h"
+#include "FixedPointSoA.h"
+#include "FixedPointParallel.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogTransform, Log, All);
 
@@ -189,4 +192,52 @@ void FFixedTransform64::SetToRelativeTransform(const FFixedTransform64& ParentTr
 	Scale3D *= SafeRecipScale3D;
 	Translation = (InverseRot * (Translation - ParentTransform.Translation)) * SafeRecipScale3D;
 	Rotation = InverseRot * Rotation;
-}
\ No newline at end of file
+}
+
+//a transform multiply costs far more than a vector transform, so levels are split into smaller parallel tasks
+static constexpr int32 HierarchyBatchSize = 256;
+
+void FFixedTransform64::ComposeHierarchy(TArrayView<const int32> ParentIndices, TArrayView<const FFixedTransform64> LocalTransforms, TArrayView<FFixedTransform64> OutComponentTransforms, bool bParallel)
+{
+	FFixedHierarchyLevels Levels;
+	if (!ensureMsgf(Levels.Build(ParentIndices), TEXT("ComposeHierarchy given a parent index out of range or a cycle")))
+	{
+		return;
+	}
+	FFixedTransform64SoA Workspace;
+	ComposeHierarchy(Levels, LocalTransforms, OutComponentTransforms, Workspace, bParallel);
+}
+
+void FFixedTransform64::ComposeHierarchy(const FFixedHierarchyLevels& Levels, TArrayView<const FFixedTransform64> LocalTransforms, TArrayView<FFixedTransform64> OutComponentTransforms, FFixedTransform64SoA& Workspace, bool bParallel)
+{
+	check(LocalTransforms.Num() == Levels.Num() && OutComponentTransforms.Num() == Levels.Num());
+	Workspace.SetNumUninitialized(Levels.Num());
+
+	const int32* Order = Levels.Order.GetData();
+	const int32* SortedParents = Levels.SortedParents.GetData();
+	const FFixedTransform64* Local = LocalTransforms.GetData();
+	FFixedTransform64* Out = OutComponentTransforms.GetData();
+	FFixedTransform64SoA* Sorted = &Workspace;
+
+	for (int32 Level = 0; Level < Levels.NumLevels(); Level++)
+	{
+		const int32 LevelStart = Levels.LevelStarts[Level];
+		const int32 LevelNum = Levels.LevelStarts[Level + 1] - LevelStart;
+		FixedPoint::Parallel::ForEachRange(LevelNum, bParallel, [=](int32 Start, int32 End)
+		{
+			for (int32 i = LevelStart + Start; i < LevelStart + End; i++)
+			{
+				const int32 Node = Order[i];
+				FFixedTransform64 Result = Local[Node];
+				if (SortedParents[i] != INDEX_NONE)
+				{
+					const FFixedTransform64 Parent = Sorted->Get(SortedParents[i]);
+					Multiply(&Result, &Local[Node], &Parent);
+				}
+				Sorted->Set(i, Result);
+				Out[Node] = Result;
+			}
+		}, HierarchyBatchSize);
+	}
+}
+
@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointTriangleMesh.h"
+#include "FixedPointGJK.h"
+#include "FixedPointInt128.h"
+#include "FixedPointParallel.h"
+
+//sweeps each task handles, a sweep runs a few GJK queries for every triangle near its path
+static constexpr int32 SweepBatchSize = 64;
+//closing distance over the whole move at or below which the shape only slides along the surface, a few roundings of a dot product
+static constexpr int64 RawSlideTolerance = 16;
+
+namespace
+{
+	/** Sphere or capsule moving from Start to Start + Delta */
+	struct FSweptShape
+	{
+		FFixedVector64 Start;
+		FFixedVector64 Delta;
+		FFixedVector64 HalfAxis;
+		FFixed64 Radius;
+
+		FORCEINLINE FFixedConvexShape At(FFixed64 Time) const
+		{
+			const FFixedVector64 Center = Start + Delta * Time;
+			return HalfAxis.IsZero() ? FFixedConvexShape::MakeSphere(Center, Radius) : FFixedConvexShape::MakeCapsule(Center - HalfAxis, Center + HalfAxis, Radius);
+		}
+	};
+}
+
+/** Dot product with a single rounding */
+static FORCEINLINE FFixed64 Dot(const FFixedVector64& A, const FFixedVector64& B)
+{
+	return FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(A.X.Value, B.X.Value, A.Y.Value, B.Y.Value, A.Z.Value, B.Z.Value));
+}
+
+/**
+* Conservative advancement of the shape against one triangle.
+* Each step moves the shape until the gap along the current normal would be half the contact tolerance, so rounding
+* in GJK's distance never carries it into the triangle.
+*
+* @param MaxTime - Stop once the shape gets past this time without a hit
+*/
+static bool SweepTriangle(const FSweptShape& Shape, TArrayView<const FFixedVector64> Triangle, FFixed64 MaxTime, FFixedSweepHit& OutHit)
+{
+	const FFixedConvexShape Target = FFixedConvexShape::MakeHull(Triangle);
+	const FFixed64 TargetGap = FFixed64::MakeFromRawInt(FFixedTriangleMesh::ContactTolerance.Value >> 1);
+	FFixedGJKCache Cache;
+	FFixedGJKResult Result;
+	FFixed64 Time = FixedPoint::Constants::Fixed64::Zero;
+	for (int32 Iteration = 0; Iteration < FFixedTriangleMesh::MaxSweepIterations; Iteration++)
+	{
+		const FFixedConvexShape Moving = Shape.At(Time);
+		if (!FFixedGJK::ComputeDistance(Moving, Target, Result, &Cache) && Result.Normal.IsZero())
+		{
+			//the cores overlap, which advancing never causes, so the shape started this way
+			FFixedGJK::ComputePenetration(Moving, Target, Result, &Cache);
+		}
+		//how far the whole move closes the gap along the normal from the shape to the triangle
+		const FFixed64 Closing = Dot(Shape.Delta, Result.Normal);
+		if (Closing.Value <= RawSlideTolerance)
+		{
+			return false;
+		}
+		if (Result.Distance <= FFixedTriangleMesh::ContactTolerance)
+		{
+			break;
+		}
+		const FFixed64 Step = (Result.Distance - TargetGap) / Closing;
+		//the rest of the gap is below the resolution of Time
+		if (Step.Value <= 0)
+		{
+			break;
+		}
+		Time += Step;
+		if (Time > MaxTime)
+		{
+			return false;
+		}
+	}
+	//also reached when the iterations run out on a grazing path, stopping early is the safe answer
+	OutHit.Time = Time;
+	OutHit.Normal = -Result.Normal;
+	OutHit.Location = Result.PointB;
+	return true;
+}
+
+static bool Sweep(const FFixedTriangleMesh& Mesh, const FSweptShape& Shape, FFixedSweepHit& OutHit)
+{
+	//the shape's center stays within this of a triangle's bounds on every axis while it is within the tolerance
+	const FFixed64 Expand = Shape.Radius + FFixedTriangleMesh::ContactTolerance
+		+ FMath::Max3(FFixedPointMath::Abs(Shape.HalfAxis.X), FFixedPointMath::Abs(Shape.HalfAxis.Y), FFixedPointMath::Abs(Shape.HalfAxis.Z));
+	FFixedSweepHit Best;
+	FFixedBVHHit TreeHit;
+	Mesh.GetBVH().SphereCast(Shape.Start, Shape.Start + Shape.Delta, Expand, TreeHit, [&Mesh, &Shape, &Best](int32 Triangle, FFixed64& Time)
+	{
+		FFixedSweepHit Hit;
+		if (!SweepTriangle(Shape, Mesh.GetTriangle(Triangle), Best.Time, Hit))
+		{
+			return false;
+		}
+		//the order the tree keeps, earliest first and then the lower index
+		if (Best.Triangle == INDEX_NONE || Hit.Time < Best.Time || (Hit.Time == Best.Time && Triangle < Best.Triangle))
+		{
+			Best = Hit;
+			Best.Triangle = Triangle;
+		}
+		Time = Hit.Time;
+		return true;
+	});
+	OutHit = Best;
+	return Best.Triangle != INDEX_NONE;
+}
+
+void FFixedTriangleMesh::Build(TArrayView<const FFixedVector64> Vertices, TArrayView<const int32> Indices)
+{
+	check(Indices.Num() % 3 == 0);
+	Corners.Reset(Indices.Num());
+	TArray<FFixedBox> Bounds;
+	Bounds.Reserve(Indices.Num() / 3);
+	for (int32 i = 0; i < Indices.Num(); i += 3)
+	{
+		Corners.Add(Vertices[Indices[i]]);
+		Corners.Add(Vertices[Indices[i + 1]]);
+		Corners.Add(Vertices[Indices[i + 2]]);
+		Bounds.Add(FFixedBox(GetTriangle(i / 3)));
+	}
+	BVH.Build(Bounds);
+}
+
+void FFixedTriangleMesh::Reset()
+{
+	Corners.Reset();
+	BVH.Reset();
+}
+
+bool FFixedTriangleMesh::SphereSweep(const FFixedVector64& Start, const FFixedVector64& End, FFixed64 Radius, FFixedSweepHit& OutHit) const
+{
+	return Sweep(*this, FSweptShape{ Start, End - Start, FFixedVector64::ZeroVector, Radius }, OutHit);
+}
+
+bool FFixedTriangleMesh::CapsuleSweep(const FFixedVector64& Start, const FFixedVector64& End, const FFixedVector64& HalfAxis, FFixed64 Radius, FFixedSweepHit& OutHit) const
+{
+	return Sweep(*this, FSweptShape{ Start, End - Start, HalfAxis, Radius }, OutHit);
+}
+
+void FFixedTriangleMesh::SweepBatch(TArrayView<const FFixedSweep> Sweeps, TArrayView<FFixedSweepHit> OutHits, bool bParallel) const
+{
+	check(OutHits.Num() == Sweeps.Num());
+	FixedPoint::Parallel::ForEachRange(Sweeps.Num(), bParallel, [this, Sweeps, OutHits](int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; i++)
+		{
+			const FFixedSweep& Request = Sweeps[i];
+			Sweep(*this, FSweptShape{ Request.Start, Request.End - Request.Start, Request.HalfAxis, Request.Radius }, OutHits[i]);
+		}
+	}, SweepBatchSize);
+}
@@ -0,0 +1,6 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "FixedPointUnitQuat.h"
+
+const FFixedUnitQuat FFixedUnitQuat::Identity(0, 0, 0, FixedPoint::Constants::RawUnit::One);
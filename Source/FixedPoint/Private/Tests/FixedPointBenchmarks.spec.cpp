@@ -0,0 +1,1236 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "FixedPointTypes.h"
+
+BEGIN_DEFINE_SPEC(FFixedPointBenchmarkSpec, "FixedPoint.FixedPointBenchmarks", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::ApplicationContextMask)
+    TArray<FFixedVector64> MakePoints(int32 Count, int32 Seed) const
+    {
+        FRandomStream Stream(Seed);
+        TArray<FFixedVector64> Points;
+        Points.SetNumUninitialized(Count);
+        for (int32 i = 0; i < Count; i++)
+        {
+            Points[i] = FFixedVector64(
+                FFixed64::MakeFromRawInt(Stream.RandRange(-FixedPoint::Constants::Raw64::One * 1000, FixedPoint::Constants::Raw64::One * 1000)),
+                FFixed64::MakeFromRawInt(Stream.RandRange(-FixedPoint::Constants::Raw64::One * 1000, FixedPoint::Constants::Raw64::One * 1000)),
+                FFixed64::MakeFromRawInt(Stream.RandRange(-FixedPoint::Constants::Raw64::One * 1000, FixedPoint::Constants::Raw64::One * 1000)));
+        }
+        return Points;
+    }
+
+    FFixedMatrix MakeTestMatrix() const
+    {
+        const FFixedRotator64 Rotation(FFixed64(12.5), FFixed64(-47.25), FFixed64(93.0));
+        FFixedMatrix Matrix = FFixedRotationTranslationMatrix(Rotation, FFixedVector64(FFixed64(100.0), FFixed64(-250.5), FFixed64(17.75)));
+        return Matrix.ApplyScale(FFixed64(1.5));
+    }
+
+    void LogTiming(const TCHAR* Label, int32 Count, double Seconds)
+    {
+        AddInfo(FString::Printf(TEXT("%s, %d items: %.3f ms (%.2f ns per item)"), Label, Count, Seconds * 1000.0, Seconds * 1.0e9 / FMath::Max(Count, 1)));
+    }
+END_DEFINE_SPEC(FFixedPointBenchmarkSpec);
+
+void FFixedPointBenchmarkSpec::Define()
+{
+    Describe("Matrix Batch Transforms", [this]()
+    {
+        for (const int32 Count : { 1000, 100000, 1000000 })
+        {
+            It(FString::Printf(TEXT("Should transform %d positions faster in batch than one at a time"), Count), [this, Count]()
+            {
+                const FFixedMatrix Matrix = MakeTestMatrix();
+                const TArray<FFixedVector64> Points = MakePoints(Count, Count);
+                TArray<FFixedVector64> Scalar, Batch, Parallel;
+                Scalar.SetNumUninitialized(Count);
+                Batch.SetNumUninitialized(Count);
+                Parallel.SetNumUninitialized(Count);
+
+                double Start = FPlatformTime::Seconds();
+                for (int32 i = 0; i < Count; i++)
+                {
+                    Scalar[i] = FFixedVector64(Matrix.TransformPosition(Points[i]));
+                }
+                LogTiming(TEXT("TransformPosition"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                Matrix.TransformPositions(Points, Batch);
+                LogTiming(TEXT("TransformPositions"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                Matrix.TransformPositions(Points, Parallel, true);
+                LogTiming(TEXT("TransformPositions parallel"), Count, FPlatformTime::Seconds() - Start);
+
+                bool result = true;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    result &= Batch[i] == Parallel[i];
+                    result &= Batch[i].Equals(Scalar[i], FFixed64::MakeFromRawInt(4));
+                }
+                TestTrue("Batch results are within FFixed64::MakeFromRawInt(4) of TransformPosition and parallel matches serial exactly", result);
+            });
+        }
+    });
+    Describe("Matrix Inverses", [this]()
+    {
+        It("Should invert affine and rigid matrices faster than the general inverse", [this]()
+        {
+            const int32 Count = 100000;
+            const FFixedRotator64 Rotation(FFixed64(12.5), FFixed64(-47.25), FFixed64(93.0));
+            const FFixedVector64 Translation(FFixed64(100.0), FFixed64(-250.5), FFixed64(17.75));
+            const FFixedTransform64 Transform(Rotation, Translation, FFixedVector64(FFixed64(1.5), FFixed64(2.0), FFixed64(0.5)));
+            const FFixedMatrix Rigid = FFixedRotationTranslationMatrix(Rotation, Translation);
+            const FFixedMatrix Scaled = Transform.ToMatrixWithScale();
+            int64 Sink = 0;
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Sink += Scaled.InverseFast().M[3][0].Value;
+            }
+            LogTiming(TEXT("InverseFast"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Sink += Scaled.InverseAffine().M[3][0].Value;
+            }
+            LogTiming(TEXT("InverseAffine"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Sink += Rigid.InverseRigid().M[3][0].Value;
+            }
+            LogTiming(TEXT("InverseRigid"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Sink += Transform.ToMatrixWithScale().Inverse().M[3][0].Value;
+            }
+            LogTiming(TEXT("ToMatrixWithScale().Inverse()"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Sink += Transform.ToInverseMatrixWithScale().M[3][0].Value;
+            }
+            LogTiming(TEXT("ToInverseMatrixWithScale"), Count, FPlatformTime::Seconds() - Start);
+
+            AddInfo(FString::Printf(TEXT("Checksum %lld"), Sink));
+            TestTrue("Affine inverse matches the general inverse within 0.001", Scaled.InverseAffine().Equals(Scaled.Inverse(), FFixed64(0.001)));
+        });
+    });
+    Describe("Transform Hierarchies", [this]()
+    {
+        It("Should compose 1000 skeletons of 64 bones faster in parallel batch than one at a time", [this]()
+        {
+            const int32 NumSkeletons = 1000;
+            const int32 NumBones = 64;
+            const int32 Count = NumSkeletons * NumBones;
+            FRandomStream Stream(31);
+            TArray<int32> Parents;
+            TArray<FFixedTransform64> Locals;
+            Parents.Reserve(Count);
+            Locals.Reserve(Count);
+            for (int32 i = 0; i < Count; i++)
+            {
+                const int32 Bone = i % NumBones;
+                Parents.Add(Bone == 0 ? INDEX_NONE : i - Bone + Stream.RandRange(FMath::Max(Bone - 4, 0), Bone - 1));
+                const FFixedRotator64 Rotation(FFixed64(Stream.FRandRange(-45.0f, 45.0f)), FFixed64(Stream.FRandRange(-45.0f, 45.0f)), FFixed64(Stream.FRandRange(-45.0f, 45.0f)));
+                Locals.Add(FFixedTransform64(Rotation, FFixedVector64(FFixed64(Stream.FRandRange(0.0f, 20.0f)), FFixed64(0.0), FFixed64(0.0))));
+            }
+            TArray<FFixedTransform64> Scalar, Batch, Parallel;
+            Scalar.SetNum(Count);
+            Batch.SetNum(Count);
+            Parallel.SetNum(Count);
+            FFixedHierarchyLevels Levels;
+            Levels.Build(Parents);
+            FFixedTransform64SoA Workspace;
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Scalar[i] = Parents[i] == INDEX_NONE ? Locals[i] : Locals[i] * Scalar[Parents[i]];
+            }
+            LogTiming(TEXT("Multiply one at a time"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            FFixedTransform64::ComposeHierarchy(Levels, Locals, Batch, Workspace);
+            LogTiming(TEXT("ComposeHierarchy"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            FFixedTransform64::ComposeHierarchy(Levels, Locals, Parallel, Workspace, true);
+            LogTiming(TEXT("ComposeHierarchy parallel"), Count, FPlatformTime::Seconds() - Start);
+
+            bool result = true;
+            for (int32 i = 0; i < Count; i++)
+            {
+                result &= Batch[i].Equals(Scalar[i], FixedPoint::Constants::Fixed64::Zero);
+                result &= Parallel[i].Equals(Scalar[i], FixedPoint::Constants::Fixed64::Zero);
+            }
+            TestTrue("Batch results match one at a time exactly", result);
+        });
+    });
+    Describe("Quat Slerp", [this]()
+    {
+        It("Should slerp a pose of 100000 rotations faster in batch than one at a time", [this]()
+        {
+            const int32 Count = 100000;
+            FRandomStream Stream(17);
+            TArray<FFixedQuat64> A, B, Scalar, Batch, Parallel;
+            TArray<FQuat> FloatA, FloatB, FloatResult;
+            for (int32 i = 0; i < Count; i++)
+            {
+                A.Add(FFixedQuat64(FFixedRotator64(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)))));
+                B.Add(FFixedQuat64(FFixedRotator64(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)))));
+                FloatA.Add((FQuat)A[i]);
+                FloatB.Add((FQuat)B[i]);
+            }
+            Scalar.SetNum(Count);
+            Batch.SetNum(Count);
+            Parallel.SetNum(Count);
+            FloatResult.SetNum(Count);
+            const FFixed64 Alpha(0.35);
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                FloatResult[i] = FQuat::Slerp(FloatA[i], FloatB[i], 0.35);
+            }
+            LogTiming(TEXT("FQuat::Slerp"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Scalar[i] = FFixedQuat64::Slerp(A[i], B[i], Alpha);
+            }
+            LogTiming(TEXT("FFixedQuat64::Slerp"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            FFixedQuat64::Slerp(Batch, A, B, Alpha);
+            LogTiming(TEXT("FFixedQuat64::Slerp batch"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            FFixedQuat64::Slerp(Parallel, A, B, Alpha, true);
+            LogTiming(TEXT("FFixedQuat64::Slerp batch parallel"), Count, FPlatformTime::Seconds() - Start);
+
+            bool result = true;
+            for (int32 i = 0; i < Count; i++)
+            {
+                result &= Batch[i] == Scalar[i] && Parallel[i] == Scalar[i];
+            }
+            TestTrue("Batch results match Slerp exactly", result);
+        });
+    });
+    Describe("Rotator Rotate Vector", [this]()
+    {
+        It("Should rotate vectors faster by quaternion and in batch than through a rotation matrix", [this]()
+        {
+            const int32 Count = 100000;
+            const FFixedRotator64 Rotator(FFixed64(12.5), FFixed64(-47.25), FFixed64(93.0));
+            const TArray<FFixedVector64> Points = MakePoints(Count, 5);
+            TArray<FFixedVector64> MatrixResult, QuatResult, Batch;
+            MatrixResult.SetNumUninitialized(Count);
+            QuatResult.SetNumUninitialized(Count);
+            Batch.SetNumUninitialized(Count);
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                MatrixResult[i] = FFixedVector64(FFixedRotationMatrix(Rotator).TransformVector(Points[i]));
+            }
+            LogTiming(TEXT("FFixedRotationMatrix per vector"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                QuatResult[i] = Rotator.QuatRotateVector(Points[i]);
+            }
+            LogTiming(TEXT("QuatRotateVector"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Rotator.RotateVectors(Points, Batch);
+            LogTiming(TEXT("RotateVectors"), Count, FPlatformTime::Seconds() - Start);
+
+            bool result = true;
+            for (int32 i = 0; i < Count; i++)
+            {
+                result &= QuatResult[i].Equals(MatrixResult[i], FFixed64(0.01));
+                result &= Batch[i].Equals(MatrixResult[i], FFixed64(0.01));
+            }
+            TestTrue("All paths agree within 0.01 at a range of 1000", result);
+        });
+    });
+    Describe("Dual Quat Skinning", [this]()
+    {
+        It("Should skin 100000 vertices with 4 influences faster by dual quaternion than by transform accumulation", [this]()
+        {
+            const int32 Count = 100000;
+            const int32 NumBones = 128;
+            const int32 Influences = 4;
+            FRandomStream Stream(41);
+            TArray<FFixedTransform64> BoneTransforms;
+            TArray<FFixedDualQuat64> Bones;
+            for (int32 i = 0; i < NumBones; i++)
+            {
+                const FFixedRotator64 Rotation(FFixed64(Stream.FRandRange(-90.0f, 90.0f)), FFixed64(Stream.FRandRange(-90.0f, 90.0f)), FFixed64(Stream.FRandRange(-90.0f, 90.0f)));
+                BoneTransforms.Add(FFixedTransform64(Rotation, FFixedVector64(FFixed64(Stream.FRandRange(-50.0f, 50.0f)), FFixed64(Stream.FRandRange(-50.0f, 50.0f)), FFixed64(Stream.FRandRange(-50.0f, 50.0f)))));
+                Bones.Add(FFixedDualQuat64(BoneTransforms[i]));
+            }
+            const TArray<FFixedVector64> Points = MakePoints(Count, 43);
+            TArray<int32> Indices;
+            TArray<FFixed64> Weights;
+            for (int32 i = 0; i < Count; i++)
+            {
+                for (int32 k = 0; k < Influences; k++)
+                {
+                    Indices.Add(Stream.RandRange(0, NumBones - 1));
+                    Weights.Add(FFixed64(0.25));
+                }
+            }
+            TArray<FFixedVector64> Accumulated, Skinned, SkinnedParallel;
+            TArray<FFixedDualQuat64> Blended;
+            Accumulated.SetNumUninitialized(Count);
+            Skinned.SetNumUninitialized(Count);
+            SkinnedParallel.SetNumUninitialized(Count);
+            Blended.SetNumUninitialized(Count);
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                FFixedTransform64 Blend(FFixedQuat64(ForceInitToZero), FFixedVector64::ZeroVector, FFixedVector64::ZeroVector);
+                for (int32 k = 0; k < Influences; k++)
+                {
+                    Blend.AccumulateWithShortestRotation(BoneTransforms[Indices[i * Influences + k]], Weights[i * Influences + k]);
+                }
+                Blend.NormalizeRotation();
+                Accumulated[i] = Blend.TransformPosition(Points[i]);
+            }
+            LogTiming(TEXT("FFixedTransform64 accumulate and normalize"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            FFixedDualQuat64::Blend(Blended, Bones, Indices, Weights, Influences);
+            FFixedDualQuat64::TransformPositions(Blended, Points, Skinned);
+            LogTiming(TEXT("FFixedDualQuat64 batch blend and transform"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            FFixedDualQuat64::Blend(Blended, Bones, Indices, Weights, Influences, true);
+            FFixedDualQuat64::TransformPositions(Blended, Points, SkinnedParallel, true);
+            LogTiming(TEXT("FFixedDualQuat64 batch blend and transform parallel"), Count, FPlatformTime::Seconds() - Start);
+
+            bool result = true;
+            for (int32 i = 0; i < Count; i++)
+            {
+                result &= Skinned[i] == SkinnedParallel[i];
+            }
+            TestTrue("Parallel skinning matches serial exactly", result);
+        });
+    });
+    Describe("Rotation Matrix 62", [this]()
+    {
+        It("Should rotate vectors faster with FFixedRotationMatrix62 than with FFixedMatrix", [this]()
+        {
+            const int32 Count = 100000;
+            const FFixedRotator64 Rotator(FFixed64(12.5), FFixed64(-47.25), FFixed64(93.0));
+            const FFixedMatrix Matrix = FFixedRotationMatrix(Rotator);
+            const FFixedRotationMatrix62 Rotation(Rotator);
+            const TArray<FFixedVector64> Points = MakePoints(Count, 9);
+            TArray<FFixedVector64> MatrixResult, Single, Batch;
+            MatrixResult.SetNumUninitialized(Count);
+            Single.SetNumUninitialized(Count);
+            Batch.SetNumUninitialized(Count);
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                MatrixResult[i] = FFixedVector64(Matrix.TransformVector(Points[i]));
+            }
+            LogTiming(TEXT("FFixedMatrix::TransformVector"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Single[i] = Rotation.TransformVector(Points[i]);
+            }
+            LogTiming(TEXT("FFixedRotationMatrix62::TransformVector"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Rotation.TransformVectors(Points, Batch);
+            LogTiming(TEXT("FFixedRotationMatrix62::TransformVectors"), Count, FPlatformTime::Seconds() - Start);
+
+            bool result = true;
+            for (int32 i = 0; i < Count; i++)
+            {
+                result &= Batch[i] == Single[i];
+                result &= Single[i].Equals(MatrixResult[i], FFixed64(0.01));
+            }
+            TestTrue("Batch matches single exactly and both are within 0.01 of FFixedMatrix at a range of 1000", result);
+        });
+    });
+    Describe("Plane Transforms", [this]()
+    {
+        It("Should transform plane arrays faster by sharing one adjoint and determinant", [this]()
+        {
+            const int32 Count = 100000;
+            const FFixedMatrix Matrix = MakeTestMatrix();
+            const TArray<FFixedVector64> Points = MakePoints(Count, 11);
+            TArray<FFixedPlane> Planes, Single, Batch;
+            Planes.SetNumUninitialized(Count);
+            Single.SetNumUninitialized(Count);
+            Batch.SetNumUninitialized(Count);
+            for (int32 i = 0; i < Count; i++)
+            {
+                Planes[i] = FFixedPlane(Points[i], Points[(i + 1) % Count].GetSafeNormal(FixedPoint::Constants::Fixed64::SmallNumber, FFixedVector64::UpVector));
+            }
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Single[i] = Planes[i].TransformBy(Matrix);
+            }
+            LogTiming(TEXT("FFixedPlane::TransformBy"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            FFixedPlane::TransformBy(Batch, Planes, Matrix);
+            LogTiming(TEXT("FFixedPlane::TransformBy batch"), Count, FPlatformTime::Seconds() - Start);
+
+            bool result = true;
+            for (int32 i = 0; i < Count; i++)
+            {
+                result &= Batch[i] == Single[i];
+            }
+            TestTrue("Batch matches single exactly", result);
+        });
+    });
+    Describe("Bounds Overlap", [this]()
+    {
+        It("Should test one query against many boxes faster in SoA than array of FFixedBox", [this]()
+        {
+            const int32 Count = 100000;
+            const TArray<FFixedVector64> Points = MakePoints(Count, 39);
+            TArray<FFixedBox> BoxArray;
+            FFixedBoxSoA Boxes;
+            BoxArray.Reserve(Count);
+            Boxes.Reserve(Count);
+            for (int32 i = 0; i < Count; i++)
+            {
+                BoxArray.Add(FFixedBox::BuildAABB(Points[i], FFixedVector64(FFixed64(10.0))));
+                Boxes.Add(BoxArray[i]);
+            }
+            const FFixedBox Query = FFixedBox::BuildAABB(FFixedVector64(FixedPoint::Constants::Fixed64::Zero), FFixedVector64(FFixed64(250.0)));
+            const FFixedSphere QuerySphere(FFixedVector64(FixedPoint::Constants::Fixed64::Zero), FFixed64(250.0));
+
+            TArray<int32> Scalar, Batch, ScalarSphere, BatchSphere;
+            Scalar.Reserve(Count);
+            Batch.Reserve(Count);
+            ScalarSphere.Reserve(Count);
+            BatchSphere.Reserve(Count);
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                if (BoxArray[i].Intersect(Query))
+                {
+                    Scalar.Add(i);
+                }
+            }
+            LogTiming(TEXT("FFixedBox::Intersect"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Boxes.OverlapBox(Query, Batch);
+            LogTiming(TEXT("FFixedBoxSoA::OverlapBox"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                if (QuerySphere.Intersects(BoxArray[i]))
+                {
+                    ScalarSphere.Add(i);
+                }
+            }
+            LogTiming(TEXT("FFixedSphere::Intersects box"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Boxes.OverlapSphere(QuerySphere, BatchSphere);
+            LogTiming(TEXT("FFixedBoxSoA::OverlapSphere"), Count, FPlatformTime::Seconds() - Start);
+
+            TestTrue("SoA box results match scalar", Batch == Scalar);
+            TestTrue("SoA sphere results match scalar", BatchSphere == ScalarSphere);
+        });
+    });
+
+    Describe("Spatial Grid", [this]()
+    {
+        It("Should find neighbours of many units faster through FFixedSpatialGrid than brute force", [this]()
+        {
+            const int32 Count = 20000;
+            const int32 NumQueries = 1000;
+            const TArray<FFixedVector64> Points = MakePoints(Count, 40);
+            const FFixed64 Radius(50.0);
+            const FFixed64 RadiusSquared = Radius * Radius;
+
+            double Start = FPlatformTime::Seconds();
+            FFixedSpatialGrid Grid(Radius);
+            for (int32 i = 0; i < Count; i++)
+            {
+                Grid.Insert(i, Points[i]);
+            }
+            Grid.Flush();
+            LogTiming(TEXT("FFixedSpatialGrid build"), Count, FPlatformTime::Seconds() - Start);
+
+            TArray<FFixedVector64> Centers;
+            Centers.Append(Points.GetData(), NumQueries);
+            TArray<TArray<int32>> BruteForce, Serial, Parallel;
+            BruteForce.SetNum(NumQueries);
+            Serial.SetNum(NumQueries);
+            Parallel.SetNum(NumQueries);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 Query = 0; Query < NumQueries; Query++)
+            {
+                for (int32 i = 0; i < Count; i++)
+                {
+                    if (FFixedVector64::DistSquared(Points[i], Centers[Query]) <= RadiusSquared)
+                    {
+                        BruteForce[Query].Add(i);
+                    }
+                }
+            }
+            LogTiming(TEXT("Brute force radius queries"), NumQueries, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Grid.QueryRadius(Centers, Radius, Serial, false);
+            LogTiming(TEXT("FFixedSpatialGrid::QueryRadius serial"), NumQueries, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Grid.QueryRadius(Centers, Radius, Parallel, true);
+            LogTiming(TEXT("FFixedSpatialGrid::QueryRadius parallel"), NumQueries, FPlatformTime::Seconds() - Start);
+
+            bool result = Parallel == Serial;
+            for (int32 Query = 0; Query < NumQueries; Query++)
+            {
+                Serial[Query].Sort();
+                result &= Serial[Query] == BruteForce[Query];
+            }
+            TestTrue("Grid radius queries match brute force", result);
+
+            Start = FPlatformTime::Seconds();
+            Grid.QueryNearest(Centers, 8, Serial, false);
+            LogTiming(TEXT("FFixedSpatialGrid::QueryNearest serial"), NumQueries, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Grid.QueryNearest(Centers, 8, Parallel, true);
+            LogTiming(TEXT("FFixedSpatialGrid::QueryNearest parallel"), NumQueries, FPlatformTime::Seconds() - Start);
+            TestTrue("Parallel nearest queries match serial", Parallel == Serial);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i++)
+            {
+                Grid.Move(i, Points[(i + 1) % Count]);
+            }
+            Grid.Flush();
+            LogTiming(TEXT("FFixedSpatialGrid move and flush"), Count, FPlatformTime::Seconds() - Start);
+        });
+    });
+
+    Describe("BVH", [this]()
+    {
+        It("Should build, refit and answer segment casts through FFixedBVH faster than brute force", [this]()
+        {
+            const int32 Count = 20000;
+            const int32 NumQueries = 2000;
+            const TArray<FFixedVector64> Points = MakePoints(Count, 41);
+            TArray<FFixedBox> Boxes;
+            Boxes.Reserve(Count);
+            for (int32 i = 0; i < Count; i++)
+            {
+                Boxes.Add(FFixedBox::BuildAABB(Points[i], FFixedVector64(FFixed64(5.0))));
+            }
+
+            FFixedBVH Tree;
+            double Start = FPlatformTime::Seconds();
+            Tree.Build(Boxes);
+            LogTiming(TEXT("FFixedBVH::Build"), Count, FPlatformTime::Seconds() - Start);
+
+            for (FFixedBox& Box : Boxes)
+            {
+                Box = Box.ShiftBy(FFixedVector64(FFixed64(1.0), FFixed64(-1.0), FFixed64(0.5)));
+            }
+            Start = FPlatformTime::Seconds();
+            Tree.Refit(Boxes);
+            LogTiming(TEXT("FFixedBVH::Refit"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Count; i += 10)
+            {
+                Boxes[i] = Boxes[i].ShiftBy(FFixedVector64(FFixed64(-1.0), FFixed64(1.0), FFixed64(-0.5)));
+                Tree.UpdateItem(i, Boxes[i]);
+            }
+            LogTiming(TEXT("FFixedBVH::UpdateItem"), Count / 10, FPlatformTime::Seconds() - Start);
+
+            TArray<FFixedVector64> Starts = MakePoints(NumQueries, 4141);
+            TArray<FFixedVector64> Ends = MakePoints(NumQueries, 414141);
+            TArray<int32> BruteForce, Casts;
+            BruteForce.Reserve(NumQueries);
+            Casts.Reserve(NumQueries);
+
+            //plain FFixed64 slab test against every box, with divisions like a naive implementation would use
+            Start = FPlatformTime::Seconds();
+            for (int32 Query = 0; Query < NumQueries; Query++)
+            {
+                int32 BestItem = INDEX_NONE;
+                FFixed64 BestTime = FixedPoint::Constants::Fixed64::One;
+                const FFixedVector64 Delta = Ends[Query] - Starts[Query];
+                for (int32 i = 0; i < Count; i++)
+                {
+                    FFixed64 Enter = FixedPoint::Constants::Fixed64::Zero;
+                    FFixed64 Exit = FixedPoint::Constants::Fixed64::One;
+                    for (int32 Axis = 0; Axis < 3 && Enter <= Exit; Axis++)
+                    {
+                        const FFixed64 D = Delta[Axis];
+                        if (D == FixedPoint::Constants::Fixed64::Zero)
+                        {
+                            continue;
+                        }
+                        const FFixed64 Near = (D > FixedPoint::Constants::Fixed64::Zero ? Boxes[i].Min[Axis] : Boxes[i].Max[Axis]) - Starts[Query][Axis];
+                        const FFixed64 Far = (D > FixedPoint::Constants::Fixed64::Zero ? Boxes[i].Max[Axis] : Boxes[i].Min[Axis]) - Starts[Query][Axis];
+                        Enter = FFixedPointMath::Max(Enter, Near / D);
+                        Exit = FFixedPointMath::Min(Exit, Far / D);
+                    }
+                    if (Enter <= Exit && (BestItem == INDEX_NONE || Enter < BestTime))
+                    {
+                        BestItem = i;
+                        BestTime = Enter;
+                    }
+                }
+                BruteForce.Add(BestItem);
+            }
+            LogTiming(TEXT("Brute force segment casts"), NumQueries, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 Query = 0; Query < NumQueries; Query++)
+            {
+                FFixedBVHHit Hit;
+                Tree.RayCast(Starts[Query], Ends[Query], Hit);
+                Casts.Add(Hit.Item);
+            }
+            LogTiming(TEXT("FFixedBVH::RayCast"), NumQueries, FPlatformTime::Seconds() - Start);
+
+            TArray<int32> Found;
+            Start = FPlatformTime::Seconds();
+            for (int32 Query = 0; Query < NumQueries; Query++)
+            {
+                Found.Reset();
+                Tree.QuerySphereSweep(Starts[Query], Ends[Query], FFixed64(10.0), Found);
+            }
+            LogTiming(TEXT("FFixedBVH::QuerySphereSweep"), NumQueries, FPlatformTime::Seconds() - Start);
+
+            TestTrue("BVH casts hit the same items as brute force", Casts == BruteForce);
+        });
+    });
+
+    Describe("Ray Batch", [this]()
+    {
+        It("Should test rays against spheres and triangles faster through FFixedRayBatch than one pair at a time", [this]()
+        {
+            const int32 NumRays = 2000;
+            const int32 NumItems = 500;
+            const TArray<FFixedVector64> Starts = MakePoints(NumRays, 42);
+            const TArray<FFixedVector64> Ends = MakePoints(NumRays, 4242);
+            const TArray<FFixedVector64> Centers = MakePoints(NumItems * 3, 424242);
+            FFixedRayBatch Rays;
+            Rays.Reserve(NumRays);
+            for (int32 i = 0; i < NumRays; i++)
+            {
+                Rays.AddSegment(Starts[i], Ends[i]);
+            }
+            FFixedSphereSoA Spheres;
+            FFixedTriangleSoA Triangles;
+            for (int32 i = 0; i < NumItems; i++)
+            {
+                Spheres.Add(FFixedSphere(Centers[i], FFixed64(50.0)));
+                Triangles.Add(Centers[i * 3], Centers[i * 3 + 1], Centers[i * 3 + 2]);
+            }
+
+            TArray<int32> Scalar, Batch, Parallel;
+            TArray<FFixed64> Times;
+            Scalar.SetNumUninitialized(NumRays);
+            Batch.SetNumUninitialized(NumRays);
+            Parallel.SetNumUninitialized(NumRays);
+            Times.SetNumUninitialized(NumRays);
+
+            double Start = FPlatformTime::Seconds();
+            for (int32 Ray = 0; Ray < NumRays; Ray++)
+            {
+                Scalar[Ray] = INDEX_NONE;
+                for (int32 Item = 0; Item < NumItems; Item++)
+                {
+                    if (FFixedPointMath::LineSphereIntersection(Rays.GetStart(Ray), Rays.GetDir(Ray), Rays.GetLength(Ray), Spheres.Get(Item).Center, Spheres.Get(Item).W))
+                    {
+                        Scalar[Ray] = Item;
+                        break;
+                    }
+                }
+            }
+            LogTiming(TEXT("LineSphereIntersection any hit, ray sphere pairs"), NumRays * NumItems, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Rays.IntersectSpheres(Spheres, Batch, Times, true);
+            LogTiming(TEXT("FFixedRayBatch::IntersectSpheres any hit, ray sphere pairs"), NumRays * NumItems, FPlatformTime::Seconds() - Start);
+            TestTrue("Batch sphere hits match", Scalar == Batch);
+
+            Start = FPlatformTime::Seconds();
+            for (int32 Ray = 0; Ray < NumRays; Ray++)
+            {
+                Scalar[Ray] = INDEX_NONE;
+                FFixed64 BestTime = FixedPoint::Constants::Fixed64::One;
+                FFixedVector64 A, B, C;
+                for (int32 Item = 0; Item < NumItems; Item++)
+                {
+                    Triangles.Get(Item, A, B, C);
+                    FFixed64 Time;
+                    if (FFixedPointMath::SegmentTriangleIntersection(Starts[Ray], Ends[Ray], A, B, C, Time) && (Scalar[Ray] == INDEX_NONE || Time < BestTime))
+                    {
+                        Scalar[Ray] = Item;
+                        BestTime = Time;
+                    }
+                }
+            }
+            LogTiming(TEXT("SegmentTriangleIntersection earliest hit, segment triangle pairs"), NumRays * NumItems, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Rays.IntersectTriangles(Triangles, Batch, Times);
+            LogTiming(TEXT("FFixedRayBatch::IntersectTriangles earliest hit, segment triangle pairs"), NumRays * NumItems, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Rays.IntersectTriangles(Triangles, Parallel, Times, false, true);
+            LogTiming(TEXT("FFixedRayBatch::IntersectTriangles parallel, segment triangle pairs"), NumRays * NumItems, FPlatformTime::Seconds() - Start);
+
+            TestTrue("Batch triangle hits match", Scalar == Batch);
+            TestTrue("Parallel triangle hits match", Batch == Parallel);
+        });
+    });
+
+    Describe("Convex Volume Culling", [this]()
+    {
+        for (const int32 Count : { 10000, 1000000 })
+        {
+            It(FString::Printf(TEXT("Should cull %d spheres and boxes faster in batch than one at a time"), Count), [this, Count]()
+            {
+                const FFixedConvexVolume Frustum = FFixedConvexVolume::MakeFrustum(FFixedVector64(FixedPoint::Constants::Fixed64::Zero), FFixedRotator64(FFixed64(10.0), FFixed64(30.0), FFixed64(0.0)), FFixed64(45.0), FFixed64(1.5), FFixed64(10.0), FFixed64(800.0));
+                const TArray<FFixedVector64> Points = MakePoints(Count, Count);
+                FFixedSphereSoA Spheres;
+                FFixedBoxSoA Boxes;
+                Spheres.Reserve(Count);
+                Boxes.Reserve(Count);
+                for (const FFixedVector64& Point : Points)
+                {
+                    Spheres.Add(FFixedSphere(Point, FFixed64(5.0)));
+                    Boxes.Add(FFixedBox::BuildAABB(Point, FFixedVector64(FFixed64(5.0))));
+                }
+
+                TArray<int32> Scalar, Batch, Parallel;
+                double Start = FPlatformTime::Seconds();
+                for (int32 i = 0; i < Count; i++)
+                {
+                    if (Frustum.IntersectSphere(Spheres.Get(i)))
+                    {
+                        Scalar.Add(i);
+                    }
+                }
+                LogTiming(TEXT("IntersectSphere one at a time"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                Frustum.CullSpheres(Spheres, Batch);
+                LogTiming(TEXT("CullSpheres"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                Frustum.CullSpheres(Spheres, Parallel, true);
+                LogTiming(TEXT("CullSpheres parallel"), Count, FPlatformTime::Seconds() - Start);
+                TestTrue("Sphere results match", Scalar == Batch && Batch == Parallel);
+
+                Scalar.Reset();
+                Batch.Reset();
+                Parallel.Reset();
+                Start = FPlatformTime::Seconds();
+                for (int32 i = 0; i < Count; i++)
+                {
+                    if (Frustum.IntersectBox(Boxes.Get(i)))
+                    {
+                        Scalar.Add(i);
+                    }
+                }
+                LogTiming(TEXT("IntersectBox one at a time"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                Frustum.CullBoxes(Boxes, Batch);
+                LogTiming(TEXT("CullBoxes"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                Frustum.CullBoxes(Boxes, Parallel, true);
+                LogTiming(TEXT("CullBoxes parallel"), Count, FPlatformTime::Seconds() - Start);
+                TestTrue("Box results match", Scalar == Batch && Batch == Parallel);
+            });
+        }
+    });
+    Describe("Polygon Clipping", [this]()
+    {
+        for (const int32 Count : { 1000, 100000 })
+        {
+            It(FString::Printf(TEXT("Should split %d polygons with a plane"), Count), [this, Count]()
+            {
+                const TArray<FFixedVector64> Points = MakePoints(Count, Count);
+                FFixedPolygonArena Polygons;
+                Polygons.Reserve(Count, Count * 4);
+                for (const FFixedVector64& Point : Points)
+                {
+                    const FFixedVector64 Quad[4] = {
+                        Point,
+                        Point + FFixedVector64(FFixed64(20.0), FFixed64(0.0), FFixed64(5.0)),
+                        Point + FFixedVector64(FFixed64(20.0), FFixed64(20.0), FFixed64(10.0)),
+                        Point + FFixedVector64(FFixed64(0.0), FFixed64(20.0), FFixed64(5.0))
+                    };
+                    Polygons.Add(Quad);
+                }
+                const FFixedPlane Plane(FFixedVector64(FFixed64(0.6), FFixed64(0.8), FFixed64(0.0)), FFixed64(0.0));
+
+                FFixedPolygonArena Front, Back;
+                double Start = FPlatformTime::Seconds();
+                Polygons.SplitAllWithPlane(Plane, Front, Back);
+                LogTiming(TEXT("SplitAllWithPlane"), Count, FPlatformTime::Seconds() - Start);
+
+                //refilling keeps the arenas' memory
+                Front.Reset();
+                Back.Reset();
+                Start = FPlatformTime::Seconds();
+                Polygons.SplitAllWithPlane(Plane, Front, Back, true);
+                LogTiming(TEXT("SplitAllWithPlane precise, reused arenas"), Count, FPlatformTime::Seconds() - Start);
+                TestTrue("Every polygon lands somewhere", Front.Num() + Back.Num() >= Count);
+            });
+        }
+
+        for (const int32 Count : { 100, 1000 })
+        {
+            It(FString::Printf(TEXT("Should union, intersect and offset %d overlapping squares"), Count), [this, Count]()
+            {
+                const TArray<FFixedVector64> Points = MakePoints(Count * 2, Count);
+                FFixedPolygonArena2D A, B;
+                for (int32 i = 0; i < Count * 2; i++)
+                {
+                    const FFixedVector2d P(Points[i].X, Points[i].Y);
+                    const FFixedVector2d Square[4] = {
+                        P,
+                        P + FFixedVector2d(FFixed64(30.0), FFixed64(0.0)),
+                        P + FFixedVector2d(FFixed64(30.0), FFixed64(30.0)),
+                        P + FFixedVector2d(FFixed64(0.0), FFixed64(30.0))
+                    };
+                    (i < Count ? A : B).Add(Square);
+                }
+
+                FFixedPolygonArena2D Union, Intersection, Grown;
+                double Start = FPlatformTime::Seconds();
+                FFixedPolygonArena2D::Union(A, B, Union);
+                LogTiming(TEXT("Union"), Count * 2, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                FFixedPolygonArena2D::Intersection(A, B, Intersection);
+                LogTiming(TEXT("Intersection"), Count * 2, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                FFixedPolygonArena2D::Offset(A, FFixed64(2.0), Grown);
+                LogTiming(TEXT("Offset"), Count, FPlatformTime::Seconds() - Start);
+                TestTrue("Union covers the intersection", Union.GetArea() >= Intersection.GetArea());
+            });
+        }
+    });
+
+    Describe("GJK Pairs", [this]()
+    {
+        for (const int32 Count : { 1000, 100000 })
+        {
+            It(FString::Printf(TEXT("Should query %d convex pairs cold and warm started"), Count), [this, Count]()
+            {
+                const TArray<FFixedVector64> Points = MakePoints(Count, Count);
+                const FFixedVector64 HullOffsets[6] = {
+                    FFixedVector64(FFixed64(1.0), FFixed64(0.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(-1.0), FFixed64(0.5), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(0.0), FFixed64(1.0), FFixed64(0.5)),
+                    FFixedVector64(FFixed64(0.0), FFixed64(-1.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(0.5), FFixed64(0.0), FFixed64(1.0)),
+                    FFixedVector64(FFixed64(0.0), FFixed64(0.5), FFixed64(-1.0))
+                };
+                TArray<FFixedVector64> HullPoints;
+                HullPoints.SetNumUninitialized(Count * 6);
+                TArray<FFixedConvexShape> A, B;
+                A.SetNum(Count);
+                B.SetNum(Count);
+                FRandomStream Stream(Count);
+                for (int32 i = 0; i < Count; i++)
+                {
+                    //a third of each pair kind, about half of them overlapping
+                    const FFixedVector64 Offset(FFixed64(Stream.FRandRange(-2.5, 2.5)), FFixed64(Stream.FRandRange(-1.0, 1.0)), FFixed64(Stream.FRandRange(-1.0, 1.0)));
+                    const FFixedQuat64 Rotation(FFixedVector64::UpVector, FFixed64(Stream.FRandRange(0.0, 3.0)));
+                    switch (i % 3)
+                    {
+                    case 0:
+                        A[i] = FFixedConvexShape::MakeBox(Points[i], FFixedVector64(FFixed64(1.0)));
+                        B[i] = FFixedConvexShape::MakeBox(Points[i] + Offset, FFixedVector64(FFixed64(1.0), FFixed64(0.5), FFixed64(0.5)), Rotation);
+                        break;
+                    case 1:
+                        A[i] = FFixedConvexShape::MakeSphere(Points[i], FFixed64(1.0));
+                        B[i] = FFixedConvexShape::MakeCapsule(Points[i] + Offset, Points[i] + Offset + Rotation.RotateVector(FFixedVector64::XAxisVector), FFixed64(0.5));
+                        break;
+                    default:
+                        for (int32 j = 0; j < 6; j++)
+                        {
+                            HullPoints[i * 6 + j] = Points[i] + Offset + Rotation.RotateVector(HullOffsets[j]);
+                        }
+                        A[i] = FFixedConvexShape::MakeBox(Points[i], FFixedVector64(FFixed64(1.0)));
+                        B[i] = FFixedConvexShape::MakeHull(TArrayView<const FFixedVector64>(HullPoints.GetData() + i * 6, 6));
+                        break;
+                    }
+                }
+
+                int32 NumIntersecting = 0;
+                double Start = FPlatformTime::Seconds();
+                for (int32 i = 0; i < Count; i++)
+                {
+                    NumIntersecting += FFixedGJK::Intersect(A[i], B[i]);
+                }
+                LogTiming(TEXT("Intersect"), Count, FPlatformTime::Seconds() - Start);
+
+                TArray<FFixedGJKResult> Results;
+                Results.SetNum(Count);
+                Start = FPlatformTime::Seconds();
+                for (int32 i = 0; i < Count; i++)
+                {
+                    FFixedGJK::ComputePenetration(A[i], B[i], Results[i]);
+                }
+                const double ColdSeconds = FPlatformTime::Seconds() - Start;
+                LogTiming(TEXT("ComputePenetration cold"), Count, ColdSeconds);
+
+                //the first pass fills the caches as last frame's query would have
+                TArray<FFixedGJKCache> Caches;
+                Caches.SetNum(Count);
+                TArray<FFixedGJKResult> WarmResults;
+                WarmResults.SetNum(Count);
+                for (int32 i = 0; i < Count; i++)
+                {
+                    FFixedGJK::ComputePenetration(A[i], B[i], WarmResults[i], &Caches[i]);
+                }
+                Start = FPlatformTime::Seconds();
+                for (int32 i = 0; i < Count; i++)
+                {
+                    FFixedGJK::ComputePenetration(A[i], B[i], WarmResults[i], &Caches[i]);
+                }
+                const double WarmSeconds = FPlatformTime::Seconds() - Start;
+                LogTiming(TEXT("ComputePenetration warm"), Count, WarmSeconds);
+                AddInfo(FString::Printf(TEXT("%.0f pairs per second cold, %.0f warm"), Count / FMath::Max(ColdSeconds, 1.0e-9), Count / FMath::Max(WarmSeconds, 1.0e-9)));
+
+                int32 NumPenetrating = 0;
+                for (const FFixedGJKResult& Result : Results)
+                {
+                    NumPenetrating += Result.Distance <= FixedPoint::Constants::Fixed64::Zero;
+                }
+                TestEqual("Intersect and ComputePenetration agree", NumIntersecting, NumPenetrating);
+            });
+        }
+    });
+
+    Describe("Convex Hull", [this]()
+    {
+        It("Should build hulls of 10000 point clouds", [this]()
+        {
+            const int32 Count = 10000;
+            const int32 NumClouds = 16;
+            TArray<TArray<FFixedVector64>> Clouds;
+            TArray<TArrayView<const FFixedVector64>> Views;
+            for (int32 Cloud = 0; Cloud < NumClouds; Cloud++)
+            {
+                //odd clouds are pushed onto a sphere, the worst case where every point is a vertex
+                TArray<FFixedVector64> Points = MakePoints(Count, Cloud + 1);
+                if (Cloud % 2 == 1)
+                {
+                    for (FFixedVector64& Point : Points)
+                    {
+                        Point = Point.GetSafeNormal() * FFixed64(1000.0);
+                    }
+                }
+                Clouds.Add(MoveTemp(Points));
+            }
+            for (const TArray<FFixedVector64>& Points : Clouds)
+            {
+                Views.Add(Points);
+            }
+
+            FFixedConvexHull Hull;
+            double Start = FPlatformTime::Seconds();
+            Hull.Build(Clouds[0]);
+            LogTiming(TEXT("Build, points in a cube"), Count, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            Hull.Build(Clouds[1]);
+            LogTiming(TEXT("Build, points on a sphere"), Count, FPlatformTime::Seconds() - Start);
+
+            TArray<FFixedConvexHull> Serial, Parallel;
+            Start = FPlatformTime::Seconds();
+            FFixedConvexHull::BuildAll(Views, Serial);
+            LogTiming(TEXT("BuildAll"), Count * NumClouds, FPlatformTime::Seconds() - Start);
+
+            Start = FPlatformTime::Seconds();
+            FFixedConvexHull::BuildAll(Views, Parallel, true);
+            LogTiming(TEXT("BuildAll parallel"), Count * NumClouds, FPlatformTime::Seconds() - Start);
+
+            bool bSame = true;
+            for (int32 Cloud = 0; Cloud < NumClouds; Cloud++)
+            {
+                bSame &= Serial[Cloud].Vertices == Parallel[Cloud].Vertices && Serial[Cloud].FaceIndices == Parallel[Cloud].FaceIndices;
+            }
+            TestTrue("Parallel hulls match", bSame);
+        });
+    });
+
+    Describe("Triangle Mesh Sweeps", [this]()
+    {
+        for (const int32 Count : { 1000, 10000 })
+        {
+            It(FString::Printf(TEXT("Should sweep %d agents over a 32768 triangle terrain"), Count), [this, Count]()
+            {
+                //128 x 128 cells two units across, heights up to four units
+                const int32 Size = 128;
+                FRandomStream Stream(Count);
+                TArray<FFixedVector64> Vertices;
+                TArray<int32> Indices;
+                for (int32 Y = 0; Y <= Size; Y++)
+                {
+                    for (int32 X = 0; X <= Size; X++)
+                    {
+                        Vertices.Add(FFixedVector64(FFixed64(X * 2.0), FFixed64(Y * 2.0), FFixed64(Stream.FRandRange(0.0, 4.0))));
+                    }
+                }
+                for (int32 Y = 0; Y < Size; Y++)
+                {
+                    for (int32 X = 0; X < Size; X++)
+                    {
+                        const int32 Corner = Y * (Size + 1) + X;
+                        Indices.Append({ Corner, Corner + 1, Corner + Size + 2, Corner, Corner + Size + 2, Corner + Size + 1 });
+                    }
+                }
+                FFixedTriangleMesh Mesh;
+                double Start = FPlatformTime::Seconds();
+                Mesh.Build(Vertices, Indices);
+                LogTiming(TEXT("Build"), Mesh.NumTriangles(), FPlatformTime::Seconds() - Start);
+
+                //agents walking and falling a few units a tick, half spheres and half upright capsules
+                TArray<FFixedSweep> Spheres, Capsules;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    FFixedSweep Sweep;
+                    Sweep.Start = FFixedVector64(FFixed64(Stream.FRandRange(4.0, 252.0)), FFixed64(Stream.FRandRange(4.0, 252.0)), FFixed64(Stream.FRandRange(7.0, 9.0)));
+                    Sweep.End = Sweep.Start + FFixedVector64(FFixed64(Stream.FRandRange(-2.0, 2.0)), FFixed64(Stream.FRandRange(-2.0, 2.0)), FFixed64(Stream.FRandRange(-6.0, -2.0)));
+                    Sweep.Radius = FFixed64(0.5);
+                    Spheres.Add(Sweep);
+                    Sweep.HalfAxis = FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(1.0));
+                    Capsules.Add(Sweep);
+                }
+                TArray<FFixedSweepHit> Hits, ParallelHits;
+                Hits.SetNum(Count);
+                ParallelHits.SetNum(Count);
+
+                Start = FPlatformTime::Seconds();
+                Mesh.SweepBatch(Spheres, Hits);
+                const double SphereSeconds = FPlatformTime::Seconds() - Start;
+                LogTiming(TEXT("SweepBatch spheres"), Count, SphereSeconds);
+
+                Start = FPlatformTime::Seconds();
+                Mesh.SweepBatch(Capsules, Hits);
+                const double CapsuleSeconds = FPlatformTime::Seconds() - Start;
+                LogTiming(TEXT("SweepBatch capsules"), Count, CapsuleSeconds);
+
+                Start = FPlatformTime::Seconds();
+                Mesh.SweepBatch(Capsules, ParallelHits, true);
+                const double ParallelSeconds = FPlatformTime::Seconds() - Start;
+                LogTiming(TEXT("SweepBatch capsules parallel"), Count, ParallelSeconds);
+                AddInfo(FString::Printf(TEXT("%.0f sphere sweeps per second, %.0f capsule, %.0f capsule in parallel"), Count / FMath::Max(SphereSeconds, 1.0e-9), Count / FMath::Max(CapsuleSeconds, 1.0e-9), Count / FMath::Max(ParallelSeconds, 1.0e-9)));
+
+                bool bSame = true;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    bSame &= Hits[i].Triangle == ParallelHits[i].Triangle && Hits[i].Time == ParallelHits[i].Time;
+                }
+                TestTrue("Parallel sweeps match", bSame);
+            });
+        }
+    });
+
+    Describe("Spatial Keys", [this]()
+    {
+        for (const int32 Count : { 100000, 1000000 })
+        {
+            It(FString::Printf(TEXT("Should key and sort %d points along Morton and Hilbert curves"), Count), [this, Count]()
+            {
+                TArray<FFixedVector64> Points = MakePoints(Count, Count);
+                const FFixed64 CellSize = FixedPoint::Constants::Fixed64::One;
+                TArray<uint64> Keys, PortableKeys;
+                Keys.SetNumUninitialized(Count);
+                PortableKeys.SetNumUninitialized(Count);
+                const bool bWasUsingBMI2 = FFixedSpatialKey::IsUsingBMI2();
+
+                double Start = FPlatformTime::Seconds();
+                FFixedSpatialKey::MakeKeys(Points, CellSize, EFixedSpatialCurve::Morton, Keys);
+                LogTiming(bWasUsingBMI2 ? TEXT("Morton BMI2") : TEXT("Morton"), Count, FPlatformTime::Seconds() - Start);
+
+                FFixedSpatialKey::SetUseBMI2(false);
+                Start = FPlatformTime::Seconds();
+                FFixedSpatialKey::MakeKeys(Points, CellSize, EFixedSpatialCurve::Morton, PortableKeys);
+                LogTiming(TEXT("Morton portable"), Count, FPlatformTime::Seconds() - Start);
+                FFixedSpatialKey::SetUseBMI2(bWasUsingBMI2);
+                TestTrue("Portable keys match", Keys == PortableKeys);
+
+                Start = FPlatformTime::Seconds();
+                FFixedSpatialKey::MakeKeys(Points, CellSize, EFixedSpatialCurve::Morton, Keys, true);
+                LogTiming(TEXT("Morton parallel"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                FFixedSpatialKey::MakeKeys(Points, CellSize, EFixedSpatialCurve::Hilbert, Keys);
+                LogTiming(TEXT("Hilbert"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                FFixedSpatialKey::MakeKeys(Points, CellSize, EFixedSpatialCurve::Hilbert, Keys, true);
+                LogTiming(TEXT("Hilbert parallel"), Count, FPlatformTime::Seconds() - Start);
+
+                TArray<int32> Order;
+                Start = FPlatformTime::Seconds();
+                FFixedSpatialKey::SortOrder(Keys, Order);
+                LogTiming(TEXT("SortOrder"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                FFixedSpatialKey::ApplyOrder(Order, Points);
+                LogTiming(TEXT("ApplyOrder"), Count, FPlatformTime::Seconds() - Start);
+            });
+        }
+    });
+
+    Describe("Radix Sort", [this]()
+    {
+        for (const int32 Count : { 100000, 1000000 })
+        {
+            It(FString::Printf(TEXT("Should sort %d FFixed64 keys"), Count), [this, Count]()
+            {
+                FRandomStream Stream(Count);
+                TArray<FFixed64> Keys;
+                Keys.SetNumUninitialized(Count);
+                for (int32 i = 0; i < Count; i++)
+                {
+                    Keys[i] = FFixed64(Stream.FRandRange(-100000.0, 100000.0));
+                }
+
+                TArray<FFixed64> Compared = Keys;
+                double Start = FPlatformTime::Seconds();
+                Compared.Sort();
+                const double CompareSeconds = FPlatformTime::Seconds() - Start;
+                LogTiming(TEXT("TArray::Sort"), Count, CompareSeconds);
+
+                TArray<FFixed64> Sorted = Keys;
+                Start = FPlatformTime::Seconds();
+                FFixedRadixSort::Sort(Sorted);
+                const double RadixSeconds = FPlatformTime::Seconds() - Start;
+                LogTiming(TEXT("Radix Sort"), Count, RadixSeconds);
+                TestTrue("Same order as comparing", Sorted == Compared);
+
+                Sorted = Keys;
+                Start = FPlatformTime::Seconds();
+                FFixedRadixSort::Sort(Sorted, true);
+                const double ParallelSeconds = FPlatformTime::Seconds() - Start;
+                LogTiming(TEXT("Radix Sort parallel"), Count, ParallelSeconds);
+                AddInfo(FString::Printf(TEXT("Radix sort %.1fx TArray::Sort, %.1fx in parallel"), CompareSeconds / FMath::Max(RadixSeconds, 1.0e-9), CompareSeconds / FMath::Max(ParallelSeconds, 1.0e-9)));
+
+                TArray<int32> Order;
+                Start = FPlatformTime::Seconds();
+                FFixedRadixSort::ArgSort(Keys, Order);
+                LogTiming(TEXT("ArgSort"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                FFixedRadixSort::ArgSort(Keys, Order, true);
+                LogTiming(TEXT("ArgSort parallel"), Count, FPlatformTime::Seconds() - Start);
+            });
+        }
+    });
+
+    Describe("Sweep And Prune", [this]()
+    {
+        for (const int32 Count : { 1000, 10000, 100000 })
+        {
+            It(FString::Printf(TEXT("Should find overlapping pairs among %d crowd agents"), Count), [this, Count]()
+            {
+                //agents one unit across spread over a square sized for a constant density
+                const double Side = FMath::Sqrt((double)Count) * 3.0;
+                FRandomStream Stream(Count);
+                const FFixedVector64 Extent(FFixed64(0.5), FFixed64(0.5), FFixed64(1.0));
+                FFixedSweepAndPrune Broadphase;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    const FFixedVector64 Center(FFixed64(Stream.FRandRange(0.0, Side)), FFixed64(Stream.FRandRange(0.0, Side)), FFixed64(1.0));
+                    Broadphase.Insert(i, FFixedBox(Center - Extent, Center + Extent));
+                }
+                double Start = FPlatformTime::Seconds();
+                Broadphase.Flush();
+                LogTiming(TEXT("Flush building the order"), Count, FPlatformTime::Seconds() - Start);
+
+                TArray<FIntPoint> Pairs;
+                Start = FPlatformTime::Seconds();
+                Broadphase.FindPairs(Pairs);
+                LogTiming(TEXT("FindPairs"), Count, FPlatformTime::Seconds() - Start);
+
+                //a tick of walking, every agent moves a little so the order is nearly sorted
+                for (int32 i = 0; i < Count; i++)
+                {
+                    const FFixedVector64 Step(FFixed64(Stream.FRandRange(-0.2, 0.2)), FFixed64(Stream.FRandRange(-0.2, 0.2)), FFixed64(0.0));
+                    const FFixedBox& Box = Broadphase.GetBox(i);
+                    Broadphase.Move(i, FFixedBox(Box.Min + Step, Box.Max + Step));
+                }
+                Start = FPlatformTime::Seconds();
+                Broadphase.Flush();
+                LogTiming(TEXT("Flush after a tick of moves"), Count, FPlatformTime::Seconds() - Start);
+
+                Start = FPlatformTime::Seconds();
+                Broadphase.FindPairs(Pairs);
+                const double SweepSeconds = FPlatformTime::Seconds() - Start;
+                LogTiming(TEXT("FindPairs"), Count, SweepSeconds);
+
+                TArray<FIntPoint> ParallelPairs;
+                Start = FPlatformTime::Seconds();
+                Broadphase.FindPairs(ParallelPairs, true);
+                LogTiming(TEXT("FindPairs parallel"), Count, FPlatformTime::Seconds() - Start);
+                TestTrue("Parallel pairs match", ParallelPairs == Pairs);
+
+                //every pair at 100k is billions of tests, so time the first rows and scale up by the share of pairs they cover
+                const int32 Rows = FMath::Min(Count, 10000);
+                int32 NumBrutePairs = 0;
+                Start = FPlatformTime::Seconds();
+                for (int32 A = 0; A < Rows; A++)
+                {
+                    const FFixedBox& Box = Broadphase.GetBox(A);
+                    for (int32 B = A + 1; B < Count; B++)
+                    {
+                        NumBrutePairs += Box.Intersect(Broadphase.GetBox(B)) ? 1 : 0;
+                    }
+                }
+                const double RowSeconds = FPlatformTime::Seconds() - Start;
+                const double TestedShare = ((double)Rows * Count - (double)Rows * (Rows + 1) / 2.0) / ((double)Count * (Count - 1) / 2.0);
+                const double BruteSeconds = RowSeconds / TestedShare;
+                LogTiming(Rows == Count ? TEXT("Brute force") : TEXT("Brute force, scaled from the first 10000 rows"), Count, BruteSeconds);
+                if (Rows == Count)
+                {
+                    TestEqual("Brute force finds the same number of pairs", NumBrutePairs, Pairs.Num());
+                }
+                AddInfo(FString::Printf(TEXT("%d pairs, sweep and prune %.1fx faster than brute force"), Pairs.Num(), BruteSeconds / FMath::Max(SweepSeconds, 1.0e-9)));
+            });
+        }
+    });
+}
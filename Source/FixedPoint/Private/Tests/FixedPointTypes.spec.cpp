@@ -3,6 +3,7 @@
 
 #include "Misc/AutomationTest.h"
 #include "FixedPointTypes.h"
+#include "FixedPointBatch.h"
 
 BEGIN_DEFINE_SPEC(FFixedPointSpec, "FixedPoint.FixedPointSpec", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
     TSharedPtr<FFixed64> TestFixed64;
@@ -2436,5 +2437,2235 @@ void FFixedPointSpec::Define()
                 TestTrue("Is Equal to epics vector within FFixed64::MakeFromRawInt(256) tolerance", testvec.Equals(FFixedVector64(testepicvec), FFixed64::MakeFromRawInt(256)));
             });
         });
+        Describe("Fixed Point Batch", [this]()
+        {
+            It("Should match the scalar FFixed64 operators bit for bit on every supported kernel", [this]()
+            {
+                FRandomStream Stream(1337);
+                const int32 Count = 1027;
+                TArray<FFixed64> A, B, C;
+                TArray<FFixedVector64> VA, VB;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    //mix small and large magnitudes so both halves of the partial products are exercised
+                    const int32 Shift = Stream.RandRange(0, 24);
+                    A.Add(FFixed64::MakeFromRawInt((((int64)Stream.GetUnsignedInt() << 32) | Stream.GetUnsignedInt()) >> (Shift + 20)));
+                    B.Add(FFixed64::MakeFromRawInt((((int64)Stream.GetUnsignedInt() << 32) | Stream.GetUnsignedInt()) >> (44 - Shift)));
+                    C.Add(FFixed64::MakeFromRawInt((int64)Stream.GetUnsignedInt() - MAX_int32));
+                }
+                for (int32 i = 0; i + 2 < Count; i += 3)
+                {
+                    VA.Add(FFixedVector64(A[i], A[i + 1], A[i + 2]));
+                    VB.Add(FFixedVector64(B[i], B[i + 1], B[i + 2]));
+                }
+
+                bool result = true;
+                const EFixedPointSIMDLevel PreviousLevel = FFixed64Batch::GetActiveLevel();
+                for (uint8 Level = 0; Level <= (uint8)FFixed64Batch::GetSupportedLevel(); Level++)
+                {
+                    FFixed64Batch::SetActiveLevel((EFixedPointSIMDLevel)Level);
+                    TArray<FFixed64> Out;
+                    Out.SetNumZeroed(Count);
+                    FFixed64Batch::Mul(Out, A, B);
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        result &= Out[i] == A[i] * B[i];
+                    }
+                    FFixed64Batch::MulAdd(Out, A, B, C);
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        result &= Out[i] == A[i] * B[i] + C[i];
+                    }
+                    FFixed64Batch::Lerp(Out, C, B, A);
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        result &= Out[i] == FMath::Lerp(C[i], B[i], A[i]);
+                    }
+                    TArray<FFixed64> Dots;
+                    Dots.SetNumZeroed(VA.Num());
+                    FFixed64Batch::Dot3(Dots, VA, VB);
+                    for (int32 i = 0; i < VA.Num(); i++)
+                    {
+                        result &= Dots[i] == (VA[i] | VB[i]);
+                    }
+                }
+                FFixed64Batch::SetActiveLevel(PreviousLevel);
+                TestTrue("All kernels match the scalar operators", result);
+            });
+            It("Should match the scalar FFixed32 operators bit for bit on every supported kernel", [this]()
+            {
+                FRandomStream Stream(7331);
+                const int32 Count = 1031;
+                FFixed32Vector3SoA VA, VB;
+                TArray<FFixed32> Divisors;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    VA.Add(FFixed32::MakeFromRawInt(Stream.RandRange(-FixedPoint::Constants::Raw32::One * 100, FixedPoint::Constants::Raw32::One * 100)),
+                        FFixed32::MakeFromRawInt(Stream.RandRange(-FixedPoint::Constants::Raw32::One * 100, FixedPoint::Constants::Raw32::One * 100)),
+                        FFixed32::MakeFromRawInt(Stream.RandRange(-FixedPoint::Constants::Raw32::One * 100, FixedPoint::Constants::Raw32::One * 100)));
+                    VB.Add(FFixed32::MakeFromRawInt(Stream.RandRange(-FixedPoint::Constants::Raw32::One * 10, FixedPoint::Constants::Raw32::One * 10)),
+                        FFixed32::MakeFromRawInt(Stream.RandRange(-FixedPoint::Constants::Raw32::One * 10, FixedPoint::Constants::Raw32::One * 10)),
+                        FFixed32::MakeFromRawInt(Stream.RandRange(-FixedPoint::Constants::Raw32::One * 10, FixedPoint::Constants::Raw32::One * 10)));
+                    Divisors.Add(FFixed32::MakeFromRawInt(Stream.RandRange(FixedPoint::Constants::Raw32::One, FixedPoint::Constants::Raw32::One * 50) * (Stream.RandRange(0, 1) * 2 - 1)));
+                }
+
+                bool result = true;
+                const EFixedPointSIMDLevel PreviousLevel = FFixed64Batch::GetActiveLevel();
+                for (uint8 Level = 0; Level <= (uint8)FFixed64Batch::GetSupportedLevel(); Level++)
+                {
+                    FFixed64Batch::SetActiveLevel((EFixedPointSIMDLevel)Level);
+                    TArray<FFixed32> Out;
+                    Out.SetNumZeroed(Count);
+                    FFixed32Batch::Mul(Out, VA.X, VB.X);
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        result &= Out[i] == VA.X[i] * VB.X[i];
+                    }
+                    FFixed32Batch::Div(Out, VA.Y, Divisors);
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        result &= Out[i] == VA.Y[i] / Divisors[i];
+                    }
+                    FFixed32Batch::Sqrt(Out, VA.Z);
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        result &= Out[i] == FFixedPointMath::Sqrt(VA.Z[i]);
+                    }
+                    FFixed32Batch::Lerp(Out, VA.X, VA.Y, VB.Z);
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        result &= Out[i] == FMath::Lerp(VA.X[i], VA.Y[i], VB.Z[i]);
+                    }
+                    FFixed32Batch::Dot(Out, VA, VB);
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        result &= Out[i] == VA.X[i] * VB.X[i] + VA.Y[i] * VB.Y[i] + VA.Z[i] * VB.Z[i];
+                    }
+                    FFixed32Vector3SoA Crossed;
+                    Crossed.SetNumZeroed(Count);
+                    FFixed32Batch::Cross(Crossed, VA, VB);
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        result &= Crossed.X[i] == VA.Y[i] * VB.Z[i] - VA.Z[i] * VB.Y[i];
+                        result &= Crossed.Y[i] == VA.Z[i] * VB.X[i] - VA.X[i] * VB.Z[i];
+                        result &= Crossed.Z[i] == VA.X[i] * VB.Y[i] - VA.Y[i] * VB.X[i];
+                    }
+                }
+                FFixed64Batch::SetActiveLevel(PreviousLevel);
+                TestTrue("All kernels match the scalar operators", result);
+            });
+        });
+        Describe("Fixed Point Matrix", [this]()
+        {
+            It("Should batch transform positions and vectors within FFixed64::MakeFromRawInt(4) of TransformPosition and TransformVector", [this]()
+            {
+                const FFixedMatrix Matrix = FFixedRotationTranslationMatrix(FFixedRotator64(FFixed64(30.0), FFixed64(-60.0), FFixed64(45.0)), FFixedVector64(FFixed64(10.0), FFixed64(-20.0), FFixed64(5.5)));
+                FRandomStream Stream(42);
+                TArray<FFixedVector64> Points;
+                for (int32 i = 0; i < 9000; i++)
+                {
+                    Points.Add(FFixedVector64(FFixed64(Stream.FRandRange(-500.0, 500.0)), FFixed64(Stream.FRandRange(-500.0, 500.0)), FFixed64(Stream.FRandRange(-500.0, 500.0))));
+                }
+                TArray<FFixedVector64> Positions = Points;
+                TArray<FFixedVector64> Vectors;
+                Vectors.SetNumUninitialized(Points.Num());
+                Matrix.TransformPositions(Positions, Positions, true);
+                Matrix.TransformVectors(Points, Vectors);
+                bool result = true;
+                for (int32 i = 0; i < Points.Num(); i++)
+                {
+                    result &= Positions[i].Equals(FFixedVector64(Matrix.TransformPosition(Points[i])), FFixed64::MakeFromRawInt(4));
+                    result &= Vectors[i].Equals(FFixedVector64(Matrix.TransformVector(Points[i])), FFixed64::MakeFromRawInt(4));
+                }
+                TestTrue("All are within FFixed64::MakeFromRawInt(4) of the single transform", result);
+            });
+            It("Should get the same inverse from InverseAffine, InverseRigid and ToInverseMatrixWithScale as from Inverse, within 0.001", [this]()
+            {
+                const FFixedRotator64 Rotation(FFixed64(30.0), FFixed64(-60.0), FFixed64(45.0));
+                const FFixedVector64 Translation(FFixed64(10.0), FFixed64(-20.0), FFixed64(5.5));
+                const FFixedMatrix Rigid = FFixedRotationTranslationMatrix(Rotation, Translation);
+                const FFixedTransform64 Transform(Rotation, Translation, FFixedVector64(FFixed64(1.5), FFixed64(0.75), FFixed64(-2.0)));
+                const FFixedMatrix Scaled = Transform.ToMatrixWithScale();
+                const FFixed64 Tolerance(0.001);
+                TestTrue("InverseAffine of a rigid matrix", Rigid.InverseAffine().Equals(Rigid.Inverse(), Tolerance));
+                TestTrue("InverseRigid of a rigid matrix", Rigid.InverseRigid().Equals(Rigid.Inverse(), Tolerance));
+                TestTrue("InverseAffine of a scaled matrix", Scaled.InverseAffine().Equals(Scaled.Inverse(), Tolerance));
+                TestTrue("ToInverseMatrixWithScale", Transform.ToInverseMatrixWithScale().Equals(Scaled.Inverse(), Tolerance));
+            });
+            It("Should inverse transform affine matrices through InverseAffine, and leave degenerate transform scales to Inverse", [this]()
+            {
+                const FFixedRotator64 Rotation(FFixed64(30.0), FFixed64(-60.0), FFixed64(45.0));
+                const FFixedVector64 Translation(FFixed64(10.0), FFixed64(-20.0), FFixed64(5.5));
+                const FFixedMatrix Scaled = FFixedTransform64(Rotation, Translation, FFixedVector64(FFixed64(1.5), FFixed64(0.75), FFixed64(-2.0))).ToMatrixWithScale();
+                const FFixedVector64 Point(FFixed64(3.25), FFixed64(-7.5), FFixed64(12.0));
+                TestTrue("InverseTransformPosition is InverseAffine then TransformPosition", Scaled.InverseTransformPosition(Point) == FFixedVector64(Scaled.InverseAffine().TransformPosition(Point)));
+                TestTrue("InverseTransformVector is InverseAffine then TransformVector", Scaled.InverseTransformVector(Point) == FFixedVector64(Scaled.InverseAffine().TransformVector(Point)));
+                TestTrue("InverseTransformPosition undoes TransformPosition", Scaled.InverseTransformPosition(FFixedVector64(Scaled.TransformPosition(Point))).Equals(Point, FFixed64(0.001)));
+                TestTrue("InverseTransformVector undoes TransformVector", Scaled.InverseTransformVector(FFixedVector64(Scaled.TransformVector(Point))).Equals(Point, FFixed64(0.001)));
+
+                //a single zero or one raw unit scale axis inverts the same as the full matrix does, as before
+                const FFixedVector64 DegenerateScales[] = {
+                    FFixedVector64(FixedPoint::Constants::Fixed64::Zero, FFixed64(2.0), FFixed64(3.0)),
+                    FFixedVector64(FFixed64(2.0), FFixed64::MakeFromRawInt(1), FFixed64(3.0)),
+                    FFixedVector64(FFixed64(2.0), FFixed64(3.0), FFixed64::MakeFromRawInt(-1)),
+                    FFixedVector64::ZeroVector
+                };
+                for (const FFixedVector64& Scale : DegenerateScales)
+                {
+                    const FFixedTransform64 Degenerate(Rotation, Translation, Scale);
+                    TestTrue("Degenerate scale inverts as ToMatrixWithScale().Inverse()", Degenerate.ToInverseMatrixWithScale() == Degenerate.ToMatrixWithScale().Inverse());
+                }
+                TestTrue("All zero scale inverts to identity", FFixedTransform64(Rotation, Translation, FFixedVector64::ZeroVector).ToInverseMatrixWithScale() == FFixedMatrix::Identity);
+            });
+            It("Should multiply, transform and invert FFixedMatrix33 and FFixedMatrix34 the same as FFixedMatrix, within 0.001", [this]()
+            {
+                const FFixedVector64 Translation(FFixed64(10.0), FFixed64(-20.0), FFixed64(5.5));
+                const FFixedTransform64 TransformA(FFixedRotator64(FFixed64(30.0), FFixed64(-60.0), FFixed64(45.0)), Translation, FFixedVector64(FFixed64(1.5), FFixed64(0.75), FFixed64(2.0)));
+                const FFixedTransform64 TransformB(FFixedRotator64(FFixed64(-15.0), FFixed64(20.0), FFixed64(110.0)), FFixedVector64(FFixed64(-3.0), FFixed64(7.25), FFixed64(1.0)), FFixedVector64(FFixed64(1.0)));
+                const FFixedMatrix A = TransformA.ToMatrixWithScale();
+                const FFixedMatrix B = TransformB.ToMatrixWithScale();
+                const FFixedMatrix34 A34(TransformA);
+                const FFixedMatrix34 B34(TransformB);
+                const FFixed64 Tolerance(0.001);
+                const FFixedVector64 Point(FFixed64(3.5), FFixed64(-8.0), FFixed64(12.25));
+
+                TestTrue("FFixedMatrix34 from a transform matches ToMatrixWithScale", A34.Equals(FFixedMatrix34(A), Tolerance));
+                TestTrue("FFixedMatrix34 product", (A34 * B34).Equals(FFixedMatrix34(A * B), Tolerance));
+                TestTrue("FFixedMatrix33 product", (FFixedMatrix33(A) * FFixedMatrix33(B)).Equals(FFixedMatrix33(A * B), Tolerance));
+                TestTrue("FFixedMatrix34 inverse", A34.Inverse().Equals(FFixedMatrix34(A.Inverse()), Tolerance));
+                TestTrue("FFixedMatrix34 rigid inverse", B34.InverseRigid().Equals(FFixedMatrix34(B.Inverse()), Tolerance));
+                TestTrue("FFixedMatrix34 TransformPosition", A34.TransformPosition(Point).Equals(FFixedVector64(A.TransformPosition(Point)), Tolerance));
+                TestTrue("FFixedMatrix33 TransformVector", FFixedMatrix33(A).TransformVector(Point).Equals(FFixedVector64(A.TransformVector(Point)), Tolerance));
+                TestTrue("FFixedMatrix33 quaternion round trip", FFixedMatrix33(FFixedMatrix33(TransformB.GetRotation()).ToQuat()).Equals(FFixedMatrix33(TransformB.GetRotation()), Tolerance));
+
+                TArray<FFixedVector64> Points = { Point, Translation, FFixedVector64(FFixed64(-100.0), FFixed64(0.5), FFixed64(42.0)) };
+                TArray<FFixedVector64> Batch;
+                Batch.SetNumUninitialized(Points.Num());
+                A34.TransformPositions(Points, Batch);
+                bool result = true;
+                for (int32 i = 0; i < Points.Num(); i++)
+                {
+                    result &= Batch[i] == A34.TransformPosition(Points[i]);
+                }
+                TestTrue("FFixedMatrix34 TransformPositions matches TransformPosition exactly", result);
+            });
+        });
+        Describe("Fixed Point Transform", [this]()
+        {
+            It("Should compose a hierarchy in batch, serial and parallel, bit identical to composing one parent at a time", [this]()
+            {
+                FRandomStream Stream(7);
+                const int32 Count = 2000;
+                TArray<int32> Parents;
+                TArray<FFixedTransform64> Locals;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    //every 50th node starts a new hierarchy, the rest hang off an earlier node
+                    Parents.Add(i % 50 == 0 ? INDEX_NONE : Stream.RandRange(i - (i % 50), i - 1));
+                    const FFixedRotator64 Rotation(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)));
+                    const FFixedVector64 Translation(FFixed64(Stream.FRandRange(-10.0f, 10.0f)), FFixed64(Stream.FRandRange(-10.0f, 10.0f)), FFixed64(Stream.FRandRange(-10.0f, 10.0f)));
+                    //a few negative scales take the matrix fallback of Multiply
+                    const FFixed64 Scale = FFixed64(i % 97 == 3 ? -1.0f : Stream.FRandRange(0.9f, 1.1f));
+                    Locals.Add(FFixedTransform64(Rotation, Translation, FFixedVector64(Scale)));
+                }
+
+                TArray<FFixedTransform64> Expected;
+                Expected.SetNum(Count);
+                for (int32 i = 0; i < Count; i++)
+                {
+                    Expected[i] = Parents[i] == INDEX_NONE ? Locals[i] : Locals[i] * Expected[Parents[i]];
+                }
+
+                TArray<FFixedTransform64> Serial, Parallel;
+                Serial.SetNum(Count);
+                Parallel.SetNum(Count);
+                FFixedTransform64::ComposeHierarchy(Parents, Locals, Serial);
+                FFixedHierarchyLevels Levels;
+                FFixedTransform64SoA Workspace;
+                TestTrue("Levels build", Levels.Build(Parents));
+                FFixedTransform64::ComposeHierarchy(Levels, Locals, Parallel, Workspace, true);
+
+                bool result = true;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    result &= Serial[i].Equals(Expected[i], FixedPoint::Constants::Fixed64::Zero);
+                    result &= Parallel[i].Equals(Expected[i], FixedPoint::Constants::Fixed64::Zero);
+                }
+                TestTrue("Serial and parallel batches match the one at a time results exactly", result);
+            });
+            It("Should reject a hierarchy with a cycle or an out of range parent", [this]()
+            {
+                FFixedHierarchyLevels Levels;
+                TestFalse("Cycle", Levels.Build(TArray<int32>({ INDEX_NONE, 2, 1 })));
+                TestFalse("Out of range", Levels.Build(TArray<int32>({ INDEX_NONE, 5 })));
+                TestTrue("Parents after children", Levels.Build(TArray<int32>({ 2, INDEX_NONE, 1 })));
+                TestEqual("Levels", Levels.NumLevels(), 3);
+            });
+        });
+        Describe("Fixed Point Transform Hierarchy", [this]()
+        {
+            It("Should cache world transforms and only report nodes under a moved node as changed", [this]()
+            {
+                FFixedTransformHierarchy Hierarchy;
+                const FFixedTransform64 Offset(FFixedRotator64(FFixed64(0.0), FFixed64(90.0), FFixed64(0.0)), FFixedVector64(FFixed64(10.0), FFixed64(0.0), FFixed64(0.0)));
+                const int32 Root = Hierarchy.AddNode(FFixedTransform64::Identity);
+                const int32 Arm = Hierarchy.AddNode(Offset, Root);
+                const int32 Hand = Hierarchy.AddNode(Offset, Arm);
+                const int32 Other = Hierarchy.AddNode(Offset, Root);
+                Hierarchy.UpdateWorldTransforms();
+                TestEqual("New nodes are reported as changed", Hierarchy.GetChangedNodes().Num(), 4);
+                TestTrue("Hand world transform", Hierarchy.GetWorldTransform(Hand).Equals(Offset * Offset, FixedPoint::Constants::Fixed64::Zero));
+                Hierarchy.ResetChanged();
+
+                const FFixedTransform64 Moved(FFixedVector64(FFixed64(0.0), FFixed64(5.0), FFixed64(0.0)));
+                Hierarchy.SetLocalTransform(Arm, Moved);
+                TestEqual("Moved subtree is reported", Hierarchy.GetChangedNodes().Num(), 2);
+                TestTrue("Arm changed", Hierarchy.WasChanged(Arm));
+                TestTrue("Hand changed", Hierarchy.WasChanged(Hand));
+                TestFalse("Sibling unchanged", Hierarchy.WasChanged(Other));
+                TestTrue("Hand picks up the new parent", Hierarchy.GetWorldTransform(Hand).Equals(Offset * Moved, FixedPoint::Constants::Fixed64::Zero));
+                TestTrue("Cached matrix", Hierarchy.GetWorldMatrix(Hand).Equals(Hierarchy.GetWorldTransform(Hand).ToMatrixWithScale(), FixedPoint::Constants::Fixed64::Zero));
+                TestTrue("Cached inverse", Hierarchy.GetWorldInverse(Hand).Equals(Hierarchy.GetWorldTransform(Hand).Inverse(), FixedPoint::Constants::Fixed64::Zero));
+
+                Hierarchy.ResetChanged();
+                Hierarchy.SetLocalTransform(Arm, Offset);
+                Hierarchy.SetLocalTransform(Arm, Offset);
+                TestEqual("Nodes are listed once per tick", Hierarchy.GetChangedNodes().Num(), 2);
+            });
+        });
+        Describe("Fixed Point Quat Slerp", [this]()
+        {
+            It("Should match FQuat::Slerp and FQuat::SlerpFullPath within 0.0001, with the batch bit identical to Slerp", [this]()
+            {
+                FRandomStream Stream(11);
+                const int32 Count = 200;
+                TArray<FFixedQuat64> A, B, Batch;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    A.Add(FFixedQuat64(FFixedRotator64(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)))));
+                    B.Add(FFixedQuat64(FFixedRotator64(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)))));
+                }
+                Batch.SetNum(Count);
+                const FFixed64 Tolerance(0.0001);
+                bool result = true;
+                for (const double Alpha : { 0.0, 0.1, 0.37, 0.5, 0.9, 1.0 })
+                {
+                    FFixedQuat64::Slerp(Batch, A, B, FFixed64(Alpha));
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        const FQuat Expected = FQuat::Slerp((FQuat)A[i], (FQuat)B[i], Alpha);
+                        const FQuat ExpectedFullPath = FQuat::SlerpFullPath((FQuat)A[i], (FQuat)B[i], Alpha);
+                        result &= FFixedQuat64::Slerp(A[i], B[i], FFixed64(Alpha)).Equals(FFixedQuat64(Expected), Tolerance);
+                        result &= FFixedQuat64::SlerpFullPath(A[i], B[i], FFixed64(Alpha)).Equals(FFixedQuat64(ExpectedFullPath), Tolerance);
+                        result &= Batch[i] == FFixedQuat64::Slerp(A[i], B[i], FFixed64(Alpha));
+                    }
+                }
+                TestTrue("Slerp, SlerpFullPath and batch Slerp", result);
+            });
+            It("Should interpolate Squad through its end points", [this]()
+            {
+                const FFixedQuat64 A(FFixedRotator64(FFixed64(10.0), FFixed64(20.0), FFixed64(30.0)));
+                const FFixedQuat64 B(FFixedRotator64(FFixed64(-40.0), FFixed64(75.0), FFixed64(5.0)));
+                TestTrue("Alpha 0", FFixedQuat64::Squad(A, A, B, B, FFixed64(0.0)).Equals(A, FFixed64(0.0001)));
+                TestTrue("Alpha 1", FFixedQuat64::Squad(A, A, B, B, FFixed64(1.0)).Equals(B, FFixed64(0.0001)));
+                TestTrue("Equal tangents match Slerp", FFixedQuat64::Squad(A, A, B, B, FFixed64(0.3)).Equals(FFixedQuat64::Slerp(A, B, FFixed64(0.3)), FFixed64(0.0001)));
+            });
+            It("Should multiply the same as FQuat, with the product applying the right hand rotation first", [this]()
+            {
+                FRandomStream Stream(17);
+                const FFixedVector64 Point(FFixed64(3.5), FFixed64(-8.0), FFixed64(12.25));
+                bool bProducts = true;
+                bool bOrder = true;
+                bool bInPlace = true;
+                for (int32 i = 0; i < 100; i++)
+                {
+                    const FFixedQuat64 A(FFixedRotator64(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f))));
+                    const FFixedQuat64 B(FFixedRotator64(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f))));
+                    const FFixedQuat64 Product = A * B;
+                    bProducts &= Product.Equals(FFixedQuat64((FQuat)A * (FQuat)B), FFixed64(0.0001));
+                    bOrder &= Product.RotateVector(Point).Equals(A.RotateVector(B.RotateVector(Point)), FFixed64(0.001));
+                    FFixedQuat64 InPlace = A;
+                    InPlace *= B;
+                    bInPlace &= InPlace == Product;
+                }
+                TestTrue("Products match FQuat", bProducts);
+                TestTrue("A * B rotates by B then A", bOrder);
+                TestTrue("*= matches *", bInPlace);
+            });
+        });
+        Describe("Fixed Point Rotator", [this]()
+        {
+            It("Should rotate and unrotate vectors the same as FFixedRotationMatrix, exactly by matrix and within 0.001 by quaternion and in batch", [this]()
+            {
+                FRandomStream Stream(23);
+                const FFixed64 Tolerance(0.001);
+                bool result = true;
+                for (int32 i = 0; i < 50; i++)
+                {
+                    const FFixedRotator64 Rotator(FFixed64(Stream.FRandRange(-360.0f, 360.0f)), FFixed64(Stream.FRandRange(-360.0f, 360.0f)), FFixed64(Stream.FRandRange(-360.0f, 360.0f)));
+                    TArray<FFixedVector64> Vectors, Rotated, Unrotated;
+                    for (int32 j = 0; j < 8; j++)
+                    {
+                        Vectors.Add(FFixedVector64(FFixed64(Stream.FRandRange(-100.0f, 100.0f)), FFixed64(Stream.FRandRange(-100.0f, 100.0f)), FFixed64(Stream.FRandRange(-100.0f, 100.0f))));
+                    }
+                    Rotated.SetNum(Vectors.Num());
+                    Unrotated.SetNum(Vectors.Num());
+                    Rotator.RotateVectors(Vectors, Rotated);
+                    Rotator.UnrotateVectors(Rotated, Unrotated);
+                    const FFixedMatrix Matrix = FFixedRotationMatrix(Rotator);
+                    for (int32 j = 0; j < Vectors.Num(); j++)
+                    {
+                        const FFixedVector64 Expected(Matrix.TransformVector(Vectors[j]));
+                        result &= Rotator.RotateVector(Vectors[j]) == Expected;
+                        result &= Rotator.UnrotateVector(Expected) == FFixedVector64(Matrix.GetTransposed().TransformVector(Expected));
+                        result &= Rotator.QuatRotateVector(Vectors[j]).Equals(Expected, Tolerance);
+                        result &= Rotated[j].Equals(Expected, Tolerance);
+                        result &= Rotator.QuatUnrotateVector(Expected).Equals(Vectors[j], Tolerance);
+                        result &= Unrotated[j].Equals(Vectors[j], Tolerance);
+                    }
+                }
+                TestTrue("RotateVector and UnrotateVector match the matrix exactly, QuatRotateVector, QuatUnrotateVector and the batch calls within 0.001", result);
+            });
+        });
+        Describe("Fixed Point Dual Quat", [this]()
+        {
+            It("Should transform, multiply and convert the same as FFixedTransform64 with uniform scale, within 0.001", [this]()
+            {
+                const FFixedTransform64 A(FFixedRotator64(FFixed64(30.0), FFixed64(-60.0), FFixed64(45.0)), FFixedVector64(FFixed64(10.0), FFixed64(-20.0), FFixed64(5.5)), FFixedVector64(FFixed64(1.5)));
+                const FFixedTransform64 B(FFixedRotator64(FFixed64(-15.0), FFixed64(20.0), FFixed64(110.0)), FFixedVector64(FFixed64(-3.0), FFixed64(7.25), FFixed64(1.0)), FFixedVector64(FFixed64(0.5)));
+                const FFixedDualQuat64 DualA(A);
+                const FFixedDualQuat64 DualB(B);
+                const FFixedVector64 Point(FFixed64(3.5), FFixed64(-8.0), FFixed64(12.25));
+                const FFixed64 Tolerance(0.001);
+                TestTrue("Translation", DualA.GetTranslation().Equals(A.GetTranslation(), Tolerance));
+                TestTrue("ToTransform", DualA.ToTransform().Equals(A, Tolerance));
+                TestTrue("TransformPosition", DualA.TransformPosition(Point).Equals(A.TransformPosition(Point), Tolerance));
+                TestTrue("Multiply", (DualA * DualB).TransformPosition(Point).Equals((A * B).TransformPosition(Point), Tolerance));
+                TestTrue("Normalize keeps a unit dual quaternion", DualA.GetNormalized().Equals(DualA, Tolerance));
+
+                //a blend shrinks Real well below unit length, normalizing has to bring it back to within a few raw units
+                FFixedDualQuat64 Shrunk = DualA;
+                Shrunk.Real *= FFixed64(0.37);
+                Shrunk.Dual *= FFixed64(0.37);
+                Shrunk.Normalize();
+                TestTrue("Normalize makes Real unit length", FFixedPointMath::Abs((Shrunk.Real | Shrunk.Real) - FixedPoint::Constants::Fixed64::One) <= FFixed64::MakeFromRawInt(8));
+                TestTrue("Normalize restores the transform", Shrunk.Equals(DualA, FFixed64(0.0001)));
+            });
+            It("Should blend in batch bit identical to Blend, and blend equal inputs back to themselves", [this]()
+            {
+                TArray<FFixedDualQuat64> Bones;
+                FRandomStream Stream(3);
+                for (int32 i = 0; i < 8; i++)
+                {
+                    const FFixedRotator64 Rotation(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)));
+                    Bones.Add(FFixedDualQuat64(FFixedQuat64(Rotation), FFixedVector64(FFixed64(Stream.FRandRange(-10.0f, 10.0f)), FFixed64(0.0), FFixed64(Stream.FRandRange(-10.0f, 10.0f)))));
+                }
+                TArray<int32> Indices;
+                TArray<FFixed64> Weights;
+                for (int32 i = 0; i < 16; i++)
+                {
+                    Indices.Append({ i % 8, (i + 3) % 8 });
+                    Weights.Append({ FFixed64(0.75), FFixed64(0.25) });
+                }
+                TArray<FFixedDualQuat64> Blended;
+                Blended.SetNum(16);
+                FFixedDualQuat64::Blend(Blended, Bones, Indices, Weights, 2);
+                bool result = true;
+                for (int32 i = 0; i < 16; i++)
+                {
+                    const FFixedDualQuat64 Pair[2] = { Bones[Indices[i * 2]], Bones[Indices[i * 2 + 1]] };
+                    const FFixedDualQuat64 Expected = FFixedDualQuat64::Blend(MakeArrayView(Pair, 2), MakeArrayView(&Weights[i * 2], 2));
+                    result &= Blended[i].Real == Expected.Real && Blended[i].Dual == Expected.Dual && Blended[i].Scale == Expected.Scale;
+                }
+                TestTrue("Batch matches Blend", result);
+                const FFixedDualQuat64 Same[2] = { Bones[1], Bones[1] };
+                const FFixed64 Halves[2] = { FFixed64(0.5), FFixed64(0.5) };
+                TestTrue("Equal inputs", FFixedDualQuat64::Blend(MakeArrayView(Same, 2), MakeArrayView(Halves, 2)).Equals(Bones[1], FFixed64(0.001)));
+            });
+        });
+        Describe("Fixed Point Unit Quat", [this]()
+        {
+            It("Should round trip FFixedQuat64 and FFixedVector64 exactly and multiply and rotate within 0.00001", [this]()
+            {
+                FRandomStream Stream(19);
+                const FFixed64 Tolerance(0.00001);
+                bool bRoundTrip = true;
+                bool bMath = true;
+                for (int32 i = 0; i < 200; i++)
+                {
+                    const FFixedQuat64 A(FFixedRotator64(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f))));
+                    const FFixedQuat64 B(FFixedRotator64(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f))));
+                    const FFixedVector64 V = FFixedVector64(FFixed64(Stream.FRandRange(-1.0f, 1.0f)), FFixed64(Stream.FRandRange(-1.0f, 1.0f)), FFixed64(Stream.FRandRange(-1.0f, 1.0f))).GetSafeNormal();
+                    bRoundTrip &= FFixedUnitQuat(A).ToQuat() == A;
+                    bRoundTrip &= FFixedUnitVector(V).ToVector() == V;
+                    const FQuat Expected = (FQuat)A * (FQuat)B;
+                    bMath &= (FFixedUnitQuat(A) * FFixedUnitQuat(B)).ToQuat().Equals(FFixedQuat64(Expected), Tolerance);
+                    const FVector ExpectedVector = ((FQuat)A).RotateVector((FVector)V);
+                    bMath &= FFixedUnitQuat(A).RotateVector(FFixedUnitVector(V)).ToVector().Equals(FFixedVector64(ExpectedVector), Tolerance);
+                    bMath &= FFixedUnitQuat(A).UnrotateVector(FFixedUnitQuat(A).RotateVector(FFixedUnitVector(V))).ToVector().Equals(V, Tolerance);
+                }
+                TestTrue("Conversions round trip exactly", bRoundTrip);
+                TestTrue("Multiply and rotate match FQuat", bMath);
+            });
+        });
+        Describe("Fixed Point Rotation Matrix 62", [this]()
+        {
+            It("Should rotate vectors the same as FFixedRotationMatrix within 0.001 and stay orthonormal over 10000 multiplies", [this]()
+            {
+                const FFixedRotator64 Rotator(FFixed64(12.5), FFixed64(-47.25), FFixed64(93.0));
+                const FFixedRotationMatrix62 Rotation(Rotator);
+                const FFixedMatrix Matrix = FFixedRotationMatrix(Rotator);
+                const FFixedVector64 Point(FFixed64(300.5), FFixed64(-80.0), FFixed64(12.25));
+                TestTrue("TransformVector", Rotation.TransformVector(Point).Equals(FFixedVector64(Matrix.TransformVector(Point)), FFixed64(0.001)));
+                TestTrue("InverseTransformVector", Rotation.InverseTransformVector(Rotation.TransformVector(Point)).Equals(Point, FFixed64(0.0001)));
+                TestTrue("From quaternion", FFixedRotationMatrix62(Rotator.Quaternion()).ToMatrix33().Equals(Rotation.ToMatrix33(), FFixed64(0.0001)));
+
+                FFixedRotationMatrix62 Chain = FFixedRotationMatrix62::Identity;
+                for (int32 i = 0; i < 10000; i++)
+                {
+                    Chain *= Rotation;
+                }
+                const FFixedRotationMatrix62 Product = Chain * Chain.GetTransposed();
+                TestTrue("10000 multiplies stay orthonormal to the last FFixed64 bit", Product.ToMatrix33().Equals(FFixedMatrix33::Identity, FFixed64::MakeFromRawInt(1)));
+                //2^-43 is about 1.1e-13, the chain drifts by around 1e-14
+                int64 Drift = 0;
+                for (int32 Row = 0; Row < 3; Row++)
+                {
+                    for (int32 Column = 0; Column < 3; Column++)
+                    {
+                        Drift = FMath::Max(Drift, FMath::Abs(Product.M[Row][Column] - FFixedRotationMatrix62::Identity.M[Row][Column]));
+                    }
+                }
+                TestTrue("10000 multiplies stay orthonormal to 2^-43", Drift <= ((int64)1 << (FixedPoint::Constants::BinaryPointRotation - 43)));
+            });
+        });
+        Describe("Fixed Point Plane", [this]()
+        {
+            It("Should transform arrays of planes identically to TransformBy and keep transformed points on them", [this]()
+            {
+                const FFixedMatrix Matrix = FFixedTransform64(FFixedRotator64(FFixed64(30.0), FFixed64(-60.0), FFixed64(15.0)), FFixedVector64(FFixed64(100.0), FFixed64(-50.0), FFixed64(25.0)), FFixedVector64(FFixed64(2.0), FFixed64(0.5), FFixed64(1.5))).ToMatrixWithScale();
+                const FFixedMatrix Mirror = FFixedTransform64(FFixedRotator64(FFixed64(10.0), FFixed64(20.0), FFixed64(0.0)), FFixedVector64(FFixed64(5.0), FFixed64(0.0), FFixed64(0.0)), FFixedVector64(FFixed64(-1.0), FFixed64(1.0), FFixed64(1.0))).ToMatrixWithScale();
+                TArray<FFixedVector64> Corners;
+                TArray<FFixedPlane> Planes;
+                for (int32 i = 0; i < 6; i++)
+                {
+                    const FFixedVector64 A(FFixed64(i * 10), FFixed64(3.0), FFixed64(-i));
+                    const FFixedVector64 B(FFixed64(-4.0), FFixed64(i * 7 + 1), FFixed64(2.0));
+                    const FFixedVector64 C(FFixed64(6.0), FFixed64(-2.0), FFixed64(i * 5 + 3));
+                    Planes.Add(FFixedPlane(A, B, C));
+                    Corners.Add(A);
+                }
+
+                bool result = true;
+                for (const FFixedMatrix& M : { Matrix, Mirror })
+                {
+                    TArray<FFixedPlane> Batch;
+                    Batch.SetNumUninitialized(Planes.Num());
+                    FFixedPlane::TransformBy(Batch, Planes, M);
+                    FFixedPlaneSoA SoA;
+                    SoA.SetPlanes(Planes);
+                    SoA.TransformBy(M);
+                    for (int32 i = 0; i < Planes.Num(); i++)
+                    {
+                        const FFixedPlane Single = Planes[i].TransformBy(M);
+                        result &= Batch[i] == Single;
+                        result &= SoA.Get(i) == Single;
+                        result &= FFixedPointMath::Abs(Single.PlaneDot(FFixedVector64(M.TransformPosition(Corners[i])))) < FFixed64(0.01);
+                        // a point in front of the plane must stay in front, including through the mirror
+                        const FFixedVector64 Front = Corners[i] + Planes[i].GetNormal();
+                        result &= Single.PlaneDot(FFixedVector64(M.TransformPosition(Front))) > FixedPoint::Constants::Fixed64::Zero;
+                    }
+                }
+                TestTrue("Batch, SoA and single transforms match, and transformed points stay on and in front of their planes", result);
+            });
+
+            It("Should classify points against SoA planes the same as PlaneDot", [this]()
+            {
+                TArray<FFixedPlane> Planes;
+                Planes.Add(FFixedPlane(FixedPoint::Constants::Fixed64::One, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, FFixed64(10.0)));
+                Planes.Add(FFixedPlane(-FixedPoint::Constants::Fixed64::One, FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero, FFixed64(10.0)));
+                Planes.Add(FFixedPlane(FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::One, FixedPoint::Constants::Fixed64::Zero, FFixed64(5.0)));
+                Planes.Add(FFixedPlane(FixedPoint::Constants::Fixed64::Zero, -FixedPoint::Constants::Fixed64::One, FixedPoint::Constants::Fixed64::Zero, FFixed64(5.0)));
+                FFixedPlaneSoA SoA;
+                SoA.SetPlanes(Planes);
+
+                TArray<FFixedVector64> Points;
+                for (int32 i = -12; i <= 12; i += 3)
+                {
+                    Points.Add(FFixedVector64(FFixed64(i), FFixed64(i / 2), FFixed64(100.0)));
+                }
+                TArray<bool> Inside;
+                Inside.SetNumUninitialized(Points.Num());
+                SoA.ClassifyPoints(Points, Inside);
+                TArray<FFixed64> Distances;
+                Distances.SetNumUninitialized(Planes.Num());
+
+                bool result = true;
+                for (int32 i = 0; i < Points.Num(); i++)
+                {
+                    bool bExpected = true;
+                    SoA.PlaneDots(Points[i], Distances);
+                    for (int32 j = 0; j < Planes.Num(); j++)
+                    {
+                        result &= Distances[j] == Planes[j].PlaneDot(Points[i]);
+                        bExpected &= Planes[j].PlaneDot(Points[i]) <= FixedPoint::Constants::Fixed64::Zero;
+                    }
+                    result &= Inside[i] == bExpected;
+                    result &= SoA.IsPointInside(Points[i]) == bExpected;
+                }
+                TestTrue("ClassifyPoints, IsPointInside and PlaneDots agree with FFixedPlane::PlaneDot", result);
+                TestTrue("Origin is inside", SoA.IsPointInside(FFixedVector64(FixedPoint::Constants::Fixed64::Zero)));
+                TestFalse("Outside X", SoA.IsPointInside(FFixedVector64(FFixed64(11.0), FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero)));
+            });
+        });
+        Describe("Fixed Point Bounds", [this]()
+        {
+            It("Should grow, intersect and overlap FFixedBox and FFixedBox2D like FBox", [this]()
+            {
+                FFixedBox Box(ForceInit);
+                TestFalse("Starts invalid", Box.IsValid != 0);
+                Box += FFixedVector64(FFixed64(1.0), FFixed64(2.0), FFixed64(3.0));
+                Box += FFixedVector64(FFixed64(-1.0), FFixed64(5.0), FFixed64(0.0));
+                TestTrue("Grown by points", Box == FFixedBox(FFixedVector64(FFixed64(-1.0), FFixed64(2.0), FFixed64(0.0)), FFixedVector64(FFixed64(1.0), FFixed64(5.0), FFixed64(3.0))));
+                TestTrue("Center", Box.GetCenter() == FFixedVector64(FFixed64(0.0), FFixed64(3.5), FFixed64(1.5)));
+                TestTrue("Extent", Box.GetExtent() == FFixedVector64(FFixed64(1.0), FFixed64(1.5), FFixed64(1.5)));
+
+                const FFixedBox Other = FFixedBox::BuildAABB(FFixedVector64(FFixed64(1.0), FFixed64(5.0), FFixed64(3.0)), FFixedVector64(FFixed64(1.0)));
+                TestTrue("Touching corner intersects", Box.Intersect(Other));
+                TestTrue("Overlap is the shared region", Box.Overlap(Other) == FFixedBox(Other.Min, Box.Max));
+                TestFalse("Shifted apart", Box.Intersect(Other.ShiftBy(FFixedVector64(FFixed64(0.001), FixedPoint::Constants::Fixed64::Zero, FixedPoint::Constants::Fixed64::Zero) + Other.GetSize())));
+                TestTrue("Union", (Box + Other) == FFixedBox(Box.Min, Other.Max));
+                TestTrue("Expanded contains original", Box.ExpandBy(FixedPoint::Constants::Fixed64::One).IsInside(Box));
+                TestTrue("Closest point", Box.GetClosestPointTo(FFixedVector64(FFixed64(10.0))) == Box.Max);
+
+                FFixedBox2D Box2D(ForceInit);
+                Box2D += FFixedVector2d(FFixed64(1.0), FFixed64(-2.0));
+                Box2D += FFixedVector2d(FFixed64(-3.0), FFixed64(4.0));
+                TestTrue("2D grown by points", Box2D == FFixedBox2D(FFixedVector2d(FFixed64(-3.0), FFixed64(-2.0)), FFixedVector2d(FFixed64(1.0), FFixed64(4.0))));
+                TestTrue("2D area", Box2D.GetArea() == FFixed64(24.0));
+                TestTrue("2D distance squared", Box2D.ComputeSquaredDistanceToPoint(FFixedVector2d(FFixed64(4.0), FFixed64(8.0))) == FFixed64(25.0));
+                TestTrue("2D circle touching box", FFixedSphere2D(FFixedVector2d(FFixed64(4.0), FFixed64(8.0)), FFixed64(5.0)).Intersects(Box2D));
+                TestFalse("2D circle short of box", FFixedSphere2D(FFixedVector2d(FFixed64(4.0), FFixed64(8.0)), FFixed64(4.99)).Intersects(Box2D));
+            });
+
+            It("Should transform boxes so they contain every transformed corner and stay tight", [this]()
+            {
+                FRandomStream Stream(39);
+                bool bContains = true;
+                bool bTight = true;
+                for (int32 i = 0; i < 200; i++)
+                {
+                    const FFixedRotator64 Rotation(FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)), FFixed64(Stream.FRandRange(-180.0f, 180.0f)));
+                    const FFixedVector64 Translation(FFixed64(Stream.FRandRange(-100.0f, 100.0f)), FFixed64(Stream.FRandRange(-100.0f, 100.0f)), FFixed64(Stream.FRandRange(-100.0f, 100.0f)));
+                    const FFixedVector64 Scale(FFixed64(Stream.FRandRange(0.5f, 2.0f)), FFixed64(Stream.FRandRange(-2.0f, -0.5f)), FFixed64(Stream.FRandRange(0.5f, 2.0f)));
+                    const FFixedTransform64 Transform(Rotation, Translation, Scale);
+                    const FFixedVector64 Center(FFixed64(Stream.FRandRange(-50.0f, 50.0f)), FFixed64(Stream.FRandRange(-50.0f, 50.0f)), FFixed64(Stream.FRandRange(-50.0f, 50.0f)));
+                    const FFixedBox Box = FFixedBox::BuildAABB(Center, FFixedVector64(FFixed64(Stream.FRandRange(0.0f, 10.0f)), FFixed64(Stream.FRandRange(0.0f, 10.0f)), FFixed64(Stream.FRandRange(0.0f, 10.0f))));
+
+                    const FFixedBox Transformed = Box.TransformBy(Transform);
+                    const FFixedMatrix34 Matrix(Transform);
+                    FFixedBox Corners(ForceInit);
+                    for (int32 Corner = 0; Corner < 8; Corner++)
+                    {
+                        Corners += Matrix.TransformPosition(FFixedVector64(
+                            (Corner & 1) ? Box.Max.X : Box.Min.X,
+                            (Corner & 2) ? Box.Max.Y : Box.Min.Y,
+                            (Corner & 4) ? Box.Max.Z : Box.Min.Z));
+                    }
+                    bContains &= Transformed.IsInsideOrOn(Corners);
+                    bTight &= Transformed.Equals(Corners, FFixed64::MakeFromRawInt(2));
+                }
+                TestTrue("Transformed box contains every transformed corner", bContains);
+                TestTrue("Transformed box is within 2 raw units of the corner box", bTight);
+            });
+
+            It("Should build, grow and transform FFixedSphere", [this]()
+            {
+                TArray<FFixedVector64> Points;
+                FRandomStream Stream(93);
+                for (int32 i = 0; i < 100; i++)
+                {
+                    Points.Add(FFixedVector64(FFixed64(Stream.FRandRange(-20.0f, 20.0f)), FFixed64(Stream.FRandRange(-5.0f, 5.0f)), FFixed64(Stream.FRandRange(0.0f, 30.0f))));
+                }
+                const FFixedSphere Sphere(Points);
+                bool result = true;
+                for (const FFixedVector64& Point : Points)
+                {
+                    result &= Sphere.IsInside(Point, FixedPoint::Constants::Fixed64::Zero);
+                }
+                TestTrue("Bounding sphere contains every point", result);
+
+                const FFixedSphere A(FFixedVector64(FFixed64(-10.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(2.0));
+                const FFixedSphere B(FFixedVector64(FFixed64(10.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(4.0));
+                const FFixedSphere Union = A + B;
+                TestTrue("Union", Union.Equals(FFixedSphere(FFixedVector64(FFixed64(1.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(13.0)), FFixed64(0.001)));
+                TestTrue("Union contains A", A.IsInside(Union, FFixed64(0.001)));
+                TestTrue("Union contains B", B.IsInside(Union, FFixed64(0.001)));
+                TestTrue("Contained sphere is absorbed", (B + FFixedSphere(B.Center, FFixed64(1.0))) == B);
+
+                //the union has to contain both inputs with no tolerance, however far apart and however different in size
+                bool bUnionsContain = true;
+                for (int32 i = 0; i < 500; i++)
+                {
+                    const FFixed64 Extent = FFixed64(i % 2 == 0 ? 10.0f : 5000.0f);
+                    const FFixedSphere First(FFixedVector64(FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent, FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent, FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent), FFixed64(Stream.FRandRange(0.001f, 1.0f)) * Extent);
+                    const FFixedSphere Second(FFixedVector64(FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent, FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent, FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent), FFixed64(Stream.FRandRange(0.001f, 1.0f)));
+                    const FFixedSphere Both = First + Second;
+                    bUnionsContain &= First.IsInside(Both, FixedPoint::Constants::Fixed64::Zero) && Second.IsInside(Both, FixedPoint::Constants::Fixed64::Zero);
+                }
+                TestTrue("Unions contain both inputs", bUnionsContain);
+
+                bool bCircleUnionsContain = true;
+                for (int32 i = 0; i < 500; i++)
+                {
+                    const FFixed64 Extent = FFixed64(i % 2 == 0 ? 10.0f : 5000.0f);
+                    const FFixedSphere2D First(FFixedVector2d(FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent, FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent), FFixed64(Stream.FRandRange(0.001f, 1.0f)) * Extent);
+                    const FFixedSphere2D Second(FFixedVector2d(FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent, FFixed64(Stream.FRandRange(-1.0f, 1.0f)) * Extent), FFixed64(Stream.FRandRange(0.001f, 1.0f)));
+                    const FFixedSphere2D Both = First + Second;
+                    bCircleUnionsContain &= First.IsInside(Both, FixedPoint::Constants::Fixed64::Zero) && Second.IsInside(Both, FixedPoint::Constants::Fixed64::Zero);
+                }
+                TestTrue("2D unions contain both inputs", bCircleUnionsContain);
+                TestFalse("Apart", A.Intersects(B));
+                TestTrue("Sphere touching box", FFixedSphere(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(5.0)), FFixed64(2.0)).Intersects(FFixedBox(FFixedVector64(FFixed64(-1.0)), FFixedVector64(FFixed64(3.0)))));
+                TestTrue("SphereAABBIntersection agrees", FFixedPointMath::SphereAABBIntersection(A, A.GetBox()));
+
+                const FFixedTransform64 Transform(FFixedRotator64(FFixed64(0.0), FFixed64(90.0), FFixed64(0.0)), FFixedVector64(FFixed64(5.0), FFixed64(0.0), FFixed64(0.0)), FFixedVector64(FFixed64(1.0), FFixed64(3.0), FFixed64(2.0)));
+                const FFixedSphere Moved = A.TransformBy(Transform);
+                TestTrue("Transformed by transform", Moved.Equals(FFixedSphere(FFixedVector64(FFixed64(5.0), FFixed64(-10.0), FFixed64(0.0)), FFixed64(6.0)), FFixed64(0.001)));
+                TestTrue("Transformed by matrix", A.TransformBy(Transform.ToMatrixWithScale()).Equals(Moved, FFixed64(0.001)));
+
+                //3 raw units scaled by half a unit plus one raw unit is 1.5 raw units and a little more, which has to round up to 2
+                const FFixedSphere Tiny(FFixedVector64::ZeroVector, FFixed64::MakeFromRawInt(3));
+                const FFixedTransform64 JustOverHalf(FFixedRotator64::ZeroRotator, FFixedVector64::ZeroVector, FFixedVector64(FFixed64::MakeFromRawInt(FixedPoint::Constants::Raw64::Half + 1), FixedPoint::Constants::Fixed64::Half, FixedPoint::Constants::Fixed64::Half));
+                TestTrue("Transformed radius rounds up", Tiny.TransformBy(JustOverHalf).W == FFixed64::MakeFromRawInt(2));
+                TestTrue("Transformed radius by matrix rounds up", Tiny.TransformBy(JustOverHalf.ToMatrixWithScale()).W >= FFixed64::MakeFromRawInt(2));
+            });
+
+            It("Should find overlaps in SoA boxes and spheres exactly as the scalar tests do", [this]()
+            {
+                FRandomStream Stream(3939);
+                FFixedBoxSoA Boxes;
+                FFixedSphereSoA Spheres;
+                TArray<FFixedBox> BoxArray;
+                TArray<FFixedSphere> SphereArray;
+                for (int32 i = 0; i < 4000; i++)
+                {
+                    const FFixedVector64 Center(FFixed64(Stream.FRandRange(-500.0f, 500.0f)), FFixed64(Stream.FRandRange(-500.0f, 500.0f)), FFixed64(Stream.FRandRange(-500.0f, 500.0f)));
+                    BoxArray.Add(FFixedBox::BuildAABB(Center, FFixedVector64(FFixed64(Stream.FRandRange(1.0f, 20.0f)), FFixed64(Stream.FRandRange(1.0f, 20.0f)), FFixed64(Stream.FRandRange(1.0f, 20.0f)))));
+                    SphereArray.Add(FFixedSphere(Center, FFixed64(Stream.FRandRange(1.0f, 20.0f))));
+                    Boxes.Add(BoxArray.Last());
+                    Spheres.Add(SphereArray.Last());
+                }
+
+                bool result = true;
+                int32 Found = 0;
+                for (int32 Query = 0; Query < 20; Query++)
+                {
+                    const FFixedVector64 Center(FFixed64(Stream.FRandRange(-500.0f, 500.0f)), FFixed64(Stream.FRandRange(-500.0f, 500.0f)), FFixed64(Stream.FRandRange(-500.0f, 500.0f)));
+                    const FFixedBox QueryBox = FFixedBox::BuildAABB(Center, FFixedVector64(FFixed64(100.0)));
+                    const FFixedSphere QuerySphere(Center, FFixed64(100.0));
+
+                    TArray<int32> BoxBox, BoxSphere, SphereSphere, SphereBox;
+                    Boxes.OverlapBox(QueryBox, BoxBox);
+                    Boxes.OverlapSphere(QuerySphere, BoxSphere);
+                    Spheres.OverlapSphere(QuerySphere, SphereSphere);
+                    Spheres.OverlapBox(QueryBox, SphereBox);
+
+                    TArray<int32> ExpectedBoxBox, ExpectedBoxSphere, ExpectedSphereSphere, ExpectedSphereBox;
+                    for (int32 i = 0; i < BoxArray.Num(); i++)
+                    {
+                        if (BoxArray[i].Intersect(QueryBox)) { ExpectedBoxBox.Add(i); }
+                        if (QuerySphere.Intersects(BoxArray[i])) { ExpectedBoxSphere.Add(i); }
+                        if (SphereArray[i].Intersects(QuerySphere)) { ExpectedSphereSphere.Add(i); }
+                        if (SphereArray[i].Intersects(QueryBox)) { ExpectedSphereBox.Add(i); }
+                    }
+                    result &= BoxBox == ExpectedBoxBox && BoxSphere == ExpectedBoxSphere && SphereSphere == ExpectedSphereSphere && SphereBox == ExpectedSphereBox;
+                    Found += BoxBox.Num() + BoxSphere.Num() + SphereSphere.Num() + SphereBox.Num();
+                }
+                TestTrue("SoA overlaps match the scalar tests", result);
+                TestTrue("Queries found something", Found > 0);
+            });
+        });
+
+        Describe("Fixed Point Spatial Grid", [this]()
+        {
+            It("Should answer radius, box and nearest queries exactly like brute force, before and after edits", [this]()
+            {
+                FRandomStream Stream(40);
+                const int32 Count = 2000;
+                TArray<FFixedVector64> Positions;
+                TArray<bool> Alive;
+                FFixedSpatialGrid Grid(FFixed64(25.0));
+                for (int32 i = 0; i < Count; i++)
+                {
+                    Positions.Add(FFixedVector64(FFixed64(Stream.FRandRange(-200.0f, 200.0f)), FFixed64(Stream.FRandRange(-200.0f, 200.0f)), FFixed64(Stream.FRandRange(-50.0f, 50.0f))));
+                    Alive.Add(true);
+                    Grid.Insert(i, Positions[i]);
+                }
+                TestTrue("Dirty before flush", Grid.IsDirty());
+                Grid.Flush();
+                TestEqual("Every insert is reported as changed", Grid.GetChangedIds().Num(), Count);
+
+                auto CheckQueries = [this, &Stream, &Grid, &Positions, &Alive, Count](const TCHAR* What)
+                {
+                    bool bRadius = true;
+                    bool bBox = true;
+                    bool bNearest = true;
+                    for (int32 Query = 0; Query < 50; Query++)
+                    {
+                        const FFixedVector64 Center(FFixed64(Stream.FRandRange(-250.0f, 250.0f)), FFixed64(Stream.FRandRange(-250.0f, 250.0f)), FFixed64(Stream.FRandRange(-60.0f, 60.0f)));
+                        const FFixed64 Radius(Stream.FRandRange(0.0f, 80.0f));
+                        const FFixedBox Box = FFixedBox::BuildAABB(Center, FFixedVector64(Radius, Radius * FixedPoint::Constants::Fixed64::Half, Radius));
+                        const int32 K = 1 + Query % 12;
+
+                        TArray<int32> ExpectedRadius, ExpectedBox;
+                        TArray<TPair<FFixed64, int32>> ByDistance;
+                        for (int32 i = 0; i < Count; i++)
+                        {
+                            if (!Alive[i])
+                            {
+                                continue;
+                            }
+                            const FFixed64 DistSquared = FFixedVector64::DistSquared(Positions[i], Center);
+                            if (DistSquared <= Radius * Radius) { ExpectedRadius.Add(i); }
+                            if (Box.IsInsideOrOn(Positions[i])) { ExpectedBox.Add(i); }
+                            ByDistance.Add(TPair<FFixed64, int32>(DistSquared, i));
+                        }
+                        ByDistance.Sort([](const TPair<FFixed64, int32>& A, const TPair<FFixed64, int32>& B) { return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value); });
+                        TArray<int32> ExpectedNearest;
+                        for (int32 i = 0; i < K && i < ByDistance.Num(); i++)
+                        {
+                            ExpectedNearest.Add(ByDistance[i].Value);
+                        }
+
+                        TArray<int32> Found;
+                        Grid.QueryRadius(Center, Radius, Found);
+                        Found.Sort();
+                        bRadius &= Found == ExpectedRadius;
+                        Found.Reset();
+                        Grid.QueryBox(Box, Found);
+                        Found.Sort();
+                        bBox &= Found == ExpectedBox;
+                        Grid.QueryNearest(Center, K, Found);
+                        bNearest &= Found == ExpectedNearest;
+                    }
+                    TestTrue(FString::Printf(TEXT("%s radius queries match brute force"), What), bRadius);
+                    TestTrue(FString::Printf(TEXT("%s box queries match brute force"), What), bBox);
+                    TestTrue(FString::Printf(TEXT("%s nearest queries match brute force"), What), bNearest);
+                };
+                CheckQueries(TEXT("Fresh grid"));
+
+                //small moves mostly stay in their cell, large ones cross cells
+                for (int32 i = 0; i < Count; i += 3)
+                {
+                    Positions[i] += FFixedVector64(FFixed64(Stream.FRandRange(-1.0f, 1.0f)), FFixed64(Stream.FRandRange(-1.0f, 1.0f)), FixedPoint::Constants::Fixed64::Zero);
+                    Grid.Move(i, Positions[i]);
+                }
+                for (int32 i = 1; i < Count; i += 7)
+                {
+                    Positions[i] = FFixedVector64(FFixed64(Stream.FRandRange(-200.0f, 200.0f)), FFixed64(Stream.FRandRange(-200.0f, 200.0f)), FFixed64(Stream.FRandRange(-50.0f, 50.0f)));
+                    Grid.Move(i, Positions[i]);
+                }
+                for (int32 i = 2; i < Count; i += 11)
+                {
+                    Grid.Remove(i);
+                    Alive[i] = false;
+                }
+                Grid.Flush();
+                TestFalse("Clean after flush", Grid.IsDirty());
+                TestEqual("Removed elements are gone", Grid.Num(), Count - (Count - 2 + 10) / 11);
+                bool bChangedValid = true;
+                for (const int32 Id : Grid.GetChangedIds())
+                {
+                    bChangedValid &= Alive[Id] && Grid.GetPosition(Id) == Positions[Id];
+                }
+                TestTrue("Changed ids are live and moved", bChangedValid && Grid.GetChangedIds().Num() > 0);
+                CheckQueries(TEXT("Edited grid"));
+            });
+
+            It("Should give identical results whatever the insert order and thread count", [this]()
+            {
+                FRandomStream Stream(4040);
+                const int32 Count = 3000;
+                FFixedSpatialGrid Forward(FFixed64(10.0));
+                FFixedSpatialGrid Backward(FFixed64(10.0));
+                TArray<FFixedVector64> Positions;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    Positions.Add(FFixedVector64(FFixed64(Stream.FRandRange(-100.0f, 100.0f)), FFixed64(Stream.FRandRange(-100.0f, 100.0f)), FFixed64(Stream.FRandRange(-100.0f, 100.0f))));
+                    Forward.Insert(i, Positions[i]);
+                }
+                for (int32 i = Count - 1; i >= 0; i--)
+                {
+                    Backward.Insert(i, Positions[i]);
+                }
+                Forward.Flush();
+                Backward.Flush();
+
+                TArray<FFixedVector64> Centers;
+                for (int32 i = 0; i < 500; i++)
+                {
+                    Centers.Add(Positions[Stream.RandRange(0, Count - 1)]);
+                }
+                TArray<TArray<int32>> Serial, Parallel, Reordered;
+                Serial.SetNum(Centers.Num());
+                Parallel.SetNum(Centers.Num());
+                Reordered.SetNum(Centers.Num());
+
+                Forward.QueryRadius(Centers, FFixed64(15.0), Serial, false);
+                Forward.QueryRadius(Centers, FFixed64(15.0), Parallel, true);
+                Backward.QueryRadius(Centers, FFixed64(15.0), Reordered, true);
+                TestTrue("Parallel radius queries match serial", Parallel == Serial);
+                TestTrue("Radius query order does not depend on insert order", Reordered == Serial);
+
+                Forward.QueryNearest(Centers, 8, Serial, false);
+                Forward.QueryNearest(Centers, 8, Parallel, true);
+                Backward.QueryNearest(Centers, 8, Reordered, true);
+                TestTrue("Parallel nearest queries match serial", Parallel == Serial);
+                TestTrue("Nearest query order does not depend on insert order", Reordered == Serial);
+            });
+        });
+
+        Describe("Fixed Point BVH", [this]()
+        {
+            //plain FFixed64 slab test as the brute force reference, entry times round down like FFixedBVH's
+            auto SegmentEntry = [](const FFixedVector64& Start, const FFixedVector64& End, const FFixedBox& Box, FFixed64& OutEnter) -> bool
+            {
+                FFixed64 Enter = FixedPoint::Constants::Fixed64::Zero;
+                FFixed64 Exit = FixedPoint::Constants::Fixed64::One;
+                for (int32 Axis = 0; Axis < 3; Axis++)
+                {
+                    const FFixed64 S = Start[Axis];
+                    const FFixed64 D = End[Axis] - S;
+                    if (D == FixedPoint::Constants::Fixed64::Zero)
+                    {
+                        if (S < Box.Min[Axis] || S > Box.Max[Axis])
+                        {
+                            return false;
+                        }
+                        continue;
+                    }
+                    const FFixed64 Near = (D > FixedPoint::Constants::Fixed64::Zero ? Box.Min[Axis] : Box.Max[Axis]) - S;
+                    const FFixed64 Far = (D > FixedPoint::Constants::Fixed64::Zero ? Box.Max[Axis] : Box.Min[Axis]) - S;
+                    Enter = FFixedPointMath::Max(Enter, Near / D);
+                    Exit = FFixedPointMath::Min(Exit, Far / D);
+                }
+                OutEnter = Enter;
+                return Enter <= Exit;
+            };
+
+            auto MakeBoxes = [](FRandomStream& Stream, int32 Count)
+            {
+                TArray<FFixedBox> Boxes;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    const FFixedVector64 Center(FFixed64(Stream.FRandRange(-500.0f, 500.0f)), FFixed64(Stream.FRandRange(-500.0f, 500.0f)), FFixed64(Stream.FRandRange(-100.0f, 100.0f)));
+                    Boxes.Add(FFixedBox::BuildAABB(Center, FFixedVector64(FFixed64(Stream.FRandRange(0.0f, 15.0f)), FFixed64(Stream.FRandRange(0.0f, 15.0f)), FFixed64(Stream.FRandRange(0.0f, 15.0f)))));
+                }
+                return Boxes;
+            };
+
+            It("Should find the same items as brute force for box, segment and sweep queries after updates and refits", [this, SegmentEntry, MakeBoxes]()
+            {
+                FRandomStream Stream(41);
+                const int32 Count = 2000;
+                TArray<FFixedBox> Boxes = MakeBoxes(Stream, Count);
+                FFixedBVH Tree;
+                Tree.Build(Boxes);
+                TestEqual("Every item is in the tree", Tree.Num(), Count);
+
+                auto CheckQueries = [this, &Stream, &Tree, &Boxes, SegmentEntry, Count](const TCHAR* What)
+                {
+                    bool bBox = true;
+                    bool bSegment = true;
+                    bool bSweep = true;
+                    for (int32 Query = 0; Query < 50; Query++)
+                    {
+                        const FFixedVector64 Start(FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-120.0f, 120.0f)));
+                        const FFixedVector64 End(FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-600.0f, 600.0f)), Query % 5 == 0 ? Start.Z : FFixed64(Stream.FRandRange(-120.0f, 120.0f)));
+                        const FFixed64 Radius(Stream.FRandRange(0.0f, 20.0f));
+                        const FFixedBox QueryBox = FFixedBox::BuildAABB(Start, FFixedVector64(Radius * FFixed64(4.0)));
+
+                        TArray<int32> ExpectedBox, ExpectedSegment, ExpectedSweep;
+                        for (int32 i = 0; i < Count; i++)
+                        {
+                            FFixed64 Enter;
+                            if (Boxes[i].Intersect(QueryBox)) { ExpectedBox.Add(i); }
+                            if (SegmentEntry(Start, End, Boxes[i], Enter)) { ExpectedSegment.Add(i); }
+                            if (SegmentEntry(Start, End, Boxes[i].ExpandBy(Radius), Enter)) { ExpectedSweep.Add(i); }
+                        }
+
+                        TArray<int32> Found;
+                        Tree.QueryBox(QueryBox, Found);
+                        Found.Sort();
+                        bBox &= Found == ExpectedBox;
+                        Found.Reset();
+                        Tree.QuerySegment(Start, End, Found);
+                        Found.Sort();
+                        bSegment &= Found == ExpectedSegment;
+                        Found.Reset();
+                        Tree.QuerySphereSweep(Start, End, Radius, Found);
+                        Found.Sort();
+                        bSweep &= Found == ExpectedSweep;
+                    }
+                    TestTrue(FString::Printf(TEXT("%s box queries match brute force"), What), bBox);
+                    TestTrue(FString::Printf(TEXT("%s segment queries match brute force"), What), bSegment);
+                    TestTrue(FString::Printf(TEXT("%s sweep queries match brute force"), What), bSweep);
+                };
+                CheckQueries(TEXT("Built"));
+
+                for (int32 i = 0; i < Count; i += 5)
+                {
+                    Boxes[i] = Boxes[i].ShiftBy(FFixedVector64(FFixed64(Stream.FRandRange(-5.0f, 5.0f)), FFixed64(Stream.FRandRange(-5.0f, 5.0f)), FFixed64(Stream.FRandRange(-5.0f, 5.0f))));
+                    Tree.UpdateItem(i, Boxes[i]);
+                }
+                CheckQueries(TEXT("Updated"));
+
+                for (int32 i = 0; i < Count; i++)
+                {
+                    Boxes[i] = Boxes[i].ShiftBy(FFixedVector64(FFixed64(Stream.FRandRange(-50.0f, 50.0f)), FFixed64(Stream.FRandRange(-50.0f, 50.0f)), FFixed64(Stream.FRandRange(-10.0f, 10.0f))));
+                }
+                Tree.Refit(Boxes);
+                CheckQueries(TEXT("Refit"));
+                bool bContained = true;
+                for (const FFixedBox& Box : Boxes)
+                {
+                    bContained &= Tree.GetBounds().IsInsideOrOn(Box);
+                }
+                TestTrue("Root bounds contain every item", bContained);
+            });
+
+            It("Should return the earliest hit, lowest index first, and build identically every time", [this, SegmentEntry, MakeBoxes]()
+            {
+                FRandomStream Stream(4141);
+                const int32 Count = 2000;
+                const TArray<FFixedBox> Boxes = MakeBoxes(Stream, Count);
+                FFixedBVH Tree;
+                Tree.Build(Boxes);
+
+                bool bBoundsHit = true;
+                bool bFilteredHit = true;
+                bool bRepeatable = true;
+                FFixedBVH Rebuilt;
+                Rebuilt.Build(Boxes);
+                for (int32 Query = 0; Query < 100; Query++)
+                {
+                    const FFixedVector64 Start(FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-120.0f, 120.0f)));
+                    const FFixedVector64 End(FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-120.0f, 120.0f)));
+
+                    FFixedBVHHit Expected, ExpectedEven;
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        FFixed64 Enter;
+                        if (!SegmentEntry(Start, End, Boxes[i], Enter))
+                        {
+                            continue;
+                        }
+                        if (Expected.Item == INDEX_NONE || Enter < Expected.Time)
+                        {
+                            Expected.Item = i;
+                            Expected.Time = Enter;
+                        }
+                        if (i % 2 == 0 && (ExpectedEven.Item == INDEX_NONE || Enter < ExpectedEven.Time))
+                        {
+                            ExpectedEven.Item = i;
+                            ExpectedEven.Time = Enter;
+                        }
+                    }
+
+                    FFixedBVHHit Hit;
+                    Tree.RayCast(Start, End, Hit);
+                    bBoundsHit &= Hit.Item == Expected.Item && (Hit.Item == INDEX_NONE || Hit.Time == Expected.Time);
+
+                    //only even items are solid, the callback does the exact test
+                    Tree.RayCast(Start, End, Hit, [&Boxes, &Start, &End, SegmentEntry](int32 Item, FFixed64& Time)
+                    {
+                        return Item % 2 == 0 && SegmentEntry(Start, End, Boxes[Item], Time);
+                    });
+                    bFilteredHit &= Hit.Item == ExpectedEven.Item && (Hit.Item == INDEX_NONE || Hit.Time == ExpectedEven.Time);
+
+                    TArray<int32> First, Second;
+                    Tree.QuerySegment(Start, End, First);
+                    Rebuilt.QuerySegment(Start, End, Second);
+                    bRepeatable &= First == Second;
+                }
+                TestTrue("RayCast finds the first item bounds", bBoundsHit);
+                TestTrue("RayCast with a callback skips items the callback rejects", bFilteredHit);
+                TestTrue("Rebuilding gives the same tree", bRepeatable && Rebuilt.NumNodes() == Tree.NumNodes());
+
+                //equal entry times resolve to the lower index whatever the tree layout
+                TArray<FFixedBox> Stacked;
+                for (int32 i = 0; i < 20; i++)
+                {
+                    Stacked.Add(FFixedBox(FFixedVector64(FFixed64(10.0), FFixed64(-1.0 - i), FFixed64(-1.0)), FFixedVector64(FFixed64(12.0), FFixed64(1.0 + i), FFixed64(1.0))));
+                }
+                FFixedBVH StackedTree;
+                StackedTree.Build(Stacked);
+                FFixedBVHHit Hit;
+                TestTrue("Stacked boxes are hit", StackedTree.RayCast(FFixedVector64(FixedPoint::Constants::Fixed64::Zero), FFixedVector64(FFixed64(20.0), FFixed64(0.0), FFixed64(0.0)), Hit));
+                TestEqual("Tie goes to the lowest index", Hit.Item, 0);
+                TestTrue("Hit time", Hit.Time == FFixed64(0.5));
+            });
+
+            It("Should build the same tree when the scene is scaled up to millions of units", [this, MakeBoxes]()
+            {
+                //a power of two scale leaves every area comparison the same, as long as the areas do not overflow
+                auto Scale = [](const FFixedVector64& V)
+                {
+                    return FFixedVector64(FFixed64::MakeFromRawInt(V.X.Value * 8192), FFixed64::MakeFromRawInt(V.Y.Value * 8192), FFixed64::MakeFromRawInt(V.Z.Value * 8192));
+                };
+                FRandomStream Stream(4141);
+                const TArray<FFixedBox> Boxes = MakeBoxes(Stream, 2000);
+                TArray<FFixedBox> ScaledBoxes;
+                for (const FFixedBox& Box : Boxes)
+                {
+                    ScaledBoxes.Add(FFixedBox(Scale(Box.Min), Scale(Box.Max)));
+                }
+                FFixedBVH Tree;
+                FFixedBVH ScaledTree;
+                Tree.Build(Boxes);
+                ScaledTree.Build(ScaledBoxes);
+                TestEqual("Same number of nodes", ScaledTree.NumNodes(), Tree.NumNodes());
+
+                bool bSameOrder = true;
+                for (int32 Query = 0; Query < 50; Query++)
+                {
+                    const FFixedVector64 Start(FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-120.0f, 120.0f)));
+                    const FFixedVector64 End(FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-600.0f, 600.0f)), FFixed64(Stream.FRandRange(-120.0f, 120.0f)));
+                    TArray<int32> Found, ScaledFound;
+                    Tree.QuerySegment(Start, End, Found);
+                    ScaledTree.QuerySegment(Scale(Start), Scale(End), ScaledFound);
+                    bSameOrder &= Found == ScaledFound;
+                }
+                TestTrue("Segment queries visit items in the same order", bSameOrder);
+            });
+        });
+
+        Describe("Fixed Point Ray Batch", [this]()
+        {
+            auto RandomVector = [](FRandomStream& Stream, float Extent)
+            {
+                return FFixedVector64(FFixed64(Stream.FRandRange(-Extent, Extent)), FFixed64(Stream.FRandRange(-Extent, Extent)), FFixed64(Stream.FRandRange(-Extent, Extent)));
+            };
+
+            //a mix of rays, segments, zero lengths and negative lengths
+            auto MakeRays = [RandomVector](FRandomStream& Stream, int32 Count)
+            {
+                FFixedRayBatch Rays;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    const FFixedVector64 Start = RandomVector(Stream, 100.0f);
+                    if (i % 3 == 0)
+                    {
+                        const FFixed64 Length = i % 30 == 0 ? FixedPoint::Constants::Fixed64::Zero : FFixed64(Stream.FRandRange(-50.0f, 150.0f));
+                        Rays.AddRay(Start, RandomVector(Stream, 1.0f).GetSafeNormal(), Length);
+                    }
+                    else
+                    {
+                        Rays.AddSegment(Start, i % 17 == 0 ? Start : Start + RandomVector(Stream, 120.0f));
+                    }
+                }
+                return Rays;
+            };
+
+            It("Should find the same earliest and any hits as the scalar intersection functions", [this, RandomVector, MakeRays]()
+            {
+                FRandomStream Stream(42);
+                const int32 NumRays = 500;
+                const int32 NumItems = 200;
+                const FFixedRayBatch Rays = MakeRays(Stream, NumRays);
+
+                TArray<FFixedSphere> Spheres;
+                TArray<FFixedPlane> Planes;
+                TArray<FFixedBox> Boxes;
+                TArray<FFixedVector64> Corners;
+                FFixedSphereSoA SphereSoA;
+                FFixedPlaneSoA PlaneSoA;
+                FFixedBoxSoA BoxSoA;
+                FFixedTriangleSoA TriangleSoA;
+                for (int32 i = 0; i < NumItems; i++)
+                {
+                    Spheres.Add(FFixedSphere(RandomVector(Stream, 100.0f), FFixed64(Stream.FRandRange(1.0f, 30.0f))));
+                    Planes.Add(FFixedPlane(RandomVector(Stream, 1.0f).GetSafeNormal(), FFixed64(Stream.FRandRange(-100.0f, 100.0f))));
+                    const FFixedVector64 Extent(FFixed64(Stream.FRandRange(0.0f, 20.0f)), FFixed64(Stream.FRandRange(0.0f, 20.0f)), FFixed64(Stream.FRandRange(0.0f, 20.0f)));
+                    Boxes.Add(FFixedBox::BuildAABB(RandomVector(Stream, 100.0f), Extent));
+                    const FFixedVector64 A = RandomVector(Stream, 100.0f);
+                    Corners.Add(A);
+                    Corners.Add(A + RandomVector(Stream, 40.0f));
+                    Corners.Add(A + RandomVector(Stream, 40.0f));
+                    SphereSoA.Add(Spheres[i]);
+                    PlaneSoA.Add(Planes[i]);
+                    BoxSoA.Add(Boxes[i]);
+                    TriangleSoA.Add(Corners[i * 3], Corners[i * 3 + 1], Corners[i * 3 + 2]);
+                }
+
+                //the scalar test for one ray and item, the time each scalar function computes on a hit
+                auto ScalarHit = [&](int32 Kind, int32 Ray, int32 Item, FFixed64& OutTime) -> bool
+                {
+                    const FFixedVector64 Start = Rays.GetStart(Ray);
+                    const FFixedVector64 End = Rays.GetEnd(Ray);
+                    const FFixedVector64 Delta = End - Start;
+                    if (Kind == 0)
+                    {
+                        const FFixed64 Length = Rays.GetLength(Ray);
+                        const FFixedVector64 Dir = Rays.GetDir(Ray);
+                        if (Length == FixedPoint::Constants::Fixed64::Zero || !FFixedPointMath::LineSphereIntersection(Start, Dir, Length, Spheres[Item].Center, Spheres[Item].W))
+                        {
+                            return false;
+                        }
+                        const FFixed64 V = Dir | (Spheres[Item].Center - Start);
+                        const FFixed64 Disc = Spheres[Item].W * Spheres[Item].W - (((Start - Spheres[Item].Center) | (Start - Spheres[Item].Center)) - V * V);
+                        OutTime = (V - FFixedPointMath::Sqrt(Disc)) / Length;
+                        return true;
+                    }
+                    if (Kind == 1)
+                    {
+                        const FFixed64 Den = Delta | Planes[Item].GetNormal();
+                        if (Den == FixedPoint::Constants::Fixed64::Zero)
+                        {
+                            return false;
+                        }
+                        OutTime = ((Planes[Item].GetOrigin() - Start) | Planes[Item].GetNormal()) / Den;
+                        return OutTime >= FixedPoint::Constants::Fixed64::Zero && OutTime <= FixedPoint::Constants::Fixed64::One;
+                    }
+                    if (Kind == 2)
+                    {
+                        return FFixedPointMath::LineBoxIntersection(Boxes[Item], Start, End, Delta, &OutTime);
+                    }
+                    return FFixedPointMath::SegmentTriangleIntersection(Start, End, Corners[Item * 3], Corners[Item * 3 + 1], Corners[Item * 3 + 2], OutTime);
+                };
+
+                const TCHAR* KindNames[] = { TEXT("Spheres"), TEXT("Planes"), TEXT("Boxes"), TEXT("Triangles") };
+                for (int32 Kind = 0; Kind < 4; Kind++)
+                {
+                    for (const bool bAnyHit : { false, true })
+                    {
+                        TArray<int32> Items;
+                        TArray<FFixed64> Times;
+                        Items.SetNumUninitialized(NumRays);
+                        Times.SetNumUninitialized(NumRays);
+                        switch (Kind)
+                        {
+                        case 0: Rays.IntersectSpheres(SphereSoA, Items, Times, bAnyHit); break;
+                        case 1: Rays.IntersectPlanes(PlaneSoA, Items, Times, bAnyHit); break;
+                        case 2: Rays.IntersectBoxes(BoxSoA, Items, Times, bAnyHit); break;
+                        default: Rays.IntersectTriangles(TriangleSoA, Items, Times, bAnyHit); break;
+                        }
+
+                        bool bMatches = true;
+                        int32 NumHits = 0;
+                        for (int32 Ray = 0; Ray < NumRays; Ray++)
+                        {
+                            int32 ExpectedItem = INDEX_NONE;
+                            FFixed64 ExpectedTime = FixedPoint::Constants::Fixed64::One;
+                            for (int32 Item = 0; Item < NumItems; Item++)
+                            {
+                                FFixed64 Time;
+                                if (ScalarHit(Kind, Ray, Item, Time) && (ExpectedItem == INDEX_NONE || Time < ExpectedTime))
+                                {
+                                    ExpectedItem = Item;
+                                    ExpectedTime = Time;
+                                    if (bAnyHit)
+                                    {
+                                        break;
+                                    }
+                                }
+                            }
+                            bMatches &= Items[Ray] == ExpectedItem && Times[Ray] == ExpectedTime;
+                            NumHits += ExpectedItem != INDEX_NONE;
+                        }
+                        TestTrue(FString::Printf(TEXT("%s %s match the scalar function"), KindNames[Kind], bAnyHit ? TEXT("any hits") : TEXT("earliest hits")), bMatches);
+                        TestTrue(FString::Printf(TEXT("%s are hit by some rays"), KindNames[Kind]), NumHits > 0);
+                    }
+                }
+            });
+
+            It("Should give the same results in parallel and resolve equal times to the lowest index", [this, RandomVector, MakeRays]()
+            {
+                FRandomStream Stream(4242);
+                const int32 NumRays = 3000;
+                const FFixedRayBatch Rays = MakeRays(Stream, NumRays);
+                FFixedBoxSoA Boxes;
+                for (int32 i = 0; i < 300; i++)
+                {
+                    Boxes.Add(FFixedBox::BuildAABB(RandomVector(Stream, 100.0f), FFixedVector64(FFixed64(Stream.FRandRange(1.0f, 20.0f)))));
+                }
+                TArray<int32> SerialItems, ParallelItems;
+                TArray<FFixed64> SerialTimes, ParallelTimes;
+                SerialItems.SetNumUninitialized(NumRays);
+                ParallelItems.SetNumUninitialized(NumRays);
+                SerialTimes.SetNumUninitialized(NumRays);
+                ParallelTimes.SetNumUninitialized(NumRays);
+                Rays.IntersectBoxes(Boxes, SerialItems, SerialTimes);
+                Rays.IntersectBoxes(Boxes, ParallelItems, ParallelTimes, false, true);
+                TestTrue("Parallel items match", SerialItems == ParallelItems);
+                TestTrue("Parallel times match", SerialTimes == ParallelTimes);
+
+                //a plane parallel to the segment, then the same plane twice
+                FFixedPlaneSoA Planes;
+                Planes.Add(FFixedPlane(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(-1.0)), FFixed64(-5.0)));
+                Planes.Add(FFixedPlane(FFixedVector64(FFixed64(1.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(5.0)));
+                Planes.Add(FFixedPlane(FFixedVector64(FFixed64(1.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(5.0)));
+                FFixedRayBatch Single;
+                Single.AddSegment(FFixedVector64(FixedPoint::Constants::Fixed64::Zero), FFixedVector64(FFixed64(10.0), FFixed64(0.0), FFixed64(0.0)));
+                int32 Item = INDEX_NONE;
+                FFixed64 Time;
+                Single.IntersectPlanes(Planes, TArrayView<int32>(&Item, 1), TArrayView<FFixed64>(&Time, 1));
+                TestEqual("Tie goes to the lowest index", Item, 1);
+                TestTrue("Hit time", Time == FixedPoint::Constants::Fixed64::Half);
+            });
+
+            It("Should hit boxes at the exact time with long segments entering through a face, an edge or a corner", [this]()
+            {
+                struct FCase
+                {
+                    FFixedVector64 Start;
+                    FFixedVector64 End;
+                    FFixedBox Box;
+                    FFixed64 Time;
+                };
+                const FFixed64 Zero = FixedPoint::Constants::Fixed64::Zero;
+                //a rounded reciprocal of these lengths puts the entry point well short of the face
+                const TArray<FCase> Cases =
+                {
+                    { FFixedVector64(Zero), FFixedVector64(FFixed64(1000.0), Zero, Zero), FFixedBox(FFixedVector64(FFixed64(500.0), FFixed64(-1.0), FFixed64(-1.0)), FFixedVector64(FFixed64(600.0), FFixed64(1.0), FFixed64(1.0))), FixedPoint::Constants::Fixed64::Half },
+                    { FFixedVector64(Zero), FFixedVector64(FFixed64(10000.0), FFixed64(10000.0), Zero), FFixedBox(FFixedVector64(FFixed64(5000.0), FFixed64(5000.0), FFixed64(-1.0)), FFixedVector64(FFixed64(6000.0), FFixed64(6000.0), FFixed64(1.0))), FixedPoint::Constants::Fixed64::Half },
+                    { FFixedVector64(FFixed64(10000.0), FFixed64(-3000.0), FFixed64(7000.0)), FFixedVector64(FFixed64(-2000.0), FFixed64(3000.0), FFixed64(-5000.0)), FFixedBox(FFixedVector64(FFixed64(-1000.0), Zero, Zero), FFixedVector64(FFixed64(4000.0), FFixed64(500.0), FFixed64(1000.0))), FixedPoint::Constants::Fixed64::Half },
+                    { FFixedVector64(Zero), FFixedVector64(FFixed64(3000.0), Zero, Zero), FFixedBox(FFixedVector64(FFixed64(3000.0), FFixed64(-1.0), FFixed64(-1.0)), FFixedVector64(FFixed64(3001.0), FFixed64(1.0), FFixed64(1.0))), FixedPoint::Constants::Fixed64::One },
+                };
+                FFixedRayBatch Rays;
+                for (const FCase& Case : Cases)
+                {
+                    Rays.AddSegment(Case.Start, Case.End);
+                }
+                TArray<int32> Items;
+                TArray<FFixed64> Times;
+                Items.SetNumUninitialized(Rays.Num());
+                Times.SetNumUninitialized(Rays.Num());
+                for (int32 i = 0; i < Cases.Num(); i++)
+                {
+                    const FCase& Case = Cases[i];
+                    FFixed64 Time;
+                    TestTrue(FString::Printf(TEXT("Segment %d hits"), i), FFixedPointMath::LineBoxIntersection(Case.Box, Case.Start, Case.End, Case.End - Case.Start, &Time));
+                    TestTrue(FString::Printf(TEXT("Segment %d enters at the exact time"), i), Time == Case.Time);
+
+                    FFixedBoxSoA Boxes;
+                    Boxes.Add(Case.Box);
+                    Rays.IntersectBoxes(Boxes, Items, Times);
+                    TestTrue(FString::Printf(TEXT("Batch segment %d enters at the exact time"), i), Items[i] == 0 && Times[i] == Case.Time);
+                }
+
+                //one raw unit past the end of the segment misses
+                const FFixedBox Past(FFixedVector64(FFixed64::MakeFromRawInt(FFixed64(1000.0).Value + 1), FFixed64(-1.0), FFixed64(-1.0)), FFixedVector64(FFixed64(1100.0), FFixed64(1.0), FFixed64(1.0)));
+                TestFalse("A box just past the end is missed", FFixedPointMath::LineBoxIntersection(Past, Cases[0].Start, Cases[0].End, Cases[0].End - Cases[0].Start));
+            });
+        });
+
+        Describe("Fixed Point Convex Volume", [this]()
+        {
+            It("Should cull sphere and box batches exactly like the single object tests", [this]()
+            {
+                FRandomStream Stream(43);
+                TArray<FFixedPlane> Planes;
+                for (int32 i = 0; i < 8; i++)
+                {
+                    const FFixedVector64 Normal = FFixedVector64(FFixed64(Stream.FRandRange(-1.0f, 1.0f)), FFixed64(Stream.FRandRange(-1.0f, 1.0f)), FFixed64(Stream.FRandRange(-1.0f, 1.0f))).GetSafeNormal();
+                    Planes.Add(FFixedPlane(Normal, FFixed64(Stream.FRandRange(100.0f, 400.0f))));
+                }
+                const FFixedConvexVolume Volume(Planes);
+
+                //not a multiple of 64 so the last mask word is partial
+                const int32 Count = 10000 + 37;
+                FFixedSphereSoA Spheres;
+                FFixedBoxSoA Boxes;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    const FFixedVector64 Center(FFixed64(Stream.FRandRange(-500.0f, 500.0f)), FFixed64(Stream.FRandRange(-500.0f, 500.0f)), FFixed64(Stream.FRandRange(-500.0f, 500.0f)));
+                    Spheres.Add(FFixedSphere(Center, FFixed64(Stream.FRandRange(0.0f, 50.0f))));
+                    Boxes.Add(FFixedBox::BuildAABB(Center, FFixedVector64(FFixed64(Stream.FRandRange(0.0f, 50.0f)), FFixed64(Stream.FRandRange(0.0f, 50.0f)), FFixed64(Stream.FRandRange(0.0f, 50.0f)))));
+                }
+
+                TArray<int32> ExpectedSpheres, ExpectedBoxes;
+                bool bBoxMatchesCorners = true;
+                for (int32 i = 0; i < Count; i++)
+                {
+                    if (Volume.IntersectSphere(Spheres.Get(i)))
+                    {
+                        ExpectedSpheres.Add(i);
+                    }
+                    const FFixedBox Box = Boxes.Get(i);
+                    if (Volume.IntersectBox(Box))
+                    {
+                        ExpectedBoxes.Add(i);
+                    }
+
+                    //a box is culled only when some plane has all eight corners in front of it
+                    bool bAllInFront = false;
+                    for (const FFixedPlane& Plane : Planes)
+                    {
+                        bool bPlaneHasAll = true;
+                        for (int32 Corner = 0; Corner < 8; Corner++)
+                        {
+                            const FFixedVector64 P((Corner & 1) ? Box.Max.X : Box.Min.X, (Corner & 2) ? Box.Max.Y : Box.Min.Y, (Corner & 4) ? Box.Max.Z : Box.Min.Z);
+                            bPlaneHasAll &= Plane.PlaneDot(P) > FixedPoint::Constants::Fixed64::Zero;
+                        }
+                        bAllInFront |= bPlaneHasAll;
+                    }
+                    bBoxMatchesCorners &= Volume.IntersectBox(Box) == !bAllInFront;
+                }
+                TestTrue("IntersectBox matches testing all eight corners", bBoxMatchesCorners);
+                TestTrue("Some objects are visible and some culled", ExpectedSpheres.Num() > 0 && ExpectedSpheres.Num() < Count && ExpectedBoxes.Num() > 0 && ExpectedBoxes.Num() < Count);
+
+                for (const bool bParallel : { false, true })
+                {
+                    TArray<uint64> Mask;
+                    Mask.SetNumUninitialized(FFixedConvexVolume::GetNumMaskWords(Count));
+                    Volume.CullSpheres(Spheres, Mask, bParallel);
+                    bool bMaskMatches = (Mask.Last() >> (Count % 64)) == 0;
+                    for (int32 i = 0; i < Count; i++)
+                    {
+                        bMaskMatches &= ((Mask[i / 64] >> (i % 64)) & 1) == (uint64)Volume.IntersectSphere(Spheres.Get(i));
+                    }
+                    TestTrue(bParallel ? TEXT("Parallel sphere mask matches") : TEXT("Sphere mask matches"), bMaskMatches);
+
+                    TArray<int32> Visible;
+                    TestEqual("CullSpheres returns the visible count", Volume.CullSpheres(Spheres, Visible, bParallel), ExpectedSpheres.Num());
+                    TestTrue(bParallel ? TEXT("Parallel sphere indices match") : TEXT("Sphere indices match"), Visible == ExpectedSpheres);
+                    Visible.Reset();
+                    TestEqual("CullBoxes returns the visible count", Volume.CullBoxes(Boxes, Visible, bParallel), ExpectedBoxes.Num());
+                    TestTrue(bParallel ? TEXT("Parallel box indices match") : TEXT("Box indices match"), Visible == ExpectedBoxes);
+                }
+
+                TArray<int32> Visible;
+                FFixedConvexVolume Empty;
+                Empty.CullSpheres(Spheres, Visible);
+                TestEqual("An empty volume culls nothing", Visible.Num(), Count);
+            });
+
+            It("Should build a view frustum that contains what the view sees", [this]()
+            {
+                const FFixedConvexVolume Frustum = FFixedConvexVolume::MakeFrustum(FFixedVector64(FixedPoint::Constants::Fixed64::Zero), FFixedRotator64(FFixed64(0.0), FFixed64(90.0), FFixed64(0.0)), FFixed64(45.0), FFixed64(2.0), FFixed64(10.0), FFixed64(1000.0));
+                TestEqual("Six planes", Frustum.Planes.Num(), 6);
+                TestTrue("Ahead is inside", Frustum.IntersectPoint(FFixedVector64(FFixed64(0.0), FFixed64(100.0), FFixed64(0.0))));
+                TestTrue("Just inside the horizontal edge", Frustum.IntersectPoint(FFixedVector64(FFixed64(-99.0), FFixed64(100.0), FFixed64(0.0))));
+                TestFalse("Just outside the horizontal edge", Frustum.IntersectPoint(FFixedVector64(FFixed64(-101.0), FFixed64(100.0), FFixed64(0.0))));
+                TestTrue("Just inside the vertical edge", Frustum.IntersectPoint(FFixedVector64(FFixed64(0.0), FFixed64(100.0), FFixed64(49.0))));
+                TestFalse("Just outside the vertical edge", Frustum.IntersectPoint(FFixedVector64(FFixed64(0.0), FFixed64(100.0), FFixed64(51.0))));
+                TestFalse("Behind is outside", Frustum.IntersectPoint(FFixedVector64(FFixed64(0.0), FFixed64(-100.0), FFixed64(0.0))));
+                TestFalse("Closer than the near plane is outside", Frustum.IntersectPoint(FFixedVector64(FFixed64(0.0), FFixed64(5.0), FFixed64(0.0))));
+                TestFalse("Past the far plane is outside", Frustum.IntersectPoint(FFixedVector64(FFixed64(0.0), FFixed64(1001.0), FFixed64(0.0))));
+                TestTrue("A sphere straddling the far plane is visible", Frustum.IntersectSphere(FFixedVector64(FFixed64(0.0), FFixed64(1001.0), FFixed64(0.0)), FFixed64(2.0)));
+                TestTrue("A box straddling the near plane is visible", Frustum.IntersectBox(FFixedBox(FFixedVector64(FFixed64(-1.0), FFixed64(5.0), FFixed64(-1.0)), FFixedVector64(FFixed64(1.0), FFixed64(15.0), FFixed64(1.0)))));
+
+                const FFixedConvexVolume NoFar = FFixedConvexVolume::MakeFrustum(FFixedVector64(FixedPoint::Constants::Fixed64::Zero), FFixedRotator64(FFixed64(0.0), FFixed64(90.0), FFixed64(0.0)), FFixed64(45.0), FFixed64(2.0), FFixed64(10.0), FixedPoint::Constants::Fixed64::Zero);
+                TestEqual("Five planes without a far plane", NoFar.Planes.Num(), 5);
+                TestTrue("Far away is inside without a far plane", NoFar.IntersectPoint(FFixedVector64(FFixed64(0.0), FFixed64(100000.0), FFixed64(0.0))));
+            });
+        });
+        Describe("Fixed Point Polygons", [this]()
+        {
+            It("Should split polygons with a plane using the split thresholds", [this]()
+            {
+                const FFixedVector64 Square[4] = {
+                    FFixedVector64(FFixed64(-1.0), FFixed64(-1.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(1.0), FFixed64(-1.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(1.0), FFixed64(1.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(-1.0), FFixed64(1.0), FFixed64(0.0))
+                };
+                const FFixedPlane Plane(FFixedVector64(FFixed64(1.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(0.5));
+                FFixedPolygonArena Front, Back;
+                TestTrue("The square is split", FFixedPolygonArena::SplitWithPlane(Square, Plane, Front, Back) == EFixedPolygonSplit::Split);
+                TestTrue("One polygon each side", Front.Num() == 1 && Back.Num() == 1);
+                TestTrue("Four vertices each side", Front.GetPolygon(0).Num() == 4 && Back.GetPolygon(0).Num() == 4);
+                bool bFrontInFront = true;
+                for (const FFixedVector64& Vertex : Front.GetPolygon(0))
+                {
+                    bFrontInFront &= Vertex.X >= FFixed64(0.5);
+                }
+                bool bBackBehind = true;
+                for (const FFixedVector64& Vertex : Back.GetPolygon(0))
+                {
+                    bBackBehind &= Vertex.X <= FFixed64(0.5);
+                }
+                TestTrue("Front half is in front", bFrontInFront);
+                TestTrue("Back half is behind", bBackBehind);
+                TestTrue("The cut lands on the plane", Front.GetPolygon(0)[0] == FFixedVector64(FFixed64(0.5), FFixed64(-1.0), FFixed64(0.0)));
+
+                //the square pokes 0.2 past the plane, within ThreshSplitPolyWithPlane but not ThreshSplitPolyPrecisely
+                const FFixedPlane NearPlane(FFixedVector64(FFixed64(1.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(0.8));
+                Front.Reset();
+                Back.Reset();
+                TestTrue("A sliver within the threshold does not split", FFixedPolygonArena::SplitWithPlane(Square, NearPlane, Front, Back) == EFixedPolygonSplit::Back);
+                TestTrue("Nothing is added unless split", Front.Num() == 0 && Back.Num() == 0);
+                TestTrue("A precise split cuts the sliver off", FFixedPolygonArena::SplitWithPlane(Square, NearPlane, Front, Back, true) == EFixedPolygonSplit::Split);
+
+                const FFixedPlane Floor(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(1.0)), FFixed64(0.0));
+                TestTrue("A polygon in the plane is coplanar", FFixedPolygonArena::SplitWithPlane(Square, Floor, Front, Back) == EFixedPolygonSplit::Coplanar);
+                TestTrue("A polygon in the plane is on it", FFixedPolygonArena::IsOnPlane(Square, Floor));
+                TestFalse("A polygon crossing the plane is not on it", FFixedPolygonArena::IsOnPlane(Square, Plane));
+            });
+
+            It("Should split every polygon in an arena in order", [this]()
+            {
+                FFixedPolygonArena Polygons;
+                for (int32 i = 0; i < 4; i++)
+                {
+                    const FFixed64 X = FFixed64((double)(i * 2 - 4));
+                    const FFixedVector64 Triangle[3] = {
+                        FFixedVector64(X, FFixed64(0.0), FFixed64(0.0)),
+                        FFixedVector64(X + FFixed64(1.5), FFixed64(0.0), FFixed64(0.0)),
+                        FFixedVector64(X, FFixed64(1.0), FFixed64(0.0))
+                    };
+                    Polygons.Add(Triangle);
+                }
+                FFixedPolygonArena Front, Back;
+                Polygons.SplitAllWithPlane(FFixedPlane(FFixedVector64(FFixed64(1.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(-1.0)), Front, Back);
+                //triangles start at -4, -2, 0 and 2, only the one at -2 reaches across x = -1
+                TestEqual("Front pieces", Front.Num(), 3);
+                TestEqual("Back pieces", Back.Num(), 2);
+                TestTrue("Whole polygons are copied unchanged", Back.GetPolygon(0)[0] == Polygons.GetPolygon(0)[0] && Front.GetPolygon(2).Num() == 3);
+            });
+
+            It("Should compute exact 2D booleans", [this]()
+            {
+                auto AddSquare = [](FFixedPolygonArena2D& Arena, double X0, double Y0, double X1, double Y1)
+                {
+                    const FFixedVector2d Square[4] = {
+                        FFixedVector2d(FFixed64(X0), FFixed64(Y0)),
+                        FFixedVector2d(FFixed64(X1), FFixed64(Y0)),
+                        FFixedVector2d(FFixed64(X1), FFixed64(Y1)),
+                        FFixedVector2d(FFixed64(X0), FFixed64(Y1))
+                    };
+                    Arena.Add(Square);
+                };
+                FFixedPolygonArena2D A, B;
+                AddSquare(A, 0.0, 0.0, 10.0, 10.0);
+                AddSquare(B, 5.0, 5.0, 15.0, 15.0);
+
+                FFixedPolygonArena2D Union, Intersection, Difference;
+                FFixedPolygonArena2D::Union(A, B, Union);
+                FFixedPolygonArena2D::Intersection(A, B, Intersection);
+                FFixedPolygonArena2D::Difference(A, B, Difference);
+                TestTrue("Union area", Union.GetArea() == FFixed64(175.0));
+                TestTrue("Intersection area", Intersection.GetArea() == FFixed64(25.0));
+                TestTrue("Difference area", Difference.GetArea() == FFixed64(75.0));
+                TestEqual("Union is one outline", Union.Num(), 1);
+                TestEqual("Union outline has eight corners", Union.GetPolygon(0).Num(), 8);
+                TestTrue("Point in the overlap", Union.IsPointInside(FFixedVector2d(FFixed64(7.0), FFixed64(7.0))) && Intersection.IsPointInside(FFixedVector2d(FFixed64(7.0), FFixed64(7.0))));
+                TestFalse("Overlap removed from the difference", Difference.IsPointInside(FFixedVector2d(FFixed64(7.0), FFixed64(7.0))));
+
+                FFixedPolygonArena2D Hole, Ring;
+                AddSquare(Hole, 3.0, 3.0, 6.0, 6.0);
+                FFixedPolygonArena2D::Difference(A, Hole, Ring);
+                TestEqual("A hole is a second outline", Ring.Num(), 2);
+                TestTrue("Ring area", Ring.GetArea() == FFixed64(91.0));
+                TestFalse("Hole is outside", Ring.IsPointInside(FFixedVector2d(FFixed64(4.0), FFixed64(4.0))));
+                TestTrue("Ring is inside", Ring.IsPointInside(FFixedVector2d(FFixed64(1.0), FFixed64(1.0))));
+
+                FFixedPolygonArena2D Neighbour, Merged;
+                AddSquare(Neighbour, 10.0, 0.0, 20.0, 10.0);
+                FFixedPolygonArena2D::Union(A, Neighbour, Merged);
+                TestTrue("Squares sharing an edge merge into one rectangle", Merged.Num() == 1 && Merged.GetPolygon(0).Num() == 4 && Merged.GetArea() == FFixed64(200.0));
+
+                FFixedPolygonArena2D Corner, Touching;
+                AddSquare(Corner, 10.0, 10.0, 20.0, 20.0);
+                FFixedPolygonArena2D::Union(A, Corner, Touching);
+                TestEqual("Squares touching at a corner stay separate", Touching.Num(), 2);
+
+                FFixedPolygonArena2D Same;
+                FFixedPolygonArena2D::Difference(A, A, Same);
+                TestEqual("A minus itself is empty", Same.Num(), 0);
+            });
+
+            It("Should match inclusion-exclusion on random polygons", [this]()
+            {
+                FRandomStream Stream(4);
+                bool bAreasMatch = true;
+                bool bPointsMatch = true;
+                for (int32 Test = 0; Test < 100; Test++)
+                {
+                    FFixedPolygonArena2D A, B;
+                    for (FFixedPolygonArena2D* Arena : { &A, &B })
+                    {
+                        const int32 NumVerts = Stream.RandRange(3, 8);
+                        const double CenterX = Stream.FRandRange(0.0, 20.0);
+                        const double CenterY = Stream.FRandRange(0.0, 20.0);
+                        TArray<FFixedVector2d> Polygon;
+                        for (int32 i = 0; i < NumVerts; i++)
+                        {
+                            const double Angle = 2.0 * UE_DOUBLE_PI * i / NumVerts + Stream.FRandRange(0.0, 0.3);
+                            const double Radius = Stream.FRandRange(2.0, 10.0);
+                            Polygon.Add(FFixedVector2d(FFixed64(CenterX + Radius * FMath::Cos(Angle)), FFixed64(CenterY + Radius * FMath::Sin(Angle))));
+                        }
+                        Arena->Add(Polygon);
+                    }
+                    FFixedPolygonArena2D Union, Intersection, Difference;
+                    FFixedPolygonArena2D::Union(A, B, Union);
+                    FFixedPolygonArena2D::Intersection(A, B, Intersection);
+                    FFixedPolygonArena2D::Difference(A, B, Difference);
+                    //each boolean rounds its crossings once, allow a little area per crossing
+                    const FFixed64 Tolerance(0.001);
+                    bAreasMatch &= FFixedPointMath::Abs(Union.GetArea() - (A.GetArea() + B.GetArea() - Intersection.GetArea())) < Tolerance;
+                    bAreasMatch &= FFixedPointMath::Abs(Difference.GetArea() - (A.GetArea() - Intersection.GetArea())) < Tolerance;
+                    for (int32 i = 0; i < 20; i++)
+                    {
+                        const FFixedVector2d P(FFixed64(Stream.FRandRange(-10.0, 30.0)), FFixed64(Stream.FRandRange(-10.0, 30.0)));
+                        const bool bInA = A.IsPointInside(P);
+                        const bool bInB = B.IsPointInside(P);
+                        bPointsMatch &= Union.IsPointInside(P) == (bInA || bInB);
+                        bPointsMatch &= Intersection.IsPointInside(P) == (bInA && bInB);
+                        bPointsMatch &= Difference.IsPointInside(P) == (bInA && !bInB);
+                    }
+                }
+                TestTrue("Areas match", bAreasMatch);
+                TestTrue("Points match", bPointsMatch);
+            });
+
+            It("Should grow and shrink polygons", [this]()
+            {
+                const FFixedVector2d Square[4] = {
+                    FFixedVector2d(FFixed64(0.0), FFixed64(0.0)),
+                    FFixedVector2d(FFixed64(10.0), FFixed64(0.0)),
+                    FFixedVector2d(FFixed64(10.0), FFixed64(10.0)),
+                    FFixedVector2d(FFixed64(0.0), FFixed64(10.0))
+                };
+                FFixedPolygonArena2D In, Grown, Shrunk;
+                In.Add(Square);
+                FFixedPolygonArena2D::Offset(In, FFixed64(1.0), Grown);
+                FFixedPolygonArena2D::Offset(In, FFixed64(-1.0), Shrunk);
+                //grown by one with octagon corners, 100 + 4 * 10 + the octagon's 2 * sqrt(2)
+                TestTrue("Grown area", FFixedPointMath::Abs(Grown.GetArea() - FFixed64(142.828427)) < FFixed64(0.001));
+                TestEqual("Grown is one outline with rounded corners", Grown.GetPolygon(0).Num(), 12);
+                TestTrue("Shrunk area", Shrunk.GetArea() == FFixed64(64.0));
+                TestTrue("Shrunk is inset", Shrunk.IsPointInside(FFixedVector2d(FFixed64(1.5), FFixed64(1.5))) && !Shrunk.IsPointInside(FFixedVector2d(FFixed64(0.5), FFixed64(5.0))));
+            });
+        });
+
+        Describe("Fixed Point GJK", [this]()
+        {
+            auto IsNear = [](FFixed64 A, double B)
+            {
+                return FFixedPointMath::Abs(A - FFixed64(B)) <= FFixed64(0.001);
+            };
+
+            It("Should find distances and closest points between separated shapes", [this, IsNear]()
+            {
+                const FFixedConvexShape UnitBox = FFixedConvexShape::MakeBox(FFixedVector64::ZeroVector, FFixedVector64(FFixed64(1.0)));
+                FFixedGJKResult Result;
+
+                const FFixedConvexShape Sphere = FFixedConvexShape::MakeSphere(FFixedVector64(FFixed64(4.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(1.0));
+                TestTrue("Box and sphere are separated", FFixedGJK::ComputeDistance(UnitBox, Sphere, Result));
+                TestTrue("Box to sphere distance", IsNear(Result.Distance, 2.0));
+                TestTrue("Normal points from the box to the sphere", Result.Normal.Equals(FFixedVector64::XAxisVector, FFixed64(0.001)));
+                TestTrue("Closest point on the sphere", Result.PointB.Equals(FFixedVector64(FFixed64(3.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(0.001)));
+
+                //rotated 45 degrees about z, its corner is sqrt(2) from its center
+                const FFixedConvexShape Diamond = FFixedConvexShape::MakeBox(FFixedVector64(FFixed64(3.0), FFixed64(0.0), FFixed64(0.0)), FFixedVector64(FFixed64(1.0)), FFixedQuat64(FFixedVector64::UpVector, FFixed64(UE_DOUBLE_PI / 4.0)));
+                TestTrue("Box to rotated box", FFixedGJK::ComputeDistance(UnitBox, Diamond, Result) && IsNear(Result.Distance, 2.0 - UE_DOUBLE_SQRT_2));
+
+                const FFixedConvexShape Post = FFixedConvexShape::MakeCapsule(FFixedVector64(FFixed64(0.0), FFixed64(3.0), FFixed64(-5.0)), FFixedVector64(FFixed64(0.0), FFixed64(3.0), FFixed64(5.0)), FFixed64(0.5));
+                TestTrue("Box to capsule", FFixedGJK::ComputeDistance(UnitBox, Post, Result) && IsNear(Result.Distance, 1.5));
+                TestTrue("Capsule normal", Result.Normal.Equals(FFixedVector64::YAxisVector, FFixed64(0.001)));
+
+                const FFixedConvexShape Near = FFixedConvexShape::MakeSphere(FFixedVector64(FFixed64(1.5), FFixed64(1.5), FFixed64(0.0)), FFixed64(1.0));
+                TestFalse("Sphere overlapping a corner is not separated", FFixedGJK::ComputeDistance(UnitBox, Near, Result));
+                TestTrue("Overlap of the rounding is a negative distance", IsNear(Result.Distance, UE_DOUBLE_SQRT_2 / 2.0 - 1.0));
+            });
+
+            It("Should find penetration depth and normal between overlapping shapes", [this, IsNear]()
+            {
+                const FFixedConvexShape UnitBox = FFixedConvexShape::MakeBox(FFixedVector64::ZeroVector, FFixedVector64(FFixed64(1.0)));
+                const FFixedVector64 Center(FFixed64(1.5), FFixed64(0.2), FFixed64(0.1));
+                const FFixedConvexShape Overlapping = FFixedConvexShape::MakeBox(Center, FFixedVector64(FFixed64(1.0)));
+                FFixedGJKResult Result;
+                TestTrue("Boxes overlap", FFixedGJK::ComputePenetration(UnitBox, Overlapping, Result));
+                TestTrue("Penetration depth", IsNear(Result.Distance, -0.5));
+                TestTrue("Normal along the shallowest axis", Result.Normal.Equals(FFixedVector64::XAxisVector, FFixed64(0.001)));
+                TestTrue("Intersect agrees", FFixedGJK::Intersect(UnitBox, Overlapping));
+
+                FFixedVector64 Corners[8];
+                for (int32 i = 0; i < 8; i++)
+                {
+                    Corners[i] = Center + FFixedVector64(FFixed64(i & 1 ? 1.0 : -1.0), FFixed64(i & 2 ? 1.0 : -1.0), FFixed64(i & 4 ? 1.0 : -1.0));
+                }
+                FFixedGJKResult HullResult;
+                FFixedGJK::ComputePenetration(UnitBox, FFixedConvexShape::MakeHull(Corners), HullResult);
+                TestTrue("A hull of the box's corners matches the box", HullResult.Distance == Result.Distance && HullResult.Normal == Result.Normal);
+
+                const FFixedConvexShape Diamond = FFixedConvexShape::MakeBox(FFixedVector64(FFixed64(2.2), FFixed64(0.0), FFixed64(0.0)), FFixedVector64(FFixed64(1.0)), FFixedQuat64(FFixedVector64::UpVector, FFixed64(UE_DOUBLE_PI / 4.0)));
+                TestTrue("Rotated box corner depth", FFixedGJK::ComputePenetration(UnitBox, Diamond, Result) && IsNear(Result.Distance, 1.2 - UE_DOUBLE_SQRT_2));
+
+                //the axes cross, so the cores touch and the whole rounding is the depth
+                const FFixedConvexShape Across = FFixedConvexShape::MakeCapsule(FFixedVector64(FFixed64(0.0), FFixed64(-2.0), FFixed64(0.0)), FFixedVector64(FFixed64(0.0), FFixed64(2.0), FFixed64(0.0)), FFixed64(0.5));
+                const FFixedConvexShape Along = FFixedConvexShape::MakeCapsule(FFixedVector64(FFixed64(0.3), FFixed64(0.0), FFixed64(-2.0)), FFixedVector64(FFixed64(0.3), FFixed64(0.0), FFixed64(2.0)), FFixed64(0.5));
+                TestTrue("Crossing capsules", FFixedGJK::ComputePenetration(Across, Along, Result) && IsNear(Result.Distance, -0.7));
+                TestTrue("Crossing capsules separate along the gap between their axes", Result.Normal.Equals(FFixedVector64::XAxisVector, FFixed64(0.001)));
+
+                const FFixedConvexShape Far = FFixedConvexShape::MakeSphere(FFixedVector64(FFixed64(5.0), FFixed64(0.0), FFixed64(0.0)), FFixed64(1.0));
+                TestFalse("Separated shapes do not penetrate", FFixedGJK::ComputePenetration(UnitBox, Far, Result));
+                TestFalse("Intersect agrees when separated", FFixedGJK::Intersect(UnitBox, Far));
+            });
+
+            It("Should match cold queries when warm started and give identical results far from the origin", [this]()
+            {
+                FRandomStream Stream(45);
+                FFixedGJKCache Cache;
+                int32 ColdIterations = 0;
+                int32 WarmIterations = 0;
+                bool bSame = true;
+                bool bTranslated = true;
+                const FFixedVector64 Offset(FFixed64(5000.0), FFixed64(-3000.0), FFixed64(7000.0));
+                for (int32 Frame = 0; Frame < 200; Frame++)
+                {
+                    const FFixed64 Angle(Frame * 0.01);
+                    const FFixedVector64 Center(FFixed64(2.5) + FFixed64(Stream.FRandRange(-0.05, 0.05)), FFixed64(0.5), FFixed64(0.2));
+                    const FFixedQuat64 Rotation(FFixedVector64::UpVector, Angle);
+                    const FFixedConvexShape A = FFixedConvexShape::MakeBox(FFixedVector64::ZeroVector, FFixedVector64(FFixed64(1.0)));
+                    const FFixedConvexShape B = FFixedConvexShape::MakeBox(Center, FFixedVector64(FFixed64(1.0), FFixed64(0.5), FFixed64(0.5)), Rotation);
+                    FFixedGJKResult Cold, Warm, Moved;
+                    FFixedGJK::ComputePenetration(A, B, Cold);
+                    FFixedGJK::ComputePenetration(A, B, Warm, &Cache);
+                    FFixedGJK::ComputePenetration(FFixedConvexShape::MakeBox(Offset, FFixedVector64(FFixed64(1.0))), FFixedConvexShape::MakeBox(Center + Offset, FFixedVector64(FFixed64(1.0), FFixed64(0.5), FFixed64(0.5)), Rotation), Moved);
+                    ColdIterations += Cold.Iterations;
+                    WarmIterations += Warm.Iterations;
+                    bSame &= FFixedPointMath::Abs(Cold.Distance - Warm.Distance) <= FFixed64(0.001);
+                    bTranslated &= Moved.Distance == Cold.Distance && Moved.Normal == Cold.Normal;
+                }
+                TestTrue("Warm started queries agree with cold ones", bSame);
+                TestTrue("Warm starts take fewer iterations", WarmIterations < ColdIterations);
+                TestTrue("Translating both shapes changes nothing", bTranslated);
+            });
+        });
+
+        Describe("Fixed Point Convex Hull", [this]()
+        {
+            It("Should merge coplanar faces and drop points on faces and edges", [this]()
+            {
+                TArray<FFixedVector64> Grid;
+                for (int32 X = -2; X <= 2; X++)
+                {
+                    for (int32 Y = -2; Y <= 2; Y++)
+                    {
+                        for (int32 Z = -2; Z <= 2; Z++)
+                        {
+                            Grid.Add(FFixedVector64(FFixed64(X * 0.5), FFixed64(Y * 0.5), FFixed64(Z * 0.5)));
+                        }
+                    }
+                }
+                FFixedConvexHull Hull;
+                TestTrue("A grid has volume", Hull.Build(Grid));
+                TestEqual("Only the corners are vertices", Hull.Vertices.Num(), 8);
+                TestEqual("One face per side", Hull.NumFaces(), 6);
+                bool bSquares = true;
+                bool bAxisPlanes = true;
+                for (int32 Face = 0; Face < Hull.NumFaces(); Face++)
+                {
+                    bSquares &= Hull.GetFace(Face).Num() == 4;
+                    const FFixedPlane& Plane = Hull.Planes[Face];
+                    bAxisPlanes &= Plane.W == FFixed64(1.0) && FFixedPointMath::Abs(Plane.X) + FFixedPointMath::Abs(Plane.Y) + FFixedPointMath::Abs(Plane.Z) == FFixed64(1.0);
+                }
+                TestTrue("Faces are squares", bSquares);
+                TestTrue("Planes are the cube's sides", bAxisPlanes);
+                TestTrue("The center is inside", Hull.IsPointInside(FFixedVector64::ZeroVector));
+                TestTrue("A corner is on the hull", Hull.IsPointInside(FFixedVector64(FFixed64(1.0))));
+                TestFalse("Past a face is outside", Hull.IsPointInside(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(1.001))));
+
+                const TArray<FFixedVector64> Flat = {
+                    FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(1.0), FFixed64(0.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(0.0), FFixed64(1.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(1.0), FFixed64(1.0), FFixed64(0.0))
+                };
+                TestFalse("Coplanar points have no hull", Hull.Build(Flat));
+                TestEqual("A failed build leaves the hull empty", Hull.NumFaces(), 0);
+            });
+
+            It("Should contain every point and give the same hull in any order and in parallel", [this]()
+            {
+                FRandomStream Stream(46);
+                TArray<TArray<FFixedVector64>> Clouds;
+                TArray<TArrayView<const FFixedVector64>> Views;
+                for (int32 Cloud = 0; Cloud < 8; Cloud++)
+                {
+                    TArray<FFixedVector64>& Points = Clouds.AddDefaulted_GetRef();
+                    for (int32 i = 0; i < 500; i++)
+                    {
+                        //half the clouds on a sphere so most points are vertices
+                        const FFixedVector64 Point(FFixed64(Stream.FRandRange(-10.0, 10.0)), FFixed64(Stream.FRandRange(-10.0, 10.0)), FFixed64(Stream.FRandRange(-10.0, 10.0)));
+                        Points.Add(Cloud % 2 == 0 ? Point : Point.GetSafeNormal() * FFixed64(10.0));
+                    }
+                }
+                for (const TArray<FFixedVector64>& Points : Clouds)
+                {
+                    Views.Add(Points);
+                }
+                TArray<FFixedConvexHull> Serial, Parallel;
+                FFixedConvexHull::BuildAll(Views, Serial);
+                FFixedConvexHull::BuildAll(Views, Parallel, true);
+
+                bool bContained = true;
+                bool bEuler = true;
+                bool bSame = true;
+                bool bShuffled = true;
+                for (int32 Cloud = 0; Cloud < Clouds.Num(); Cloud++)
+                {
+                    const FFixedConvexHull& Hull = Serial[Cloud];
+                    for (const FFixedVector64& Point : Clouds[Cloud])
+                    {
+                        bContained &= Hull.IsPointInside(Point);
+                    }
+                    //every edge is shared by two faces
+                    bEuler &= Hull.Vertices.Num() - Hull.FaceIndices.Num() / 2 + Hull.NumFaces() == 2;
+                    bSame &= Hull.Vertices == Parallel[Cloud].Vertices && Hull.FaceIndices == Parallel[Cloud].FaceIndices && Hull.Planes == Parallel[Cloud].Planes;
+
+                    TArray<FFixedVector64> Reversed;
+                    for (int32 i = Clouds[Cloud].Num() - 1; i >= 0; i--)
+                    {
+                        Reversed.Add(Clouds[Cloud][i]);
+                    }
+                    FFixedConvexHull Other;
+                    Other.Build(Reversed);
+                    bShuffled &= Other.Vertices.Num() == Hull.Vertices.Num() && Other.NumFaces() == Hull.NumFaces();
+                    for (const FFixedVector64& Vertex : Other.Vertices)
+                    {
+                        bShuffled &= Hull.Vertices.Contains(Vertex);
+                    }
+                }
+                TestTrue("Every point is inside its hull", bContained);
+                TestTrue("Hulls are closed", bEuler);
+                TestTrue("Parallel builds are identical", bSame);
+                TestTrue("Input order does not change the hull", bShuffled);
+            });
+        });
+
+        Describe("Fixed Point Triangle Mesh", [this]()
+        {
+            auto IsNear = [](FFixed64 A, double B)
+            {
+                return FFixedPointMath::Abs(A - FFixed64(B)) <= FFixed64(0.001);
+            };
+
+            It("Should stop spheres and capsules just short of a floor and a wall", [this, IsNear]()
+            {
+                //a 20 x 20 floor at z = 0 and a wall 3 high across x = 5
+                const TArray<FFixedVector64> Vertices = {
+                    FFixedVector64(FFixed64(-10.0), FFixed64(-10.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(10.0), FFixed64(-10.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(10.0), FFixed64(10.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(-10.0), FFixed64(10.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(5.0), FFixed64(-10.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(5.0), FFixed64(10.0), FFixed64(0.0)),
+                    FFixedVector64(FFixed64(5.0), FFixed64(10.0), FFixed64(3.0)),
+                    FFixedVector64(FFixed64(5.0), FFixed64(-10.0), FFixed64(3.0))
+                };
+                const TArray<int32> Indices = { 0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7 };
+                FFixedTriangleMesh Mesh;
+                Mesh.Build(Vertices, Indices);
+                TestEqual("Four triangles", Mesh.NumTriangles(), 4);
+
+                FFixedSweepHit Hit;
+                TestTrue("Falling sphere lands", Mesh.SphereSweep(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(5.0)), FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(-5.0)), FFixed64(1.0), Hit));
+                TestTrue("Lands after falling four units", IsNear(Hit.Time, 0.4) && Hit.Time < FFixed64(0.4));
+                TestTrue("Floor normal", Hit.Normal == FFixedVector64::UpVector);
+                TestTrue("Contact under the center", Hit.Location.Equals(FFixedVector64::ZeroVector, FFixed64(0.001)));
+                TestTrue("Lowest index of the two floor triangles", Hit.Triangle == 0);
+
+                TestFalse("Sliding along the floor is not a hit", Mesh.SphereSweep(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(1.0)), FFixedVector64(FFixed64(3.0), FFixed64(0.0), FFixed64(1.0)), FFixed64(1.0), Hit));
+                TestFalse("Backing out of the floor is not a hit", Mesh.SphereSweep(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(0.5)), FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(3.0)), FFixed64(1.0), Hit));
+                TestTrue("Moving further into the floor is a hit at the start", Mesh.SphereSweep(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(0.5)), FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(-1.0)), FFixed64(1.0), Hit) && Hit.Time == FixedPoint::Constants::Fixed64::Zero);
+
+                TestTrue("Sphere hits the wall", Mesh.SphereSweep(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(1.5)), FFixedVector64(FFixed64(8.0), FFixed64(0.0), FFixed64(1.5)), FFixed64(1.0), Hit));
+                TestTrue("Wall hit time and normal", IsNear(Hit.Time, 0.5) && Hit.Normal.Equals(-FFixedVector64::XAxisVector, FFixed64(0.001)));
+                //passing half a unit over the wall's top edge catches the sphere where it is one unit from the edge
+                TestTrue("Sphere clips the top edge", Mesh.SphereSweep(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(3.5)), FFixedVector64(FFixed64(8.0), FFixed64(0.0), FFixed64(3.5)), FFixed64(1.0), Hit));
+                TestTrue("Edge hit time and normal", IsNear(Hit.Time, (5.0 - FMath::Sqrt(0.75)) / 8.0) && Hit.Normal.Equals(FFixedVector64(FFixed64(-FMath::Sqrt(0.75)), FFixed64(0.0), FFixed64(0.5)), FFixed64(0.001)));
+                TestTrue("Edge contact", Hit.Location.Equals(FFixedVector64(FFixed64(5.0), FFixed64(0.0), FFixed64(3.0)), FFixed64(0.001)));
+
+                const FFixedVector64 HalfAxis(FFixed64(0.0), FFixed64(0.0), FFixed64(1.0));
+                TestTrue("Falling capsule lands on its bottom cap", Mesh.CapsuleSweep(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(5.0)), FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(-5.0)), HalfAxis, FFixed64(0.5), Hit) && IsNear(Hit.Time, 0.35));
+                TestTrue("Capsule hits the wall side on", Mesh.CapsuleSweep(FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(2.0)), FFixedVector64(FFixed64(8.0), FFixed64(0.0), FFixed64(2.0)), HalfAxis, FFixed64(0.5), Hit) && IsNear(Hit.Time, 0.5625));
+            });
+
+            It("Should never end a sweep inside a triangle and give the same hits in parallel", [this]()
+            {
+                FRandomStream Stream(47);
+                TArray<FFixedVector64> Vertices;
+                TArray<int32> Indices;
+                const int32 Size = 16;
+                for (int32 Y = 0; Y <= Size; Y++)
+                {
+                    for (int32 X = 0; X <= Size; X++)
+                    {
+                        Vertices.Add(FFixedVector64(FFixed64(X * 2.0), FFixed64(Y * 2.0), FFixed64(Stream.FRandRange(0.0, 3.0))));
+                    }
+                }
+                for (int32 Y = 0; Y < Size; Y++)
+                {
+                    for (int32 X = 0; X < Size; X++)
+                    {
+                        const int32 Corner = Y * (Size + 1) + X;
+                        Indices.Append({ Corner, Corner + 1, Corner + Size + 2, Corner, Corner + Size + 2, Corner + Size + 1 });
+                    }
+                }
+                FFixedTriangleMesh Mesh;
+                Mesh.Build(Vertices, Indices);
+
+                TArray<FFixedSweep> Sweeps;
+                for (int32 i = 0; i < 200; i++)
+                {
+                    FFixedSweep& Sweep = Sweeps.AddDefaulted_GetRef();
+                    Sweep.Start = FFixedVector64(FFixed64(Stream.FRandRange(0.0, 32.0)), FFixed64(Stream.FRandRange(0.0, 32.0)), FFixed64(Stream.FRandRange(6.0, 10.0)));
+                    Sweep.End = Sweep.Start + FFixedVector64(FFixed64(Stream.FRandRange(-8.0, 8.0)), FFixed64(Stream.FRandRange(-8.0, 8.0)), FFixed64(Stream.FRandRange(-12.0, 0.0)));
+                    Sweep.Radius = FFixed64(Stream.FRandRange(0.3, 1.0));
+                    //every other sweep is an upright capsule
+                    Sweep.HalfAxis = i % 2 == 0 ? FFixedVector64::ZeroVector : FFixedVector64(FFixed64(0.0), FFixed64(0.0), FFixed64(Stream.FRandRange(0.5, 1.5)));
+                }
+                TArray<FFixedSweepHit> Serial, Parallel;
+                Serial.SetNum(Sweeps.Num());
+                Parallel.SetNum(Sweeps.Num());
+                Mesh.SweepBatch(Sweeps, Serial);
+                Mesh.SweepBatch(Sweeps, Parallel, true);
+
+                bool bSame = true;
+                bool bMatchesSingle = true;
+                bool bOutside = true;
+                int32 NumHits = 0;
+                for (int32 i = 0; i < Sweeps.Num(); i++)
+                {
+                    const FFixedSweep& Sweep = Sweeps[i];
+                    const FFixedSweepHit& Hit = Serial[i];
+                    bSame &= Hit.Triangle == Parallel[i].Triangle && Hit.Time == Parallel[i].Time && Hit.Normal == Parallel[i].Normal && Hit.Location == Parallel[i].Location;
+                    FFixedSweepHit Single;
+                    Mesh.CapsuleSweep(Sweep.Start, Sweep.End, Sweep.HalfAxis, Sweep.Radius, Single);
+                    bMatchesSingle &= Single.Triangle == Hit.Triangle && Single.Time == Hit.Time;
+                    NumHits += Hit.Triangle != INDEX_NONE;
+
+                    //the shape where the sweep stopped touches nothing, the starts are all above the terrain
+                    const FFixedVector64 Center = Sweep.Start + (Sweep.End - Sweep.Start) * Hit.Time;
+                    const FFixedConvexShape Shape = FFixedConvexShape::MakeCapsule(Center - Sweep.HalfAxis, Center + Sweep.HalfAxis, Sweep.Radius);
+                    for (int32 Triangle = 0; Triangle < Mesh.NumTriangles(); Triangle++)
+                    {
+                        bOutside &= !FFixedGJK::Intersect(Shape, FFixedConvexShape::MakeHull(Mesh.GetTriangle(Triangle)));
+                    }
+                }
+                TestTrue("Many sweeps hit the terrain", NumHits > Sweeps.Num() / 4);
+                TestTrue("Parallel batches match", bSame);
+                TestTrue("Batches match single sweeps", bMatchesSingle);
+                TestTrue("No sweep ends inside a triangle", bOutside);
+            });
+        });
+
+        Describe("Fixed Point Spatial Key", [this]()
+        {
+            It("Should interleave cell bits in Morton order and clamp cells out of range", [this]()
+            {
+                const FFixed64 One = FixedPoint::Constants::Fixed64::One;
+                //the lowest cell of the 3D key range, -2^20 on every axis
+                const double Low = -1048576.0;
+                TestEqual("Lowest cell is key zero", FFixedSpatialKey::Morton(FFixedVector64(FFixed64(Low), FFixed64(Low), FFixed64(Low)), One), (uint64)0);
+                TestEqual("X is the lowest bit", FFixedSpatialKey::Morton(FFixedVector64(FFixed64(Low + 1.0), FFixed64(Low), FFixed64(Low)), One), (uint64)1);
+                TestEqual("Then Y", FFixedSpatialKey::Morton(FFixedVector64(FFixed64(Low), FFixed64(Low + 1.0), FFixed64(Low)), One), (uint64)2);
+                TestEqual("Then Z", FFixedSpatialKey::Morton(FFixedVector64(FFixed64(Low), FFixed64(Low), FFixed64(Low + 1.0)), One), (uint64)4);
+                TestEqual("Cell 3 on X", FFixedSpatialKey::Morton(FFixedVector64(FFixed64(Low + 3.0), FFixed64(Low), FFixed64(Low)), One), (uint64)9);
+                TestEqual("Origin is mid range", FFixedSpatialKey::Morton(FFixedVector64::ZeroVector, One), (uint64)0x7000000000000000);
+                TestEqual("Cells below the range clamp to it", FFixedSpatialKey::Morton(FFixedVector64(FFixed64(Low * 4.0), FFixed64(Low), FFixed64(Low)), One), (uint64)0);
+
+                //cells floor divide, so -0.5 and -1 share a cell that 0 is not in
+                const FFixed64 CellSize(1.5);
+                TestEqual("Negative coordinates floor", FFixedSpatialKey::Morton(FFixedVector2d(FFixed64(-0.5), FFixed64(0.0)), CellSize), FFixedSpatialKey::Morton(FFixedVector2d(FFixed64(-1.5), FFixed64(0.0)), CellSize));
+                TestNotEqual("Zero is the next cell", FFixedSpatialKey::Morton(FFixedVector2d(FFixed64(-0.5), FFixed64(0.0)), CellSize), FFixedSpatialKey::Morton(FFixedVector2d(FFixed64(0.0), FFixed64(0.0)), CellSize));
+                TestNotEqual("Past the cell", FFixedSpatialKey::Morton(FFixedVector2d(FFixed64(-0.5), FFixed64(0.0)), CellSize), FFixedSpatialKey::Morton(FFixedVector2d(FFixed64(-1.75), FFixed64(0.0)), CellSize));
+            });
+
+            It("Should step between neighboring cells along the Hilbert curve", [this]()
+            {
+                const FFixed64 One = FixedPoint::Constants::Fixed64::One;
+                //the curve starts at the lowest corner, so its first 8^3 or 16^2 keys fill the cube or square there
+                for (int32 Dimensions = 2; Dimensions <= 3; Dimensions++)
+                {
+                    const int32 Side = Dimensions == 3 ? 8 : 16;
+                    const double Low = Dimensions == 3 ? -1048576.0 : -2147483648.0;
+                    TArray<TPair<uint64, FIntVector>> Cells;
+                    for (int32 X = 0; X < Side; X++)
+                    {
+                        for (int32 Y = 0; Y < Side; Y++)
+                        {
+                            for (int32 Z = 0; Z < (Dimensions == 3 ? Side : 1); Z++)
+                            {
+                                const uint64 Key = Dimensions == 3
+                                    ? FFixedSpatialKey::Hilbert(FFixedVector64(FFixed64(Low + X), FFixed64(Low + Y), FFixed64(Low + Z)), One)
+                                    : FFixedSpatialKey::Hilbert(FFixedVector2d(FFixed64(Low + X), FFixed64(Low + Y)), One);
+                                Cells.Add(TPair<uint64, FIntVector>(Key, FIntVector(X, Y, Z)));
+                            }
+                        }
+                    }
+                    Cells.Sort([](const TPair<uint64, FIntVector>& A, const TPair<uint64, FIntVector>& B) { return A.Key < B.Key; });
+                    bool bDense = true;
+                    bool bAdjacent = true;
+                    for (int32 i = 0; i < Cells.Num(); i++)
+                    {
+                        bDense &= Cells[i].Key == (uint64)i;
+                        if (i > 0)
+                        {
+                            const FIntVector Step = Cells[i].Value - Cells[i - 1].Value;
+                            bAdjacent &= FMath::Abs(Step.X) + FMath::Abs(Step.Y) + FMath::Abs(Step.Z) == 1;
+                        }
+                    }
+                    TestTrue(FString::Printf(TEXT("%dD keys fill the corner"), Dimensions), bDense);
+                    TestTrue(FString::Printf(TEXT("%dD consecutive keys are neighbors"), Dimensions), bAdjacent);
+                }
+            });
+
+            It("Should give the same keys with and without BMI2 and in parallel", [this]()
+            {
+                FRandomStream Stream(48);
+                TArray<FFixedVector64> Positions;
+                TArray<FFixed64> X, Y, Z;
+                TArray<FFixedVector2d> Positions2D;
+                for (int32 i = 0; i < 20000; i++)
+                {
+                    const FFixedVector64 Position(FFixed64(Stream.FRandRange(-1000000.0, 1000000.0)), FFixed64(Stream.FRandRange(-1000000.0, 1000000.0)), FFixed64(Stream.FRandRange(-1000000.0, 1000000.0)));
+                    Positions.Add(Position);
+                    X.Add(Position.X);
+                    Y.Add(Position.Y);
+                    Z.Add(Position.Z);
+                    Positions2D.Add(FFixedVector2d(Position.X, Position.Y));
+                }
+                const bool bWasUsingBMI2 = FFixedSpatialKey::IsUsingBMI2();
+                const FFixed64 CellSizes[] = { FixedPoint::Constants::Fixed64::One, FFixed64(0.37), FFixed64(16.0) };
+                for (const EFixedSpatialCurve Curve : { EFixedSpatialCurve::Morton, EFixedSpatialCurve::Hilbert })
+                {
+                    for (const FFixed64 CellSize : CellSizes)
+                    {
+                        TArray<uint64> Fast, Portable, Keys2D, Portable2D;
+                        Fast.SetNumUninitialized(Positions.Num());
+                        Portable.SetNumUninitialized(Positions.Num());
+                        Keys2D.SetNumUninitialized(Positions.Num());
+                        Portable2D.SetNumUninitialized(Positions.Num());
+                        FFixedSpatialKey::SetUseBMI2(true);
+                        FFixedSpatialKey::MakeKeys(Positions, CellSize, Curve, Fast, true);
+                        FFixedSpatialKey::MakeKeys(Positions2D, CellSize, Curve, Keys2D, true);
+                        FFixedSpatialKey::SetUseBMI2(false);
+                        FFixedSpatialKey::MakeKeys(X, Y, Z, CellSize, Curve, Portable);
+                        FFixedSpatialKey::MakeKeys(X, Y, CellSize, Curve, Portable2D);
+                        bool bSingleMatches = true;
+                        for (int32 i = 0; i < Positions.Num(); i++)
+                        {
+                            bSingleMatches &= FFixedSpatialKey::Make(Positions[i], CellSize, Curve) == Portable[i];
+                        }
+                        TestTrue("3D keys match", Fast == Portable);
+                        TestTrue("2D keys match", Keys2D == Portable2D);
+                        TestTrue("Single keys match", bSingleMatches);
+                    }
+                }
+                FFixedSpatialKey::SetUseBMI2(bWasUsingBMI2);
+            });
+
+            It("Should sort parallel arrays into key order", [this]()
+            {
+                FRandomStream Stream(480);
+                TArray<FFixedVector64> Positions;
+                TArray<int32> Ids;
+                for (int32 i = 0; i < 5000; i++)
+                {
+                    //a coarse grid so many positions share a key
+                    Positions.Add(FFixedVector64(FFixed64(Stream.RandRange(-20, 20)), FFixed64(Stream.RandRange(-20, 20)), FFixed64(Stream.RandRange(-20, 20))));
+                    Ids.Add(i);
+                }
+                const TArray<FFixedVector64> Original = Positions;
+                const FFixed64 CellSize(4.0);
+                FFixedSpatialKey::SortArrays(Positions, CellSize, EFixedSpatialCurve::Hilbert, Positions, Ids);
+
+                bool bInStep = true;
+                bool bOrdered = true;
+                for (int32 i = 0; i < Positions.Num(); i++)
+                {
+                    bInStep &= Positions[i] == Original[Ids[i]];
+                    if (i > 0)
+                    {
+                        const uint64 Previous = FFixedSpatialKey::Hilbert(Positions[i - 1], CellSize);
+                        const uint64 Current = FFixedSpatialKey::Hilbert(Positions[i], CellSize);
+                        bOrdered &= Previous < Current || (Previous == Current && Ids[i - 1] < Ids[i]);
+                    }
+                }
+                TestTrue("Arrays stay in step", bInStep);
+                TestTrue("Ascending keys, ties by original index", bOrdered);
+            });
+        });
+
+        Describe("Fixed Point Radix Sort", [this]()
+        {
+            It("Should sort signed values in the same order as comparing them", [this]()
+            {
+                FRandomStream Stream(49);
+                for (const int32 Num : { 0, 1, 10, 63, 64, 1000, 100000 })
+                {
+                    TArray<FFixed64> Values64;
+                    TArray<FFixed32> Values32;
+                    for (int32 i = 0; i < Num; i++)
+                    {
+                        Values64.Add(FFixed64(Stream.FRandRange(-100000.0, 100000.0)));
+                        Values32.Add(FFixed32(Stream.FRandRange(-10000.0, 10000.0)));
+                    }
+                    if (Num > 2)
+                    {
+                        Values64[0] = FFixed64::MakeFromRawInt(MIN_int64);
+                        Values64[1] = FFixed64::MakeFromRawInt(MAX_int64);
+                        Values32[0] = FFixed32::MakeFromRawInt(MIN_int32);
+                        Values32[1] = FFixed32::MakeFromRawInt(MAX_int32);
+                    }
+                    TArray<FFixed64> Expected64 = Values64;
+                    Expected64.Sort();
+                    TArray<FFixed32> Expected32 = Values32;
+                    Expected32.Sort();
+                    for (const bool bParallel : { false, true })
+                    {
+                        TArray<FFixed64> Sorted64 = Values64;
+                        FFixedRadixSort::Sort(Sorted64, bParallel);
+                        TArray<FFixed32> Sorted32 = Values32;
+                        FFixedRadixSort::Sort(Sorted32, bParallel);
+                        TestTrue(FString::Printf(TEXT("%d FFixed64 sorted, parallel %d"), Num, bParallel), Sorted64 == Expected64);
+                        TestTrue(FString::Printf(TEXT("%d FFixed32 sorted, parallel %d"), Num, bParallel), Sorted32 == Expected32);
+                    }
+                }
+            });
+
+            It("Should keep equal keys in input order and give the same order in parallel", [this]()
+            {
+                FRandomStream Stream(490);
+                //enough keys for several parallel chunks, from few enough values that most are tied
+                TArray<FFixed64> Keys;
+                for (int32 i = 0; i < 300000; i++)
+                {
+                    Keys.Add(FFixed64(Stream.RandRange(-50, 50)) / FFixed64(4));
+                }
+                TArray<int32> Order, ParallelOrder;
+                FFixedRadixSort::ArgSort(Keys, Order);
+                FFixedRadixSort::ArgSort(Keys, ParallelOrder, true);
+                bool bStable = true;
+                for (int32 i = 1; i < Order.Num(); i++)
+                {
+                    bStable &= Keys[Order[i - 1]] < Keys[Order[i]] || (Keys[Order[i - 1]] == Keys[Order[i]] && Order[i - 1] < Order[i]);
+                }
+                TestTrue("Ascending, ties by index", bStable);
+                TestTrue("Parallel order matches", Order == ParallelOrder);
+
+                //arrival times with the agent each belongs to
+                TArray<FFixed32> Times = { FFixed32(3.0), FFixed32(-1.0), FFixed32(3.0), FFixed32(0.5), FFixed32(-1.0) };
+                TArray<int32> Agents = { 0, 1, 2, 3, 4 };
+                FFixedRadixSort::SortPairs(Times, Agents);
+                TestTrue("Pairs sorted by time", Agents == TArray<int32>({ 1, 4, 3, 0, 2 }));
+                TestTrue("Keys sorted", Times == TArray<FFixed32>({ FFixed32(-1.0), FFixed32(-1.0), FFixed32(0.5), FFixed32(3.0), FFixed32(3.0) }));
+
+                const TArray<uint64> SpatialKeys = { 7, (uint64)1 << 63, 0, 7, MAX_uint64 };
+                FFixedRadixSort::ArgSort(SpatialKeys, Order);
+                TestTrue("Unsigned keys", Order == TArray<int32>({ 2, 0, 3, 1, 4 }));
+                TArray<uint64> SortedKeys = SpatialKeys;
+                FFixedRadixSort::Sort(SortedKeys);
+                TestTrue("Unsigned sort", SortedKeys == TArray<uint64>({ 0, 7, 7, (uint64)1 << 63, MAX_uint64 }));
+            });
+        });
+
+        Describe("Fixed Point Sweep And Prune", [this]()
+        {
+            It("Should count touching boxes and apply edits at Flush", [this]()
+            {
+                auto MakeBox = [](double MinX, double MinY, double MinZ, double Size)
+                {
+                    return FFixedBox(FFixedVector64(FFixed64(MinX), FFixed64(MinY), FFixed64(MinZ)), FFixedVector64(FFixed64(MinX + Size), FFixed64(MinY + Size), FFixed64(MinZ + Size)));
+                };
+                FFixedSweepAndPrune Broadphase;
+                Broadphase.Insert(7, MakeBox(0.0, 0.0, 0.0, 1.0));
+                Broadphase.Insert(2, MakeBox(1.0, 1.0, 1.0, 1.0));
+                //overlaps 7 on the sweep axis only
+                Broadphase.Insert(4, MakeBox(0.5, 5.0, 0.0, 1.0));
+                TestTrue("Edits wait for Flush", Broadphase.IsDirty());
+                Broadphase.Flush();
+
+                TArray<FIntPoint> Pairs;
+                Broadphase.FindPairs(Pairs);
+                TestTrue("Touching corners overlap, lower id first", Pairs == TArray<FIntPoint>({ FIntPoint(2, 7) }));
+
+                Broadphase.Move(4, MakeBox(0.5, 0.5, 0.5, 1.0));
+                Broadphase.Remove(2);
+                TestTrue("Moves and removes wait for Flush", Broadphase.IsDirty());
+                Broadphase.Flush();
+                Broadphase.FindPairs(Pairs);
+                TestTrue("Moved box found, removed one gone", Pairs == TArray<FIntPoint>({ FIntPoint(4, 7) }));
+
+                Broadphase.SetSweepAxis(EAxis::Z);
+                Broadphase.Flush();
+                Broadphase.FindPairs(Pairs);
+                TestTrue("Same pairs along another axis", Pairs == TArray<FIntPoint>({ FIntPoint(4, 7) }));
+            });
+
+            It("Should find the same pairs as testing every pair while boxes move", [this]()
+            {
+                FRandomStream Stream(50);
+                const int32 MaxId = 1500;
+                FFixedSweepAndPrune Broadphase(EAxis::Y);
+                auto RandomBox = [&Stream]()
+                {
+                    const FFixedVector64 Center(FFixed64(Stream.FRandRange(0.0, 60.0)), FFixed64(Stream.FRandRange(0.0, 60.0)), FFixed64(Stream.FRandRange(0.0, 6.0)));
+                    const FFixedVector64 Extent(FFixed64(Stream.FRandRange(0.2, 1.0)), FFixed64(Stream.FRandRange(0.2, 1.0)), FFixed64(Stream.FRandRange(0.2, 1.0)));
+                    return FFixedBox(Center - Extent, Center + Extent);
+                };
+                bool bMatches = true;
+                bool bParallelMatches = true;
+                for (int32 Tick = 0; Tick < 12; Tick++)
+                {
+                    for (int32 Edit = 0; Edit < 200; Edit++)
+                    {
+                        const int32 Id = Stream.RandRange(0, MaxId - 1);
+                        if (!Broadphase.Contains(Id))
+                        {
+                            Broadphase.Insert(Id, RandomBox());
+                        }
+                        else if (Stream.RandRange(0, 2) == 0)
+                        {
+                            Broadphase.Remove(Id);
+                        }
+                    }
+                    for (int32 Id = 0; Id < MaxId; Id++)
+                    {
+                        if (Broadphase.Contains(Id))
+                        {
+                            //mostly small steps, with the odd teleport
+                            const double Range = Stream.RandRange(0, 99) == 0 ? 30.0 : 0.4;
+                            const FFixedVector64 Step(FFixed64(Stream.FRandRange(-Range, Range)), FFixed64(Stream.FRandRange(-Range, Range)), FFixed64(Stream.FRandRange(-0.1, 0.1)));
+                            const FFixedBox& Box = Broadphase.GetBox(Id);
+                            Broadphase.Move(Id, FFixedBox(Box.Min + Step, Box.Max + Step));
+                        }
+                    }
+                    if (Tick == 6)
+                    {
+                        Broadphase.SetSweepAxis(EAxis::X);
+                    }
+                    Broadphase.Flush();
+
+                    TArray<FIntPoint> Pairs, ParallelPairs, Expected;
+                    Broadphase.FindPairs(Pairs);
+                    Broadphase.FindPairs(ParallelPairs, true);
+                    for (int32 A = 0; A < MaxId; A++)
+                    {
+                        if (!Broadphase.Contains(A))
+                        {
+                            continue;
+                        }
+                        for (int32 B = A + 1; B < MaxId; B++)
+                        {
+                            if (Broadphase.Contains(B) && Broadphase.GetBox(A).Intersect(Broadphase.GetBox(B)))
+                            {
+                                Expected.Add(FIntPoint(A, B));
+                            }
+                        }
+                    }
+                    bMatches &= Pairs == Expected;
+                    bParallelMatches &= ParallelPairs == Pairs;
+                }
+                TestTrue("Pairs match brute force in order", bMatches);
+                TestTrue("Parallel pairs match", bParallelMatches);
+            });
+        });
     });
 }
@@ -0,0 +1,165 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointBox.h"
+
+/**
+* FFixedBVHHit
+* Closest hit of a cast against a FFixedBVH.
+*/
+struct FFixedBVHHit
+{
+	/** Index of the item that was hit, INDEX_NONE if nothing was */
+	int32 Item = INDEX_NONE;
+
+	/** Fraction of the way from Start to End where the hit happened, 0 to 1 */
+	FFixed64 Time = FixedPoint::Constants::Fixed64::One;
+};
+
+/**
+* FFixedBVH
+* Bounding volume hierarchy over FFixedBox item bounds for raycasts, sweeps and overlap queries.
+* Built with a binned surface area heuristic whose costs are exact 128 bit integers, and traversed with a segment slab
+* test that compares entry and exit times as exact fractions, so builds, refits and query results are bit identical
+* on every machine. Costs stay exact while item bounds span less than about 1e11 units on a side.
+*
+* Nodes are flattened depth first into one cache line each, a node's first child directly follows it.
+* Item bounds are copied into leaf order so a leaf's items are tested from contiguous memory.
+* Moving items can be refit without changing the tree, rebuild once refits have grown the nodes too much.
+*/
+struct FIXEDPOINT_API FFixedBVH
+{
+public:
+	/**
+	* Builds the tree, replacing any previous one.
+	*
+	* @param Bounds - Bounds of each item, the item index is its index in this array
+	*/
+	void Build(TArrayView<const FFixedBox> Bounds);
+
+	/**
+	* Updates every item's bounds and refits all nodes bottom up, the tree layout is unchanged.
+	*
+	* @param Bounds - New bounds of each item, must be the same length as the array the tree was built from
+	*/
+	void Refit(TArrayView<const FFixedBox> Bounds);
+
+	/**
+	* Updates one item's bounds and refits its ancestors, stopping at the first node whose bounds did not change.
+	* Cheaper than Refit when only a few items move.
+	*/
+	void UpdateItem(int32 Item, const FFixedBox& NewBounds);
+
+	void Reset();
+
+	FORCEINLINE int32 Num() const
+	{
+		return Items.Num();
+	}
+
+	FORCEINLINE int32 NumNodes() const
+	{
+		return Nodes.Num();
+	}
+
+	/** @return the bounds of everything in the tree, invalid if the tree is empty */
+	FFixedBox GetBounds() const;
+
+	FORCEINLINE const FFixedBox& GetItemBounds(int32 Item) const
+	{
+		return PackedBounds[PackedIndexOfItem[Item]];
+	}
+
+	/**
+	* Finds every item whose bounds overlap Box, touching counts.
+	*
+	* @param OutItems - Items are appended in tree order
+	*/
+	void QueryBox(const FFixedBox& Box, TArray<int32>& OutItems) const;
+
+	/**
+	* Finds every item whose bounds the segment from Start to End touches.
+	*
+	* @param OutItems - Items are appended in tree order, nearer children first
+	*/
+	void QuerySegment(const FFixedVector64& Start, const FFixedVector64& End, TArray<int32>& OutItems) const;
+
+	/**
+	* Finds every item whose bounds, grown by Radius on each axis, the segment from Start to End touches.
+	* This is conservative for a sphere swept along the segment, test the real shapes to narrow the result.
+	*
+	* @param OutItems - Items are appended in tree order, nearer children first
+	*/
+	void QuerySphereSweep(const FFixedVector64& Start, const FFixedVector64& End, FFixed64 Radius, TArray<int32>& OutItems) const;
+
+	/**
+	* Finds the first item bounds hit by the segment from Start to End.
+	* Hits at equal times go to the lower item index.
+	*
+	* @return true if something was hit
+	*/
+	bool RayCast(const FFixedVector64& Start, const FFixedVector64& End, FFixedBVHHit& OutHit) const;
+
+	/**
+	* Finds the first item hit by the segment from Start to End, using HitItem for the exact test against each item whose
+	* bounds the segment touches. Hits at equal times go to the lower item index.
+	*
+	* @param HitItem - Returns true if the segment hits the item and writes the hit fraction from 0 to 1 to Time,
+	*                  which must not be earlier than where the segment enters the item's bounds
+	* @return true if something was hit
+	*/
+	bool RayCast(const FFixedVector64& Start, const FFixedVector64& End, FFixedBVHHit& OutHit, TFunctionRef<bool(int32 Item, FFixed64& Time)> HitItem) const;
+
+	/**
+	* Finds the first item hit by a sphere swept from Start to End, see RayCast.
+	* Item bounds are grown by Radius on each axis before HitItem is called, so HitItem does the exact sphere test.
+	*/
+	bool SphereCast(const FFixedVector64& Start, const FFixedVector64& End, FFixed64 Radius, FFixedBVHHit& OutHit, TFunctionRef<bool(int32 Item, FFixed64& Time)> HitItem) const;
+
+private:
+	/** One cache line, a leaf when NumItems is not zero */
+	struct alignas(64) FNode
+	{
+		FFixedVector64 Min;
+		FFixedVector64 Max;
+		/** First packed item for a leaf, index of the second child for an interior node */
+		int32 Offset;
+		int32 Parent;
+		uint16 NumItems;
+		/** Split axis, used to visit the nearer child first */
+		uint8 Axis;
+	};
+
+	/** Segment in raw units, an entry or exit time is the exact fraction Num / Den */
+	struct FSegment
+	{
+		int64 Start[3];
+		int64 Delta[3];
+		int64 Expand;
+	};
+
+	static FSegment MakeSegment(const FFixedVector64& Start, const FFixedVector64& End, FFixed64 Expand);
+
+	/** @return true if the segment touches the box, with the entry time as a fraction */
+	static bool SegmentHitsBox(const FSegment& Segment, const FFixedVector64& Min, const FFixedVector64& Max, int64& OutEnterNum, int64& OutEnterDen);
+
+	/** Recomputes a node's bounds from its items or children, @return true if they changed */
+	bool RefitNode(int32 NodeIndex);
+
+	void QuerySegment(const FSegment& Segment, TArray<int32>& OutItems) const;
+
+	bool Cast(const FSegment& Segment, FFixedBVHHit& OutHit, TFunctionRef<bool(int32 Item, FFixed64& Time)> HitItem) const;
+
+	TArray<FNode, TAlignedHeapAllocator<64>> Nodes;
+
+	/** Item index of each packed slot, leaves own contiguous runs */
+	TArray<int32> Items;
+	TArray<FFixedBox> PackedBounds;
+	TArray<int32> PackedIndexOfItem;
+	TArray<int32> LeafOfItem;
+};
@@ -0,0 +1,200 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointSoA.h"
+
+/**
+* Instruction set used by the batch kernels.
+* Every level produces bit-identical results, the level only changes how many lanes are processed at once.
+*/
+enum class EFixedPointSIMDLevel : uint8
+{
+	Scalar,
+	SSE2,
+	AVX2
+};
+
+/**
+* FFixed64Batch
+* Array kernels for FFixed64, for batch vector and matrix work.
+* Products are built from 32x32->64 partial products so the vector paths can process 2 (SSE2) or 4 (AVX2) lanes at once.
+* Each product is truncated exactly like FFixed64::operator*, the absolute values are multiplied, shifted down by the binary point,
+* and the sign is reapplied, so results match the scalar operators bit for bit on every dispatch target.
+* The kernel is chosen at runtime from CPUID the first time any function is called.
+* Operands must not be the raw value INT64_MIN, which has no positive counterpart.
+* Output arrays may alias input arrays.
+*/
+struct FIXEDPOINT_API FFixed64Batch
+{
+	/**
+	* Best instruction set supported by the running CPU
+	*/
+	static EFixedPointSIMDLevel GetSupportedLevel();
+
+	/**
+	* Instruction set currently used by the kernels
+	*/
+	static EFixedPointSIMDLevel GetActiveLevel();
+
+	/**
+	* Overrides the instruction set used by the kernels, clamped to what the CPU supports. Mainly for tests and profiling.
+	* @param Level - Requested instruction set
+	* @return The instruction set that is now active
+	*/
+	static EFixedPointSIMDLevel SetActiveLevel(EFixedPointSIMDLevel Level);
+
+	/**
+	* Out[i] = A[i] * B[i]
+	*/
+	static void Mul(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, TArrayView<const FFixed64> B);
+
+	/**
+	* Out[i] = A[i] * B
+	*/
+	static void Mul(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, const FFixed64& B);
+
+	/**
+	* Out[i] = A[i] * B[i] + C[i], the product is truncated before the add, as with the scalar operators
+	*/
+	static void MulAdd(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, TArrayView<const FFixed64> B, TArrayView<const FFixed64> C);
+
+	/**
+	* Out[i] = AX[i] * BX[i] + AY[i] * BY[i] + AZ[i] * BZ[i], on structure of arrays input
+	*/
+	static void Dot3(TArrayView<FFixed64> Out,
+		TArrayView<const FFixed64> AX, TArrayView<const FFixed64> AY, TArrayView<const FFixed64> AZ,
+		TArrayView<const FFixed64> BX, TArrayView<const FFixed64> BY, TArrayView<const FFixed64> BZ);
+
+	/**
+	* Out[i] = A[i] | B[i], matches FFixedVector64::operator|
+	*/
+	static void Dot3(TArrayView<FFixed64> Out, TArrayView<const FFixedVector64> A, TArrayView<const FFixedVector64> B);
+
+	/**
+	* Out[i] = A[i] + Alpha[i] * (B[i] - A[i]), matches FMath::Lerp
+	*/
+	static void Lerp(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, TArrayView<const FFixed64> B, TArrayView<const FFixed64> Alpha);
+
+	/**
+	* Out[i] = A[i] + Alpha * (B[i] - A[i]), matches FMath::Lerp
+	*/
+	static void Lerp(TArrayView<FFixed64> Out, TArrayView<const FFixed64> A, TArrayView<const FFixed64> B, const FFixed64& Alpha);
+
+	/**
+	* Scalar reference for the lane multiply the kernels use, identical to FFixed64::operator*
+	*/
+	static FORCEINLINE int64 MulRaw(int64 A, int64 B)
+	{
+		const uint64 SignA = (uint64)(A >> 63);
+		const uint64 SignB = (uint64)(B >> 63);
+		const uint64 AbsA = ((uint64)A ^ SignA) - SignA;
+		const uint64 AbsB = ((uint64)B ^ SignB) - SignB;
+		const uint64 ALo = AbsA & 0xFFFFFFFFull;
+		const uint64 AHi = AbsA >> 32;
+		const uint64 BLo = AbsB & 0xFFFFFFFFull;
+		const uint64 BHi = AbsB >> 32;
+		const uint64 Lo = ALo * BLo;
+		const uint64 MidA = AHi * BLo;
+		const uint64 MidB = ALo * BHi;
+		const uint64 Hi = AHi * BHi;
+		const uint64 Carry = (Lo >> 32) + (MidA & 0xFFFFFFFFull) + (MidB & 0xFFFFFFFFull);
+		const uint64 Low = (Lo & 0xFFFFFFFFull) | (Carry << 32);
+		const uint64 High = Hi + (MidA >> 32) + (MidB >> 32) + (Carry >> 32);
+		const uint64 Result = (Low >> FixedPoint::Constants::BinaryPoint64) | (High << (64 - FixedPoint::Constants::BinaryPoint64));
+		const uint64 Sign = SignA ^ SignB;
+		return (int64)((Result ^ Sign) - Sign);
+	}
+};
+
+/**
+* FFixed32Batch
+* Array kernels for FFixed32, for systems that do not need the range of FFixed64 (particles, crowd steering, flow fields).
+* FFixed32 products fit in a plain int64 so AVX2 processes 8 lanes at once, at half the memory traffic of FFixed64.
+* Results match the scalar FFixed32 operators and FFixedPointMath::Sqrt bit for bit.
+* Uses the instruction set selected through FFixed64Batch, there is no SSE2 path so SSE2 runs the scalar kernels.
+* Div requires nonzero divisors and quotients that fit in FFixed32, the same as the scalar operator.
+* Output arrays may alias input arrays.
+*/
+struct FIXEDPOINT_API FFixed32Batch
+{
+	/**
+	* Out[i] = A[i] + B[i]
+	*/
+	static void Add(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B);
+
+	/**
+	* Out[i] = A[i] - B[i]
+	*/
+	static void Sub(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B);
+
+	/**
+	* Out[i] = A[i] * B[i]
+	*/
+	static void Mul(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B);
+
+	/**
+	* Out[i] = A[i] * B
+	*/
+	static void Mul(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, const FFixed32& B);
+
+	/**
+	* Out[i] = A[i] / B[i]
+	*/
+	static void Div(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B);
+
+	/**
+	* Out[i] = FFixedPointMath::Sqrt(A[i]), negative inputs give 0
+	*/
+	static void Sqrt(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A);
+
+	/**
+	* Out[i] = A[i] + Alpha[i] * (B[i] - A[i]), matches FMath::Lerp
+	*/
+	static void Lerp(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B, TArrayView<const FFixed32> Alpha);
+
+	/**
+	* Out[i] = A[i] + Alpha * (B[i] - A[i]), matches FMath::Lerp
+	*/
+	static void Lerp(TArrayView<FFixed32> Out, TArrayView<const FFixed32> A, TArrayView<const FFixed32> B, const FFixed32& Alpha);
+
+	/**
+	* Component wise vector ops on structure of arrays vectors. Out must already be sized to match the inputs.
+	*/
+	static void Add(FFixed32Vector2SoA& Out, const FFixed32Vector2SoA& A, const FFixed32Vector2SoA& B);
+	static void Add(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B);
+	static void Sub(FFixed32Vector2SoA& Out, const FFixed32Vector2SoA& A, const FFixed32Vector2SoA& B);
+	static void Sub(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B);
+	static void Scale(FFixed32Vector2SoA& Out, const FFixed32Vector2SoA& A, const FFixed32& Scale);
+	static void Scale(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32& Scale);
+	static void Lerp(FFixed32Vector2SoA& Out, const FFixed32Vector2SoA& A, const FFixed32Vector2SoA& B, const FFixed32& Alpha);
+	static void Lerp(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B, const FFixed32& Alpha);
+
+	/**
+	* Out[i] = A[i].X * B[i].X + A[i].Y * B[i].Y (+ A[i].Z * B[i].Z), each product truncated as with the scalar operators
+	*/
+	static void Dot(TArrayView<FFixed32> Out, const FFixed32Vector2SoA& A, const FFixed32Vector2SoA& B);
+	static void Dot(TArrayView<FFixed32> Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B);
+
+	/**
+	* Out[i] = A[i] x B[i]
+	*/
+	static void Cross(FFixed32Vector3SoA& Out, const FFixed32Vector3SoA& A, const FFixed32Vector3SoA& B);
+
+	/**
+	* Out[i] = Sqrt(A[i] | A[i])
+	*/
+	static void Size(TArrayView<FFixed32> Out, const FFixed32Vector2SoA& A);
+	static void Size(TArrayView<FFixed32> Out, const FFixed32Vector3SoA& A);
+
+	/**
+	* Scalar reference for the lane multiply the kernels use, identical to FFixed32::operator*
+	*/
+	static FORCEINLINE int32 MulRaw(int32 A, int32 B)
+	{
+		return (int32)(((int64)A * (int64)B) >> FixedPoint::Constants::BinaryPoint32);
+	}
+};
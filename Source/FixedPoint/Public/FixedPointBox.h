@@ -0,0 +1,429 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointMath.h"
+#include "FixedPointVector.h"
+#include "FixedPointBox.generated.h"
+
+/**
+* FFixedBox
+* Axis aligned bounding box, the deterministic counterpart of FBox.
+* Transformed boxes round their bounds outwards so they always contain the transformed corners.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedBox
+{
+public:
+	GENERATED_BODY()
+
+	/** Holds the box's minimum point. */
+	UPROPERTY(EditAnywhere)
+	FFixedVector64 Min;
+
+	/** Holds the box's maximum point. */
+	UPROPERTY(EditAnywhere)
+	FFixedVector64 Max;
+
+	/** Holds a flag indicating whether this box is valid. */
+	UPROPERTY(EditAnywhere)
+	uint8 IsValid;
+
+	/** Default constructor (no initialization). */
+	FORCEINLINE FFixedBox() {}
+
+	/**
+	 * Creates and initializes a new box with zero extent and marks it as invalid.
+	 *
+	 * @param EForceInit Force Init Enum.
+	 */
+	explicit FORCEINLINE FFixedBox(EForceInit)
+		: Min(FixedPoint::Constants::Fixed64::Zero), Max(FixedPoint::Constants::Fixed64::Zero), IsValid(0)
+	{
+	}
+
+	/**
+	 * Creates and initializes a new box from the specified extents.
+	 *
+	 * @param InMin The box's minimum point.
+	 * @param InMax The box's maximum point.
+	 */
+	FORCEINLINE FFixedBox(const FFixedVector64& InMin, const FFixedVector64& InMax)
+		: Min(InMin), Max(InMax), IsValid(1)
+	{
+	}
+
+	/**
+	 * Creates and initializes a new box from the given set of points.
+	 *
+	 * @param Points Array of points to create for the bounding volume.
+	 */
+	explicit FFixedBox(TArrayView<const FFixedVector64> Points)
+		: FFixedBox(ForceInit)
+	{
+		for (const FFixedVector64& Point : Points)
+		{
+			*this += Point;
+		}
+	}
+
+	/**
+	 * Compares two boxes for equality.
+	 *
+	 * @return true if the boxes are equal, false otherwise.
+	 */
+	FORCEINLINE bool operator==(const FFixedBox& Other) const
+	{
+		return (Min == Other.Min) && (Max == Other.Max);
+	}
+
+	FORCEINLINE bool operator!=(const FFixedBox& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	/**
+	 * Check against another box for equality, within specified error limits.
+	 */
+	FORCEINLINE bool Equals(const FFixedBox& Other, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		return Min.Equals(Other.Min, Tolerance) && Max.Equals(Other.Max, Tolerance);
+	}
+
+	/**
+	 * Adds to this bounding box to include a given point.
+	 *
+	 * @param Other the point to increase the bounding volume to.
+	 * @return Reference to this bounding box after resizing to include the other point.
+	 */
+	FORCEINLINE FFixedBox& operator+=(const FFixedVector64& Other)
+	{
+		if (IsValid)
+		{
+			Min = Min.ComponentMin(Other);
+			Max = Max.ComponentMax(Other);
+		}
+		else
+		{
+			Min = Max = Other;
+			IsValid = 1;
+		}
+		return *this;
+	}
+
+	FORCEINLINE FFixedBox operator+(const FFixedVector64& Other) const
+	{
+		return FFixedBox(*this) += Other;
+	}
+
+	/**
+	 * Adds to this bounding box to include a new bounding volume.
+	 *
+	 * @param Other the bounding volume to increase the bounding volume to.
+	 * @return Reference to this bounding volume after resizing to include the other bounding volume.
+	 */
+	FORCEINLINE FFixedBox& operator+=(const FFixedBox& Other)
+	{
+		if (IsValid && Other.IsValid)
+		{
+			Min = Min.ComponentMin(Other.Min);
+			Max = Max.ComponentMax(Other.Max);
+		}
+		else if (Other.IsValid)
+		{
+			*this = Other;
+		}
+		return *this;
+	}
+
+	FORCEINLINE FFixedBox operator+(const FFixedBox& Other) const
+	{
+		return FFixedBox(*this) += Other;
+	}
+
+	/**
+	 * Calculates the distance of a point to this box.
+	 *
+	 * @param Point The point.
+	 * @return The distance squared, zero for points inside the box.
+	 */
+	FORCEINLINE FFixed64 ComputeSquaredDistanceToPoint(const FFixedVector64& Point) const
+	{
+		return ComputeSquaredDistanceFromBoxToPoint(Min, Max, Point);
+	}
+
+	/**
+	 * Returns a box of increased size.
+	 *
+	 * @param W The size to increase the volume by.
+	 * @return A new bounding box.
+	 */
+	FORCEINLINE FFixedBox ExpandBy(FFixed64 W) const
+	{
+		return FFixedBox(Min - FFixedVector64(W), Max + FFixedVector64(W));
+	}
+
+	/**
+	 * Returns a box of increased size.
+	 *
+	 * @param V The size to increase the volume by.
+	 * @return A new bounding box.
+	 */
+	FORCEINLINE FFixedBox ExpandBy(const FFixedVector64& V) const
+	{
+		return FFixedBox(Min - V, Max + V);
+	}
+
+	/**
+	 * Returns a box of increased size.
+	 *
+	 * @param Neg The size to increase the volume by in the negative direction (positive values move the bounds outwards)
+	 * @param Pos The size to increase the volume by in the positive direction (positive values move the bounds outwards)
+	 * @return A new bounding box.
+	 */
+	FORCEINLINE FFixedBox ExpandBy(const FFixedVector64& Neg, const FFixedVector64& Pos) const
+	{
+		return FFixedBox(Min - Neg, Max + Pos);
+	}
+
+	/**
+	 * Returns a box with its position shifted.
+	 *
+	 * @param Offset The vector to shift the box by.
+	 * @return A new bounding box.
+	 */
+	FORCEINLINE FFixedBox ShiftBy(const FFixedVector64& Offset) const
+	{
+		return FFixedBox(Min + Offset, Max + Offset);
+	}
+
+	/**
+	 * Returns a box with its center moved to the new destination.
+	 *
+	 * @param Destination The destination point to move center of box to.
+	 * @return A new bounding box.
+	 */
+	FORCEINLINE FFixedBox MoveTo(const FFixedVector64& Destination) const
+	{
+		const FFixedVector64 Offset = Destination - GetCenter();
+		return FFixedBox(Min + Offset, Max + Offset);
+	}
+
+	/**
+	 * Gets the center point of this box.
+	 *
+	 * @return The center point.
+	 */
+	FORCEINLINE FFixedVector64 GetCenter() const
+	{
+		return FFixedVector64((Min + Max) * FixedPoint::Constants::Fixed64::Half);
+	}
+
+	/**
+	 * Gets the center and extents of this box.
+	 *
+	 * @param Center [out] Will contain the box center point.
+	 * @param Extents [out] Will contain the extent around the center.
+	 */
+	FORCEINLINE void GetCenterAndExtents(FFixedVector64& Center, FFixedVector64& Extents) const
+	{
+		Extents = GetExtent();
+		Center = GetCenter();
+	}
+
+	/**
+	 * Calculates the closest point on or inside the box to a given point in space.
+	 *
+	 * @param Point The point in space.
+	 * @return The closest point on or inside the box.
+	 */
+	FORCEINLINE FFixedVector64 GetClosestPointTo(const FFixedVector64& Point) const
+	{
+		return Point.BoundToBox(Min, Max);
+	}
+
+	/**
+	 * Gets the extents of this box.
+	 *
+	 * @return The box extents.
+	 */
+	FORCEINLINE FFixedVector64 GetExtent() const
+	{
+		return FFixedVector64((Max - Min) * FixedPoint::Constants::Fixed64::Half);
+	}
+
+	/**
+	 * Gets the size of this box.
+	 *
+	 * @return The box size.
+	 */
+	FORCEINLINE FFixedVector64 GetSize() const
+	{
+		return Max - Min;
+	}
+
+	/**
+	 * Gets the volume of this box.
+	 *
+	 * @return The box volume.
+	 */
+	FORCEINLINE FFixed64 GetVolume() const
+	{
+		return (Max.X - Min.X) * (Max.Y - Min.Y) * (Max.Z - Min.Z);
+	}
+
+	/**
+	 * Checks whether the given bounding box intersects this bounding box, touching boxes intersect.
+	 *
+	 * @param Other The bounding box to intersect with.
+	 * @return true if the boxes intersect, false otherwise.
+	 */
+	FORCEINLINE bool Intersect(const FFixedBox& Other) const
+	{
+		if ((Min.X > Other.Max.X) || (Other.Min.X > Max.X))
+		{
+			return false;
+		}
+
+		if ((Min.Y > Other.Max.Y) || (Other.Min.Y > Max.Y))
+		{
+			return false;
+		}
+
+		if ((Min.Z > Other.Max.Z) || (Other.Min.Z > Max.Z))
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Checks whether the given bounding box intersects this bounding box in the XY plane.
+	 *
+	 * @param Other The bounding box to test intersection.
+	 * @return true if the boxes intersect in the XY Plane, false otherwise.
+	 */
+	FORCEINLINE bool IntersectXY(const FFixedBox& Other) const
+	{
+		if ((Min.X > Other.Max.X) || (Other.Min.X > Max.X))
+		{
+			return false;
+		}
+
+		if ((Min.Y > Other.Max.Y) || (Other.Min.Y > Max.Y))
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Returns the overlap FFixedBox of two boxes
+	 *
+	 * @param Other The bounding box to test overlap
+	 * @return the overlap box. It can be 0 if they don't overlap
+	 */
+	FORCEINLINE FFixedBox Overlap(const FFixedBox& Other) const
+	{
+		if (Intersect(Other) == false)
+		{
+			return FFixedBox(ForceInit);
+		}
+
+		return FFixedBox(Min.ComponentMax(Other.Min), Max.ComponentMin(Other.Max));
+	}
+
+	/**
+	 * Checks whether the given location is inside this box, points on the surface are outside.
+	 *
+	 * @param In The location to test for inside the bounding volume.
+	 * @return true if location is inside this volume.
+	 */
+	FORCEINLINE bool IsInside(const FFixedVector64& In) const
+	{
+		return ((In.X > Min.X) && (In.X < Max.X) && (In.Y > Min.Y) && (In.Y < Max.Y) && (In.Z > Min.Z) && (In.Z < Max.Z));
+	}
+
+	/**
+	 * Checks whether the given location is inside or on this box.
+	 *
+	 * @param In The location to test for inside the bounding volume.
+	 * @return true if location is inside this volume.
+	 */
+	FORCEINLINE bool IsInsideOrOn(const FFixedVector64& In) const
+	{
+		return ((In.X >= Min.X) && (In.X <= Max.X) && (In.Y >= Min.Y) && (In.Y <= Max.Y) && (In.Z >= Min.Z) && (In.Z <= Max.Z));
+	}
+
+	/**
+	 * Checks whether a given box is fully encapsulated by this box.
+	 *
+	 * @param Other The box to test for encapsulation within the bounding volume.
+	 * @return true if box is inside this volume.
+	 */
+	FORCEINLINE bool IsInside(const FFixedBox& Other) const
+	{
+		return (IsInside(Other.Min) && IsInside(Other.Max));
+	}
+
+	/**
+	 * Checks whether a given box is fully encapsulated by this box, sharing faces is allowed.
+	 *
+	 * @param Other The box to test for encapsulation within the bounding volume.
+	 * @return true if box is inside this volume or on its surface.
+	 */
+	FORCEINLINE bool IsInsideOrOn(const FFixedBox& Other) const
+	{
+		return (IsInsideOrOn(Other.Min) && IsInsideOrOn(Other.Max));
+	}
+
+	/**
+	 * Gets a bounding volume transformed by an affine matrix.
+	 * Each bound is accumulated at 128 bits and rounded outwards once, so the result contains every transformed corner.
+	 *
+	 * @param M The matrix to transform by.
+	 * @return The transformed box.
+	 */
+	FORCEINLINE FFixedBox TransformBy(const FFixedMatrix34& M) const;
+
+	/**
+	 * Gets a bounding volume transformed by a matrix, the last column of M is assumed to be 0,0,0,1.
+	 *
+	 * @param M The matrix to transform by.
+	 * @return The transformed box.
+	 */
+	FORCEINLINE FFixedBox TransformBy(const FFixedMatrix& M) const;
+
+	/**
+	 * Gets a bounding volume transformed by a FFixedTransform64, using the same matrix as ToMatrixWithScale.
+	 *
+	 * @param M The transform to transform by.
+	 * @return The transformed box.
+	 */
+	FORCEINLINE FFixedBox TransformBy(const FFixedTransform64& M) const;
+
+	/**
+	 * Gets a bounding volume transformed by the inverse of a FFixedTransform64.
+	 *
+	 * @param M The transformation object to perform the inversely transform this box with.
+	 * @return The transformed box.
+	 */
+	FORCEINLINE FFixedBox InverseTransformBy(const FFixedTransform64& M) const;
+
+	/**
+	 * Utility function to build an AABB from Origin and Extent
+	 *
+	 * @param Origin The location of the bounding box.
+	 * @param Extent Half size of the bounding box.
+	 * @return A new axis-aligned bounding box.
+	 */
+	static FORCEINLINE FFixedBox BuildAABB(const FFixedVector64& Origin, const FFixedVector64& Extent)
+	{
+		return FFixedBox(Origin - Extent, Origin + Extent);
+	}
+};
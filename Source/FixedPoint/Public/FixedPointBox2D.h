@@ -0,0 +1,341 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointMath.h"
+#include "FixedPointVector2D.h"
+#include "FixedPointBox2D.generated.h"
+
+/**
+* FFixedBox2D
+* Axis aligned 2D bounding box, the deterministic counterpart of FBox2D.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedBox2D
+{
+public:
+	GENERATED_BODY()
+
+	/** Holds the box's minimum point. */
+	UPROPERTY(EditAnywhere)
+	FFixedVector2d Min;
+
+	/** Holds the box's maximum point. */
+	UPROPERTY(EditAnywhere)
+	FFixedVector2d Max;
+
+	/** Holds a flag indicating whether this box is valid. */
+	UPROPERTY(EditAnywhere)
+	bool bIsValid;
+
+	/** Default constructor (no initialization). */
+	FORCEINLINE FFixedBox2D() {}
+
+	/**
+	 * Creates and initializes a new box with zero extent and marks it as invalid.
+	 *
+	 * @param EForceInit Force Init Enum.
+	 */
+	explicit FORCEINLINE FFixedBox2D(EForceInit)
+		: Min(FixedPoint::Constants::Fixed64::Zero), Max(FixedPoint::Constants::Fixed64::Zero), bIsValid(false)
+	{
+	}
+
+	/**
+	 * Creates and initializes a new box from the specified parameters.
+	 *
+	 * @param InMin The box's minimum point.
+	 * @param InMax The box's maximum point.
+	 */
+	FORCEINLINE FFixedBox2D(const FFixedVector2d& InMin, const FFixedVector2d& InMax)
+		: Min(InMin), Max(InMax), bIsValid(true)
+	{
+	}
+
+	/**
+	 * Creates and initializes a new box from the given set of points.
+	 *
+	 * @param Points Array of points to create for the bounding volume.
+	 */
+	explicit FFixedBox2D(TArrayView<const FFixedVector2d> Points)
+		: FFixedBox2D(ForceInit)
+	{
+		for (const FFixedVector2d& Point : Points)
+		{
+			*this += Point;
+		}
+	}
+
+	/**
+	 * Compares two boxes for equality.
+	 *
+	 * @return true if the boxes are equal, false otherwise.
+	 */
+	FORCEINLINE bool operator==(const FFixedBox2D& Other) const
+	{
+		return (Min == Other.Min) && (Max == Other.Max);
+	}
+
+	FORCEINLINE bool operator!=(const FFixedBox2D& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	/**
+	 * Adds to this bounding box to include a given point.
+	 *
+	 * @param Other The point to increase the bounding volume to.
+	 * @return Reference to this bounding box after resizing to include the other point.
+	 */
+	FORCEINLINE FFixedBox2D& operator+=(const FFixedVector2d& Other)
+	{
+		if (bIsValid)
+		{
+			Min.X = FFixedPointMath::Min(Min.X, Other.X);
+			Min.Y = FFixedPointMath::Min(Min.Y, Other.Y);
+			Max.X = FFixedPointMath::Max(Max.X, Other.X);
+			Max.Y = FFixedPointMath::Max(Max.Y, Other.Y);
+		}
+		else
+		{
+			Min = Max = Other;
+			bIsValid = true;
+		}
+		return *this;
+	}
+
+	FORCEINLINE FFixedBox2D operator+(const FFixedVector2d& Other) const
+	{
+		return FFixedBox2D(*this) += Other;
+	}
+
+	/**
+	 * Adds to this bounding box to include a new bounding volume.
+	 *
+	 * @param Other The bounding volume to increase the bounding volume to.
+	 * @return Reference to this bounding volume after resizing to include the other bounding volume.
+	 */
+	FORCEINLINE FFixedBox2D& operator+=(const FFixedBox2D& Other)
+	{
+		if (bIsValid && Other.bIsValid)
+		{
+			Min.X = FFixedPointMath::Min(Min.X, Other.Min.X);
+			Min.Y = FFixedPointMath::Min(Min.Y, Other.Min.Y);
+			Max.X = FFixedPointMath::Max(Max.X, Other.Max.X);
+			Max.Y = FFixedPointMath::Max(Max.Y, Other.Max.Y);
+		}
+		else if (Other.bIsValid)
+		{
+			*this = Other;
+		}
+		return *this;
+	}
+
+	FORCEINLINE FFixedBox2D operator+(const FFixedBox2D& Other) const
+	{
+		return FFixedBox2D(*this) += Other;
+	}
+
+	/**
+	 * Calculates the distance of a point to this box.
+	 *
+	 * @param Point The point.
+	 * @return The distance squared, zero for points inside the box.
+	 */
+	FORCEINLINE FFixed64 ComputeSquaredDistanceToPoint(const FFixedVector2d& Point) const
+	{
+		FFixed64 DistSquared = FixedPoint::Constants::Fixed64::Zero;
+
+		if (Point.X < Min.X)
+		{
+			DistSquared += FFixedPointMath::Square(Point.X - Min.X);
+		}
+		else if (Point.X > Max.X)
+		{
+			DistSquared += FFixedPointMath::Square(Point.X - Max.X);
+		}
+
+		if (Point.Y < Min.Y)
+		{
+			DistSquared += FFixedPointMath::Square(Point.Y - Min.Y);
+		}
+		else if (Point.Y > Max.Y)
+		{
+			DistSquared += FFixedPointMath::Square(Point.Y - Max.Y);
+		}
+
+		return DistSquared;
+	}
+
+	/**
+	 * Increase the bounding box volume.
+	 *
+	 * @param W The size to increase the volume by.
+	 * @return A new bounding box increased in size.
+	 */
+	FORCEINLINE FFixedBox2D ExpandBy(FFixed64 W) const
+	{
+		return FFixedBox2D(Min - FFixedVector2d(W), Max + FFixedVector2d(W));
+	}
+
+	/**
+	 * Shift bounding box position.
+	 *
+	 * @param Offset The vector to shift the box by.
+	 * @return A new shifted bounding box.
+	 */
+	FORCEINLINE FFixedBox2D ShiftBy(const FFixedVector2d& Offset) const
+	{
+		return FFixedBox2D(Min + Offset, Max + Offset);
+	}
+
+	/**
+	 * Gets the box area.
+	 *
+	 * @return Box area.
+	 */
+	FORCEINLINE FFixed64 GetArea() const
+	{
+		return (Max.X - Min.X) * (Max.Y - Min.Y);
+	}
+
+	/**
+	 * Gets the box's center point.
+	 *
+	 * @return The center point.
+	 */
+	FORCEINLINE FFixedVector2d GetCenter() const
+	{
+		return (Min + Max) * FixedPoint::Constants::Fixed64::Half;
+	}
+
+	/**
+	 * Get the center and extents
+	 *
+	 * @param center[out] reference to center point
+	 * @param Extents[out] reference to the extent around the center
+	 */
+	FORCEINLINE void GetCenterAndExtents(FFixedVector2d& Center, FFixedVector2d& Extents) const
+	{
+		Extents = GetExtent();
+		Center = GetCenter();
+	}
+
+	/**
+	 * Calculates the closest point on or inside the box to a given point in space.
+	 *
+	 * @param Point The point in space.
+	 * @return The closest point on or inside the box.
+	 */
+	FORCEINLINE FFixedVector2d GetClosestPointTo(const FFixedVector2d& Point) const
+	{
+		return FFixedVector2d(FFixedPointMath::Clamp(Point.X, Min.X, Max.X), FFixedPointMath::Clamp(Point.Y, Min.Y, Max.Y));
+	}
+
+	/**
+	 * Gets the box extents around the center.
+	 *
+	 * @return Box extents.
+	 */
+	FORCEINLINE FFixedVector2d GetExtent() const
+	{
+		return (Max - Min) * FixedPoint::Constants::Fixed64::Half;
+	}
+
+	/**
+	 * Gets the box size.
+	 *
+	 * @return Box size.
+	 */
+	FORCEINLINE FFixedVector2d GetSize() const
+	{
+		return Max - Min;
+	}
+
+	/**
+	 * Checks whether the given box intersects this box, touching boxes intersect.
+	 *
+	 * @param Other bounding box to test intersection
+	 * @return true if boxes intersect, false otherwise.
+	 */
+	FORCEINLINE bool Intersect(const FFixedBox2D& Other) const
+	{
+		if ((Min.X > Other.Max.X) || (Other.Min.X > Max.X))
+		{
+			return false;
+		}
+
+		if ((Min.Y > Other.Max.Y) || (Other.Min.Y > Max.Y))
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Returns the overlap FFixedBox2D of two boxes
+	 *
+	 * @param Other The bounding box to test overlap
+	 * @return the overlap box. It can be 0 if they don't overlap
+	 */
+	FORCEINLINE FFixedBox2D Overlap(const FFixedBox2D& Other) const
+	{
+		if (Intersect(Other) == false)
+		{
+			return FFixedBox2D(ForceInit);
+		}
+
+		return FFixedBox2D(
+			FFixedVector2d(FFixedPointMath::Max(Min.X, Other.Min.X), FFixedPointMath::Max(Min.Y, Other.Min.Y)),
+			FFixedVector2d(FFixedPointMath::Min(Max.X, Other.Max.X), FFixedPointMath::Min(Max.Y, Other.Max.Y)));
+	}
+
+	/**
+	 * Checks whether the given point is inside this box, points on the edges are outside.
+	 *
+	 * @param TestPoint The point to test.
+	 * @return true if the point is inside this box, otherwise false.
+	 */
+	FORCEINLINE bool IsInside(const FFixedVector2d& TestPoint) const
+	{
+		return ((TestPoint.X > Min.X) && (TestPoint.X < Max.X) && (TestPoint.Y > Min.Y) && (TestPoint.Y < Max.Y));
+	}
+
+	/**
+	 * Checks whether the given point is inside or on this box.
+	 *
+	 * @param TestPoint The point to test.
+	 * @return true if the point is inside or on this box, otherwise false.
+	 */
+	FORCEINLINE bool IsInsideOrOn(const FFixedVector2d& TestPoint) const
+	{
+		return ((TestPoint.X >= Min.X) && (TestPoint.X <= Max.X) && (TestPoint.Y >= Min.Y) && (TestPoint.Y <= Max.Y));
+	}
+
+	/**
+	 * Checks whether the given box is fully encapsulated by this box.
+	 *
+	 * @param Other The box to test for encapsulation within the bounding volume.
+	 * @return true if box is inside this volume, false otherwise.
+	 */
+	FORCEINLINE bool IsInside(const FFixedBox2D& Other) const
+	{
+		return (IsInside(Other.Min) && IsInside(Other.Max));
+	}
+
+	/**
+	 * Utility function to build an AABB from Origin and Extent
+	 *
+	 * @param Origin The location of the bounding box.
+	 * @param Extent Half size of the bounding box.
+	 * @return A new axis-aligned bounding box.
+	 */
+	static FORCEINLINE FFixedBox2D BuildAABB(const FFixedVector2d& Origin, const FFixedVector2d& Extent)
+	{
+		return FFixedBox2D(Origin - Extent, Origin + Extent);
+	}
+};
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointPlane.h"
+
+/**
+* FFixedConvexHull
+* Convex hull of a FFixedVector64 point set built with quickhull.
+*
+* Every decision is an exact 128 bit orientation test on the raw coordinates, so there are no epsilons and the same
+* points give the same hull byte for byte on every machine. Coplanar triangles are merged into one polygon face and
+* points on an edge or face of the hull are not vertices. Differences between coordinates must stay within 2^40 raw,
+* about a million units.
+*
+* Vertices can be passed to FFixedConvexShape::MakeHull for FFixedGJK queries.
+*/
+struct FIXEDPOINT_API FFixedConvexHull
+{
+public:
+	/** Hull corners, a subset of the input points in the order the faces first use them */
+	TArray<FFixedVector64> Vertices;
+
+	/** Every face's indices into Vertices, counter clockwise seen from outside */
+	TArray<int32> FaceIndices;
+
+	/** First entry in FaceIndices of each face */
+	TArray<int32> FaceStarts;
+
+	/** Outward plane of each face, pushed out so none of the face's own vertices is in front of it after rounding */
+	TArray<FFixedPlane> Planes;
+
+	FORCEINLINE int32 NumFaces() const
+	{
+		return FaceStarts.Num();
+	}
+
+	FORCEINLINE TArrayView<const int32> GetFace(int32 Index) const
+	{
+		const int32 Start = FaceStarts[Index];
+		const int32 End = Index + 1 < FaceStarts.Num() ? FaceStarts[Index + 1] : FaceIndices.Num();
+		return TArrayView<const int32>(FaceIndices.GetData() + Start, End - Start);
+	}
+
+	/** Removes the hull, keeping the memory */
+	void Reset();
+
+	/**
+	* Rebuilds the hull around Points.
+	* @return false, leaving the hull empty, when the points are all coplanar so they have no volume
+	*/
+	bool Build(TArrayView<const FFixedVector64> Points);
+
+	/** @return true if P is inside or on the hull, tested exactly against each face */
+	bool IsPointInside(const FFixedVector64& P) const;
+
+	/**
+	* Builds one hull per point set, each the same as Build gives.
+	* @param bParallel - Build the hulls across task threads with ParallelFor
+	*/
+	static void BuildAll(TArrayView<const TArrayView<const FFixedVector64>> PointSets, TArray<FFixedConvexHull>& OutHulls, bool bParallel = false);
+};
@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointPlane.h"
+#include "FixedPointBox.h"
+#include "FixedPointSphere.h"
+#include "FixedPointSoA.h"
+
+/**
+* FFixedConvexVolume
+* Convex volume bounded by planes that face outward, a point is inside when it is on or behind every plane.
+* Fixed point counterpart of FConvexVolume for deterministic visibility and relevancy culling.
+*
+* The planes are kept as an array of structs for editing and copied to a FFixedPlaneSoA by Init, which the culling
+* functions stream one plane at a time over blocks of 64 objects, dropping out of a block once every object in it is
+* culled. Batch results match the single object tests exactly and do not depend on bParallel.
+*/
+struct FIXEDPOINT_API FFixedConvexVolume
+{
+public:
+	FFixedConvexVolume() {}
+
+	FFixedConvexVolume(TArrayView<const FFixedPlane> InPlanes);
+
+	/**
+	* Builds a view frustum, five planes when FarDistance is zero and six otherwise.
+	*
+	* @param Origin - Eye position
+	* @param Rotation - View rotation, X is forward, Y is right and Z is up
+	* @param HalfFOVDegrees - Half the horizontal field of view
+	* @param AspectRatio - Width over height
+	* @param NearDistance - Distance of the near plane along the view direction
+	* @param FarDistance - Distance of the far plane along the view direction, zero for none
+	*/
+	static FFixedConvexVolume MakeFrustum(const FFixedVector64& Origin, const FFixedRotator64& Rotation, FFixed64 HalfFOVDegrees, FFixed64 AspectRatio, FFixed64 NearDistance, FFixed64 FarDistance);
+
+	/** Rebuilds the plane SoA, call after changing Planes */
+	void Init();
+
+	/** @return the number of 64 bit words a visibility mask for Count objects needs */
+	static FORCEINLINE int32 GetNumMaskWords(int32 Count)
+	{
+		return (Count + 63) / 64;
+	}
+
+	/** @return true if Point is on or behind every plane */
+	bool IntersectPoint(const FFixedVector64& Point) const;
+
+	/** @return true if no plane has the sphere entirely in front of it, see FConvexVolume::IntersectSphere */
+	bool IntersectSphere(const FFixedVector64& Origin, FFixed64 Radius) const;
+
+	FORCEINLINE bool IntersectSphere(const FFixedSphere& Sphere) const
+	{
+		return IntersectSphere(Sphere.Center, Sphere.W);
+	}
+
+	/**
+	* @return true if no plane has all eight corners of the box in front of it.
+	* Only the corner furthest behind each plane is tested, each truncated product is monotonic in its coordinate
+	* so that corner also has the lowest computed PlaneDot of the eight.
+	*/
+	bool IntersectBox(const FFixedBox& Box) const;
+
+	/**
+	* Culls every sphere, bit i % 64 of word i / 64 is IntersectSphere(Spheres.Get(i)).
+	*
+	* @param OutVisibleMask - Must be GetNumMaskWords(Spheres.Num()) long, bits past the last sphere are cleared
+	* @param bParallel - Split the spheres across task threads with ParallelFor
+	*/
+	void CullSpheres(const FFixedSphereSoA& Spheres, TArrayView<uint64> OutVisibleMask, bool bParallel = false) const;
+
+	/**
+	* Culls every sphere, see CullSpheres.
+	*
+	* @param OutVisible - Indices of the visible spheres are appended in ascending order
+	* @return the number of indices appended
+	*/
+	int32 CullSpheres(const FFixedSphereSoA& Spheres, TArray<int32>& OutVisible, bool bParallel = false) const;
+
+	/**
+	* Culls every box, bit i % 64 of word i / 64 is IntersectBox(Boxes.Get(i)).
+	*
+	* @param OutVisibleMask - Must be GetNumMaskWords(Boxes.Num()) long, bits past the last box are cleared
+	* @param bParallel - Split the boxes across task threads with ParallelFor
+	*/
+	void CullBoxes(const FFixedBoxSoA& Boxes, TArrayView<uint64> OutVisibleMask, bool bParallel = false) const;
+
+	/**
+	* Culls every box, see CullBoxes.
+	*
+	* @param OutVisible - Indices of the visible boxes are appended in ascending order
+	* @return the number of indices appended
+	*/
+	int32 CullBoxes(const FFixedBoxSoA& Boxes, TArray<int32>& OutVisible, bool bParallel = false) const;
+
+	/** Outward facing planes, call Init after changing them */
+	TArray<FFixedPlane> Planes;
+
+private:
+	FFixedPlaneSoA PlaneSoA;
+};
@@ -0,0 +1,201 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointMath.h"
+#include "FixedPointVector.h"
+#include "FixedPointQuat.h"
+#include "FixedPointTransform.h"
+#include "FixedPointInt128.h"
+#include "FixedPointDualQuat.generated.h"
+
+/**
+* FFixedDualQuat64
+* Rigid transform with uniform scale as a unit dual quaternion, Real is the rotation and Dual is half the translation times the rotation.
+* Blending dual quaternions linearly and renormalizing keeps the result rigid, so skinned joints don't collapse the way blended matrices do.
+* Same order as FFixedTransform64, a position is scaled, then rotated, then translated.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedDualQuat64
+{
+public:
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere)
+	FFixedQuat64 Real;
+
+	UPROPERTY(EditAnywhere)
+	FFixedQuat64 Dual;
+
+	UPROPERTY(EditAnywhere)
+	FFixed64 Scale;
+
+	static const FFixedDualQuat64 Identity;
+
+	/**
+	* Default constructor, no initialization
+	*/
+	FORCEINLINE FFixedDualQuat64() {}
+
+	/**
+	 * Constructor.
+	 *
+	 * @param InRotation Rotation, should be normalized
+	 * @param InTranslation Translation
+	 * @param InScale Uniform scale
+	 */
+	FORCEINLINE FFixedDualQuat64(const FFixedQuat64& InRotation, const FFixedVector64& InTranslation, FFixed64 InScale = FixedPoint::Constants::Fixed64::One)
+		: Real(InRotation)
+		, Dual(FFixedQuat64(InTranslation.X, InTranslation.Y, InTranslation.Z, FixedPoint::Constants::Fixed64::Zero) * InRotation * FixedPoint::Constants::Fixed64::Half)
+		, Scale(InScale)
+	{
+	}
+
+	/**
+	* Constructor from a transform, which should have a uniform scale, only Scale3D.X is kept
+	*/
+	explicit FORCEINLINE FFixedDualQuat64(const FFixedTransform64& InTransform)
+		: FFixedDualQuat64(InTransform.GetRotation(), InTransform.GetTranslation(), InTransform.GetScale3D().X)
+	{
+		checkSlow(InTransform.GetScale3D().AllComponentsEqual());
+	}
+
+	/** @return the rotation part */
+	FORCEINLINE FFixedQuat64 GetRotation() const
+	{
+		return Real;
+	}
+
+	/** @return the translation, 2 * Dual * conjugate(Real) */
+	FORCEINLINE FFixedVector64 GetTranslation() const
+	{
+		const FFixedVector64 RealVector(Real.X, Real.Y, Real.Z);
+		const FFixedVector64 DualVector(Dual.X, Dual.Y, Dual.Z);
+		const FFixedVector64 HalfTranslation = DualVector * Real.W - RealVector * Dual.W + FFixedVector64::CrossProduct(RealVector, DualVector);
+		return HalfTranslation + HalfTranslation;
+	}
+
+	FORCEINLINE FFixedTransform64 ToTransform() const
+	{
+		return FFixedTransform64(Real, GetTranslation(), FFixedVector64(Scale));
+	}
+
+	/**
+	 * Create a new dual quaternion: OutDualQuat = A * B, which first applies A then B, the same order as FFixedTransform64::Multiply.
+	 * The translation of A is scaled by the scale of B before the two are joined.
+	 */
+	FORCEINLINE static void Multiply(FFixedDualQuat64* OutDualQuat, const FFixedDualQuat64* A, const FFixedDualQuat64* B)
+	{
+		const FFixedQuat64 ScaledDual = A->Dual * B->Scale;
+		const FFixedQuat64 NewReal = B->Real * A->Real;
+		const FFixedQuat64 NewDual = B->Real * ScaledDual + B->Dual * A->Real;
+		OutDualQuat->Real = NewReal;
+		OutDualQuat->Dual = NewDual;
+		OutDualQuat->Scale = A->Scale * B->Scale;
+	}
+
+	FORCEINLINE FFixedDualQuat64 operator*(const FFixedDualQuat64& Other) const
+	{
+		FFixedDualQuat64 Output;
+		Multiply(&Output, this, &Other);
+		return Output;
+	}
+
+	FORCEINLINE FFixedDualQuat64& operator*=(const FFixedDualQuat64& Other)
+	{
+		Multiply(this, this, &Other);
+		return *this;
+	}
+
+	/**
+	 * Makes Real unit length and Dual orthogonal to it, needed after blending.
+	 * If Real is too small, sets this to Identity.
+	 *
+	 * @param Tolerance Minimum squared length of Real for normalization.
+	 */
+	FORCEINLINE void Normalize(FFixed64 Tolerance = FixedPoint::Constants::Fixed64::SmallNumber)
+	{
+		using namespace FixedPoint::Int128;
+		const FInt128 SquareSum = Add(Add(Mul(Real.X.Value, Real.X.Value), Mul(Real.Y.Value, Real.Y.Value)), Add(Mul(Real.Z.Value, Real.Z.Value), Mul(Real.W.Value, Real.W.Value)));
+		if (Compare(SquareSum, Mul(Tolerance.Value, FixedPoint::Constants::Raw64::One)) < 0)
+		{
+			*this = Identity;
+			return;
+		}
+		// InvSqrt is only good to about 1e-3, so the length comes from an exact integer square root with 40 fraction bits
+		// and each component is divided by it once
+		constexpr int64 LengthOne = FixedPoint::Constants::Raw64::One * FixedPoint::Constants::Raw64::One;
+		const int64 Length = SqrtFloor(MulWide(SquareSum, LengthOne));
+		auto DivideByLength = [Length](FFixed64& Component)
+		{
+			Component.Value = DivideTruncate(Mul(Component.Value, LengthOne), Length);
+		};
+		DivideByLength(Real.X);
+		DivideByLength(Real.Y);
+		DivideByLength(Real.Z);
+		DivideByLength(Real.W);
+		DivideByLength(Dual.X);
+		DivideByLength(Dual.Y);
+		DivideByLength(Dual.Z);
+		DivideByLength(Dual.W);
+		Dual -= Real * (Real | Dual);
+	}
+
+	FORCEINLINE FFixedDualQuat64 GetNormalized(FFixed64 Tolerance = FixedPoint::Constants::Fixed64::SmallNumber) const
+	{
+		FFixedDualQuat64 Result(*this);
+		Result.Normalize(Tolerance);
+		return Result;
+	}
+
+	/** Transform a position, scaled, rotated, then translated */
+	FORCEINLINE FFixedVector64 TransformPosition(const FFixedVector64& V) const
+	{
+		return Real.RotateVector(V * Scale) + GetTranslation();
+	}
+
+	/** Transform a direction vector, scaled and rotated but not translated */
+	FORCEINLINE FFixedVector64 TransformVector(const FFixedVector64& V) const
+	{
+		return Real.RotateVector(V * Scale);
+	}
+
+	FORCEINLINE bool Equals(const FFixedDualQuat64& Other, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		return Real.Equals(Other.Real, Tolerance) && Dual.Equals(Other.Dual, Tolerance) && FFixedPointMath::Abs(Scale - Other.Scale) <= Tolerance;
+	}
+
+	/**
+	 * Weighted blend of dual quaternions, normalized.
+	 * Each input is flipped onto the same hemisphere as the first before it is added, so the blend takes the shortest path.
+	 *
+	 * @param DualQuats - Inputs to blend
+	 * @param Weights - Weight of each input, should sum to one
+	 */
+	static FFixedDualQuat64 Blend(TArrayView<const FFixedDualQuat64> DualQuats, TArrayView<const FFixed64> Weights);
+
+	/**
+	 * Weighted blends for skinning or pose blending, OutDualQuats[i] blends InfluencesPerOutput inputs
+	 * DualQuats[Indices[i * InfluencesPerOutput + k]] by Weights[i * InfluencesPerOutput + k].
+	 * Results are bit identical to Blend.
+	 *
+	 * @param OutDualQuats - Receives the normalized blends
+	 * @param DualQuats - Inputs, such as the bones of a skeleton
+	 * @param Indices - Input index of each influence, OutDualQuats.Num() * InfluencesPerOutput entries
+	 * @param Weights - Weight of each influence, laid out like Indices
+	 * @param InfluencesPerOutput - Number of influences of each output
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	static void Blend(TArrayView<FFixedDualQuat64> OutDualQuats, TArrayView<const FFixedDualQuat64> DualQuats, TArrayView<const int32> Indices, TArrayView<const FFixed64> Weights, int32 InfluencesPerOutput, bool bParallel = false);
+
+	/**
+	 * Transforms an array of positions, each by its own dual quaternion, OutPositions[i] = DualQuats[i].TransformPosition(Positions[i]).
+	 *
+	 * @param OutPositions - Receives the transformed positions, must be the same length as Positions and DualQuats, may alias Positions
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	static void TransformPositions(TArrayView<const FFixedDualQuat64> DualQuats, TArrayView<const FFixedVector64> Positions, TArrayView<FFixedVector64> OutPositions, bool bParallel = false);
+};
@@ -15,4 +15,40 @@ struct FFixedQuatRotationMatrix;
 struct FFixedQuat64;
 struct FFixedPlane;
 struct FFixedRotator64;
-struct FFixedTransform64;
\ No newline at end of file
+struct FFixedTransform64;
+struct FFixed32Vector2SoA;
+struct FFixed32Vector3SoA;
+struct FFixedMatrix33;
+struct FFixedMatrix34;
+struct FFixedTransform64SoA;
+struct FFixedHierarchyLevels;
+struct FFixedDualQuat64;
+struct FFixedUnitVector;
+struct FFixedUnitQuat;
+struct FFixedRotationMatrix62;
+struct FFixedPlaneSoA;
+struct FFixedBox;
+struct FFixedBox2D;
+struct FFixedSphere;
+struct FFixedSphere2D;
+struct FFixedBoxSoA;
+struct FFixedSphereSoA;
+struct FFixedSpatialGrid;
+struct FFixedBVH;
+struct FFixedBVHHit;
+struct FFixedTriangleSoA;
+struct FFixedRayBatch;
+struct FFixedConvexVolume;
+struct FFixedPolygonArena;
+struct FFixedPolygonArena2D;
+struct FFixedConvexShape;
+struct FFixedGJKCache;
+struct FFixedGJKResult;
+struct FFixedGJK;
+struct FFixedConvexHull;
+struct FFixedSweep;
+struct FFixedSweepHit;
+struct FFixedTriangleMesh;
+struct FFixedSpatialKey;
+struct FFixedRadixSort;
+struct FFixedSweepAndPrune;
\ No newline at end of file
@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointQuat.h"
+#include "FixedPointBox.h"
+#include "FixedPointSphere.h"
+
+/**
+* Kind of FFixedConvexShape
+*/
+enum class EFixedConvexShape : uint8
+{
+	Sphere,
+	Box,
+	Capsule,
+	Hull
+};
+
+/**
+* FFixedConvexShape
+* Convex shape for FFixedGJK queries, a core point, segment, box or hull of points rounded by Radius.
+* Spheres are a rounded point and capsules a rounded segment. The queries run on the cores and add the radii
+* afterwards, so rounded shapes are exact and never need a normalized support direction.
+*
+* Hulls view their points rather than copying them, the points must outlive the shape.
+*/
+struct FIXEDPOINT_API FFixedConvexShape
+{
+public:
+	EFixedConvexShape Type = EFixedConvexShape::Sphere;
+
+	/** Sphere and box center, capsule start */
+	FFixedVector64 Center = FFixedVector64::ZeroVector;
+
+	/** Capsule end */
+	FFixedVector64 End = FFixedVector64::ZeroVector;
+
+	/** Box axes scaled by the half extents */
+	FFixedVector64 Axes[3];
+
+	/** Hull points in world space */
+	TArrayView<const FFixedVector64> Points;
+
+	/** Rounding added around the core */
+	FFixed64 Radius = FixedPoint::Constants::Fixed64::Zero;
+
+	static FFixedConvexShape MakeSphere(const FFixedVector64& InCenter, FFixed64 InRadius);
+
+	static FORCEINLINE FFixedConvexShape MakeSphere(const FFixedSphere& Sphere)
+	{
+		return MakeSphere(Sphere.Center, Sphere.W);
+	}
+
+	/** Box aligned to Rotation's axes */
+	static FFixedConvexShape MakeBox(const FFixedVector64& InCenter, const FFixedVector64& Extent, const FFixedQuat64& Rotation = FFixedQuat64::Identity);
+
+	static FORCEINLINE FFixedConvexShape MakeBox(const FFixedBox& Box)
+	{
+		return MakeBox(Box.GetCenter(), Box.GetExtent());
+	}
+
+	static FFixedConvexShape MakeCapsule(const FFixedVector64& Start, const FFixedVector64& InEnd, FFixed64 InRadius);
+
+	/** Convex hull of Points, which may include interior points, optionally rounded */
+	static FFixedConvexShape MakeHull(TArrayView<const FFixedVector64> InPoints, FFixed64 InRadius = FixedPoint::Constants::Fixed64::Zero);
+
+	/** @return the core's furthest point along Direction, which does not need to be normalized */
+	FFixedVector64 Support(const FFixedVector64& Direction) const;
+
+	/** @return a point inside the core, used to pick the first search direction */
+	FFixedVector64 GetCenter() const;
+};
+
+/**
+* Simplex kept between queries of the same pair.
+* GJK converges in a few iterations when started from the simplex it ended on last frame, so the directions that
+* found that simplex are stored and searched again for the shapes' new positions.
+*/
+struct FIXEDPOINT_API FFixedGJKCache
+{
+public:
+	FFixedVector64 Directions[4];
+
+	int32 NumDirections = 0;
+
+	FORCEINLINE void Reset()
+	{
+		NumDirections = 0;
+	}
+};
+
+/**
+* Result of a FFixedGJK query
+*/
+struct FIXEDPOINT_API FFixedGJKResult
+{
+public:
+	/** Closest point on A, or when overlapping the point of A deepest inside B */
+	FFixedVector64 PointA = FFixedVector64::ZeroVector;
+
+	/** Closest point on B, or when overlapping the point of B deepest inside A */
+	FFixedVector64 PointB = FFixedVector64::ZeroVector;
+
+	/** Unit direction from A towards B, moving B along it by -Distance separates overlapping shapes */
+	FFixedVector64 Normal = FFixedVector64::ZeroVector;
+
+	/** Gap between the shapes, negative penetration depth when they overlap */
+	FFixed64 Distance = FixedPoint::Constants::Fixed64::Zero;
+
+	/** GJK plus EPA iterations taken */
+	int32 Iterations = 0;
+};
+
+/**
+* FFixedGJK
+* Convex distance and penetration queries between FFixedConvexShapes.
+* GJK finds the closest points of the cores, and when the cores overlap EPA expands the final simplex to find the
+* penetration depth. Every simplex, polytope and horizon lives in fixed size arrays on the stack and both loops stop
+* at a fixed iteration cap, so a query never allocates and gives the same result on every machine.
+* Simplex sub-algorithm ratios and side tests use exact 128 bit products.
+*/
+struct FIXEDPOINT_API FFixedGJK
+{
+public:
+	/** GJK iterations before returning the best simplex found */
+	static constexpr int32 MaxIterations = 32;
+
+	/** EPA expansions before returning the best face found, also bounded by the polytope's fixed capacity */
+	static constexpr int32 MaxEPAIterations = 48;
+
+	/**
+	* @param Cache - Optional simplex from the last query of this pair, updated with this query's simplex
+	* @return true if the shapes touch or overlap, stopping as soon as a separating direction is found
+	*/
+	static bool Intersect(const FFixedConvexShape& A, const FFixedConvexShape& B, FFixedGJKCache* Cache = nullptr);
+
+	/**
+	* Closest points and distance. Overlapping shapes get their radii's overlap as a negative distance when only the
+	* rounding overlaps, and zero with no normal when the cores overlap, see ComputePenetration.
+	*
+	* @return true if the shapes are separated
+	*/
+	static bool ComputeDistance(const FFixedConvexShape& A, const FFixedConvexShape& B, FFixedGJKResult& OutResult, FFixedGJKCache* Cache = nullptr);
+
+	/**
+	* Closest points and distance when separated, otherwise the penetration depth, normal and deepest points.
+	*
+	* @return true if the shapes touch or overlap
+	*/
+	static bool ComputePenetration(const FFixedConvexShape& A, const FFixedConvexShape& B, FFixedGJKResult& OutResult, FFixedGJKCache* Cache = nullptr);
+};
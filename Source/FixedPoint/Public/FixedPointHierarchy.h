@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointTransform.h"
+#include "FixedPointMatrix.h"
+
+/**
+* FFixedHierarchyLevels
+* A parent index array sorted breadth first, so every node of a level only depends on nodes of earlier levels.
+* Build it once per skeleton or scene layout and reuse it every tick, nodes within a level can be processed in any order or in parallel.
+* Several hierarchies can be concatenated into one parent array, each root just has a parent of INDEX_NONE.
+*/
+struct FIXEDPOINT_API FFixedHierarchyLevels
+{
+	/** Node indices in level order, roots first */
+	TArray<int32> Order;
+
+	/** For each entry of Order, the position of its parent in Order, INDEX_NONE for roots */
+	TArray<int32> SortedParents;
+
+	/** Start of each level in Order, with one extra entry at the end holding Order.Num() */
+	TArray<int32> LevelStarts;
+
+	/**
+	* Sorts a hierarchy into levels.
+	*
+	* @param ParentIndices - Parent of each node, INDEX_NONE for roots
+	* @return false and leaves this empty if a parent index is out of range or the hierarchy has a cycle
+	*/
+	bool Build(TArrayView<const int32> ParentIndices);
+
+	FORCEINLINE void Reset()
+	{
+		Order.Reset();
+		SortedParents.Reset();
+		LevelStarts.Reset();
+	}
+
+	FORCEINLINE int32 Num() const
+	{
+		return Order.Num();
+	}
+
+	FORCEINLINE int32 NumLevels() const
+	{
+		return FMath::Max(LevelStarts.Num() - 1, 0);
+	}
+};
+
+/**
+* FFixedTransformHierarchy
+* Scene graph of local transforms with lazily cached world transforms, world inverses and world matrices.
+* Setting a local transform invalidates that node and everything below it, nothing is recomputed until it is asked for,
+* so static geometry pays for Multiply, Inverse and ToMatrixWithScale once rather than every tick.
+* A parent is always added before its children, so index order is also a valid update order.
+*/
+struct FIXEDPOINT_API FFixedTransformHierarchy
+{
+public:
+	/**
+	* Adds a node.
+	*
+	* @param LocalTransform - Transform relative to the parent
+	* @param Parent - Index of an existing node, or INDEX_NONE for a root
+	* @return index of the new node
+	*/
+	int32 AddNode(const FFixedTransform64& LocalTransform, int32 Parent = INDEX_NONE);
+
+	/** Sets the transform of a node relative to its parent, invalidating the caches of it and all of its descendants */
+	void SetLocalTransform(int32 Index, const FFixedTransform64& LocalTransform);
+
+	FORCEINLINE const FFixedTransform64& GetLocalTransform(int32 Index) const
+	{
+		return LocalTransforms[Index];
+	}
+
+	FORCEINLINE int32 GetParent(int32 Index) const
+	{
+		return Parents[Index];
+	}
+
+	FORCEINLINE int32 Num() const
+	{
+		return Parents.Num();
+	}
+
+	/** @return the transform of a node relative to its root, computed on first use after the node or an ancestor changed */
+	const FFixedTransform64& GetWorldTransform(int32 Index);
+
+	/** @return the inverse of GetWorldTransform, cached separately */
+	const FFixedTransform64& GetWorldInverse(int32 Index);
+
+	/** @return GetWorldTransform as a matrix from ToMatrixWithScale, cached separately */
+	const FFixedMatrix& GetWorldMatrix(int32 Index);
+
+	/** Computes every world transform that is out of date, in parent before child order */
+	void UpdateWorldTransforms();
+
+	/**
+	* Nodes whose world transform was invalidated since the last ResetChanged, each listed once, in no particular order.
+	* Use this to push only moved nodes to collision, rendering or networking.
+	*/
+	FORCEINLINE TArrayView<const int32> GetChangedNodes() const
+	{
+		return ChangedNodes;
+	}
+
+	FORCEINLINE bool WasChanged(int32 Index) const
+	{
+		return (Flags[Index] & Changed) != 0;
+	}
+
+	/** Clears the changed list, call once per tick after consumers have read it */
+	void ResetChanged();
+
+	void Reserve(int32 Number);
+
+	void Reset();
+
+private:
+	enum : uint8
+	{
+		WorldValid = 1 << 0,
+		InverseValid = 1 << 1,
+		MatrixValid = 1 << 2,
+		Changed = 1 << 3,
+	};
+
+	/** Invalidates a node and its descendants, stopping at subtrees that are already invalid */
+	void Invalidate(int32 Index);
+
+	TArray<int32> Parents;
+	TArray<int32> FirstChild;
+	TArray<int32> NextSibling;
+	TArray<uint8> Flags;
+	TArray<FFixedTransform64> LocalTransforms;
+	TArray<FFixedTransform64> WorldTransforms;
+	TArray<FFixedTransform64> WorldInverses;
+	TArray<FFixedMatrix> WorldMatrices;
+	TArray<int32> ChangedNodes;
+	TArray<int32> InvalidateStack;
+};
+
@@ -0,0 +1,307 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointNumbers.h"
+
+#if defined(_MSC_VER) && !defined(__clang__) && PLATFORM_64BITS
+#include <intrin.h>
+#endif
+
+namespace FixedPoint
+{
+	/**
+	* Lightweight signed 128 bit integer helpers for accumulating raw FFixed64 products.
+	* TBigInt is exact but loops over 32 bit words for every operation.
+	* These helpers use native 128 bit support where the compiler has it and 32 bit partial products otherwise,
+	* all paths give identical results.
+	*/
+	namespace Int128
+	{
+		struct FInt128
+		{
+			uint64 Lo;
+			int64 Hi;
+		};
+
+		FORCEINLINE FInt128 Make(int64 Value)
+		{
+			return FInt128{ (uint64)Value, Value >> 63 };
+		}
+
+		/**
+		* Full signed 64 x 64 -> 128 bit product
+		*/
+		FORCEINLINE FInt128 Mul(int64 A, int64 B)
+		{
+#if defined(__SIZEOF_INT128__)
+			const __int128 Product = (__int128)A * (__int128)B;
+			return FInt128{ (uint64)Product, (int64)(Product >> 64) };
+#elif defined(_MSC_VER) && PLATFORM_64BITS && PLATFORM_CPU_X86_FAMILY
+			int64 High;
+			const int64 Low = _mul128(A, B, &High);
+			return FInt128{ (uint64)Low, High };
+#else
+			const uint64 UA = (uint64)A;
+			const uint64 UB = (uint64)B;
+			const uint64 ALo = UA & 0xFFFFFFFFull;
+			const uint64 AHi = UA >> 32;
+			const uint64 BLo = UB & 0xFFFFFFFFull;
+			const uint64 BHi = UB >> 32;
+			const uint64 Lo = ALo * BLo;
+			const uint64 MidA = AHi * BLo;
+			const uint64 MidB = ALo * BHi;
+			const uint64 Carry = (Lo >> 32) + (MidA & 0xFFFFFFFFull) + (MidB & 0xFFFFFFFFull);
+			uint64 High = AHi * BHi + (MidA >> 32) + (MidB >> 32) + (Carry >> 32);
+			//unsigned product to signed, subtract the other operand from the high word for each negative operand
+			High -= A < 0 ? UB : 0;
+			High -= B < 0 ? UA : 0;
+			return FInt128{ (Lo & 0xFFFFFFFFull) | (Carry << 32), (int64)High };
+#endif
+		}
+
+		/**
+		* A * B keeping the low 128 bits, exact whenever the product fits in 128 bits.
+		* Used for 3x3 determinants, a 128 bit cross product term times a 64 bit coordinate.
+		*/
+		FORCEINLINE FInt128 MulWide(const FInt128& A, int64 B)
+		{
+			//the low word as unsigned is its signed value plus 2^64 when its top bit is set, which only reaches the high word
+			const FInt128 Low = Mul((int64)A.Lo, B);
+			const uint64 High = (uint64)Low.Hi + (uint64)A.Hi * (uint64)B + ((A.Lo >> 63) != 0 ? (uint64)B : 0);
+			return FInt128{ Low.Lo, (int64)High };
+		}
+
+		FORCEINLINE FInt128 Add(const FInt128& A, const FInt128& B)
+		{
+			const uint64 Lo = A.Lo + B.Lo;
+			return FInt128{ Lo, (int64)((uint64)A.Hi + (uint64)B.Hi + (Lo < A.Lo ? 1 : 0)) };
+		}
+
+		FORCEINLINE FInt128 Sub(const FInt128& A, const FInt128& B)
+		{
+			const uint64 Lo = A.Lo - B.Lo;
+			return FInt128{ Lo, (int64)((uint64)A.Hi - (uint64)B.Hi - (A.Lo < B.Lo ? 1 : 0)) };
+		}
+
+		FORCEINLINE FInt128 Negate(const FInt128& A)
+		{
+			return Sub(FInt128{ 0, 0 }, A);
+		}
+
+		FORCEINLINE bool IsNegative(const FInt128& A)
+		{
+			return A.Hi < 0;
+		}
+
+		FORCEINLINE bool IsZero(const FInt128& A)
+		{
+			return A.Hi == 0 && A.Lo == 0;
+		}
+
+		/**
+		* @return -1, 0 or 1 as A is less than, equal to or greater than B
+		*/
+		FORCEINLINE int32 Compare(const FInt128& A, const FInt128& B)
+		{
+			if (A.Hi != B.Hi)
+			{
+				return A.Hi < B.Hi ? -1 : 1;
+			}
+			if (A.Lo != B.Lo)
+			{
+				return A.Lo < B.Lo ? -1 : 1;
+			}
+			return 0;
+		}
+
+		/**
+		* @return -1, 0 or 1 for the sign of A
+		*/
+		FORCEINLINE int32 Sign(const FInt128& A)
+		{
+			return A.Hi < 0 ? -1 : (IsZero(A) ? 0 : 1);
+		}
+
+		/**
+		* Shifts right rounding towards zero and returns the low 64 bits.
+		* This is the rounding FFixed64::operator* uses, so a sum of raw products shifted by the binary point
+		* is rounded the same way a single product would be.
+		*/
+		FORCEINLINE int64 ShiftRightTruncate(const FInt128& A, uint32 Shift)
+		{
+			checkSlow(Shift > 0 && Shift < 64);
+			const bool bNegative = IsNegative(A);
+			const FInt128 Magnitude = bNegative ? Negate(A) : A;
+			const uint64 Result = (Magnitude.Lo >> Shift) | ((uint64)Magnitude.Hi << (64 - Shift));
+			return bNegative ? -(int64)Result : (int64)Result;
+		}
+
+		/**
+		* Shifts right rounding towards negative infinity and returns the low 64 bits.
+		* Used where a result has to bound an exact value from below, ceiling is -ShiftRightFloor(Negate(A)).
+		*/
+		FORCEINLINE int64 ShiftRightFloor(const FInt128& A, uint32 Shift)
+		{
+			checkSlow(Shift > 0 && Shift < 64);
+			return (int64)((A.Lo >> Shift) | ((uint64)A.Hi << (64 - Shift)));
+		}
+
+		/**
+		* Sum of raw FFixed64 products truncated once by the binary point, (A0 * B0 + A1 * B1 + A2 * B2) with a single rounding
+		*/
+		FORCEINLINE int64 Dot3Raw(int64 A0, int64 B0, int64 A1, int64 B1, int64 A2, int64 B2)
+		{
+			return ShiftRightTruncate(Add(Add(Mul(A0, B0), Mul(A1, B1)), Mul(A2, B2)), FixedPoint::Constants::BinaryPoint64);
+		}
+
+		/**
+		* (A0 * B0 + A1 * B1 + A2 * B2 + C) with a single rounding, C is a raw FFixed64 value and is added before the truncation
+		*/
+		FORCEINLINE int64 Dot3AddRaw(int64 A0, int64 B0, int64 A1, int64 B1, int64 A2, int64 B2, int64 C)
+		{
+			const FInt128 Sum = Add(Add(Mul(A0, B0), Mul(A1, B1)), Add(Mul(A2, B2), Mul(C, FixedPoint::Constants::Raw64::One)));
+			return ShiftRightTruncate(Sum, FixedPoint::Constants::BinaryPoint64);
+		}
+
+		/**
+		* Arithmetic shift right, rounding towards negative infinity, keeping all 128 bits
+		*/
+		FORCEINLINE FInt128 ShiftRight(const FInt128& A, uint32 Shift)
+		{
+			if (Shift == 0)
+			{
+				return A;
+			}
+			if (Shift >= 64)
+			{
+				return FInt128{ (uint64)(A.Hi >> FMath::Min<uint32>(Shift - 64, 63)), A.Hi >> 63 };
+			}
+			return FInt128{ (A.Lo >> Shift) | ((uint64)A.Hi << (64 - Shift)), A.Hi >> Shift };
+		}
+
+		/**
+		* @return the number of bits needed to hold the magnitude of A
+		*/
+		FORCEINLINE uint32 MagnitudeBits(const FInt128& A)
+		{
+			const FInt128 Magnitude = IsNegative(A) ? Negate(A) : A;
+			if (Magnitude.Hi != 0)
+			{
+				return 128 - (uint32)FMath::CountLeadingZeros64((uint64)Magnitude.Hi);
+			}
+			return 64 - (uint32)FMath::CountLeadingZeros64(Magnitude.Lo);
+		}
+
+		/**
+		* Num / Den rounded towards zero, the quotient must fit in 64 bits and Den must not be zero
+		*/
+		FORCEINLINE int64 DivideTruncate(const FInt128& Num, int64 Den)
+		{
+#if defined(__SIZEOF_INT128__)
+			const __int128 Value = (__int128)(((unsigned __int128)(uint64)Num.Hi << 64) | Num.Lo);
+			return (int64)(Value / Den);
+#else
+			//restoring division of the magnitudes, only the low 64 quotient bits can be set
+			const bool bNegative = IsNegative(Num) != (Den < 0);
+			const FInt128 Magnitude = IsNegative(Num) ? Negate(Num) : Num;
+			const uint64 Divisor = Den < 0 ? (uint64)0 - (uint64)Den : (uint64)Den;
+			uint64 Remainder = 0;
+			uint64 Quotient = 0;
+			for (int32 Bit = 127; Bit >= 0; Bit--)
+			{
+				const uint64 Carry = Remainder >> 63;
+				const uint64 NextBit = Bit >= 64 ? ((uint64)Magnitude.Hi >> (Bit - 64)) & 1 : (Magnitude.Lo >> Bit) & 1;
+				Remainder = (Remainder << 1) | NextBit;
+				if (Carry != 0 || Remainder >= Divisor)
+				{
+					Remainder -= Divisor;
+					if (Bit < 64)
+					{
+						Quotient |= 1ull << Bit;
+					}
+				}
+			}
+			return bNegative ? -(int64)Quotient : (int64)Quotient;
+#endif
+		}
+
+		/**
+		* A * Num / Den rounded towards zero, where |Num| <= |Den| so the result is never larger than A.
+		* Num and Den are shifted down together until Den fits in 62 bits, so the ratio always keeps at least 60 bits,
+		* used to place intersection points from exact 128 bit predicates.
+		*/
+		FORCEINLINE int64 MulDivTruncate(int64 A, const FInt128& Num, const FInt128& Den)
+		{
+			const uint32 DenBits = MagnitudeBits(Den);
+			const uint32 Shift = DenBits > 62 ? DenBits - 62 : 0;
+			const FInt128 ScaledNum = ShiftRight(Num, Shift);
+			const FInt128 ScaledDen = ShiftRight(Den, Shift);
+			if (ScaledDen.Lo == 0)
+			{
+				return 0;
+			}
+			return DivideTruncate(Mul(A, (int64)ScaledNum.Lo), (int64)ScaledDen.Lo);
+		}
+
+		/**
+		* @return floor of the square root of a non negative Value below 2^124, by integer Newton steps from a power of two
+		* above it. The square root of a sum of raw products is a raw value, exact where FFixedPointMath::Sqrt keeps 10 bits.
+		*/
+		FORCEINLINE int64 SqrtFloor(const FInt128& Value)
+		{
+			checkSlow(!IsNegative(Value) && Value.Hi < ((int64)1 << 60));
+			const uint32 Bits = MagnitudeBits(Value);
+			if (Bits < 2)
+			{
+				return (int64)Value.Lo;
+			}
+			int64 Root = (int64)1 << ((Bits + 1) / 2);
+			int64 Next = (Root + DivideTruncate(Value, Root)) >> 1;
+			while (Next < Root)
+			{
+				Root = Next;
+				Next = (Root + DivideTruncate(Value, Root)) >> 1;
+			}
+			return Root;
+		}
+
+		/**
+		* @return ceiling of the square root of a non negative Value below 2^124, for lengths that have to bound a value
+		*/
+		FORCEINLINE int64 SqrtCeil(const FInt128& Value)
+		{
+			const int64 Root = SqrtFloor(Value);
+			return Compare(Mul(Root, Root), Value) < 0 ? Root + 1 : Root;
+		}
+
+		/**
+		* Narrows a segment's [Enter, Exit] interval to the slab Lo <= Start + Delta * Time <= Hi of one axis, the times are
+		* fractions with positive denominators compared exactly, start a segment at 0 / 1 and 1 / 1.
+		* @return false if the segment misses the slab or the interval became empty
+		*/
+		FORCEINLINE bool ClipSlab(int64 Start, int64 Delta, int64 Lo, int64 Hi, int64& EnterNum, int64& EnterDen, int64& ExitNum, int64& ExitDen)
+		{
+			if (Delta == 0)
+			{
+				return Start >= Lo && Start <= Hi;
+			}
+			//flip a negative direction so the denominator is positive and the near plane is always the entry
+			const int64 NearNum = Delta > 0 ? Lo - Start : Start - Hi;
+			const int64 FarNum = Delta > 0 ? Hi - Start : Start - Lo;
+			const int64 Den = Delta > 0 ? Delta : -Delta;
+			if (Compare(Mul(NearNum, EnterDen), Mul(EnterNum, Den)) > 0)
+			{
+				EnterNum = NearNum;
+				EnterDen = Den;
+			}
+			if (Compare(Mul(FarNum, ExitDen), Mul(ExitNum, Den)) < 0)
+			{
+				ExitNum = FarNum;
+				ExitDen = Den;
+			}
+			return Compare(Mul(EnterNum, ExitDen), Mul(ExitNum, EnterDen)) <= 0;
+		}
+	}
+}
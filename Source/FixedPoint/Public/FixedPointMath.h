@@ -656,6 +656,49 @@ struct FIXEDPOINT_API FFixedPointMath : public FMath
 	/** Determines whether a line intersects a sphere. */
 	UE_NODISCARD static bool LineSphereIntersection(const FFixedVector64& Start, const FFixedVector64& Dir, FFixed64 Length, const FFixedVector64& Origin, FFixed64 Radius);
 
+	/**
+	 * Performs a sphere vs box intersection test, touching counts as intersecting.
+	 *
+	 * @param SphereCenter the center of the sphere being tested against the AABB
+	 * @param RadiusSquared the size of the sphere being tested
+	 * @param AABB the box being tested against
+	 *
+	 * @return Whether the sphere/box intersect or not.
+	 */
+	UE_NODISCARD static bool SphereAABBIntersection(const FFixedVector64& SphereCenter, FFixed64 RadiusSquared, const FFixedBox& AABB);
+
+	/**
+	 * Converts a sphere into a point plus radius squared for the test above
+	 */
+	UE_NODISCARD static bool SphereAABBIntersection(const FFixedSphere& Sphere, const FFixedBox& AABB);
+
+	/**
+	 * Determines whether a line intersects a box, and where it enters it. The slab times are compared as exact fractions,
+	 * so long lines that only just cross a face still hit, and only the reported time is divided.
+	 *
+	 * @param Box the box to test against
+	 * @param Start the start of the line
+	 * @param End the end of the line
+	 * @param StartToEnd End - Start
+	 * @param OutTime optional, receives the fraction along the line where it enters the box, zero if it starts inside
+	 *
+	 * @return true if the line touches the box.
+	 */
+	UE_NODISCARD static bool LineBoxIntersection(const FFixedBox& Box, const FFixedVector64& Start, const FFixedVector64& End, const FFixedVector64& StartToEnd, FFixed64* OutTime = nullptr);
+
+	/**
+	 * Determines whether a line segment crosses a triangle, edges and corners count as crossing.
+	 * The triangle is two sided, segments parallel to its plane never cross it.
+	 *
+	 * @param StartPoint the start of the segment
+	 * @param EndPoint the end of the segment
+	 * @param A, B, C the triangle's corners
+	 * @param OutTime receives the fraction along the segment where it crosses the triangle
+	 *
+	 * @return true if the segment crosses the triangle.
+	 */
+	UE_NODISCARD static bool SegmentTriangleIntersection(const FFixedVector64& StartPoint, const FFixedVector64& EndPoint, const FFixedVector64& A, const FFixedVector64& B, const FFixedVector64& C, FFixed64& OutTime);
+
 	/** Return a uniformly distributed random unit length vector = point on the unit sphere surface. */
 	UE_NODISCARD static FFixedVector64 VRand();
 };
@@ -6,6 +6,7 @@
 #include "FixedPointFwd.h"
 #include "FixedPointNumbers.h"
 #include "FixedPointMath.h"
+#include "FixedPointInt128.h"
 #include "FixedPointMatrix.generated.h"
 
 USTRUCT(BlueprintType)
@@ -319,7 +320,11 @@ public:
 	/** Transform a location - will take into account translation part of the FFixedMatrix. */
 	FORCEINLINE FFixedVector4d TransformPosition(const FFixedVector64& V) const;
 
-	/** Inverts the matrix and then transforms V - correctly handles scaling in this matrix. */
+	/**
+	 *	Inverts the matrix and then transforms V - correctly handles scaling in this matrix.
+	 *	An affine matrix is inverted with InverseAffine, so the result can differ from InverseFast().TransformPosition(V) in the last few bits,
+	 *	and a singular affine matrix inverts to Identity.
+	 */
 	FORCEINLINE FFixedVector64 InverseTransformPosition(const FFixedVector64& V) const;
 
 	/**
@@ -331,9 +336,32 @@ public:
 	/**
 	 *	Transform a direction vector by the inverse of this matrix - will not take into account translation part.
 	 *	If you want to transform a surface normal (or plane) and correctly account for non-uniform scaling you should use TransformByUsingAdjointT with adjoint of matrix inverse.
+	 *	An affine matrix is inverted with InverseAffine, as in InverseTransformPosition.
 	 */
 	FORCEINLINE FFixedVector64 InverseTransformVector(const FFixedVector64& V) const;
 
+	/**
+	 * Transforms an array of locations by the affine part of this matrix, the last column is ignored.
+	 * The matrix is read once up front and each component is accumulated at 128 bits and truncated once,
+	 * so results can differ from TransformPosition by a few raw units, in the direction of the exact answer.
+	 * Points are independent, splitting the work across threads gives the same result.
+	 *
+	 * @param Positions - Locations to transform
+	 * @param OutPositions - Receives the transformed locations, must be the same length as Positions, may alias it
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	void TransformPositions(TArrayView<const FFixedVector64> Positions, TArrayView<FFixedVector64> OutPositions, bool bParallel = false) const;
+
+	/**
+	 * Transforms an array of direction vectors by the 3x3 part of this matrix, translation is ignored.
+	 * Same precision and threading rules as TransformPositions.
+	 *
+	 * @param Vectors - Directions to transform
+	 * @param OutVectors - Receives the transformed directions, must be the same length as Vectors, may alias it
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	void TransformVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel = false) const;
+
 	// Transpose.
 
 	FORCEINLINE FFixedMatrix GetTransposed() const
@@ -404,6 +432,89 @@ public:
 	/** Fast path, and handles nil matrices. */
 	FORCEINLINE FFixedMatrix Inverse() const;
 
+	/** @return true if the last column is 0,0,0,1, so InverseAffine gives the same inverse as Inverse */
+	FORCEINLINE bool IsAffine() const
+	{
+		return M[0][3] == FixedPoint::Constants::Fixed64::Zero && M[1][3] == FixedPoint::Constants::Fixed64::Zero &&
+			M[2][3] == FixedPoint::Constants::Fixed64::Zero && M[3][3] == FixedPoint::Constants::Fixed64::One;
+	}
+
+	/**
+	 * Inverse of an affine matrix (last column 0,0,0,1), rotation, scale, shear and translation are all handled.
+	 * Inverts the 3x3 part by its cofactors and determinant, then moves the translation through it,
+	 * skipping the full 4x4 cofactor expansion of Inverse.
+	 * Returns Identity for a non-invertible matrix, the same as Inverse.
+	 */
+	FORCEINLINE FFixedMatrix InverseAffine() const
+	{
+		const FFixed64 C00 = M[1][1] * M[2][2] - M[1][2] * M[2][1];
+		const FFixed64 C01 = M[1][2] * M[2][0] - M[1][0] * M[2][2];
+		const FFixed64 C02 = M[1][0] * M[2][1] - M[1][1] * M[2][0];
+		const FFixed64 Det = M[0][0] * C00 + M[0][1] * C01 + M[0][2] * C02;
+		if (Det == FixedPoint::Constants::Fixed64::Zero)
+		{
+			return Identity;
+		}
+		const FFixed64 C10 = M[2][1] * M[0][2] - M[2][2] * M[0][1];
+		const FFixed64 C11 = M[2][2] * M[0][0] - M[2][0] * M[0][2];
+		const FFixed64 C12 = M[2][0] * M[0][1] - M[2][1] * M[0][0];
+		const FFixed64 C20 = M[0][1] * M[1][2] - M[0][2] * M[1][1];
+		const FFixed64 C21 = M[0][2] * M[1][0] - M[0][0] * M[1][2];
+		const FFixed64 C22 = M[0][0] * M[1][1] - M[0][1] * M[1][0];
+
+		FFixedMatrix Result;
+		Result.M[0][0] = C00 / Det;
+		Result.M[0][1] = C10 / Det;
+		Result.M[0][2] = C20 / Det;
+		Result.M[0][3] = FixedPoint::Constants::Fixed64::Zero;
+		Result.M[1][0] = C01 / Det;
+		Result.M[1][1] = C11 / Det;
+		Result.M[1][2] = C21 / Det;
+		Result.M[1][3] = FixedPoint::Constants::Fixed64::Zero;
+		Result.M[2][0] = C02 / Det;
+		Result.M[2][1] = C12 / Det;
+		Result.M[2][2] = C22 / Det;
+		Result.M[2][3] = FixedPoint::Constants::Fixed64::Zero;
+		Result.SetInverseTranslation(M[3][0], M[3][1], M[3][2]);
+		return Result;
+	}
+
+	/**
+	 * Inverse of a rigid matrix, rotation and translation only with no scale or shear.
+	 * The rotation is transposed and the translation is rotated by it and negated, no determinant or division is needed.
+	 * Only valid when the 3x3 part is orthonormal, use InverseAffine for scaled matrices.
+	 */
+	FORCEINLINE FFixedMatrix InverseRigid() const
+	{
+		FFixedMatrix Result;
+		Result.M[0][0] = M[0][0];
+		Result.M[0][1] = M[1][0];
+		Result.M[0][2] = M[2][0];
+		Result.M[0][3] = FixedPoint::Constants::Fixed64::Zero;
+		Result.M[1][0] = M[0][1];
+		Result.M[1][1] = M[1][1];
+		Result.M[1][2] = M[2][1];
+		Result.M[1][3] = FixedPoint::Constants::Fixed64::Zero;
+		Result.M[2][0] = M[0][2];
+		Result.M[2][1] = M[1][2];
+		Result.M[2][2] = M[2][2];
+		Result.M[2][3] = FixedPoint::Constants::Fixed64::Zero;
+		Result.SetInverseTranslation(M[3][0], M[3][1], M[3][2]);
+		return Result;
+	}
+
+	/**
+	 * Sets the translation row to -(T * the 3x3 part of this matrix), each component accumulated at 128 bits and truncated once.
+	 * Used by the affine inverses once the 3x3 part holds the inverted rotation and scale.
+	 */
+	FORCEINLINE void SetInverseTranslation(const FFixed64& TX, const FFixed64& TY, const FFixed64& TZ)
+	{
+		M[3][0].Value = -FixedPoint::Int128::Dot3Raw(TX.Value, M[0][0].Value, TY.Value, M[1][0].Value, TZ.Value, M[2][0].Value);
+		M[3][1].Value = -FixedPoint::Int128::Dot3Raw(TX.Value, M[0][1].Value, TY.Value, M[1][1].Value, TZ.Value, M[2][1].Value);
+		M[3][2].Value = -FixedPoint::Int128::Dot3Raw(TX.Value, M[0][2].Value, TY.Value, M[1][2].Value, TZ.Value, M[2][2].Value);
+		M[3][3] = FixedPoint::Constants::Fixed64::One;
+	}
+
 	FORCEINLINE FFixedMatrix TransposeAdjoint() const
 	{
 		FFixedMatrix TA;
@@ -0,0 +1,198 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointMath.h"
+#include "FixedPointInt128.h"
+#include "FixedPointMatrix33.generated.h"
+
+/**
+* FFixedMatrix33
+* 3x3 rotation and scale matrix, 72 bytes instead of the 128 of FFixedMatrix.
+* Same row vector layout as FFixedMatrix, rows are the X, Y and Z axes.
+* Products and transforms accumulate each element at 128 bits and truncate once, 9 multiplies per vector instead of 16.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedMatrix33
+{
+public:
+	GENERATED_BODY()
+
+	FFixed64 M[3][3];
+
+	static const FFixedMatrix33 Identity;
+
+	/**
+	* Default constructor, no initialization
+	*/
+	FORCEINLINE FFixedMatrix33() {}
+
+	/**
+	 * Constructor.
+	 *
+	 * @param EForceInit Force Init Enum.
+	 */
+	explicit FORCEINLINE FFixedMatrix33(EForceInit)
+	{
+		FMemory::Memzero(this, sizeof(*this));
+	}
+
+	/**
+	 * Constructor.
+	 *
+	 * @param InX X axis
+	 * @param InY Y axis
+	 * @param InZ Z axis
+	 */
+	FORCEINLINE FFixedMatrix33(const FFixedVector64& InX, const FFixedVector64& InY, const FFixedVector64& InZ);
+
+	/**
+	* Constructor that takes the upper 3x3 of a FFixedMatrix, translation and the last column are dropped
+	*/
+	explicit FORCEINLINE FFixedMatrix33(const FFixedMatrix& InMatrix);
+
+	/**
+	* Constructor that builds a rotation matrix from a quaternion, which should be normalized
+	*/
+	explicit FORCEINLINE FFixedMatrix33(const FFixedQuat64& Q);
+
+	/**
+	* Constructor that builds the same rotation as FFixedRotationMatrix, for rotating many vectors by one rotator
+	*/
+	explicit FORCEINLINE FFixedMatrix33(const FFixedRotator64& Rot);
+
+	FORCEINLINE FFixedMatrix33 operator*(const FFixedMatrix33& Other) const
+	{
+		FFixedMatrix33 Result;
+		for (int32 Row = 0; Row < 3; Row++)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				Result.M[Row][Column].Value = FixedPoint::Int128::Dot3Raw(
+					M[Row][0].Value, Other.M[0][Column].Value,
+					M[Row][1].Value, Other.M[1][Column].Value,
+					M[Row][2].Value, Other.M[2][Column].Value);
+			}
+		}
+		return Result;
+	}
+
+	FORCEINLINE FFixedMatrix33& operator*=(const FFixedMatrix33& Other)
+	{
+		*this = *this * Other;
+		return *this;
+	}
+
+	FORCEINLINE bool operator==(const FFixedMatrix33& Other) const
+	{
+		for (int32 Row = 0; Row < 3; Row++)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				if (M[Row][Column] != Other.M[Row][Column])
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	FORCEINLINE bool operator!=(const FFixedMatrix33& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	FORCEINLINE bool Equals(const FFixedMatrix33& Other, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		for (int32 Row = 0; Row < 3; Row++)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				if (FFixedPointMath::Abs(M[Row][Column] - Other.M[Row][Column]) > Tolerance)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	/** Transform a direction vector, V * M */
+	FORCEINLINE FFixedVector64 TransformVector(const FFixedVector64& V) const;
+
+	/** Transform a direction vector by the transpose, which is the inverse for a pure rotation */
+	FORCEINLINE FFixedVector64 TransformVectorTransposed(const FFixedVector64& V) const;
+
+	FORCEINLINE FFixedMatrix33 GetTransposed() const
+	{
+		FFixedMatrix33 Result;
+		Result.M[0][0] = M[0][0]; Result.M[0][1] = M[1][0]; Result.M[0][2] = M[2][0];
+		Result.M[1][0] = M[0][1]; Result.M[1][1] = M[1][1]; Result.M[1][2] = M[2][1];
+		Result.M[2][0] = M[0][2]; Result.M[2][1] = M[1][2]; Result.M[2][2] = M[2][2];
+		return Result;
+	}
+
+	FORCEINLINE FFixed64 Determinant() const
+	{
+		return FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(
+			M[0][0].Value, (M[1][1] * M[2][2] - M[1][2] * M[2][1]).Value,
+			M[0][1].Value, (M[1][2] * M[2][0] - M[1][0] * M[2][2]).Value,
+			M[0][2].Value, (M[1][0] * M[2][1] - M[1][1] * M[2][0]).Value));
+	}
+
+	/**
+	 * General inverse from the cofactors and determinant.
+	 * Returns Identity for a non-invertible matrix, the same as FFixedMatrix::Inverse.
+	 * For a pure rotation GetTransposed is exact and much cheaper.
+	 */
+	FORCEINLINE FFixedMatrix33 Inverse() const
+	{
+		const FFixed64 C00 = M[1][1] * M[2][2] - M[1][2] * M[2][1];
+		const FFixed64 C01 = M[1][2] * M[2][0] - M[1][0] * M[2][2];
+		const FFixed64 C02 = M[1][0] * M[2][1] - M[1][1] * M[2][0];
+		const FFixed64 Det = FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(M[0][0].Value, C00.Value, M[0][1].Value, C01.Value, M[0][2].Value, C02.Value));
+		if (Det == FixedPoint::Constants::Fixed64::Zero)
+		{
+			return Identity;
+		}
+
+		FFixedMatrix33 Result;
+		Result.M[0][0] = C00 / Det;
+		Result.M[0][1] = (M[2][1] * M[0][2] - M[2][2] * M[0][1]) / Det;
+		Result.M[0][2] = (M[0][1] * M[1][2] - M[0][2] * M[1][1]) / Det;
+		Result.M[1][0] = C01 / Det;
+		Result.M[1][1] = (M[2][2] * M[0][0] - M[2][0] * M[0][2]) / Det;
+		Result.M[1][2] = (M[0][2] * M[1][0] - M[0][0] * M[1][2]) / Det;
+		Result.M[2][0] = C02 / Det;
+		Result.M[2][1] = (M[2][0] * M[0][1] - M[2][1] * M[0][0]) / Det;
+		Result.M[2][2] = (M[0][0] * M[1][1] - M[0][1] * M[1][0]) / Det;
+		return Result;
+	}
+
+	/** @return this matrix as a FFixedMatrix with no translation */
+	FORCEINLINE FFixedMatrix ToMatrix() const;
+
+	/** @return the rotation of this matrix as a quaternion, the axes should be unit length */
+	FORCEINLINE FFixedQuat64 ToQuat() const;
+
+	/**
+	 * Transforms an array of direction vectors by this matrix.
+	 *
+	 * @param Vectors - Directions to transform
+	 * @param OutVectors - Receives the transformed directions, must be the same length as Vectors, may alias it
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	void TransformVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel = false) const;
+
+	/**
+	 * Multiplies arrays of matrices, OutMatrices[i] = A[i] * B[i].
+	 *
+	 * @param OutMatrices - Receives the products, must be the same length as A and B, may alias either
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	static void Multiply(TArrayView<FFixedMatrix33> OutMatrices, TArrayView<const FFixedMatrix33> A, TArrayView<const FFixedMatrix33> B, bool bParallel = false);
+};
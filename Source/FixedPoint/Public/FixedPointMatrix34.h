@@ -0,0 +1,245 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointMath.h"
+#include "FixedPointInt128.h"
+#include "FixedPointMatrix33.h"
+#include "FixedPointMatrix34.generated.h"
+
+/**
+* FFixedMatrix34
+* Affine matrix without the constant 0,0,0,1 column of FFixedMatrix, 96 bytes instead of 128.
+* Same row vector layout as FFixedMatrix, rows 0 to 2 are the X, Y and Z axes and row 3 is the origin.
+* Products and transforms accumulate each element at 128 bits and truncate once, 12 multiplies per position instead of 16.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedMatrix34
+{
+public:
+	GENERATED_BODY()
+
+	FFixed64 M[4][3];
+
+	static const FFixedMatrix34 Identity;
+
+	/**
+	* Default constructor, no initialization
+	*/
+	FORCEINLINE FFixedMatrix34() {}
+
+	/**
+	 * Constructor.
+	 *
+	 * @param EForceInit Force Init Enum.
+	 */
+	explicit FORCEINLINE FFixedMatrix34(EForceInit)
+	{
+		FMemory::Memzero(this, sizeof(*this));
+	}
+
+	/**
+	 * Constructor.
+	 *
+	 * @param InX X axis
+	 * @param InY Y axis
+	 * @param InZ Z axis
+	 * @param InOrigin Origin
+	 */
+	FORCEINLINE FFixedMatrix34(const FFixedVector64& InX, const FFixedVector64& InY, const FFixedVector64& InZ, const FFixedVector64& InOrigin);
+
+	/**
+	 * Constructor.
+	 *
+	 * @param InRotation Rotation and scale part
+	 * @param InOrigin Origin
+	 */
+	FORCEINLINE FFixedMatrix34(const FFixedMatrix33& InRotation, const FFixedVector64& InOrigin);
+
+	/**
+	 * Constructor.
+	 *
+	 * @param Q Rotation, should be normalized
+	 * @param InOrigin Origin
+	 */
+	FORCEINLINE FFixedMatrix34(const FFixedQuat64& Q, const FFixedVector64& InOrigin);
+
+	/**
+	* Constructor that takes the affine part of a FFixedMatrix, the last column is dropped
+	*/
+	explicit FORCEINLINE FFixedMatrix34(const FFixedMatrix& InMatrix);
+
+	/**
+	* Constructor that builds the same matrix as FFixedTransform64::ToMatrixWithScale
+	*/
+	explicit FORCEINLINE FFixedMatrix34(const FFixedTransform64& InTransform);
+
+	FORCEINLINE FFixedMatrix34 operator*(const FFixedMatrix34& Other) const
+	{
+		FFixedMatrix34 Result;
+		for (int32 Row = 0; Row < 3; Row++)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				Result.M[Row][Column].Value = FixedPoint::Int128::Dot3Raw(
+					M[Row][0].Value, Other.M[0][Column].Value,
+					M[Row][1].Value, Other.M[1][Column].Value,
+					M[Row][2].Value, Other.M[2][Column].Value);
+			}
+		}
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			Result.M[3][Column].Value = FixedPoint::Int128::Dot3AddRaw(
+				M[3][0].Value, Other.M[0][Column].Value,
+				M[3][1].Value, Other.M[1][Column].Value,
+				M[3][2].Value, Other.M[2][Column].Value,
+				Other.M[3][Column].Value);
+		}
+		return Result;
+	}
+
+	FORCEINLINE FFixedMatrix34& operator*=(const FFixedMatrix34& Other)
+	{
+		*this = *this * Other;
+		return *this;
+	}
+
+	FORCEINLINE bool operator==(const FFixedMatrix34& Other) const
+	{
+		for (int32 Row = 0; Row < 4; Row++)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				if (M[Row][Column] != Other.M[Row][Column])
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	FORCEINLINE bool operator!=(const FFixedMatrix34& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	FORCEINLINE bool Equals(const FFixedMatrix34& Other, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		for (int32 Row = 0; Row < 4; Row++)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				if (FFixedPointMath::Abs(M[Row][Column] - Other.M[Row][Column]) > Tolerance)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	/** Transform a location, V * M + Origin */
+	FORCEINLINE FFixedVector64 TransformPosition(const FFixedVector64& V) const;
+
+	/** Transform a direction vector, translation is ignored */
+	FORCEINLINE FFixedVector64 TransformVector(const FFixedVector64& V) const;
+
+	/** @return the rotation and scale part */
+	FORCEINLINE FFixedMatrix33 GetMatrix33() const
+	{
+		FFixedMatrix33 Result;
+		for (int32 Row = 0; Row < 3; Row++)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				Result.M[Row][Column] = M[Row][Column];
+			}
+		}
+		return Result;
+	}
+
+	FORCEINLINE FFixedVector64 GetOrigin() const;
+
+	FORCEINLINE void SetOrigin(const FFixedVector64& NewOrigin);
+
+	/**
+	 * Inverse of this affine matrix, the 3x3 part is inverted from its cofactors and the origin moved through it.
+	 * Returns Identity for a non-invertible matrix, the same as FFixedMatrix::Inverse.
+	 */
+	FORCEINLINE FFixedMatrix34 Inverse() const
+	{
+		const FFixedMatrix33 Rotation = GetMatrix33();
+		if (Rotation.Determinant() == FixedPoint::Constants::Fixed64::Zero)
+		{
+			return Identity;
+		}
+		return MakeInverse(Rotation.Inverse());
+	}
+
+	/**
+	 * Inverse of a rigid matrix, rotation and translation only with no scale or shear.
+	 * The rotation is transposed and the origin is rotated by it and negated.
+	 */
+	FORCEINLINE FFixedMatrix34 InverseRigid() const
+	{
+		return MakeInverse(GetMatrix33().GetTransposed());
+	}
+
+	/** @return this matrix as a FFixedMatrix */
+	FORCEINLINE FFixedMatrix ToMatrix() const;
+
+	/** @return this matrix as a transform, see FFixedTransform64::SetFromMatrix */
+	FORCEINLINE FFixedTransform64 ToTransform() const;
+
+	/**
+	 * Transforms an array of locations by this matrix.
+	 *
+	 * @param Positions - Locations to transform
+	 * @param OutPositions - Receives the transformed locations, must be the same length as Positions, may alias it
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	void TransformPositions(TArrayView<const FFixedVector64> Positions, TArrayView<FFixedVector64> OutPositions, bool bParallel = false) const;
+
+	/**
+	 * Transforms an array of direction vectors by this matrix, translation is ignored.
+	 *
+	 * @param Vectors - Directions to transform
+	 * @param OutVectors - Receives the transformed directions, must be the same length as Vectors, may alias it
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	void TransformVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel = false) const;
+
+	/**
+	 * Multiplies arrays of matrices, OutMatrices[i] = A[i] * B[i].
+	 *
+	 * @param OutMatrices - Receives the products, must be the same length as A and B, may alias either
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	static void Multiply(TArrayView<FFixedMatrix34> OutMatrices, TArrayView<const FFixedMatrix34> A, TArrayView<const FFixedMatrix34> B, bool bParallel = false);
+
+private:
+	/** Builds the inverse from an already inverted 3x3 part, the origin becomes -(Origin * InvRotation) */
+	FORCEINLINE FFixedMatrix34 MakeInverse(const FFixedMatrix33& InvRotation) const
+	{
+		FFixedMatrix34 Result;
+		for (int32 Row = 0; Row < 3; Row++)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				Result.M[Row][Column] = InvRotation.M[Row][Column];
+			}
+		}
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			Result.M[3][Column].Value = -FixedPoint::Int128::Dot3Raw(
+				M[3][0].Value, InvRotation.M[0][Column].Value,
+				M[3][1].Value, InvRotation.M[1][Column].Value,
+				M[3][2].Value, InvRotation.M[2][Column].Value);
+		}
+		return Result;
+	}
+};
@@ -16,6 +16,14 @@ namespace FixedPoint
 		constexpr uint8 BinaryPoint32 = 16;
 		//difference between 64 bit and 32 bit binary points, for conversion
 		constexpr uint8 BinaryPointDifference = BinaryPoint64 - BinaryPoint32;
+		//number of bits beyond the binary point for the Q1.30 unit length types, FFixedUnitQuat and FFixedUnitVector
+		constexpr uint8 BinaryPointUnit = 30;
+		//difference between the unit and 64 bit binary points, for conversion
+		constexpr uint8 BinaryPointUnitDifference = BinaryPointUnit - BinaryPoint64;
+		//number of bits beyond the binary point for FFixedRotationMatrix62 entries, Q1.62
+		constexpr uint8 BinaryPointRotation = 62;
+		//difference between the rotation matrix and 64 bit binary points, for conversion
+		constexpr uint8 BinaryPointRotationDifference = BinaryPointRotation - BinaryPoint64;
 
 		namespace Raw64
 		{
@@ -69,6 +77,18 @@ namespace FixedPoint
 			constexpr int64 ThreshVectorNormalized = 10485;
 			constexpr int64 ThreshQuatNormalized = 10485;
 		}
+		namespace RawUnit
+		{
+			//The value 1 in the Q1.30 unit length types
+			constexpr int32 One = 1 << FixedPoint::Constants::BinaryPointUnit;
+			//The value 0.5 in the Q1.30 unit length types
+			constexpr int32 Half = One >> 1;
+		}
+		namespace RawRotation
+		{
+			//The value 1 in FFixedRotationMatrix62 entries
+			constexpr int64 One = (int64)1 << FixedPoint::Constants::BinaryPointRotation;
+		}
 		namespace Raw32
 		{
 
@@ -166,7 +166,19 @@ public:
 	 * @param TA Transpose-adjoint of Matrix.
 	 * @return The result of transform.
 	 */
-	FORCEINLINE FFixedPlane TransformByUsingAdjointT(const FFixedMatrix& M, FFixed64 DetM, const FFixedMatrix& TA) const { return FFixedPlane(); }
+	FORCEINLINE FFixedPlane TransformByUsingAdjointT(const FFixedMatrix& M, FFixed64 DetM, const FFixedMatrix& TA) const;
+
+	/**
+	 * Transforms an array of planes by one matrix, for convex volumes and frustums.
+	 * The transpose-adjoint and determinant are computed once for the whole array,
+	 * each result is identical to calling TransformBy on that plane.
+	 *
+	 * @param OutPlanes - Receives the transformed planes, must be the same length as Planes, may alias it
+	 * @param Planes - Planes to transform
+	 * @param M - The matrix to transform the planes with
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	static void TransformBy(TArrayView<FFixedPlane> OutPlanes, TArrayView<const FFixedPlane> Planes, const FFixedMatrix& M, bool bParallel = false);
 
 	/**
 	 * Get the result of translating the plane by the given offset
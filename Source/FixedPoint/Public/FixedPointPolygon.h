@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointPlane.h"
+
+/**
+* Result of splitting a polygon with a plane, see FPoly::SplitWithPlane
+*/
+enum class EFixedPolygonSplit : uint8
+{
+	/** Every vertex is within the split threshold of the plane */
+	Coplanar,
+	/** No vertex is behind the plane */
+	Front,
+	/** No vertex is in front of the plane */
+	Back,
+	/** Vertices on both sides, the polygon was cut in two */
+	Split
+};
+
+/**
+* FFixedPolygonArena
+* Many FFixedVector64 polygons packed into one vertex buffer, each polygon a contiguous run of vertices.
+* Adding polygons never allocates per polygon and Reset keeps the memory, so one arena can be refilled every frame.
+*/
+struct FIXEDPOINT_API FFixedPolygonArena
+{
+public:
+	/**
+	* Appends a polygon, the last vertex connects back to the first.
+	* @return index of the polygon
+	*/
+	int32 Add(TArrayView<const FFixedVector64> Polygon);
+
+	FORCEINLINE int32 Num() const
+	{
+		return Starts.Num();
+	}
+
+	FORCEINLINE int32 NumVertices() const
+	{
+		return Vertices.Num();
+	}
+
+	FORCEINLINE TArrayView<const FFixedVector64> GetPolygon(int32 Index) const
+	{
+		const int32 Start = Starts[Index];
+		const int32 End = Index + 1 < Starts.Num() ? Starts[Index + 1] : Vertices.Num();
+		return TArrayView<const FFixedVector64>(Vertices.GetData() + Start, End - Start);
+	}
+
+	void Reserve(int32 NumPolygons, int32 InNumVertices);
+
+	/** Removes every polygon, keeping the memory */
+	void Reset();
+
+	/**
+	* Splits a convex polygon with a plane, see FPoly::SplitWithPlane.
+	* Each vertex's distance to the plane is an exact 128 bit value compared against ThreshSplitPolyWithPlane,
+	* or ThreshSplitPolyPrecisely when bVeryPrecise is set, so the classification never depends on product rounding.
+	* Front and back use these same thresholds as FPoly does, ThreshPointOnSide is for single point side tests and is not used here.
+	* Vertices within the threshold go to both halves, and edges crossing the plane are cut where their exact
+	* distances interpolate to zero.
+	*
+	* @param OutFront - Receives the part in front of the plane when the result is Split
+	* @param OutBack - Receives the part behind the plane when the result is Split
+	* @return how the polygon lies against the plane, nothing is added unless it is Split
+	*/
+	static EFixedPolygonSplit SplitWithPlane(TArrayView<const FFixedVector64> Polygon, const FFixedPlane& Plane, FFixedPolygonArena& OutFront, FFixedPolygonArena& OutBack, bool bVeryPrecise = false);
+
+	/** @return true if every vertex is within ThreshPointOnPlane of the plane, see FPoly::OnPlane */
+	static bool IsOnPlane(TArrayView<const FFixedVector64> Polygon, const FFixedPlane& Plane);
+
+	/**
+	* Splits every polygon with a plane, appending the pieces in order. Polygons entirely on one side are copied
+	* to that side and coplanar polygons are copied to OutFront.
+	*/
+	void SplitAllWithPlane(const FFixedPlane& Plane, FFixedPolygonArena& OutFront, FFixedPolygonArena& OutBack, bool bVeryPrecise = false) const;
+
+private:
+	TArray<FFixedVector64> Vertices;
+
+	/** First vertex of each polygon */
+	TArray<int32> Starts;
+};
@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector2D.h"
+
+/**
+* Boolean operation between two FFixedPolygonArena2D regions
+*/
+enum class EFixedPolygonBoolean : uint8
+{
+	Union,
+	Intersection,
+	/** A minus B */
+	Difference
+};
+
+/**
+* FFixedPolygonArena2D
+* Many FFixedVector2d polygons packed into one vertex buffer, each polygon a contiguous run of vertices.
+*
+* An arena is also read as one region: a point is inside when the polygons wind around it a positive number of times,
+* so counter clockwise outlines add area, clockwise outlines inside them cut holes and overlapping outlines merge.
+* Boolean results are written the same way, outlines counter clockwise and holes clockwise.
+*
+* The booleans decide everything with exact 128 bit orientation tests on the raw coordinates. Only the crossing points
+* of edges are rounded, and each one is computed once and shared by both edges, so outputs always close up and are
+* identical on every machine. Coordinates must stay within +-2^40.
+* Boolean's working buffers come from the thread's FMemStack, nothing is allocated on the heap except the output.
+*/
+struct FIXEDPOINT_API FFixedPolygonArena2D
+{
+public:
+	/**
+	* Appends a polygon, the last vertex connects back to the first.
+	* @return index of the polygon
+	*/
+	int32 Add(TArrayView<const FFixedVector2d> Polygon);
+
+	/** Appends every polygon of Other */
+	void Append(const FFixedPolygonArena2D& Other);
+
+	FORCEINLINE int32 Num() const
+	{
+		return Starts.Num();
+	}
+
+	FORCEINLINE int32 NumVertices() const
+	{
+		return Vertices.Num();
+	}
+
+	FORCEINLINE TArrayView<const FFixedVector2d> GetPolygon(int32 Index) const
+	{
+		const int32 Start = Starts[Index];
+		const int32 End = Index + 1 < Starts.Num() ? Starts[Index + 1] : Vertices.Num();
+		return TArrayView<const FFixedVector2d>(Vertices.GetData() + Start, End - Start);
+	}
+
+	void Reserve(int32 NumPolygons, int32 InNumVertices);
+
+	/** Removes every polygon, keeping the memory */
+	void Reset();
+
+	/** @return the signed area of the region, counter clockwise polygons count positive, summed exactly and rounded once */
+	FFixed64 GetArea() const;
+
+	/** @return true if the polygons wind around P a positive number of times */
+	bool IsPointInside(const FFixedVector2d& P) const;
+
+	/**
+	* Computes a boolean of two regions, appending the result polygons to Out.
+	* Edges are cut wherever they cross or touch, and each piece is kept when the region is inside on exactly one side
+	* of it. One exact ray cast finds the windings beside each connected set of pieces and they spread from there
+	* through the faces shared around each vertex. Pieces are then joined into polygons, taking the tightest turn
+	* where several meet, so polygons touching at a corner come out separate while a hole touching its outline at a
+	* vertex is traced as part of that outline.
+	*
+	* @param Out - Must not be A or B
+	*/
+	static void Boolean(const FFixedPolygonArena2D& A, const FFixedPolygonArena2D& B, EFixedPolygonBoolean Operation, FFixedPolygonArena2D& Out);
+
+	static FORCEINLINE void Union(const FFixedPolygonArena2D& A, const FFixedPolygonArena2D& B, FFixedPolygonArena2D& Out)
+	{
+		Boolean(A, B, EFixedPolygonBoolean::Union, Out);
+	}
+
+	static FORCEINLINE void Intersection(const FFixedPolygonArena2D& A, const FFixedPolygonArena2D& B, FFixedPolygonArena2D& Out)
+	{
+		Boolean(A, B, EFixedPolygonBoolean::Intersection, Out);
+	}
+
+	static FORCEINLINE void Difference(const FFixedPolygonArena2D& A, const FFixedPolygonArena2D& B, FFixedPolygonArena2D& Out)
+	{
+		Boolean(A, B, EFixedPolygonBoolean::Difference, Out);
+	}
+
+	/**
+	* Grows the region by Distance, or shrinks it when Distance is negative, appending the result polygons to Out.
+	* The boundary is stroked with a rectangle along each edge and an octagon at each vertex, which is then
+	* added to or removed from the region with Boolean. Corners are rounded to within 8% of Distance.
+	*
+	* @param Out - Must not be In
+	*/
+	static void Offset(const FFixedPolygonArena2D& In, FFixed64 Distance, FFixedPolygonArena2D& Out);
+
+private:
+	TArray<FFixedVector2d> Vertices;
+
+	/** First vertex of each polygon */
+	TArray<int32> Starts;
+};
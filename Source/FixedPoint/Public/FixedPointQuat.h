@@ -391,6 +391,53 @@ public:
 		return (B * Alpha) + (A * (Bias * (FixedPoint::Constants::Fixed64::One - Alpha)));
 	}
 
+	/**
+	 * Spherical interpolation along the shortest path, constant angular velocity. Result is NOT normalized.
+	 * Evaluates sin(Alpha * Theta) / sin(Theta) as a fixed polynomial in cos(Theta), no trig, tables or divisions,
+	 * within about 0.00002 of the exact weights.
+	 */
+	static FFixedQuat64 Slerp_NotNormalized(const FFixedQuat64& Quat1, const FFixedQuat64& Quat2, FFixed64 Slerp);
+
+	/**
+	 * Spherical interpolation along the shortest path. Result is normalized.
+	 */
+	static FORCEINLINE FFixedQuat64 Slerp(const FFixedQuat64& Quat1, const FFixedQuat64& Quat2, FFixed64 Slerp)
+	{
+		FFixedQuat64 Result = Slerp_NotNormalized(Quat1, Quat2, Slerp);
+		Result.Normalize();
+		return Result;
+	}
+
+	/**
+	 * Spherical interpolation without taking the shortest path, Quat1 and -Quat1 give different results. Result is NOT normalized.
+	 * Angles past 90 degrees are split at the midpoint so the polynomial stays in its accurate range.
+	 */
+	static FFixedQuat64 SlerpFullPath_NotNormalized(const FFixedQuat64& quat1, const FFixedQuat64& quat2, FFixed64 Alpha);
+
+	/**
+	 * Spherical interpolation without taking the shortest path. Result is normalized.
+	 */
+	static FORCEINLINE FFixedQuat64 SlerpFullPath(const FFixedQuat64& quat1, const FFixedQuat64& quat2, FFixed64 Alpha)
+	{
+		FFixedQuat64 Result = SlerpFullPath_NotNormalized(quat1, quat2, Alpha);
+		Result.Normalize();
+		return Result;
+	}
+
+	/**
+	 * Spherical quadrangle interpolation between quat1 and quat2 with tangents tang1 and tang2, shortest path. Result is normalized.
+	 */
+	static FFixedQuat64 Squad(const FFixedQuat64& quat1, const FFixedQuat64& tang1, const FFixedQuat64& quat2, const FFixedQuat64& tang2, FFixed64 Alpha);
+
+	/**
+	 * Slerps arrays of quaternions by one shared Alpha, OutQuats[i] = Slerp(Quat1[i], Quat2[i], Alpha).
+	 * The Alpha dependent polynomial terms are computed once for the whole batch, results are bit identical to Slerp.
+	 *
+	 * @param OutQuats - Receives the normalized results, must be the same length as Quat1 and Quat2, may alias either
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	static void Slerp(TArrayView<FFixedQuat64> OutQuats, TArrayView<const FFixedQuat64> Quat1, TArrayView<const FFixedQuat64> Quat2, FFixed64 Alpha, bool bParallel = false);
+
 	FORCEINLINE operator FQuat() const
 	{
 		return FQuat((double)X, (double)Y, (double)Z, (double)W);
@@ -462,7 +509,7 @@ inline FFixedQuat64::FFixedQuat64(const FFixedMatrix& M)
 
 	if (tr > FFixed64(0.0f))
 	{
-		FFixed64 InvS = FFixed64();// = FMath::InvSqrt(tr + T(1.f));
+		FFixed64 InvS = FFixedPointMath::InvSqrt(tr + FFixed64(1.f));
 		this->W = FFixed64(FFixed64(0.5f) * (FFixed64(1.f) / InvS));
 		s = FFixed64(0.5f) * InvS;
 
@@ -555,19 +602,16 @@ FORCEINLINE FFixedQuat64 FFixedQuat64::operator-=(const FFixedQuat64& Q)
 FORCEINLINE FFixedQuat64 FFixedQuat64::operator*(const FFixedQuat64& Q) const
 {
 	return FFixedQuat64(
-		W * Q.W - X * Q.X - Y * Q.Y - Z * Q.Z,  // 1
 		W * Q.X + X * Q.W + Y * Q.Z - Z * Q.Y,  // i
 		W * Q.Y - X * Q.Z + Y * Q.W + Z * Q.X,  // j
-		W * Q.Z + X * Q.Y - Y * Q.X + Z * Q.W   // k
+		W * Q.Z + X * Q.Y - Y * Q.X + Z * Q.W,  // k
+		W * Q.W - X * Q.X - Y * Q.Y - Z * Q.Z   // 1
 	);
 }
 
 FORCEINLINE FFixedQuat64 FFixedQuat64::operator*=(const FFixedQuat64& Q)
 {
-	this->X = W * Q.W - X * Q.X - Y * Q.Y - Z * Q.Z;  // 1
-	this->Y = W * Q.X + X * Q.W + Y * Q.Z - Z * Q.Y;  // i
-	this->Z = W * Q.Y - X * Q.Z + Y * Q.W + Z * Q.X;  // j
-	this->W = W * Q.Z + X * Q.Y - Y * Q.X + Z * Q.W;   // k
+	*this = *this * Q;
 
 	return *this;
 }
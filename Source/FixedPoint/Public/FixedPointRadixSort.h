@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+
+/**
+* FFixedRadixSort
+* Stable LSD radix sorts of FFixed64 and FFixed32 arrays, for depth sorting, arrival time queues and broadphases.
+*
+* A fixed point number orders the same as its raw signed integer, and flipping the sign bit makes that order the
+* unsigned one, so keys are sorted 8 bits a pass with no comparisons. Passes where every key shares the same digit are
+* skipped, so keys spanning a small range take fewer passes. Short arrays use an insertion sort instead.
+*
+* Every sort is stable: equal keys keep their input order, so the result is a pure function of the input. With bParallel
+* each pass is split into fixed size chunks counted and scattered on task threads, and the chunks' buckets are laid out
+* in chunk order, which gives exactly the serial result.
+*/
+struct FIXEDPOINT_API FFixedRadixSort
+{
+public:
+	static void Sort(TArrayView<FFixed64> Values, bool bParallel = false);
+	static void Sort(TArrayView<FFixed32> Values, bool bParallel = false);
+
+	/** Sorts unsigned keys, such as packed pairs of ids */
+	static void Sort(TArrayView<uint64> Values, bool bParallel = false);
+
+	/**
+	* Indices of Keys in ascending order, equal keys in ascending index order. Keys are not moved.
+	*
+	* @param bParallel - Split the passes across task threads with ParallelFor
+	*/
+	static void ArgSort(TArrayView<const FFixed64> Keys, TArray<int32>& OutOrder, bool bParallel = false);
+	static void ArgSort(TArrayView<const FFixed32> Keys, TArray<int32>& OutOrder, bool bParallel = false);
+
+	/** Indices of unsigned keys in ascending order, such as FFixedSpatialKey's, see ArgSort */
+	static void ArgSort(TArrayView<const uint64> Keys, TArray<int32>& OutOrder, bool bParallel = false);
+
+	/**
+	* Sorts Keys and moves Values along with them, equal keys keep their input order.
+	*
+	* @param Values - A TArray or TArrayView as long as Keys
+	*/
+	template<typename ValueArrayType>
+	static void SortPairs(TArrayView<FFixed64> Keys, ValueArrayType&& Values, bool bParallel = false)
+	{
+		check(Values.Num() == Keys.Num());
+		TArray<int32> Order;
+		ArgSort(Keys, Order, bParallel);
+		Gather(Order, Keys);
+		Gather(Order, MakeArrayView(Values));
+	}
+
+	template<typename ValueArrayType>
+	static void SortPairs(TArrayView<FFixed32> Keys, ValueArrayType&& Values, bool bParallel = false)
+	{
+		check(Values.Num() == Keys.Num());
+		TArray<int32> Order;
+		ArgSort(Keys, Order, bParallel);
+		Gather(Order, Keys);
+		Gather(Order, MakeArrayView(Values));
+	}
+
+private:
+	/** Moves element Order[i] of View to i */
+	template<typename ElementType>
+	static void Gather(const TArray<int32>& Order, TArrayView<ElementType> View)
+	{
+		TArray<ElementType> Sorted;
+		Sorted.Reserve(View.Num());
+		for (const int32 Index : Order)
+		{
+			Sorted.Add(MoveTemp(View[Index]));
+		}
+		for (int32 i = 0; i < View.Num(); i++)
+		{
+			View[i] = MoveTemp(Sorted[i]);
+		}
+	}
+};
@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointInt128.h"
+#include "FixedPointVector.h"
+#include "FixedPointSoA.h"
+
+/**
+* FFixedRayBatch
+* Many rays tested against many spheres, planes, boxes or triangles stored as structures of arrays.
+* Each ray stores both forms the scalar tests take, Start with a direction and length for LineSphereIntersection and
+* Start with End for the others, plus the per ray values the tests would otherwise recompute for every primitive:
+* End - Start for the plane, box and triangle tests, and the bounds the sphere time is checked against.
+*
+* Rays are processed in blocks of 64 with a mask of the rays still searching, so any hit queries stop touching a ray
+* as soon as it hits and skip the rest of the primitives once the whole block has. Tests that the scalar functions
+* decide with a division (the sphere and plane times) are decided here by comparing exact 128 bit products instead,
+* and the division only runs for hits.
+*
+* Every hit decision and time is bit identical to the scalar function named on each query, wherever that function is
+* defined. Results do not depend on bParallel.
+*/
+struct FIXEDPOINT_API FFixedRayBatch
+{
+public:
+	/**
+	* Adds a ray in the form LineSphereIntersection takes, End is Start + Dir * Length.
+	* @return index of the ray
+	*/
+	int32 AddRay(const FFixedVector64& Start, const FFixedVector64& Dir, FFixed64 Length);
+
+	/**
+	* Adds a segment, Dir and Length are (End - Start).GetSafeNormal() and (End - Start).Size().
+	* @return index of the ray
+	*/
+	int32 AddSegment(const FFixedVector64& Start, const FFixedVector64& End);
+
+	void Reserve(int32 Number);
+
+	void Reset();
+
+	FORCEINLINE int32 Num() const
+	{
+		return StartX.Num();
+	}
+
+	FORCEINLINE FFixedVector64 GetStart(int32 Index) const
+	{
+		return FFixedVector64(StartX[Index], StartY[Index], StartZ[Index]);
+	}
+
+	FORCEINLINE FFixedVector64 GetEnd(int32 Index) const
+	{
+		return FFixedVector64(EndX[Index], EndY[Index], EndZ[Index]);
+	}
+
+	FORCEINLINE FFixedVector64 GetDir(int32 Index) const
+	{
+		return FFixedVector64(DirX[Index], DirY[Index], DirZ[Index]);
+	}
+
+	FORCEINLINE FFixed64 GetLength(int32 Index) const
+	{
+		return Length[Index];
+	}
+
+	/**
+	* Tests every ray against every sphere, a hit is FFixedPointMath::LineSphereIntersection(Start, Dir, Length, Center, W)
+	* returning true, rays with a zero length never hit.
+	*
+	* @param OutItems - Per ray, the sphere hit, INDEX_NONE for a miss. Must be Num() long
+	* @param OutTimes - Per ray, (v - Sqrt(disc)) / Length as LineSphereIntersection computes it. Must be Num() long
+	* @param bAnyHit - Stop at the lowest index sphere hit rather than finding the earliest hit
+	* @param bParallel - Split the rays across task threads with ParallelFor
+	*/
+	void IntersectSpheres(const FFixedSphereSoA& Spheres, TArrayView<int32> OutItems, TArrayView<FFixed64> OutTimes, bool bAnyHit = false, bool bParallel = false) const;
+
+	/**
+	* Tests every segment against every plane. A hit is the plane not being parallel to the segment and the time
+	* LinePlaneIntersection(Start, End, Plane.GetOrigin(), Plane.GetNormal()) uses lying in [0, 1],
+	* Start + (End - Start) * Time is then exactly the point LinePlaneIntersection returns.
+	*
+	* @see IntersectSpheres for the other parameters
+	*/
+	void IntersectPlanes(const FFixedPlaneSoA& Planes, TArrayView<int32> OutItems, TArrayView<FFixed64> OutTimes, bool bAnyHit = false, bool bParallel = false) const;
+
+	/**
+	* Tests every segment against every box, a hit and its time are those of FFixedPointMath::LineBoxIntersection with
+	* StartToEnd = End - Start.
+	*
+	* @see IntersectSpheres for the other parameters
+	*/
+	void IntersectBoxes(const FFixedBoxSoA& Boxes, TArrayView<int32> OutItems, TArrayView<FFixed64> OutTimes, bool bAnyHit = false, bool bParallel = false) const;
+
+	/**
+	* Tests every segment against every triangle, a hit is FFixedPointMath::SegmentTriangleIntersection returning true.
+	*
+	* @see IntersectSpheres for the other parameters
+	*/
+	void IntersectTriangles(const FFixedTriangleSoA& Triangles, TArrayView<int32> OutItems, TArrayView<FFixed64> OutTimes, bool bAnyHit = false, bool bParallel = false) const;
+
+private:
+	int32 AddInternal(const FFixedVector64& Start, const FFixedVector64& End, const FFixedVector64& Dir, FFixed64 InLength);
+
+	TArray<FFixed64> StartX;
+	TArray<FFixed64> StartY;
+	TArray<FFixed64> StartZ;
+	TArray<FFixed64> EndX;
+	TArray<FFixed64> EndY;
+	TArray<FFixed64> EndZ;
+	TArray<FFixed64> DirX;
+	TArray<FFixed64> DirY;
+	TArray<FFixed64> DirZ;
+	TArray<FFixed64> Length;
+
+	/** End - Start */
+	TArray<FFixed64> DeltaX;
+	TArray<FFixed64> DeltaY;
+	TArray<FFixed64> DeltaZ;
+
+	/** |Length|, and |Length| times one plus one raw unit, the exact bounds a sphere time numerator is compared against */
+	TArray<int64> TimeDenominator;
+	TArray<FixedPoint::Int128::FInt128> TimeUpperBound;
+};
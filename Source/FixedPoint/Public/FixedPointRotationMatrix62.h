@@ -0,0 +1,152 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointInt128.h"
+#include "FixedPointRotationMatrix62.generated.h"
+
+/**
+* FFixedRotationMatrix62
+* Pure rotation matrix with Q1.62 entries, 42 more fraction bits than FFixedMatrix for values that never leave [-1, 1].
+* Same row vector layout as FFixedMatrix. Rotating a FFixedVector64 is a mixed format multiply,
+* each Q43.20 by Q1.62 product is summed at 128 bits and truncated once, 9 multiplies instead of 16 through TBigInt.
+* Long chains of rotations stay orthonormal to far more bits, 10000 multiplies drift by around 1e-14, and Orthonormalize
+* pulls drift back without a square root.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedRotationMatrix62
+{
+public:
+	GENERATED_BODY()
+
+	int64 M[3][3];
+
+	static const FFixedRotationMatrix62 Identity;
+
+	/**
+	* Default constructor, no initialization
+	*/
+	FORCEINLINE FFixedRotationMatrix62() {}
+
+	/**
+	* Constructor from raw Q1.62 rows
+	*/
+	FORCEINLINE FFixedRotationMatrix62(int64 M00, int64 M01, int64 M02, int64 M10, int64 M11, int64 M12, int64 M20, int64 M21, int64 M22)
+	{
+		M[0][0] = M00; M[0][1] = M01; M[0][2] = M02;
+		M[1][0] = M10; M[1][1] = M11; M[1][2] = M12;
+		M[2][0] = M20; M[2][1] = M21; M[2][2] = M22;
+	}
+
+	/**
+	* Constructor from a quaternion, the terms are exact 40 bit int64 products of the 20 bit components widened by 2^22 to
+	* 62 bits, then orthonormalized
+	*/
+	explicit FFixedRotationMatrix62(const FFixedQuat64& Q);
+
+	/**
+	* Constructor from a rotator, the same rotation as FFixedRotationMatrix refined to 62 bits
+	*/
+	explicit FFixedRotationMatrix62(const FFixedRotator64& Rot);
+
+	/**
+	* Constructor from the upper 3x3 of a matrix, which should be a pure rotation, refined to 62 bits
+	*/
+	explicit FFixedRotationMatrix62(const FFixedMatrix33& InMatrix);
+
+	/**
+	 * Gets the result of multiplying this by another rotation, applying this first, entries summed at 128 bits and truncated once.
+	 */
+	FORCEINLINE FFixedRotationMatrix62 operator*(const FFixedRotationMatrix62& Other) const
+	{
+		FFixedRotationMatrix62 Result;
+		for (int32 Row = 0; Row < 3; Row++)
+		{
+			for (int32 Column = 0; Column < 3; Column++)
+			{
+				Result.M[Row][Column] = Dot3(M[Row][0], Other.M[0][Column], M[Row][1], Other.M[1][Column], M[Row][2], Other.M[2][Column], FixedPoint::Constants::BinaryPointRotation);
+			}
+		}
+		return Result;
+	}
+
+	FORCEINLINE FFixedRotationMatrix62& operator*=(const FFixedRotationMatrix62& Other)
+	{
+		*this = *this * Other;
+		return *this;
+	}
+
+	FORCEINLINE bool operator==(const FFixedRotationMatrix62& Other) const
+	{
+		return FMemory::Memcmp(M, Other.M, sizeof(M)) == 0;
+	}
+
+	FORCEINLINE bool operator!=(const FFixedRotationMatrix62& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	/** Rotate a vector, V * M, a mixed format multiply summed at 128 bits and truncated once */
+	FORCEINLINE FFixedVector64 TransformVector(const FFixedVector64& V) const
+	{
+		return FFixedVector64(
+			FFixed64::MakeFromRawInt(Dot3(V.X.Value, M[0][0], V.Y.Value, M[1][0], V.Z.Value, M[2][0], FixedPoint::Constants::BinaryPointRotation)),
+			FFixed64::MakeFromRawInt(Dot3(V.X.Value, M[0][1], V.Y.Value, M[1][1], V.Z.Value, M[2][1], FixedPoint::Constants::BinaryPointRotation)),
+			FFixed64::MakeFromRawInt(Dot3(V.X.Value, M[0][2], V.Y.Value, M[1][2], V.Z.Value, M[2][2], FixedPoint::Constants::BinaryPointRotation)));
+	}
+
+	/** Rotate a vector by the inverse of this rotation, which is the transpose */
+	FORCEINLINE FFixedVector64 InverseTransformVector(const FFixedVector64& V) const
+	{
+		return FFixedVector64(
+			FFixed64::MakeFromRawInt(Dot3(V.X.Value, M[0][0], V.Y.Value, M[0][1], V.Z.Value, M[0][2], FixedPoint::Constants::BinaryPointRotation)),
+			FFixed64::MakeFromRawInt(Dot3(V.X.Value, M[1][0], V.Y.Value, M[1][1], V.Z.Value, M[1][2], FixedPoint::Constants::BinaryPointRotation)),
+			FFixed64::MakeFromRawInt(Dot3(V.X.Value, M[2][0], V.Y.Value, M[2][1], V.Z.Value, M[2][2], FixedPoint::Constants::BinaryPointRotation)));
+	}
+
+	FORCEINLINE FFixedRotationMatrix62 GetTransposed() const
+	{
+		return FFixedRotationMatrix62(
+			M[0][0], M[1][0], M[2][0],
+			M[0][1], M[1][1], M[2][1],
+			M[0][2], M[1][2], M[2][2]);
+	}
+
+	/** @return the inverse rotation, exact since it is the transpose */
+	FORCEINLINE FFixedRotationMatrix62 Inverse() const
+	{
+		return GetTransposed();
+	}
+
+	/**
+	 * Pulls a rotation that has drifted back towards orthonormal with one Newton step, M = M * (3I - Mt * M) / 2.
+	 * No square root or division, each step squares the error, so call it every so often on long accumulations.
+	 */
+	void Orthonormalize();
+
+	/** @return the rotation with entries rounded to FFixed64 */
+	FFixedMatrix33 ToMatrix33() const;
+
+	/** @return the rotation with entries rounded to FFixed64, no translation */
+	FFixedMatrix ToMatrix() const;
+
+	/**
+	 * Rotates an array of vectors by this matrix.
+	 *
+	 * @param Vectors - Vectors to rotate
+	 * @param OutVectors - Receives the rotated vectors, must be the same length as Vectors, may alias it
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	void TransformVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel = false) const;
+
+	/** Sum of three products of raw values truncated once by Shift */
+	static FORCEINLINE int64 Dot3(int64 A0, int64 B0, int64 A1, int64 B1, int64 A2, int64 B2, uint32 Shift)
+	{
+		using namespace FixedPoint::Int128;
+		return ShiftRightTruncate(Add(Add(Mul(A0, B0), Mul(A1, B1)), Mul(A2, B2)), Shift);
+	}
+};
@@ -285,6 +285,43 @@ public:
 	 */
 	FORCEINLINE FFixedVector64 UnrotateVector(const FFixedVector64& V) const;
 
+	/**
+	 * Rotate a vector by this rotator through its quaternion instead of a rotation matrix.
+	 * Faster than RotateVector, but the result can differ from it in the last few bits.
+	 *
+	 * @param V The vector to rotate.
+	 * @return The rotated vector.
+	 */
+	FORCEINLINE FFixedVector64 QuatRotateVector(const FFixedVector64& V) const;
+
+	/**
+	 * Returns the vector rotated by the inverse of this rotator, through its quaternion instead of a rotation matrix.
+	 * Faster than UnrotateVector, but the result can differ from it in the last few bits.
+	 *
+	 * @param V The vector to rotate.
+	 * @return The rotated vector.
+	 */
+	FORCEINLINE FFixedVector64 QuatUnrotateVector(const FFixedVector64& V) const;
+
+	/**
+	 * Rotates an array of vectors by this rotator, the trig is evaluated once for the whole batch.
+	 * To rotate vectors a few at a time with the same rotator, keep a FFixedMatrix33 built from it instead.
+	 *
+	 * @param Vectors - Vectors to rotate
+	 * @param OutVectors - Receives the rotated vectors, must be the same length as Vectors, may alias it
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	void RotateVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel = false) const;
+
+	/**
+	 * Rotates an array of vectors by the inverse of this rotator, the trig is evaluated once for the whole batch.
+	 *
+	 * @param Vectors - Vectors to rotate
+	 * @param OutVectors - Receives the rotated vectors, must be the same length as Vectors, may alias it
+	 * @param bParallel - Split large arrays across task threads with ParallelFor
+	 */
+	void UnrotateVectors(TArrayView<const FFixedVector64> Vectors, TArrayView<FFixedVector64> OutVectors, bool bParallel = false) const;
+
 	/**
 	 * Gets the rotation values so they fall within the range [0,360]
 	 *
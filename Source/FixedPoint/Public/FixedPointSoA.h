@@ -0,0 +1,686 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointVector2D.h"
+#include "FixedPointQuat.h"
+#include "FixedPointTransform.h"
+#include "FixedPointPlane.h"
+#include "FixedPointBox.h"
+#include "FixedPointSphere.h"
+
+/**
+* FFixed32Vector2SoA
+* Structure of arrays storage for 2D FFixed32 vectors, 8 bytes per vector.
+* Components are stored in separate arrays so batch kernels can stream each one with full width loads.
+*/
+struct FFixed32Vector2SoA
+{
+	TArray<FFixed32> X;
+	TArray<FFixed32> Y;
+
+	FORCEINLINE int32 Num() const
+	{
+		return X.Num();
+	}
+
+	FORCEINLINE void SetNumZeroed(int32 NewNum)
+	{
+		X.SetNumZeroed(NewNum);
+		Y.SetNumZeroed(NewNum);
+	}
+
+	FORCEINLINE void Reserve(int32 Number)
+	{
+		X.Reserve(Number);
+		Y.Reserve(Number);
+	}
+
+	FORCEINLINE void Reset()
+	{
+		X.Reset();
+		Y.Reset();
+	}
+
+	FORCEINLINE int32 Add(const FFixed32& InX, const FFixed32& InY)
+	{
+		Y.Add(InY);
+		return X.Add(InX);
+	}
+
+	/**
+	* Adds a vector, converting each component from FFixed64
+	*/
+	FORCEINLINE int32 Add(const FFixedVector2d& V)
+	{
+		return Add(FFixed32(V.X), FFixed32(V.Y));
+	}
+
+	FORCEINLINE void Set(int32 Index, const FFixedVector2d& V)
+	{
+		X[Index] = FFixed32(V.X);
+		Y[Index] = FFixed32(V.Y);
+	}
+
+	/**
+	* Gets a vector, converting each component to FFixed64
+	*/
+	FORCEINLINE FFixedVector2d Get(int32 Index) const
+	{
+		return FFixedVector2d(FFixed64(X[Index]), FFixed64(Y[Index]));
+	}
+};
+
+/**
+* FFixed32Vector3SoA
+* Structure of arrays storage for 3D FFixed32 vectors, 12 bytes per vector, half of FFixedVector64.
+* Components are stored in separate arrays so batch kernels can stream each one with full width loads.
+*/
+struct FFixed32Vector3SoA
+{
+	TArray<FFixed32> X;
+	TArray<FFixed32> Y;
+	TArray<FFixed32> Z;
+
+	FORCEINLINE int32 Num() const
+	{
+		return X.Num();
+	}
+
+	FORCEINLINE void SetNumZeroed(int32 NewNum)
+	{
+		X.SetNumZeroed(NewNum);
+		Y.SetNumZeroed(NewNum);
+		Z.SetNumZeroed(NewNum);
+	}
+
+	FORCEINLINE void Reserve(int32 Number)
+	{
+		X.Reserve(Number);
+		Y.Reserve(Number);
+		Z.Reserve(Number);
+	}
+
+	FORCEINLINE void Reset()
+	{
+		X.Reset();
+		Y.Reset();
+		Z.Reset();
+	}
+
+	FORCEINLINE int32 Add(const FFixed32& InX, const FFixed32& InY, const FFixed32& InZ)
+	{
+		Y.Add(InY);
+		Z.Add(InZ);
+		return X.Add(InX);
+	}
+
+	/**
+	* Adds a vector, converting each component from FFixed64
+	*/
+	FORCEINLINE int32 Add(const FFixedVector64& V)
+	{
+		return Add(FFixed32(V.X), FFixed32(V.Y), FFixed32(V.Z));
+	}
+
+	FORCEINLINE void Set(int32 Index, const FFixedVector64& V)
+	{
+		X[Index] = FFixed32(V.X);
+		Y[Index] = FFixed32(V.Y);
+		Z[Index] = FFixed32(V.Z);
+	}
+
+	/**
+	* Gets a vector, converting each component to FFixed64
+	*/
+	FORCEINLINE FFixedVector64 Get(int32 Index) const
+	{
+		return FFixedVector64(FFixed64(X[Index]), FFixed64(Y[Index]), FFixed64(Z[Index]));
+	}
+};
+
+/**
+* FFixedTransform64SoA
+* Structure of arrays storage for FFixedTransform64, one array per component of rotation, translation and scale.
+* Used as working storage by the batch hierarchy functions so each level streams through contiguous memory.
+*/
+struct FFixedTransform64SoA
+{
+	TArray<FFixed64> RotationX;
+	TArray<FFixed64> RotationY;
+	TArray<FFixed64> RotationZ;
+	TArray<FFixed64> RotationW;
+	TArray<FFixed64> TranslationX;
+	TArray<FFixed64> TranslationY;
+	TArray<FFixed64> TranslationZ;
+	TArray<FFixed64> ScaleX;
+	TArray<FFixed64> ScaleY;
+	TArray<FFixed64> ScaleZ;
+
+	FORCEINLINE int32 Num() const
+	{
+		return RotationX.Num();
+	}
+
+	FORCEINLINE void SetNumUninitialized(int32 NewNum)
+	{
+		RotationX.SetNumUninitialized(NewNum);
+		RotationY.SetNumUninitialized(NewNum);
+		RotationZ.SetNumUninitialized(NewNum);
+		RotationW.SetNumUninitialized(NewNum);
+		TranslationX.SetNumUninitialized(NewNum);
+		TranslationY.SetNumUninitialized(NewNum);
+		TranslationZ.SetNumUninitialized(NewNum);
+		ScaleX.SetNumUninitialized(NewNum);
+		ScaleY.SetNumUninitialized(NewNum);
+		ScaleZ.SetNumUninitialized(NewNum);
+	}
+
+	FORCEINLINE void Reset()
+	{
+		RotationX.Reset();
+		RotationY.Reset();
+		RotationZ.Reset();
+		RotationW.Reset();
+		TranslationX.Reset();
+		TranslationY.Reset();
+		TranslationZ.Reset();
+		ScaleX.Reset();
+		ScaleY.Reset();
+		ScaleZ.Reset();
+	}
+
+	FORCEINLINE void Set(int32 Index, const FFixedTransform64& Transform)
+	{
+		const FFixedQuat64 Rotation = Transform.GetRotation();
+		const FFixedVector64 Translation = Transform.GetTranslation();
+		const FFixedVector64 Scale = Transform.GetScale3D();
+		RotationX[Index] = Rotation.X;
+		RotationY[Index] = Rotation.Y;
+		RotationZ[Index] = Rotation.Z;
+		RotationW[Index] = Rotation.W;
+		TranslationX[Index] = Translation.X;
+		TranslationY[Index] = Translation.Y;
+		TranslationZ[Index] = Translation.Z;
+		ScaleX[Index] = Scale.X;
+		ScaleY[Index] = Scale.Y;
+		ScaleZ[Index] = Scale.Z;
+	}
+
+	FORCEINLINE FFixedTransform64 Get(int32 Index) const
+	{
+		return FFixedTransform64(
+			FFixedQuat64(RotationX[Index], RotationY[Index], RotationZ[Index], RotationW[Index]),
+			FFixedVector64(TranslationX[Index], TranslationY[Index], TranslationZ[Index]),
+			FFixedVector64(ScaleX[Index], ScaleY[Index], ScaleZ[Index]));
+	}
+};
+
+/**
+* FFixedPlaneSoA
+* Structure of arrays storage for FFixedPlane, one array per coefficient.
+* Testing a point against every plane streams four contiguous arrays instead of striding over 32 byte planes,
+* distances are computed exactly as FFixedPlane::PlaneDot so results match the array of structs path.
+*/
+struct FFixedPlaneSoA
+{
+	TArray<FFixed64> X;
+	TArray<FFixed64> Y;
+	TArray<FFixed64> Z;
+	TArray<FFixed64> W;
+
+	FORCEINLINE int32 Num() const
+	{
+		return X.Num();
+	}
+
+	FORCEINLINE void SetNumUninitialized(int32 NewNum)
+	{
+		X.SetNumUninitialized(NewNum);
+		Y.SetNumUninitialized(NewNum);
+		Z.SetNumUninitialized(NewNum);
+		W.SetNumUninitialized(NewNum);
+	}
+
+	FORCEINLINE void Reserve(int32 Number)
+	{
+		X.Reserve(Number);
+		Y.Reserve(Number);
+		Z.Reserve(Number);
+		W.Reserve(Number);
+	}
+
+	FORCEINLINE void Reset()
+	{
+		X.Reset();
+		Y.Reset();
+		Z.Reset();
+		W.Reset();
+	}
+
+	FORCEINLINE int32 Add(const FFixedPlane& Plane)
+	{
+		Y.Add(Plane.Y);
+		Z.Add(Plane.Z);
+		W.Add(Plane.W);
+		return X.Add(Plane.X);
+	}
+
+	FORCEINLINE void Set(int32 Index, const FFixedPlane& Plane)
+	{
+		X[Index] = Plane.X;
+		Y[Index] = Plane.Y;
+		Z[Index] = Plane.Z;
+		W[Index] = Plane.W;
+	}
+
+	FORCEINLINE FFixedPlane Get(int32 Index) const
+	{
+		return FFixedPlane(X[Index], Y[Index], Z[Index], W[Index]);
+	}
+
+	/**
+	* Replaces the contents with a copy of Planes
+	*/
+	FORCEINLINE void SetPlanes(TArrayView<const FFixedPlane> Planes)
+	{
+		SetNumUninitialized(Planes.Num());
+		for (int32 i = 0; i < Planes.Num(); i++)
+		{
+			Set(i, Planes[i]);
+		}
+	}
+
+	/**
+	* Transforms every plane in place by M, computing the transpose-adjoint and determinant once.
+	* Each plane ends up identical to FFixedPlane::TransformBy.
+	*/
+	FORCEINLINE void TransformBy(const FFixedMatrix& M);
+
+	/**
+	* Calculates the distance from every plane to P, see FFixedPlane::PlaneDot.
+	*
+	* @param P - The point to test
+	* @param OutDistances - Receives one distance per plane, must be Num() long
+	*/
+	FORCEINLINE void PlaneDots(const FFixedVector64& P, TArrayView<FFixed64> OutDistances) const
+	{
+		check(OutDistances.Num() == Num());
+		for (int32 i = 0; i < Num(); i++)
+		{
+			OutDistances[i] = X[i] * P.X + Y[i] * P.Y + Z[i] * P.Z - W[i];
+		}
+	}
+
+	/**
+	* @return true if P is on or behind every plane, with an early out on the first plane it is in front of.
+	* An empty set of planes contains every point.
+	*/
+	FORCEINLINE bool IsPointInside(const FFixedVector64& P) const
+	{
+		const int32 NumPlanes = Num();
+		for (int32 i = 0; i < NumPlanes; i++)
+		{
+			if (X[i] * P.X + Y[i] * P.Y + Z[i] * P.Z - W[i] > FixedPoint::Constants::Fixed64::Zero)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	* Classifies each point against all planes, OutInside[i] is IsPointInside(Points[i]).
+	* Planes are the outer loop so each coefficient is loaded once per plane rather than once per point.
+	*
+	* @param Points - Points to classify
+	* @param OutInside - Receives the result per point, must be the same length as Points
+	*/
+	FORCEINLINE void ClassifyPoints(TArrayView<const FFixedVector64> Points, TArrayView<bool> OutInside) const
+	{
+		check(OutInside.Num() == Points.Num());
+		const int32 NumPoints = Points.Num();
+		for (int32 PointIndex = 0; PointIndex < NumPoints; PointIndex++)
+		{
+			OutInside[PointIndex] = true;
+		}
+		const int32 NumPlanes = Num();
+		for (int32 PlaneIndex = 0; PlaneIndex < NumPlanes; PlaneIndex++)
+		{
+			const FFixed64 PX = X[PlaneIndex], PY = Y[PlaneIndex], PZ = Z[PlaneIndex], PW = W[PlaneIndex];
+			for (int32 PointIndex = 0; PointIndex < NumPoints; PointIndex++)
+			{
+				const FFixedVector64& P = Points[PointIndex];
+				OutInside[PointIndex] &= !(PX * P.X + PY * P.Y + PZ * P.Z - PW > FixedPoint::Constants::Fixed64::Zero);
+			}
+		}
+	}
+};
+
+/**
+* FFixedBoxSoA
+* Structure of arrays storage for FFixedBox, one array per bound.
+* The overlap queries test one volume against every box in a single pass with no early outs,
+* each result matches the corresponding FFixedBox or FFixedSphere test exactly.
+*/
+struct FFixedBoxSoA
+{
+	TArray<FFixed64> MinX;
+	TArray<FFixed64> MinY;
+	TArray<FFixed64> MinZ;
+	TArray<FFixed64> MaxX;
+	TArray<FFixed64> MaxY;
+	TArray<FFixed64> MaxZ;
+
+	FORCEINLINE int32 Num() const
+	{
+		return MinX.Num();
+	}
+
+	FORCEINLINE void SetNumUninitialized(int32 NewNum)
+	{
+		MinX.SetNumUninitialized(NewNum);
+		MinY.SetNumUninitialized(NewNum);
+		MinZ.SetNumUninitialized(NewNum);
+		MaxX.SetNumUninitialized(NewNum);
+		MaxY.SetNumUninitialized(NewNum);
+		MaxZ.SetNumUninitialized(NewNum);
+	}
+
+	FORCEINLINE void Reserve(int32 Number)
+	{
+		MinX.Reserve(Number);
+		MinY.Reserve(Number);
+		MinZ.Reserve(Number);
+		MaxX.Reserve(Number);
+		MaxY.Reserve(Number);
+		MaxZ.Reserve(Number);
+	}
+
+	FORCEINLINE void Reset()
+	{
+		MinX.Reset();
+		MinY.Reset();
+		MinZ.Reset();
+		MaxX.Reset();
+		MaxY.Reset();
+		MaxZ.Reset();
+	}
+
+	FORCEINLINE int32 Add(const FFixedBox& Box)
+	{
+		MinY.Add(Box.Min.Y);
+		MinZ.Add(Box.Min.Z);
+		MaxX.Add(Box.Max.X);
+		MaxY.Add(Box.Max.Y);
+		MaxZ.Add(Box.Max.Z);
+		return MinX.Add(Box.Min.X);
+	}
+
+	FORCEINLINE void Set(int32 Index, const FFixedBox& Box)
+	{
+		MinX[Index] = Box.Min.X;
+		MinY[Index] = Box.Min.Y;
+		MinZ[Index] = Box.Min.Z;
+		MaxX[Index] = Box.Max.X;
+		MaxY[Index] = Box.Max.Y;
+		MaxZ[Index] = Box.Max.Z;
+	}
+
+	FORCEINLINE FFixedBox Get(int32 Index) const
+	{
+		return FFixedBox(FFixedVector64(MinX[Index], MinY[Index], MinZ[Index]), FFixedVector64(MaxX[Index], MaxY[Index], MaxZ[Index]));
+	}
+
+	/**
+	* Finds every box that intersects Query, see FFixedBox::Intersect.
+	*
+	* @param Query - The box to test against every stored box
+	* @param OutIndices - Indices of the intersecting boxes are appended in ascending order
+	* @return the number of indices appended
+	*/
+	FORCEINLINE int32 OverlapBox(const FFixedBox& Query, TArray<int32>& OutIndices) const
+	{
+		const int32 FirstIndex = OutIndices.Num();
+		for (int32 i = 0; i < Num(); i++)
+		{
+			// non short circuiting so the six compares stay branch free
+			const bool bOverlap = (MinX[i] <= Query.Max.X) & (Query.Min.X <= MaxX[i])
+				& (MinY[i] <= Query.Max.Y) & (Query.Min.Y <= MaxY[i])
+				& (MinZ[i] <= Query.Max.Z) & (Query.Min.Z <= MaxZ[i]);
+			if (bOverlap)
+			{
+				OutIndices.Add(i);
+			}
+		}
+		return OutIndices.Num() - FirstIndex;
+	}
+
+	/**
+	* Finds every box that intersects Query, see FFixedSphere::Intersects.
+	*
+	* @param Query - The sphere to test against every stored box
+	* @param OutIndices - Indices of the intersecting boxes are appended in ascending order
+	* @return the number of indices appended
+	*/
+	FORCEINLINE int32 OverlapSphere(const FFixedSphere& Query, TArray<int32>& OutIndices) const
+	{
+		const int32 FirstIndex = OutIndices.Num();
+		const FFixed64 RadiusSquared = FFixedPointMath::Square(Query.W);
+		for (int32 i = 0; i < Num(); i++)
+		{
+			// at most one of the two differences is positive on each axis, the same term ComputeSquaredDistanceFromBoxToPoint adds
+			const FFixed64 DX = FFixedPointMath::Max(FFixedPointMath::Max(MinX[i] - Query.Center.X, Query.Center.X - MaxX[i]), FixedPoint::Constants::Fixed64::Zero);
+			const FFixed64 DY = FFixedPointMath::Max(FFixedPointMath::Max(MinY[i] - Query.Center.Y, Query.Center.Y - MaxY[i]), FixedPoint::Constants::Fixed64::Zero);
+			const FFixed64 DZ = FFixedPointMath::Max(FFixedPointMath::Max(MinZ[i] - Query.Center.Z, Query.Center.Z - MaxZ[i]), FixedPoint::Constants::Fixed64::Zero);
+			if (DX * DX + DY * DY + DZ * DZ <= RadiusSquared)
+			{
+				OutIndices.Add(i);
+			}
+		}
+		return OutIndices.Num() - FirstIndex;
+	}
+};
+
+/**
+* FFixedSphereSoA
+* Structure of arrays storage for FFixedSphere, centers and radii in separate arrays.
+* The overlap queries match FFixedSphere::Intersects for each stored sphere exactly.
+*/
+struct FFixedSphereSoA
+{
+	TArray<FFixed64> CenterX;
+	TArray<FFixed64> CenterY;
+	TArray<FFixed64> CenterZ;
+	TArray<FFixed64> W;
+
+	FORCEINLINE int32 Num() const
+	{
+		return CenterX.Num();
+	}
+
+	FORCEINLINE void SetNumUninitialized(int32 NewNum)
+	{
+		CenterX.SetNumUninitialized(NewNum);
+		CenterY.SetNumUninitialized(NewNum);
+		CenterZ.SetNumUninitialized(NewNum);
+		W.SetNumUninitialized(NewNum);
+	}
+
+	FORCEINLINE void Reserve(int32 Number)
+	{
+		CenterX.Reserve(Number);
+		CenterY.Reserve(Number);
+		CenterZ.Reserve(Number);
+		W.Reserve(Number);
+	}
+
+	FORCEINLINE void Reset()
+	{
+		CenterX.Reset();
+		CenterY.Reset();
+		CenterZ.Reset();
+		W.Reset();
+	}
+
+	FORCEINLINE int32 Add(const FFixedSphere& Sphere)
+	{
+		CenterY.Add(Sphere.Center.Y);
+		CenterZ.Add(Sphere.Center.Z);
+		W.Add(Sphere.W);
+		return CenterX.Add(Sphere.Center.X);
+	}
+
+	FORCEINLINE void Set(int32 Index, const FFixedSphere& Sphere)
+	{
+		CenterX[Index] = Sphere.Center.X;
+		CenterY[Index] = Sphere.Center.Y;
+		CenterZ[Index] = Sphere.Center.Z;
+		W[Index] = Sphere.W;
+	}
+
+	FORCEINLINE FFixedSphere Get(int32 Index) const
+	{
+		return FFixedSphere(FFixedVector64(CenterX[Index], CenterY[Index], CenterZ[Index]), W[Index]);
+	}
+
+	/**
+	* Finds every sphere that intersects Query, see FFixedSphere::Intersects.
+	*
+	* @param Query - The sphere to test against every stored sphere
+	* @param OutIndices - Indices of the intersecting spheres are appended in ascending order
+	* @param Tolerance - Error tolerance, the same as FFixedSphere::Intersects
+	* @return the number of indices appended
+	*/
+	FORCEINLINE int32 OverlapSphere(const FFixedSphere& Query, TArray<int32>& OutIndices, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		const int32 FirstIndex = OutIndices.Num();
+		for (int32 i = 0; i < Num(); i++)
+		{
+			const FFixedVector64 Delta(CenterX[i] - Query.Center.X, CenterY[i] - Query.Center.Y, CenterZ[i] - Query.Center.Z);
+			if (Delta.SizeSquared() <= FFixedPointMath::Square(FFixedPointMath::Max(FixedPoint::Constants::Fixed64::Zero, Query.W + W[i] + Tolerance)))
+			{
+				OutIndices.Add(i);
+			}
+		}
+		return OutIndices.Num() - FirstIndex;
+	}
+
+	/**
+	* Finds every sphere that intersects Query, see FFixedSphere::Intersects.
+	*
+	* @param Query - The box to test against every stored sphere
+	* @param OutIndices - Indices of the intersecting spheres are appended in ascending order
+	* @return the number of indices appended
+	*/
+	FORCEINLINE int32 OverlapBox(const FFixedBox& Query, TArray<int32>& OutIndices) const
+	{
+		const int32 FirstIndex = OutIndices.Num();
+		for (int32 i = 0; i < Num(); i++)
+		{
+			const FFixed64 DX = FFixedPointMath::Max(FFixedPointMath::Max(Query.Min.X - CenterX[i], CenterX[i] - Query.Max.X), FixedPoint::Constants::Fixed64::Zero);
+			const FFixed64 DY = FFixedPointMath::Max(FFixedPointMath::Max(Query.Min.Y - CenterY[i], CenterY[i] - Query.Max.Y), FixedPoint::Constants::Fixed64::Zero);
+			const FFixed64 DZ = FFixedPointMath::Max(FFixedPointMath::Max(Query.Min.Z - CenterZ[i], CenterZ[i] - Query.Max.Z), FixedPoint::Constants::Fixed64::Zero);
+			if (DX * DX + DY * DY + DZ * DZ <= FFixedPointMath::Square(W[i]))
+			{
+				OutIndices.Add(i);
+			}
+		}
+		return OutIndices.Num() - FirstIndex;
+	}
+};
+
+/**
+* FFixedTriangleSoA
+* Structure of arrays storage for triangles as a corner and two edges, B - A and C - A.
+* The edges are what FFixedPointMath::SegmentTriangleIntersection computes first, storing them keeps the results identical
+* while skipping two subtractions per test.
+*/
+struct FFixedTriangleSoA
+{
+	TArray<FFixed64> AX;
+	TArray<FFixed64> AY;
+	TArray<FFixed64> AZ;
+	TArray<FFixed64> Edge1X;
+	TArray<FFixed64> Edge1Y;
+	TArray<FFixed64> Edge1Z;
+	TArray<FFixed64> Edge2X;
+	TArray<FFixed64> Edge2Y;
+	TArray<FFixed64> Edge2Z;
+
+	FORCEINLINE int32 Num() const
+	{
+		return AX.Num();
+	}
+
+	FORCEINLINE void SetNumUninitialized(int32 NewNum)
+	{
+		AX.SetNumUninitialized(NewNum);
+		AY.SetNumUninitialized(NewNum);
+		AZ.SetNumUninitialized(NewNum);
+		Edge1X.SetNumUninitialized(NewNum);
+		Edge1Y.SetNumUninitialized(NewNum);
+		Edge1Z.SetNumUninitialized(NewNum);
+		Edge2X.SetNumUninitialized(NewNum);
+		Edge2Y.SetNumUninitialized(NewNum);
+		Edge2Z.SetNumUninitialized(NewNum);
+	}
+
+	FORCEINLINE void Reserve(int32 Number)
+	{
+		AX.Reserve(Number);
+		AY.Reserve(Number);
+		AZ.Reserve(Number);
+		Edge1X.Reserve(Number);
+		Edge1Y.Reserve(Number);
+		Edge1Z.Reserve(Number);
+		Edge2X.Reserve(Number);
+		Edge2Y.Reserve(Number);
+		Edge2Z.Reserve(Number);
+	}
+
+	FORCEINLINE void Reset()
+	{
+		AX.Reset();
+		AY.Reset();
+		AZ.Reset();
+		Edge1X.Reset();
+		Edge1Y.Reset();
+		Edge1Z.Reset();
+		Edge2X.Reset();
+		Edge2Y.Reset();
+		Edge2Z.Reset();
+	}
+
+	FORCEINLINE int32 Add(const FFixedVector64& A, const FFixedVector64& B, const FFixedVector64& C)
+	{
+		const int32 Index = AX.Num();
+		SetNumUninitialized(Index + 1);
+		Set(Index, A, B, C);
+		return Index;
+	}
+
+	FORCEINLINE void Set(int32 Index, const FFixedVector64& A, const FFixedVector64& B, const FFixedVector64& C)
+	{
+		AX[Index] = A.X;
+		AY[Index] = A.Y;
+		AZ[Index] = A.Z;
+		Edge1X[Index] = B.X - A.X;
+		Edge1Y[Index] = B.Y - A.Y;
+		Edge1Z[Index] = B.Z - A.Z;
+		Edge2X[Index] = C.X - A.X;
+		Edge2Y[Index] = C.Y - A.Y;
+		Edge2Z[Index] = C.Z - A.Z;
+	}
+
+	/** Corners are rebuilt exactly, the edges were stored without rounding */
+	FORCEINLINE void Get(int32 Index, FFixedVector64& OutA, FFixedVector64& OutB, FFixedVector64& OutC) const
+	{
+		OutA = FFixedVector64(AX[Index], AY[Index], AZ[Index]);
+		OutB = OutA + FFixedVector64(Edge1X[Index], Edge1Y[Index], Edge1Z[Index]);
+		OutC = OutA + FFixedVector64(Edge2X[Index], Edge2Y[Index], Edge2Z[Index]);
+	}
+};
@@ -0,0 +1,180 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointBox.h"
+
+/**
+* FFixedSpatialGrid
+* Uniform grid of cubic cells for neighbour queries over points identified by caller chosen ids.
+* Cell coordinates are the floor of raw FFixed64 values divided by the raw cell size, so they are exact integers
+* and the grid is bit identical on every machine.
+*
+* Elements are packed in (Z, Y, X) cell order and by id within a cell, and occupied cells are found through an
+* open addressing hash table storing the cell coordinates inline, so a query touches one slot per cell and then streams
+* contiguous ids and positions. Insert, Remove and moves to another cell go on a dirty list and take effect at Flush,
+* which merges them into the packed order without re-sorting the untouched elements.
+* Moves that stay inside their cell update the packed position directly and do not need a Flush.
+*
+* Query results never depend on the order of edits or on thread count: radius and box queries return ids in cell order
+* then id order, nearest queries return ids by distance then id.
+*/
+struct FIXEDPOINT_API FFixedSpatialGrid
+{
+public:
+	FFixedSpatialGrid();
+
+	/** @param InCellSize - Edge length of a cell, must be positive. Around the most common query radius works well */
+	explicit FFixedSpatialGrid(FFixed64 InCellSize);
+
+	/** Removes every element and changes the cell size */
+	void Reset(FFixed64 InCellSize);
+
+	FORCEINLINE FFixed64 GetCellSize() const
+	{
+		return CellSize;
+	}
+
+	/**
+	* Adds an element, it is visible to queries after the next Flush.
+	*
+	* @param Id - Non negative id not already in the grid, storage grows to the largest id used
+	* @param Position - Location of the element
+	*/
+	void Insert(int32 Id, const FFixedVector64& Position);
+
+	/** Removes an element, it stays visible to queries until the next Flush */
+	void Remove(int32 Id);
+
+	/** Moves an element, a move to another cell is visible to queries after the next Flush */
+	void Move(int32 Id, const FFixedVector64& NewPosition);
+
+	/** Applies every pending Insert, Remove and move to another cell */
+	void Flush();
+
+	/** @return true if there are edits waiting for Flush, queries check this */
+	FORCEINLINE bool IsDirty() const
+	{
+		return DirtyIds.Num() > 0;
+	}
+
+	FORCEINLINE bool Contains(int32 Id) const
+	{
+		return IdFlags.IsValidIndex(Id) && (IdFlags[Id] & Present) != 0;
+	}
+
+	FORCEINLINE const FFixedVector64& GetPosition(int32 Id) const
+	{
+		check(Contains(Id));
+		return Positions[Id];
+	}
+
+	FORCEINLINE int32 Num() const
+	{
+		return NumElements;
+	}
+
+	/** @return ids inserted or moved to another cell by the last Flush, ascending */
+	FORCEINLINE TArrayView<const int32> GetChangedIds() const
+	{
+		return ChangedIds;
+	}
+
+	/**
+	* Finds every element within Radius of Center, inclusive.
+	*
+	* @param OutIds - Ids are appended in cell order, then id order within a cell
+	*/
+	void QueryRadius(const FFixedVector64& Center, FFixed64 Radius, TArray<int32>& OutIds) const;
+
+	/**
+	* Finds every element inside or on Box.
+	*
+	* @param OutIds - Ids are appended in cell order, then id order within a cell
+	*/
+	void QueryBox(const FFixedBox& Box, TArray<int32>& OutIds) const;
+
+	/**
+	* Finds the K elements nearest to Center, compared by squared distance so no square root is taken.
+	* Ties are broken by the lower id, so the result is unique.
+	*
+	* @param OutIds - Replaced with up to K ids, nearest first
+	*/
+	void QueryNearest(const FFixedVector64& Center, int32 K, TArray<int32>& OutIds) const;
+
+	/**
+	* Runs QueryRadius for each center.
+	*
+	* @param OutIds - One array per center, each replaced with the result for that center, must be the same length as Centers
+	* @param bParallel - Split the queries across task threads with ParallelFor, results are identical either way
+	*/
+	void QueryRadius(TArrayView<const FFixedVector64> Centers, FFixed64 Radius, TArrayView<TArray<int32>> OutIds, bool bParallel = false) const;
+
+	/**
+	* Runs QueryNearest for each center.
+	*
+	* @param OutIds - One array per center, each replaced with the result for that center, must be the same length as Centers
+	* @param bParallel - Split the queries across task threads with ParallelFor, results are identical either way
+	*/
+	void QueryNearest(TArrayView<const FFixedVector64> Centers, int32 K, TArrayView<TArray<int32>> OutIds, bool bParallel = false) const;
+
+private:
+	enum : uint8
+	{
+		Present = 1 << 0,
+		Dirty = 1 << 1,
+	};
+
+	/** A run of packed elements that share one cell */
+	struct FCell
+	{
+		FIntVector Coord;
+		int32 Start;
+		int32 Num;
+	};
+
+	/** Open addressing slot, the coordinates are stored inline so probing never leaves the table */
+	struct FSlot
+	{
+		FIntVector Coord;
+		int32 Cell;
+	};
+
+	/** Floor of each raw component divided by the raw cell size, clamped to int32 */
+	FIntVector GetCellCoord(const FFixedVector64& Position) const;
+
+	/** @return the index into Cells of an occupied cell, or INDEX_NONE */
+	int32 FindCell(const FIntVector& Coord) const;
+
+	/** Order of the packed elements, cell Z, Y, X then id */
+	bool PackedLess(int32 A, int32 B) const;
+
+	void MarkDirty(int32 Id);
+
+	/** Calls Visitor(Cell) for every occupied cell in the inclusive range, in (Z, Y, X) order */
+	template<typename VisitorType>
+	void ForEachCellInRange(const FIntVector& MinCoord, const FIntVector& MaxCoord, VisitorType&& Visitor) const;
+
+	FFixed64 CellSize;
+	int32 NumElements;
+
+	TArray<FFixedVector64> Positions;
+	TArray<FIntVector> CellOfId;
+	TArray<int32> PackedIndexOfId;
+	TArray<uint8> IdFlags;
+	TArray<int32> DirtyIds;
+	TArray<int32> ChangedIds;
+
+	TArray<int32> PackedIds;
+	TArray<FFixed64> PackedX;
+	TArray<FFixed64> PackedY;
+	TArray<FFixed64> PackedZ;
+
+	TArray<FCell> Cells;
+	TArray<FSlot> Slots;
+	FIntVector MinOccupied;
+	FIntVector MaxOccupied;
+};
@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointVector2D.h"
+
+/**
+* Space filling curve a FFixedSpatialKey follows
+*/
+enum class EFixedSpatialCurve : uint8
+{
+	/** Z-order, bits of the cell coordinates interleaved. Cheapest, with jumps between quadrants */
+	Morton,
+	/** Every step moves to a neighboring cell, so runs of keys stay closer together in space */
+	Hilbert
+};
+
+/**
+* FFixedSpatialKey
+* Space filling curve keys of FFixed64 positions, for sorting entities so ones near each other in space are near each
+* other in memory.
+*
+* A position is first snapped to a cell: each raw coordinate is floor divided by the raw cell size, or shifted when the
+* cell size is a power of two in raw units, then offset so cell zero is in the middle of the key's range. 3D keys hold
+* 21 bits per axis, cells -2^20 to 2^20 - 1, and 2D keys 32 bits per axis, cells -2^31 to 2^31 - 1. Cells outside the
+* range are clamped to its edge.
+*
+* Bits are interleaved with BMI2 pdep when the CPU has it and with shifts and masks otherwise, both give the same keys.
+* Everything is integer arithmetic so keys and orders are identical on every machine and whether or not bParallel is set.
+*/
+struct FIXEDPOINT_API FFixedSpatialKey
+{
+public:
+	static constexpr int32 Bits3D = 21;
+	static constexpr int32 Bits2D = 32;
+
+	static uint64 Morton(const FFixedVector64& Position, FFixed64 CellSize);
+	static uint64 Morton(const FFixedVector2d& Position, FFixed64 CellSize);
+	static uint64 Hilbert(const FFixedVector64& Position, FFixed64 CellSize);
+	static uint64 Hilbert(const FFixedVector2d& Position, FFixed64 CellSize);
+
+	static FORCEINLINE uint64 Make(const FFixedVector64& Position, FFixed64 CellSize, EFixedSpatialCurve Curve)
+	{
+		return Curve == EFixedSpatialCurve::Morton ? Morton(Position, CellSize) : Hilbert(Position, CellSize);
+	}
+
+	static FORCEINLINE uint64 Make(const FFixedVector2d& Position, FFixed64 CellSize, EFixedSpatialCurve Curve)
+	{
+		return Curve == EFixedSpatialCurve::Morton ? Morton(Position, CellSize) : Hilbert(Position, CellSize);
+	}
+
+	/**
+	* Keys of many positions, each the same as Make gives.
+	*
+	* @param OutKeys - Must be as long as Positions
+	* @param bParallel - Split the positions across task threads with ParallelFor
+	*/
+	static void MakeKeys(TArrayView<const FFixedVector64> Positions, FFixed64 CellSize, EFixedSpatialCurve Curve, TArrayView<uint64> OutKeys, bool bParallel = false);
+	static void MakeKeys(TArrayView<const FFixedVector2d> Positions, FFixed64 CellSize, EFixedSpatialCurve Curve, TArrayView<uint64> OutKeys, bool bParallel = false);
+
+	/** Keys of positions stored as structure of arrays, see MakeKeys */
+	static void MakeKeys(TArrayView<const FFixed64> X, TArrayView<const FFixed64> Y, TArrayView<const FFixed64> Z, FFixed64 CellSize, EFixedSpatialCurve Curve, TArrayView<uint64> OutKeys, bool bParallel = false);
+	static void MakeKeys(TArrayView<const FFixed64> X, TArrayView<const FFixed64> Y, FFixed64 CellSize, EFixedSpatialCurve Curve, TArrayView<uint64> OutKeys, bool bParallel = false);
+
+	/**
+	* Indices of Keys in ascending key order, equal keys keep their index order so the result is a pure function of the keys.
+	* A radix argsort, see FFixedRadixSort.
+	*/
+	static void SortOrder(TArrayView<const uint64> Keys, TArray<int32>& OutOrder, bool bParallel = false);
+
+	/**
+	* Reorders every array so element i becomes the element at Order[i], for keeping parallel entity arrays in step.
+	* Elements are moved rather than copied.
+	*
+	* @param Order - A permutation of the arrays' indices, as from SortOrder
+	*/
+	template<typename... ArrayTypes>
+	static void ApplyOrder(TArrayView<const int32> Order, ArrayTypes&... Arrays)
+	{
+		(ApplyOrderTo(Order, Arrays), ...);
+	}
+
+	/**
+	* Sorts structure of arrays entities along a curve: keys Positions, an array of FFixedVector64 or FFixedVector2d,
+	* sorts them and applies the order to every array. Positions may be one of the arrays, the order is found before
+	* anything moves.
+	*/
+	template<typename PositionArrayType, typename... ArrayTypes>
+	static void SortArrays(const PositionArrayType& Positions, FFixed64 CellSize, EFixedSpatialCurve Curve, ArrayTypes&... Arrays)
+	{
+		TArray<uint64> Keys;
+		Keys.SetNumUninitialized(Positions.Num());
+		MakeKeys(Positions, CellSize, Curve, Keys);
+		TArray<int32> Order;
+		SortOrder(Keys, Order);
+		ApplyOrder(Order, Arrays...);
+	}
+
+	/** @return true if keys are interleaved with BMI2 pdep */
+	static bool IsUsingBMI2();
+
+	/**
+	* Turns the BMI2 path on or off, it stays off on CPUs without BMI2. Mainly for tests and profiling.
+	* @return true if the BMI2 path is now used
+	*/
+	static bool SetUseBMI2(bool bUse);
+
+private:
+	template<typename ElementType, typename AllocatorType>
+	static void ApplyOrderTo(TArrayView<const int32> Order, TArray<ElementType, AllocatorType>& Array)
+	{
+		check(Order.Num() == Array.Num());
+		TArray<ElementType, AllocatorType> Sorted;
+		Sorted.Reserve(Array.Num());
+		for (const int32 Index : Order)
+		{
+			Sorted.Add(MoveTemp(Array[Index]));
+		}
+		Array = MoveTemp(Sorted);
+	}
+};
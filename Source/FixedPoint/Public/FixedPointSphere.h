@@ -0,0 +1,245 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointMath.h"
+#include "FixedPointVector.h"
+#include "FixedPointBox.h"
+#include "FixedPointInt128.h"
+#include "FixedPointSphere.generated.h"
+
+/**
+* FFixedSphere
+* Bounding sphere, the deterministic counterpart of FSphere. W is the radius.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedSphere
+{
+public:
+	GENERATED_BODY()
+
+	/** The sphere's center point. */
+	UPROPERTY(EditAnywhere)
+	FFixedVector64 Center;
+
+	/** The radius of the sphere. */
+	UPROPERTY(EditAnywhere)
+	FFixed64 W;
+
+	/** Default constructor (no initialization). */
+	FORCEINLINE FFixedSphere() {}
+
+	/**
+	 * Creates and initializes a new sphere.
+	 *
+	 * @param EForceInit Force Init Enum.
+	 */
+	explicit FORCEINLINE FFixedSphere(EForceInit)
+		: Center(ForceInit), W(FixedPoint::Constants::Fixed64::Zero)
+	{
+	}
+
+	/**
+	 * Creates and initializes a new sphere with the specified parameters.
+	 *
+	 * @param InV Center of sphere.
+	 * @param InW Radius of sphere.
+	 */
+	FORCEINLINE FFixedSphere(const FFixedVector64& InV, FFixed64 InW)
+		: Center(InV), W(InW)
+	{
+	}
+
+	/**
+	 * Constructor, centered on the bounding box of the points.
+	 * The radius is the smallest that contains every point under IsInside with no tolerance.
+	 *
+	 * @param Points Array of points to build the sphere around.
+	 */
+	explicit FFixedSphere(TArrayView<const FFixedVector64> Points)
+		: FFixedSphere(ForceInit)
+	{
+		if (Points.Num() > 0)
+		{
+			Center = FFixedBox(Points).GetCenter();
+			FFixed64 MaxDistSquared = FixedPoint::Constants::Fixed64::Zero;
+			for (const FFixedVector64& Point : Points)
+			{
+				MaxDistSquared = FFixedPointMath::Max(MaxDistSquared, FFixedVector64::DistSquared(Point, Center));
+			}
+			W = FFixedPointMath::Sqrt(MaxDistSquared);
+			// square root rounds down, step up until the squared radius covers the furthest point
+			while (W * W < MaxDistSquared)
+			{
+				W.Value++;
+			}
+		}
+	}
+
+	/**
+	 * Check whether two spheres are the same within specified tolerance.
+	 *
+	 * @param Sphere The other sphere.
+	 * @param Tolerance Error Tolerance.
+	 * @return true if spheres are equal within specified tolerance, otherwise false.
+	 */
+	FORCEINLINE bool Equals(const FFixedSphere& Sphere, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		return Center.Equals(Sphere.Center, Tolerance) && FFixedPointMath::Abs(W - Sphere.W) <= Tolerance;
+	}
+
+	/**
+	 * Check whether sphere is inside of another.
+	 *
+	 * @param Other The other sphere.
+	 * @param Tolerance Error Tolerance.
+	 * @return true if sphere is inside another, otherwise false.
+	 */
+	FORCEINLINE bool IsInside(const FFixedSphere& Other, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		if (W > Other.W + Tolerance)
+		{
+			return false;
+		}
+
+		return (Center - Other.Center).SizeSquared() <= FFixedPointMath::Square(Other.W + Tolerance - W);
+	}
+
+	/**
+	 * Checks whether the given location is inside this sphere.
+	 *
+	 * @param In The location to test for inside the bounding volume.
+	 * @param Tolerance Error Tolerance.
+	 * @return true if location is inside this volume.
+	 */
+	FORCEINLINE bool IsInside(const FFixedVector64& In, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		return (Center - In).SizeSquared() <= FFixedPointMath::Square(W + Tolerance);
+	}
+
+	/**
+	 * Test whether this sphere intersects another.
+	 *
+	 * @param Other The other sphere.
+	 * @param Tolerance Error tolerance.
+	 * @return true if spheres intersect, false otherwise.
+	 */
+	FORCEINLINE bool Intersects(const FFixedSphere& Other, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		return (Center - Other.Center).SizeSquared() <= FFixedPointMath::Square(FFixedPointMath::Max(FixedPoint::Constants::Fixed64::Zero, Other.W + W + Tolerance));
+	}
+
+	/**
+	 * Test whether this sphere intersects a box, touching counts as intersecting.
+	 *
+	 * @param Box The box to test against.
+	 * @return true if the sphere and box intersect, false otherwise.
+	 */
+	FORCEINLINE bool Intersects(const FFixedBox& Box) const
+	{
+		return Box.ComputeSquaredDistanceToPoint(Center) <= FFixedPointMath::Square(W);
+	}
+
+	/**
+	 * Get result of Transforming sphere by Matrix.
+	 *
+	 * @param M Matrix to transform by.
+	 * @return Result of transformation.
+	 */
+	FORCEINLINE FFixedSphere TransformBy(const FFixedMatrix& M) const;
+
+	/**
+	 * Get result of Transforming sphere with Transform.
+	 *
+	 * @param M Transform information.
+	 * @return Result of transformation.
+	 */
+	FORCEINLINE FFixedSphere TransformBy(const FFixedTransform64& M) const;
+
+	/**
+	 * Get volume of the current sphere
+	 *
+	 * @return Volume (in Unreal units).
+	 */
+	FORCEINLINE FFixed64 GetVolume() const
+	{
+		return W * W * W * FixedPoint::Constants::Fixed64::Pi * FFixed64(4) / FFixed64(3);
+	}
+
+	/**
+	 * Adds to this sphere to include a new bounding volume.
+	 *
+	 * @param Other the bounding volume to increase the bounding volume to.
+	 * @return Reference to this bounding volume after resizing to include the other bounding volume.
+	 */
+	FORCEINLINE FFixedSphere& operator+=(const FFixedSphere& Other)
+	{
+		if (W == FixedPoint::Constants::Fixed64::Zero)
+		{
+			*this = Other;
+			return *this;
+		}
+
+		// the distance rounds up, so a sphere is only taken as containing the other when it really does
+		const FFixed64 Dist = CeilDistance(Center, Other.Center);
+		if (Dist + FFixedPointMath::Min(W, Other.W) <= FFixedPointMath::Max(W, Other.W))
+		{
+			// one sphere contains the other, pick the larger
+			if (W < Other.W)
+			{
+				*this = Other;
+			}
+		}
+		else
+		{
+			using namespace FixedPoint::Int128;
+			const FFixedVector64 ToOther = Other.Center - Center;
+
+			FFixedSphere NewSphere;
+			NewSphere.W = FFixed64::MakeFromRawInt((Dist.Value + Other.W.Value + W.Value + 1) >> 1);
+			NewSphere.Center = Center;
+
+			if (Dist > FixedPoint::Constants::Fixed64::SmallNumber)
+			{
+				// move towards the other sphere by (NewSphere.W - W) / Dist of the way, which is at most all of it
+				const FInt128 Grow = Make(NewSphere.W.Value - W.Value);
+				const FInt128 Den = Make(Dist.Value);
+				NewSphere.Center.X.Value += MulDivTruncate(ToOther.X.Value, Grow, Den);
+				NewSphere.Center.Y.Value += MulDivTruncate(ToOther.Y.Value, Grow, Den);
+				NewSphere.Center.Z.Value += MulDivTruncate(ToOther.Z.Value, Grow, Den);
+			}
+
+			// the center is rounded, grow the radius to reach the far side of both inputs from where it landed
+			NewSphere.W = FFixedPointMath::Max3(NewSphere.W, CeilDistance(NewSphere.Center, Center) + W, CeilDistance(NewSphere.Center, Other.Center) + Other.W);
+
+			*this = NewSphere;
+		}
+
+		return *this;
+	}
+
+	FORCEINLINE FFixedSphere operator+(const FFixedSphere& Other) const
+	{
+		return FFixedSphere(*this) += Other;
+	}
+
+	/** @return the tightest box around this sphere */
+	FORCEINLINE FFixedBox GetBox() const
+	{
+		return FFixedBox::BuildAABB(Center, FFixedVector64(W));
+	}
+
+private:
+	/** @return the distance between A and B rounded up, from their exact squared distance */
+	static FORCEINLINE FFixed64 CeilDistance(const FFixedVector64& A, const FFixedVector64& B)
+	{
+		using namespace FixedPoint::Int128;
+		const int64 DX = A.X.Value - B.X.Value;
+		const int64 DY = A.Y.Value - B.Y.Value;
+		const int64 DZ = A.Z.Value - B.Z.Value;
+		return FFixed64::MakeFromRawInt(SqrtCeil(Add(Add(Mul(DX, DX), Mul(DY, DY)), Mul(DZ, DZ))));
+	}
+};
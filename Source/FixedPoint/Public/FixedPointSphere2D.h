@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointMath.h"
+#include "FixedPointVector2D.h"
+#include "FixedPointBox2D.h"
+#include "FixedPointInt128.h"
+#include "FixedPointSphere2D.generated.h"
+
+/**
+* FFixedSphere2D
+* Bounding circle, the 2D counterpart of FFixedSphere. W is the radius.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedSphere2D
+{
+public:
+	GENERATED_BODY()
+
+	/** The circle's center point. */
+	UPROPERTY(EditAnywhere)
+	FFixedVector2d Center;
+
+	/** The radius of the circle. */
+	UPROPERTY(EditAnywhere)
+	FFixed64 W;
+
+	/** Default constructor (no initialization). */
+	FORCEINLINE FFixedSphere2D() {}
+
+	/**
+	 * Creates and initializes a new circle.
+	 *
+	 * @param EForceInit Force Init Enum.
+	 */
+	explicit FORCEINLINE FFixedSphere2D(EForceInit)
+		: Center(FixedPoint::Constants::Fixed64::Zero), W(FixedPoint::Constants::Fixed64::Zero)
+	{
+	}
+
+	/**
+	 * Creates and initializes a new circle with the specified parameters.
+	 *
+	 * @param InV Center of circle.
+	 * @param InW Radius of circle.
+	 */
+	FORCEINLINE FFixedSphere2D(const FFixedVector2d& InV, FFixed64 InW)
+		: Center(InV), W(InW)
+	{
+	}
+
+	/**
+	 * Constructor, centered on the bounding box of the points.
+	 * The radius is the smallest that contains every point under IsInside with no tolerance.
+	 *
+	 * @param Points Array of points to build the circle around.
+	 */
+	explicit FFixedSphere2D(TArrayView<const FFixedVector2d> Points)
+		: FFixedSphere2D(ForceInit)
+	{
+		if (Points.Num() > 0)
+		{
+			Center = FFixedBox2D(Points).GetCenter();
+			FFixed64 MaxDistSquared = FixedPoint::Constants::Fixed64::Zero;
+			for (const FFixedVector2d& Point : Points)
+			{
+				MaxDistSquared = FFixedPointMath::Max(MaxDistSquared, DistSquared(Point, Center));
+			}
+			W = FFixedPointMath::Sqrt(MaxDistSquared);
+			// square root rounds down, step up until the squared radius covers the furthest point
+			while (W * W < MaxDistSquared)
+			{
+				W.Value++;
+			}
+		}
+	}
+
+	/**
+	 * Check whether two circles are the same within specified tolerance.
+	 */
+	FORCEINLINE bool Equals(const FFixedSphere2D& Other, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		return FFixedPointMath::Abs(Center.X - Other.Center.X) <= Tolerance && FFixedPointMath::Abs(Center.Y - Other.Center.Y) <= Tolerance && FFixedPointMath::Abs(W - Other.W) <= Tolerance;
+	}
+
+	/**
+	 * Check whether this circle is inside of another.
+	 *
+	 * @param Other The other circle.
+	 * @param Tolerance Error Tolerance.
+	 * @return true if this circle is inside the other, otherwise false.
+	 */
+	FORCEINLINE bool IsInside(const FFixedSphere2D& Other, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		if (W > Other.W + Tolerance)
+		{
+			return false;
+		}
+
+		return DistSquared(Center, Other.Center) <= FFixedPointMath::Square(Other.W + Tolerance - W);
+	}
+
+	/**
+	 * Checks whether the given location is inside this circle.
+	 *
+	 * @param In The location to test.
+	 * @param Tolerance Error Tolerance.
+	 * @return true if location is inside this circle.
+	 */
+	FORCEINLINE bool IsInside(const FFixedVector2d& In, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		return DistSquared(Center, In) <= FFixedPointMath::Square(W + Tolerance);
+	}
+
+	/**
+	 * Test whether this circle intersects another.
+	 *
+	 * @param Other The other circle.
+	 * @param Tolerance Error tolerance.
+	 * @return true if the circles intersect, false otherwise.
+	 */
+	FORCEINLINE bool Intersects(const FFixedSphere2D& Other, FFixed64 Tolerance = FixedPoint::Constants::Fixed64::KindaSmallNumber) const
+	{
+		return DistSquared(Center, Other.Center) <= FFixedPointMath::Square(FFixedPointMath::Max(FixedPoint::Constants::Fixed64::Zero, Other.W + W + Tolerance));
+	}
+
+	/**
+	 * Test whether this circle intersects a box, touching counts as intersecting.
+	 *
+	 * @param Box The box to test against.
+	 * @return true if the circle and box intersect, false otherwise.
+	 */
+	FORCEINLINE bool Intersects(const FFixedBox2D& Box) const
+	{
+		return Box.ComputeSquaredDistanceToPoint(Center) <= FFixedPointMath::Square(W);
+	}
+
+	/** @return the area of this circle */
+	FORCEINLINE FFixed64 GetArea() const
+	{
+		return W * W * FixedPoint::Constants::Fixed64::Pi;
+	}
+
+	/**
+	 * Adds to this circle to include another, see FFixedSphere::operator+=.
+	 *
+	 * @param Other the circle to increase this one to.
+	 * @return Reference to this circle after resizing to include the other circle.
+	 */
+	FORCEINLINE FFixedSphere2D& operator+=(const FFixedSphere2D& Other)
+	{
+		if (W == FixedPoint::Constants::Fixed64::Zero)
+		{
+			*this = Other;
+			return *this;
+		}
+
+		// the distance rounds up, so a circle is only taken as containing the other when it really does
+		const FFixed64 Dist = CeilDistance(Center, Other.Center);
+		if (Dist + FFixedPointMath::Min(W, Other.W) <= FFixedPointMath::Max(W, Other.W))
+		{
+			// one circle contains the other, pick the larger
+			if (W < Other.W)
+			{
+				*this = Other;
+			}
+		}
+		else
+		{
+			using namespace FixedPoint::Int128;
+			const FFixedVector2d ToOther = Other.Center - Center;
+
+			FFixedSphere2D NewSphere;
+			NewSphere.W = FFixed64::MakeFromRawInt((Dist.Value + Other.W.Value + W.Value + 1) >> 1);
+			NewSphere.Center = Center;
+
+			if (Dist > FixedPoint::Constants::Fixed64::SmallNumber)
+			{
+				// move towards the other circle by (NewSphere.W - W) / Dist of the way, which is at most all of it
+				const FInt128 Grow = Make(NewSphere.W.Value - W.Value);
+				const FInt128 Den = Make(Dist.Value);
+				NewSphere.Center.X.Value += MulDivTruncate(ToOther.X.Value, Grow, Den);
+				NewSphere.Center.Y.Value += MulDivTruncate(ToOther.Y.Value, Grow, Den);
+			}
+
+			// the center is rounded, grow the radius to reach the far side of both inputs from where it landed
+			NewSphere.W = FFixedPointMath::Max3(NewSphere.W, CeilDistance(NewSphere.Center, Center) + W, CeilDistance(NewSphere.Center, Other.Center) + Other.W);
+
+			*this = NewSphere;
+		}
+
+		return *this;
+	}
+
+	FORCEINLINE FFixedSphere2D operator+(const FFixedSphere2D& Other) const
+	{
+		return FFixedSphere2D(*this) += Other;
+	}
+
+	/** @return the tightest box around this circle */
+	FORCEINLINE FFixedBox2D GetBox() const
+	{
+		return FFixedBox2D::BuildAABB(Center, FFixedVector2d(W));
+	}
+
+private:
+	static FORCEINLINE FFixed64 DistSquared(const FFixedVector2d& A, const FFixedVector2d& B)
+	{
+		return FFixedPointMath::Square(A.X - B.X) + FFixedPointMath::Square(A.Y - B.Y);
+	}
+
+	/** @return the distance between A and B rounded up, from their exact squared distance */
+	static FORCEINLINE FFixed64 CeilDistance(const FFixedVector2d& A, const FFixedVector2d& B)
+	{
+		using namespace FixedPoint::Int128;
+		const int64 DX = A.X.Value - B.X.Value;
+		const int64 DY = A.Y.Value - B.Y.Value;
+		return FFixed64::MakeFromRawInt(SqrtCeil(Add(Mul(DX, DX), Mul(DY, DY))));
+	}
+};
@@ -0,0 +1,131 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointBox.h"
+
+/**
+* FFixedSweepAndPrune
+* Broadphase over FFixedBox bounds identified by caller chosen ids, for dense crowds where most boxes move a little each
+* tick. Overlaps are inclusive, boxes that touch overlap, the same as FFixedBox::Intersect.
+*
+* Boxes are kept sorted by their raw int64 minimum on the sweep axis, then by id. Each box is compared only with the
+* boxes after it whose minimum is not past its maximum, and those are pruned on the other two axes before a pair is
+* kept. The sorted entries hold every raw endpoint inline, so the sweep never leaves them.
+*
+* Moves write straight into the sorted entries, and Flush restores the order with an insertion sort, which is close to
+* linear when boxes have only moved a little. Large changes, such as many inserts or a new sweep axis, rebuild the order
+* with a radix sort instead. Pairs are returned in (lower id, higher id) order, so the result does not depend on the
+* sweep axis, the order of edits or bParallel.
+*/
+struct FIXEDPOINT_API FFixedSweepAndPrune
+{
+public:
+	FFixedSweepAndPrune();
+
+	/** @param InSweepAxis - EAxis::X, Y or Z. The axis boxes are most spread along prunes the most */
+	explicit FFixedSweepAndPrune(EAxis::Type InSweepAxis);
+
+	/** Removes every box and changes the sweep axis */
+	void Reset(EAxis::Type InSweepAxis = EAxis::X);
+
+	FORCEINLINE EAxis::Type GetSweepAxis() const
+	{
+		return SweepAxis;
+	}
+
+	/** Changes the sweep axis, the boxes are re-sorted at the next Flush */
+	void SetSweepAxis(EAxis::Type InSweepAxis);
+
+	/**
+	* Adds a box, it is found by FindPairs after the next Flush.
+	*
+	* @param Id - Non negative id not already added, storage grows to the largest id used
+	*/
+	void Insert(int32 Id, const FFixedBox& Box);
+
+	/** Removes a box, it is still found by FindPairs until the next Flush */
+	void Remove(int32 Id);
+
+	/** Changes the bounds of a box, visible after the next Flush */
+	void Move(int32 Id, const FFixedBox& NewBox);
+
+	/** Applies every pending Insert, Remove and Move and restores the sorted order */
+	void Flush();
+
+	/** @return true if there are edits waiting for Flush, FindPairs checks this */
+	FORCEINLINE bool IsDirty() const
+	{
+		return DirtyIds.Num() > 0 || bOrderDirty;
+	}
+
+	FORCEINLINE bool Contains(int32 Id) const
+	{
+		return IdFlags.IsValidIndex(Id) && (IdFlags[Id] & Present) != 0;
+	}
+
+	FORCEINLINE const FFixedBox& GetBox(int32 Id) const
+	{
+		check(Contains(Id));
+		return Boxes[Id];
+	}
+
+	FORCEINLINE int32 Num() const
+	{
+		return NumElements;
+	}
+
+	/**
+	* Finds every pair of overlapping boxes.
+	*
+	* @param OutPairs - Replaced with one entry per pair, X the lower id and Y the higher, sorted by X then Y
+	* @param bParallel - Split the sweep across task threads with ParallelFor, results are identical either way
+	*/
+	void FindPairs(TArray<FIntPoint>& OutPairs, bool bParallel = false) const;
+
+private:
+	enum : uint8
+	{
+		Present = 1 << 0,
+		Dirty = 1 << 1,
+	};
+
+	/** Raw bounds of a box in sweep order, the sweep axis minimum lives in SortedMin */
+	struct FSortedBox
+	{
+		int64 SweepMax;
+		int64 MinA;
+		int64 MaxA;
+		int64 MinB;
+		int64 MaxB;
+		int32 Id;
+	};
+
+	FSortedBox MakeSortedBox(int32 Id, int64& OutSweepMin) const;
+
+	void MarkDirty(int32 Id);
+
+	/** Sorts every present box from scratch */
+	void RebuildOrder();
+
+	/** @return false if the entries were too far out of order and the sort gave up part way */
+	bool InsertionSortOrder();
+
+	EAxis::Type SweepAxis;
+	int32 NumElements;
+	bool bOrderDirty;
+	bool bRebuildOrder;
+
+	TArray<FFixedBox> Boxes;
+	TArray<int32> SortedIndexOfId;
+	TArray<uint8> IdFlags;
+	TArray<int32> DirtyIds;
+
+	/** Sweep axis minimums, the only values the inner loop of the sweep streams through */
+	TArray<int64> SortedMin;
+	TArray<FSortedBox> SortedBoxes;
+};
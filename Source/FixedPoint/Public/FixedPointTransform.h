@@ -209,11 +209,33 @@ public:
 
 	/**
 	* Convert this Transform to matrix with scaling and compute the inverse of that.
+	* The inverse is built directly from the rotation and scale, so entries can differ from ToMatrixWithScale().Inverse() in the last few bits.
+	* A scale axis at or below SmallNumber still goes through ToMatrixWithScale().Inverse(), which gives the same result as before.
 	*/
 	FORCEINLINE FFixedMatrix ToInverseMatrixWithScale() const
 	{
-		// todo: optimize
-		return ToMatrixWithScale().Inverse();
+		// the 3x3 part of ToMatrixWithScale is diag(Scale3D) * R, so its inverse is transpose(R) * diag(1 / Scale3D).
+		// Dividing each column of the transposed rotation by its scale avoids a general inverse and the precision loss of a reciprocal.
+		if (FFixedPointMath::Abs(Scale3D.X) <= FixedPoint::Constants::Fixed64::SmallNumber ||
+			FFixedPointMath::Abs(Scale3D.Y) <= FixedPoint::Constants::Fixed64::SmallNumber ||
+			FFixedPointMath::Abs(Scale3D.Z) <= FixedPoint::Constants::Fixed64::SmallNumber)
+		{
+			// the column divide can't take a zero scale, leave the degenerate cases to Inverse()
+			return ToMatrixWithScale().Inverse();
+		}
+		const FFixedMatrix RotationMatrix = ToMatrixNoScale();
+		const FFixed64 Scales[3] = { Scale3D.X, Scale3D.Y, Scale3D.Z };
+		FFixedMatrix OutMatrix;
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			for (int32 Row = 0; Row < 3; Row++)
+			{
+				OutMatrix.M[Row][Column] = RotationMatrix.M[Column][Row] / Scales[Column];
+			}
+			OutMatrix.M[Column][3] = FixedPoint::Constants::Fixed64::Zero;
+		}
+		OutMatrix.SetInverseTranslation(Translation.X, Translation.Y, Translation.Z);
+		return OutMatrix;
 	}
 
 	/**
@@ -832,6 +854,30 @@ public:
 		// that was removed at rev 21 with UE4
 	}
 
+	/**
+	* Composes a hierarchy of local transforms into component space, OutComponentTransforms[i] = Local[i] * OutComponentTransforms[Parent[i]].
+	* Each result goes through Multiply, including its negative scale fallback, so it is bit identical to composing one pair at a time.
+	* Builds the levels on every call, use the FFixedHierarchyLevels overload to reuse them across ticks.
+	*
+	* @param ParentIndices - Parent of each transform, INDEX_NONE for roots, several hierarchies can share one array
+	* @param LocalTransforms - Transforms relative to their parent
+	* @param OutComponentTransforms - Receives the composed transforms, must be the same length as LocalTransforms, may alias it
+	* @param bParallel - Split each level across task threads with ParallelFor
+	*/
+	static void ComposeHierarchy(TArrayView<const int32> ParentIndices, TArrayView<const FFixedTransform64> LocalTransforms, TArrayView<FFixedTransform64> OutComponentTransforms, bool bParallel = false);
+
+	/**
+	* Composes a hierarchy of local transforms into component space one level at a time.
+	* Parents are read back from Workspace, which holds the results in level order as structure of arrays.
+	*
+	* @param Levels - Hierarchy sorted by FFixedHierarchyLevels::Build
+	* @param LocalTransforms - Transforms relative to their parent
+	* @param OutComponentTransforms - Receives the composed transforms, must be the same length as LocalTransforms, may alias it
+	* @param Workspace - Scratch storage, keep it around between calls to avoid reallocating
+	* @param bParallel - Split each level across task threads with ParallelFor
+	*/
+	static void ComposeHierarchy(const FFixedHierarchyLevels& Levels, TArrayView<const FFixedTransform64> LocalTransforms, TArrayView<FFixedTransform64> OutComponentTransforms, FFixedTransform64SoA& Workspace, bool bParallel = false);
+
 	/**
 	* Sets the components
 	* @param InRotation The new value for the Rotation component
@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointBVH.h"
+
+/**
+* One sphere or capsule sweep for FFixedTriangleMesh::SweepBatch
+*/
+struct FIXEDPOINT_API FFixedSweep
+{
+public:
+	/** Shape center at the start of the move */
+	FFixedVector64 Start = FFixedVector64::ZeroVector;
+
+	/** Shape center at the end of the move */
+	FFixedVector64 End = FFixedVector64::ZeroVector;
+
+	/** Capsule segment from the center to one end, the other end is -HalfAxis. Zero for a sphere */
+	FFixedVector64 HalfAxis = FFixedVector64::ZeroVector;
+
+	FFixed64 Radius = FixedPoint::Constants::Fixed64::Zero;
+};
+
+/**
+* First contact of a sweep against a FFixedTriangleMesh
+*/
+struct FIXEDPOINT_API FFixedSweepHit
+{
+public:
+	/** Index of the triangle that was hit, INDEX_NONE if nothing was */
+	int32 Triangle = INDEX_NONE;
+
+	/** Fraction of the way from Start to End where the shape touches, 0 when it starts overlapping and moves further in */
+	FFixed64 Time = FixedPoint::Constants::Fixed64::One;
+
+	/** Unit normal from the triangle towards the shape */
+	FFixedVector64 Normal = FFixedVector64::ZeroVector;
+
+	/** Contact point on the triangle */
+	FFixedVector64 Location = FFixedVector64::ZeroVector;
+};
+
+/**
+* FFixedTriangleMesh
+* Triangle soup with a FFixedBVH over its triangles for swept sphere and capsule queries, such as character movement.
+*
+* Sweeps use conservative advancement: FFixedGJK finds the gap between the shape and a triangle, and the shape is moved
+* forward by as much as the gap allows along the closing direction, which can never pass the contact. This repeats,
+* warm starting GJK, until the gap is within ContactTolerance. A hit therefore leaves the shape a hair short of the
+* triangle rather than touching it, and the shape can be moved to Time without overlapping anything.
+* Moves that only slide along a surface the shape already touches, or back out of one it overlaps, are not hits.
+*
+* Triangles are two sided. Every step is integer arithmetic with fixed iteration caps, so results are identical on
+* every machine and whether or not batches run in parallel.
+*/
+struct FIXEDPOINT_API FFixedTriangleMesh
+{
+public:
+	/** Gap a sweep stops within, about a thousandth of a unit */
+	static constexpr FFixed64 ContactTolerance = FFixed64::MakeFromRawInt(1 << 10);
+
+	/** Advancement steps before a sweep gives up and reports a hit where it got to */
+	static constexpr int32 MaxSweepIterations = 32;
+
+	/**
+	* Builds the mesh and its tree, replacing any previous one.
+	*
+	* @param Indices - Three vertex indices per triangle
+	*/
+	void Build(TArrayView<const FFixedVector64> Vertices, TArrayView<const int32> Indices);
+
+	void Reset();
+
+	FORCEINLINE int32 NumTriangles() const
+	{
+		return Corners.Num() / 3;
+	}
+
+	/** @return the three corners of a triangle */
+	FORCEINLINE TArrayView<const FFixedVector64> GetTriangle(int32 Index) const
+	{
+		return TArrayView<const FFixedVector64>(Corners.GetData() + Index * 3, 3);
+	}
+
+	FORCEINLINE const FFixedBVH& GetBVH() const
+	{
+		return BVH;
+	}
+
+	/**
+	* Finds the first triangle a sphere moving from Start to End touches.
+	* Hits at equal times go to the lower triangle index.
+	*
+	* @return true if something was hit
+	*/
+	bool SphereSweep(const FFixedVector64& Start, const FFixedVector64& End, FFixed64 Radius, FFixedSweepHit& OutHit) const;
+
+	/**
+	* Finds the first triangle a capsule moving from Start to End touches, see SphereSweep.
+	*
+	* @param HalfAxis - Capsule segment from its center to one end, the capsule does not rotate while it moves
+	*/
+	bool CapsuleSweep(const FFixedVector64& Start, const FFixedVector64& End, const FFixedVector64& HalfAxis, FFixed64 Radius, FFixedSweepHit& OutHit) const;
+
+	/**
+	* Runs every sweep, each the same as SphereSweep or CapsuleSweep gives.
+	*
+	* @param OutHits - Per sweep, its first hit, Triangle is INDEX_NONE for a miss. Must be as long as Sweeps
+	* @param bParallel - Split the sweeps across task threads with ParallelFor
+	*/
+	void SweepBatch(TArrayView<const FFixedSweep> Sweeps, TArrayView<FFixedSweepHit> OutHits, bool bParallel = false) const;
+
+private:
+	/** Three corners per triangle, so each triangle is a contiguous hull for FFixedGJK */
+	TArray<FFixedVector64> Corners;
+
+	FFixedBVH BVH;
+};
@@ -13,12 +13,36 @@
 #include "FixedPointVector4.h"
 #include "FixedPointPlane.h"
 #include "FixedPointMatrix.h"
+#include "FixedPointMatrix33.h"
+#include "FixedPointMatrix34.h"
 #include "FixedPointQuat.h"
 #include "FixedPointRotator.h"
 #include "FixedPointRotationTranslationMatrix.h"
 #include "FixedPointRotationMatrix.h"
 #include "FixedPointQuatRotationTranslationMatrix.h"
 #include "FixedPointTransform.h"
+#include "FixedPointSoA.h"
+#include "FixedPointHierarchy.h"
+#include "FixedPointDualQuat.h"
+#include "FixedPointUnitVector.h"
+#include "FixedPointUnitQuat.h"
+#include "FixedPointRotationMatrix62.h"
+#include "FixedPointBox.h"
+#include "FixedPointBox2D.h"
+#include "FixedPointSphere.h"
+#include "FixedPointSphere2D.h"
+#include "FixedPointSpatialGrid.h"
+#include "FixedPointBVH.h"
+#include "FixedPointRayBatch.h"
+#include "FixedPointConvexVolume.h"
+#include "FixedPointPolygon.h"
+#include "FixedPointPolygon2D.h"
+#include "FixedPointGJK.h"
+#include "FixedPointConvexHull.h"
+#include "FixedPointTriangleMesh.h"
+#include "FixedPointSpatialKey.h"
+#include "FixedPointRadixSort.h"
+#include "FixedPointSweepAndPrune.h"
 
 FORCEINLINE FFixedVector64::FFixedVector64(const FFixedVector2d& V, const FFixed64& InZ)
 {
@@ -301,6 +325,18 @@ inline FFixedPlane FFixedPlane::TransformBy(const FFixedMatrix& M) const
 	return this->TransformByUsingAdjointT(M, DetM, tmpTA);
 }
 
+inline FFixedPlane FFixedPlane::TransformByUsingAdjointT(const FFixedMatrix& M, FFixed64 DetM, const FFixedMatrix& TA) const
+{
+	FFixedVector64 NewNorm = FFixedVector64(TA.TransformVector(*this)).GetSafeNormal();
+
+	if (DetM < FixedPoint::Constants::Fixed64::Zero)
+	{
+		NewNorm = -NewNorm;
+	}
+
+	return FFixedPlane(FFixedVector64(M.TransformPosition(GetNormal() * W)), NewNorm);
+}
+
 FORCEINLINE FFixedVector4d FFixedMatrix::TransformFVector4(const FFixedVector4d& P) const
 {
 	FFixedVector4d VOurX = FFixedVector4d(M[0][0], M[0][1], M[0][2], M[0][3]);
@@ -328,7 +364,7 @@ FORCEINLINE FFixedVector4d FFixedMatrix::TransformPosition(const FFixedVector64&
 
 FORCEINLINE FFixedVector64 FFixedMatrix::InverseTransformPosition(const FFixedVector64& V) const
 {
-	FFixedMatrix InvSelf = this->InverseFast();
+	FFixedMatrix InvSelf = IsAffine() ? this->InverseAffine() : this->InverseFast();
 	return InvSelf.TransformPosition(V);
 	return FFixedVector64();
 }
@@ -340,7 +376,7 @@ FORCEINLINE FFixedVector4d FFixedMatrix::TransformVector(const FFixedVector64& V
 
 FORCEINLINE FFixedVector64 FFixedMatrix::InverseTransformVector(const FFixedVector64& V) const
 {
-	FFixedMatrix InvSelf = this->InverseFast();
+	FFixedMatrix InvSelf = IsAffine() ? this->InverseAffine() : this->InverseFast();
 	return InvSelf.TransformVector(V);
 	return FFixedVector64();
 }
@@ -413,6 +449,17 @@ FORCEINLINE FFixedVector64 FFixedRotator64::UnrotateVector(const FFixedVector64&
 	return FFixedRotationMatrix(*this).GetTransposed().TransformVector(V);
 }
 
+FORCEINLINE FFixedVector64 FFixedRotator64::QuatRotateVector(const FFixedVector64& V) const
+{
+	// the quaternion needs the same three SinCos as the matrix but far less setup, and no 4x4 transform or transpose
+	return Quaternion().RotateVector(V);
+}
+
+FORCEINLINE FFixedVector64 FFixedRotator64::QuatUnrotateVector(const FFixedVector64& V) const
+{
+	return Quaternion().UnrotateVector(V);
+}
+
 FORCEINLINE_DEBUGGABLE FFixedRotator64 FFixedPointMath::LerpRange(const FFixedRotator64& A, const FFixedRotator64& B, FFixed64 Alpha)
 {
 	// Similar to Lerp, but does not take the shortest path. Allows interpolation over more than 180 degrees.
@@ -492,6 +539,74 @@ inline bool FFixedPointMath::LineSphereIntersection(const FFixedVector64& Start,
 		return 0;
 }
 
+inline bool FFixedPointMath::SphereAABBIntersection(const FFixedVector64& SphereCenter, FFixed64 RadiusSquared, const FFixedBox& AABB)
+{
+	return AABB.ComputeSquaredDistanceToPoint(SphereCenter) <= RadiusSquared;
+}
+
+inline bool FFixedPointMath::SphereAABBIntersection(const FFixedSphere& Sphere, const FFixedBox& AABB)
+{
+	return SphereAABBIntersection(Sphere.Center, Square(Sphere.W), AABB);
+}
+
+inline bool FFixedPointMath::LineBoxIntersection(const FFixedBox& Box, const FFixedVector64& Start, const FFixedVector64& End, const FFixedVector64& StartToEnd, FFixed64* OutTime)
+{
+	using namespace FixedPoint::Int128;
+	// slab entry and exit times are kept as exact fractions, a rounded reciprocal misses long lines grazing a face
+	int64 EnterNum = 0;
+	int64 EnterDen = 1;
+	int64 ExitNum = 1;
+	int64 ExitDen = 1;
+	if (!ClipSlab(Start.X.Value, StartToEnd.X.Value, Box.Min.X.Value, Box.Max.X.Value, EnterNum, EnterDen, ExitNum, ExitDen)
+		|| !ClipSlab(Start.Y.Value, StartToEnd.Y.Value, Box.Min.Y.Value, Box.Max.Y.Value, EnterNum, EnterDen, ExitNum, ExitDen)
+		|| !ClipSlab(Start.Z.Value, StartToEnd.Z.Value, Box.Min.Z.Value, Box.Max.Z.Value, EnterNum, EnterDen, ExitNum, ExitDen))
+	{
+		return false;
+	}
+
+	if (OutTime != nullptr)
+	{
+		*OutTime = FFixed64::MakeFromRawInt(DivideTruncate(Mul(EnterNum, FixedPoint::Constants::Raw64::One), EnterDen));
+	}
+	return true;
+}
+
+inline bool FFixedPointMath::SegmentTriangleIntersection(const FFixedVector64& StartPoint, const FFixedVector64& EndPoint, const FFixedVector64& A, const FFixedVector64& B, const FFixedVector64& C, FFixed64& OutTime)
+{
+	// Moller-Trumbore, the barycentric tests compare numerators against the determinant so only the hit time is divided
+	const FFixedVector64 Delta = EndPoint - StartPoint;
+	const FFixedVector64 Edge1 = B - A;
+	const FFixedVector64 Edge2 = C - A;
+	const FFixedVector64 P = Delta ^ Edge2;
+	FFixed64 Det = Edge1 | P;
+	if (Det == FixedPoint::Constants::Fixed64::Zero)
+	{
+		return false;
+	}
+
+	const FFixedVector64 T = StartPoint - A;
+	FFixed64 U = T | P;
+	const FFixedVector64 Q = T ^ Edge1;
+	FFixed64 V = Delta | Q;
+	FFixed64 W = Edge2 | Q;
+	if (Det < FixedPoint::Constants::Fixed64::Zero)
+	{
+		Det = -Det;
+		U = -U;
+		V = -V;
+		W = -W;
+	}
+
+	if (U < FixedPoint::Constants::Fixed64::Zero || V < FixedPoint::Constants::Fixed64::Zero || U + V > Det
+		|| W < FixedPoint::Constants::Fixed64::Zero || W > Det)
+	{
+		return false;
+	}
+
+	OutTime = W / Det;
+	return true;
+}
+
 inline FFixedVector64 FFixedPointMath::VRand()
 {
 	FFixedVector64 Result;
@@ -574,4 +689,298 @@ inline void FFixedMatrix::SetColumn(int32 i, FFixedVector64 Value)
 //FFixedVector FFixedRotator64::UnrotateVector(const FFixedVector& V) const
 //{
 //	FFixedRotationMatrix(*this).GetTransposed().TransformVector( V );
-//}
\ No newline at end of file
+//}
+
+FORCEINLINE FFixedMatrix33::FFixedMatrix33(const FFixedVector64& InX, const FFixedVector64& InY, const FFixedVector64& InZ)
+{
+	M[0][0] = InX.X; M[0][1] = InX.Y; M[0][2] = InX.Z;
+	M[1][0] = InY.X; M[1][1] = InY.Y; M[1][2] = InY.Z;
+	M[2][0] = InZ.X; M[2][1] = InZ.Y; M[2][2] = InZ.Z;
+}
+
+FORCEINLINE FFixedMatrix33::FFixedMatrix33(const FFixedMatrix& InMatrix)
+{
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			M[Row][Column] = InMatrix.M[Row][Column];
+		}
+	}
+}
+
+FORCEINLINE FFixedMatrix33::FFixedMatrix33(const FFixedQuat64& Q)
+{
+	// same terms as FFixedTransform64::ToMatrixNoScale
+	const FFixed64 x2 = Q.X + Q.X;
+	const FFixed64 y2 = Q.Y + Q.Y;
+	const FFixed64 z2 = Q.Z + Q.Z;
+	const FFixed64 xx2 = Q.X * x2;
+	const FFixed64 yy2 = Q.Y * y2;
+	const FFixed64 zz2 = Q.Z * z2;
+	const FFixed64 yz2 = Q.Y * z2;
+	const FFixed64 wx2 = Q.W * x2;
+	const FFixed64 xy2 = Q.X * y2;
+	const FFixed64 wz2 = Q.W * z2;
+	const FFixed64 xz2 = Q.X * z2;
+	const FFixed64 wy2 = Q.W * y2;
+
+	M[0][0] = FixedPoint::Constants::Fixed64::One - (yy2 + zz2);
+	M[0][1] = xy2 + wz2;
+	M[0][2] = xz2 - wy2;
+	M[1][0] = xy2 - wz2;
+	M[1][1] = FixedPoint::Constants::Fixed64::One - (xx2 + zz2);
+	M[1][2] = yz2 + wx2;
+	M[2][0] = xz2 + wy2;
+	M[2][1] = yz2 - wx2;
+	M[2][2] = FixedPoint::Constants::Fixed64::One - (xx2 + yy2);
+}
+
+FORCEINLINE FFixedMatrix33::FFixedMatrix33(const FFixedRotator64& Rot)
+{
+	// same terms as FFixedRotationTranslationMatrix
+	FFixed64 SP, SY, SR;
+	FFixed64 CP, CY, CR;
+	FFixedPointMath::SinCos(&SP, &CP, FFixedPointMath::DegreesToRadians(Rot.Pitch));
+	FFixedPointMath::SinCos(&SY, &CY, FFixedPointMath::DegreesToRadians(Rot.Yaw));
+	FFixedPointMath::SinCos(&SR, &CR, FFixedPointMath::DegreesToRadians(Rot.Roll));
+
+	M[0][0] = CP * CY;
+	M[0][1] = CP * SY;
+	M[0][2] = SP;
+
+	M[1][0] = SR * SP * CY - CR * SY;
+	M[1][1] = SR * SP * SY + CR * CY;
+	M[1][2] = -SR * CP;
+
+	M[2][0] = -(CR * SP * CY + SR * SY);
+	M[2][1] = CY * SR - CR * SP * SY;
+	M[2][2] = CR * CP;
+}
+
+FORCEINLINE FFixedVector64 FFixedMatrix33::TransformVector(const FFixedVector64& V) const
+{
+	return FFixedVector64(
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(V.X.Value, M[0][0].Value, V.Y.Value, M[1][0].Value, V.Z.Value, M[2][0].Value)),
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(V.X.Value, M[0][1].Value, V.Y.Value, M[1][1].Value, V.Z.Value, M[2][1].Value)),
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(V.X.Value, M[0][2].Value, V.Y.Value, M[1][2].Value, V.Z.Value, M[2][2].Value)));
+}
+
+FORCEINLINE FFixedVector64 FFixedMatrix33::TransformVectorTransposed(const FFixedVector64& V) const
+{
+	return FFixedVector64(
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(V.X.Value, M[0][0].Value, V.Y.Value, M[0][1].Value, V.Z.Value, M[0][2].Value)),
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(V.X.Value, M[1][0].Value, V.Y.Value, M[1][1].Value, V.Z.Value, M[1][2].Value)),
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(V.X.Value, M[2][0].Value, V.Y.Value, M[2][1].Value, V.Z.Value, M[2][2].Value)));
+}
+
+FORCEINLINE FFixedMatrix FFixedMatrix33::ToMatrix() const
+{
+	FFixedMatrix Result;
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			Result.M[Row][Column] = M[Row][Column];
+		}
+		Result.M[Row][3] = FixedPoint::Constants::Fixed64::Zero;
+		Result.M[3][Row] = FixedPoint::Constants::Fixed64::Zero;
+	}
+	Result.M[3][3] = FixedPoint::Constants::Fixed64::One;
+	return Result;
+}
+
+FORCEINLINE FFixedQuat64 FFixedMatrix33::ToQuat() const
+{
+	return FFixedQuat64(ToMatrix());
+}
+
+FORCEINLINE FFixedMatrix34::FFixedMatrix34(const FFixedVector64& InX, const FFixedVector64& InY, const FFixedVector64& InZ, const FFixedVector64& InOrigin)
+{
+	M[0][0] = InX.X; M[0][1] = InX.Y; M[0][2] = InX.Z;
+	M[1][0] = InY.X; M[1][1] = InY.Y; M[1][2] = InY.Z;
+	M[2][0] = InZ.X; M[2][1] = InZ.Y; M[2][2] = InZ.Z;
+	M[3][0] = InOrigin.X; M[3][1] = InOrigin.Y; M[3][2] = InOrigin.Z;
+}
+
+FORCEINLINE FFixedMatrix34::FFixedMatrix34(const FFixedMatrix33& InRotation, const FFixedVector64& InOrigin)
+{
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			M[Row][Column] = InRotation.M[Row][Column];
+		}
+	}
+	SetOrigin(InOrigin);
+}
+
+FORCEINLINE FFixedMatrix34::FFixedMatrix34(const FFixedQuat64& Q, const FFixedVector64& InOrigin)
+	: FFixedMatrix34(FFixedMatrix33(Q), InOrigin)
+{
+}
+
+FORCEINLINE FFixedMatrix34::FFixedMatrix34(const FFixedMatrix& InMatrix)
+{
+	for (int32 Row = 0; Row < 4; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			M[Row][Column] = InMatrix.M[Row][Column];
+		}
+	}
+}
+
+FORCEINLINE FFixedMatrix34::FFixedMatrix34(const FFixedTransform64& InTransform)
+	: FFixedMatrix34(FFixedMatrix33(InTransform.GetRotation()), InTransform.GetTranslation())
+{
+	// ToMatrixWithScale scales each axis row by the matching scale component
+	const FFixedVector64 Scale = InTransform.GetScale3D();
+	const FFixed64 Scales[3] = { Scale.X, Scale.Y, Scale.Z };
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			M[Row][Column] *= Scales[Row];
+		}
+	}
+}
+
+FORCEINLINE FFixedVector64 FFixedMatrix34::TransformPosition(const FFixedVector64& V) const
+{
+	return FFixedVector64(
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3AddRaw(V.X.Value, M[0][0].Value, V.Y.Value, M[1][0].Value, V.Z.Value, M[2][0].Value, M[3][0].Value)),
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3AddRaw(V.X.Value, M[0][1].Value, V.Y.Value, M[1][1].Value, V.Z.Value, M[2][1].Value, M[3][1].Value)),
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3AddRaw(V.X.Value, M[0][2].Value, V.Y.Value, M[1][2].Value, V.Z.Value, M[2][2].Value, M[3][2].Value)));
+}
+
+FORCEINLINE FFixedVector64 FFixedMatrix34::TransformVector(const FFixedVector64& V) const
+{
+	return FFixedVector64(
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(V.X.Value, M[0][0].Value, V.Y.Value, M[1][0].Value, V.Z.Value, M[2][0].Value)),
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(V.X.Value, M[0][1].Value, V.Y.Value, M[1][1].Value, V.Z.Value, M[2][1].Value)),
+		FFixed64::MakeFromRawInt(FixedPoint::Int128::Dot3Raw(V.X.Value, M[0][2].Value, V.Y.Value, M[1][2].Value, V.Z.Value, M[2][2].Value)));
+}
+
+FORCEINLINE FFixedVector64 FFixedMatrix34::GetOrigin() const
+{
+	return FFixedVector64(M[3][0], M[3][1], M[3][2]);
+}
+
+FORCEINLINE void FFixedMatrix34::SetOrigin(const FFixedVector64& NewOrigin)
+{
+	M[3][0] = NewOrigin.X;
+	M[3][1] = NewOrigin.Y;
+	M[3][2] = NewOrigin.Z;
+}
+
+FORCEINLINE FFixedMatrix FFixedMatrix34::ToMatrix() const
+{
+	FFixedMatrix Result;
+	for (int32 Row = 0; Row < 4; Row++)
+	{
+		for (int32 Column = 0; Column < 3; Column++)
+		{
+			Result.M[Row][Column] = M[Row][Column];
+		}
+		Result.M[Row][3] = FixedPoint::Constants::Fixed64::Zero;
+	}
+	Result.M[3][3] = FixedPoint::Constants::Fixed64::One;
+	return Result;
+}
+
+FORCEINLINE FFixedTransform64 FFixedMatrix34::ToTransform() const
+{
+	return FFixedTransform64(ToMatrix());
+}
+
+FORCEINLINE void FFixedPlaneSoA::TransformBy(const FFixedMatrix& M)
+{
+	const FFixedMatrix TA = M.TransposeAdjoint();
+	const FFixed64 DetM = M.Determinant();
+	for (int32 i = 0; i < Num(); i++)
+	{
+		Set(i, Get(i).TransformByUsingAdjointT(M, DetM, TA));
+	}
+}
+
+FORCEINLINE FFixedBox FFixedBox::TransformBy(const FFixedMatrix34& M) const
+{
+	using namespace FixedPoint::Int128;
+
+	if (!IsValid)
+	{
+		return FFixedBox(ForceInit);
+	}
+
+	// center and extent are kept doubled so no bit is lost before the single outward rounding of each bound
+	const int64 Center2[3] = { Min.X.Value + Max.X.Value, Min.Y.Value + Max.Y.Value, Min.Z.Value + Max.Z.Value };
+	const int64 Extent2[3] = { Max.X.Value - Min.X.Value, Max.Y.Value - Min.Y.Value, Max.Z.Value - Min.Z.Value };
+
+	FFixedBox Result;
+	Result.IsValid = 1;
+	for (int32 Column = 0; Column < 3; Column++)
+	{
+		FInt128 Mid = Mul(M.M[3][Column].Value, FixedPoint::Constants::Raw64::One * 2);
+		FInt128 Radius = Make(0);
+		for (int32 Row = 0; Row < 3; Row++)
+		{
+			Mid = Add(Mid, Mul(Center2[Row], M.M[Row][Column].Value));
+			Radius = Add(Radius, Mul(Extent2[Row], FFixedPointMath::Abs(M.M[Row][Column]).Value));
+		}
+		// one extra bit of shift halves the doubled values
+		Result.Min.Component(Column).Value = ShiftRightFloor(Sub(Mid, Radius), FixedPoint::Constants::BinaryPoint64 + 1);
+		Result.Max.Component(Column).Value = -ShiftRightFloor(Negate(Add(Mid, Radius)), FixedPoint::Constants::BinaryPoint64 + 1);
+	}
+	return Result;
+}
+
+FORCEINLINE FFixedBox FFixedBox::TransformBy(const FFixedMatrix& M) const
+{
+	return TransformBy(FFixedMatrix34(M));
+}
+
+FORCEINLINE FFixedBox FFixedBox::TransformBy(const FFixedTransform64& M) const
+{
+	return TransformBy(FFixedMatrix34(M));
+}
+
+FORCEINLINE FFixedBox FFixedBox::InverseTransformBy(const FFixedTransform64& M) const
+{
+	return TransformBy(FFixedMatrix34(M).Inverse());
+}
+
+FORCEINLINE FFixedSphere FFixedSphere::TransformBy(const FFixedMatrix& M) const
+{
+	FFixedSphere Result;
+
+	Result.Center = FFixedVector64(M.TransformPosition(this->Center));
+
+	// the squared axis lengths are exact at 40 fraction bits, the scale and radius round up so the result still bounds the sphere
+	using namespace FixedPoint::Int128;
+	FInt128 MaxAxisSquared = Make(0);
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		const FInt128 AxisSquared = Add(Add(Mul(M.M[Row][0].Value, M.M[Row][0].Value), Mul(M.M[Row][1].Value, M.M[Row][1].Value)), Mul(M.M[Row][2].Value, M.M[Row][2].Value));
+		if (Compare(AxisSquared, MaxAxisSquared) > 0)
+		{
+			MaxAxisSquared = AxisSquared;
+		}
+	}
+	Result.W = FFixed64::MakeFromRawInt(-ShiftRightFloor(Negate(Mul(SqrtCeil(MaxAxisSquared), W.Value)), FixedPoint::Constants::BinaryPoint64));
+
+	return Result;
+}
+
+FORCEINLINE FFixedSphere FFixedSphere::TransformBy(const FFixedTransform64& M) const
+{
+	FFixedSphere Result;
+
+	Result.Center = M.TransformPosition(this->Center);
+
+	// round the scaled radius up as the matrix overload does, so the result still bounds the sphere
+	using namespace FixedPoint::Int128;
+	Result.W = FFixed64::MakeFromRawInt(-ShiftRightFloor(Negate(Mul(M.GetMaximumAxisScale().Value, W.Value)), FixedPoint::Constants::BinaryPoint64));
+
+	return Result;
+}
@@ -0,0 +1,147 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointQuat.h"
+#include "FixedPointUnitVector.h"
+#include "FixedPointUnitQuat.generated.h"
+
+/**
+* FFixedUnitQuat
+* Unit quaternion stored as four Q1.30 int32 components, 16 bytes instead of 32 for FFixedQuat64, with 30 fraction bits instead of 20.
+* Products are native 32x32 to 64 bit multiplies summed at 64 bits and rounded once, no TBigInt.
+* Meant for storing and composing rotations, convert to FFixedQuat64 for the rest of the quaternion API.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedUnitQuat
+{
+public:
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere)
+	int32 X;
+
+	UPROPERTY(EditAnywhere)
+	int32 Y;
+
+	UPROPERTY(EditAnywhere)
+	int32 Z;
+
+	UPROPERTY(EditAnywhere)
+	int32 W;
+
+	static const FFixedUnitQuat Identity;
+
+	/**
+	* Default constructor, no initialization
+	*/
+	FORCEINLINE FFixedUnitQuat() {}
+
+	/**
+	* Constructor from raw Q1.30 components
+	*/
+	FORCEINLINE FFixedUnitQuat(int32 InX, int32 InY, int32 InZ, int32 InW) : X(InX), Y(InY), Z(InZ), W(InW) {}
+
+	/**
+	* Constructor from a FFixedQuat64, exact since every 20 bit fraction fits in 30 bits.
+	* Call Renormalize afterwards to use the extra precision to bring the rotation closer to unit length.
+	*/
+	explicit FORCEINLINE FFixedUnitQuat(const FFixedQuat64& Q)
+		: X(FixedPoint::Unit::FromRaw64(Q.X.Value))
+		, Y(FixedPoint::Unit::FromRaw64(Q.Y.Value))
+		, Z(FixedPoint::Unit::FromRaw64(Q.Z.Value))
+		, W(FixedPoint::Unit::FromRaw64(Q.W.Value))
+	{
+	}
+
+	/** @return this rotation as a FFixedQuat64, each component rounded to nearest */
+	FORCEINLINE FFixedQuat64 ToQuat() const
+	{
+		return FFixedQuat64(
+			FFixed64::MakeFromRawInt(FixedPoint::Unit::ToRaw64(X)),
+			FFixed64::MakeFromRawInt(FixedPoint::Unit::ToRaw64(Y)),
+			FFixed64::MakeFromRawInt(FixedPoint::Unit::ToRaw64(Z)),
+			FFixed64::MakeFromRawInt(FixedPoint::Unit::ToRaw64(W)));
+	}
+
+	/**
+	 * Gets the result of multiplying this by another quaternion (this * Q), same order as FFixedQuat64::operator*.
+	 */
+	FORCEINLINE FFixedUnitQuat operator*(const FFixedUnitQuat& Q) const
+	{
+		return FFixedUnitQuat(
+			FixedPoint::Unit::RoundProducts((int64)W * Q.X + (int64)X * Q.W + (int64)Y * Q.Z - (int64)Z * Q.Y),
+			FixedPoint::Unit::RoundProducts((int64)W * Q.Y - (int64)X * Q.Z + (int64)Y * Q.W + (int64)Z * Q.X),
+			FixedPoint::Unit::RoundProducts((int64)W * Q.Z + (int64)X * Q.Y - (int64)Y * Q.X + (int64)Z * Q.W),
+			FixedPoint::Unit::RoundProducts((int64)W * Q.W - (int64)X * Q.X - (int64)Y * Q.Y - (int64)Z * Q.Z));
+	}
+
+	FORCEINLINE FFixedUnitQuat& operator*=(const FFixedUnitQuat& Q)
+	{
+		*this = *this * Q;
+		return *this;
+	}
+
+	FORCEINLINE bool operator==(const FFixedUnitQuat& Q) const
+	{
+		return X == Q.X && Y == Q.Y && Z == Q.Z && W == Q.W;
+	}
+
+	FORCEINLINE bool operator!=(const FFixedUnitQuat& Q) const
+	{
+		return !(*this == Q);
+	}
+
+	/** @return dot product, as a FFixed64 */
+	FORCEINLINE FFixed64 operator|(const FFixedUnitQuat& Q) const
+	{
+		return FFixed64::MakeFromRawInt(FixedPoint::Unit::ToRaw64(FixedPoint::Unit::RoundProducts((int64)X * Q.X + (int64)Y * Q.Y + (int64)Z * Q.Z + (int64)W * Q.W)));
+	}
+
+	/** @return inverse of this quaternion, which is exact for a unit quaternion */
+	FORCEINLINE FFixedUnitQuat Inverse() const
+	{
+		return FFixedUnitQuat(-X, -Y, -Z, W);
+	}
+
+	/**
+	 * Rotate a unit vector by this quaternion, V' = V + 2 * (W * H + (Q x H)) with H = Q x V.
+	 * The factor of two is applied last so no intermediate leaves the Q1.30 range.
+	 */
+	FORCEINLINE FFixedUnitVector RotateVector(const FFixedUnitVector& V) const
+	{
+		const FFixedUnitVector Q(X, Y, Z);
+		const FFixedUnitVector H = Q ^ V;
+		const FFixedUnitVector QH = Q ^ H;
+		return FFixedUnitVector(
+			(int32)(V.X + 2 * ((int64)FixedPoint::Unit::Mul(W, H.X) + QH.X)),
+			(int32)(V.Y + 2 * ((int64)FixedPoint::Unit::Mul(W, H.Y) + QH.Y)),
+			(int32)(V.Z + 2 * ((int64)FixedPoint::Unit::Mul(W, H.Z) + QH.Z)));
+	}
+
+	/**
+	 * Rotate a unit vector by the inverse of this quaternion.
+	 */
+	FORCEINLINE FFixedUnitVector UnrotateVector(const FFixedUnitVector& V) const
+	{
+		return Inverse().RotateVector(V);
+	}
+
+	/**
+	 * Brings a quaternion that has drifted slightly from unit length back to it with one Newton step, no division or square root.
+	 * Only valid for quaternions already close to unit length, such as after a chain of multiplies or a conversion.
+	 */
+	FORCEINLINE void Renormalize()
+	{
+		const int32 SizeSquared = FixedPoint::Unit::RoundProducts((int64)X * X + (int64)Y * Y + (int64)Z * Z + (int64)W * W);
+		// 1 / sqrt(S) is close to (3 - S) / 2 near S = 1
+		const int32 Scale = (int32)((3 * (int64)FixedPoint::Constants::RawUnit::One - SizeSquared) >> 1);
+		X = FixedPoint::Unit::Mul(X, Scale);
+		Y = FixedPoint::Unit::Mul(Y, Scale);
+		Z = FixedPoint::Unit::Mul(Z, Scale);
+		W = FixedPoint::Unit::Mul(W, Scale);
+	}
+};
@@ -0,0 +1,140 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FixedPointFwd.h"
+#include "FixedPointNumbers.h"
+#include "FixedPointVector.h"
+#include "FixedPointUnitVector.generated.h"
+
+namespace FixedPoint
+{
+	namespace Unit
+	{
+		/** FFixed64 raw value to Q1.30, exact for values in [-2, 2), clamped outside it */
+		FORCEINLINE int32 FromRaw64(int64 Raw)
+		{
+			const int64 Limit = (int64)1 << (FixedPoint::Constants::BinaryPoint64 + 1);
+			return (int32)(FMath::Clamp(Raw, -Limit, Limit - 1) << FixedPoint::Constants::BinaryPointUnitDifference);
+		}
+
+		/** Q1.30 to FFixed64 raw value, rounded to nearest */
+		FORCEINLINE int64 ToRaw64(int32 Unit)
+		{
+			return ((int64)Unit + ((int64)1 << (FixedPoint::Constants::BinaryPointUnitDifference - 1))) >> FixedPoint::Constants::BinaryPointUnitDifference;
+		}
+
+		/** Rounds a sum of 32x32 products back down to Q1.30, the sum may hold up to four products */
+		FORCEINLINE int32 RoundProducts(int64 Sum)
+		{
+			return (int32)((Sum + ((int64)1 << (FixedPoint::Constants::BinaryPointUnit - 1))) >> FixedPoint::Constants::BinaryPointUnit);
+		}
+
+		FORCEINLINE int32 Mul(int32 A, int32 B)
+		{
+			return RoundProducts((int64)A * B);
+		}
+	}
+}
+
+/**
+* FFixedUnitVector
+* Unit length direction stored as three Q1.30 int32 components, 12 bytes instead of 24 for FFixedVector64,
+* with 30 fraction bits instead of 20. Components must stay within [-2, 2), which any normal or direction does.
+* Products are native 32x32 to 64 bit multiplies rounded once, no TBigInt.
+*/
+USTRUCT(BlueprintType)
+struct FIXEDPOINT_API FFixedUnitVector
+{
+public:
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere)
+	int32 X;
+
+	UPROPERTY(EditAnywhere)
+	int32 Y;
+
+	UPROPERTY(EditAnywhere)
+	int32 Z;
+
+	/**
+	* Default constructor, no initialization
+	*/
+	FORCEINLINE FFixedUnitVector() {}
+
+	/**
+	* Constructor from raw Q1.30 components
+	*/
+	FORCEINLINE FFixedUnitVector(int32 InX, int32 InY, int32 InZ) : X(InX), Y(InY), Z(InZ) {}
+
+	/**
+	* Constructor from a FFixedVector64, exact since every 20 bit fraction fits in 30 bits
+	*/
+	explicit FORCEINLINE FFixedUnitVector(const FFixedVector64& V)
+		: X(FixedPoint::Unit::FromRaw64(V.X.Value))
+		, Y(FixedPoint::Unit::FromRaw64(V.Y.Value))
+		, Z(FixedPoint::Unit::FromRaw64(V.Z.Value))
+	{
+	}
+
+	/** @return this direction as a FFixedVector64, each component rounded to nearest */
+	FORCEINLINE FFixedVector64 ToVector() const
+	{
+		return FFixedVector64(
+			FFixed64::MakeFromRawInt(FixedPoint::Unit::ToRaw64(X)),
+			FFixed64::MakeFromRawInt(FixedPoint::Unit::ToRaw64(Y)),
+			FFixed64::MakeFromRawInt(FixedPoint::Unit::ToRaw64(Z)));
+	}
+
+	FORCEINLINE bool operator==(const FFixedUnitVector& Other) const
+	{
+		return X == Other.X && Y == Other.Y && Z == Other.Z;
+	}
+
+	FORCEINLINE bool operator!=(const FFixedUnitVector& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	FORCEINLINE FFixedUnitVector operator-() const
+	{
+		return FFixedUnitVector(-X, -Y, -Z);
+	}
+
+	/** @return dot product, as a FFixed64 */
+	FORCEINLINE FFixed64 operator|(const FFixedUnitVector& Other) const
+	{
+		return FFixed64::MakeFromRawInt(FixedPoint::Unit::ToRaw64(Dot(Other)));
+	}
+
+	/** @return dot product, in Q1.30 */
+	FORCEINLINE int32 Dot(const FFixedUnitVector& Other) const
+	{
+		return FixedPoint::Unit::RoundProducts((int64)X * Other.X + (int64)Y * Other.Y + (int64)Z * Other.Z);
+	}
+
+	/** @return cross product, in Q1.30 */
+	FORCEINLINE FFixedUnitVector operator^(const FFixedUnitVector& Other) const
+	{
+		return FFixedUnitVector(
+			FixedPoint::Unit::RoundProducts((int64)Y * Other.Z - (int64)Z * Other.Y),
+			FixedPoint::Unit::RoundProducts((int64)Z * Other.X - (int64)X * Other.Z),
+			FixedPoint::Unit::RoundProducts((int64)X * Other.Y - (int64)Y * Other.X));
+	}
+
+	/**
+	 * Brings a vector that has drifted slightly from unit length back to it with one Newton step, no division or square root.
+	 * Only valid for vectors already close to unit length, use FFixedVector64::GetSafeNormal for anything else.
+	 */
+	FORCEINLINE void Renormalize()
+	{
+		const int32 SizeSquared = FixedPoint::Unit::RoundProducts((int64)X * X + (int64)Y * Y + (int64)Z * Z);
+		// 1 / sqrt(S) is close to (3 - S) / 2 near S = 1
+		const int32 Scale = (int32)((3 * (int64)FixedPoint::Constants::RawUnit::One - SizeSquared) >> 1);
+		X = FixedPoint::Unit::Mul(X, Scale);
+		Y = FixedPoint::Unit::Mul(Y, Scale);
+		Z = FixedPoint::Unit::Mul(Z, Scale);
+	}
+};